@@ -0,0 +1,129 @@
+// Schedules random expiries on every level of the timing wheel, beyond its
+// span and in the past, advances it the way the timer server does, and
+// checks that every timer is handed out exactly once, at the first advance
+// that reaches its tick. Exits with 1 on the first one that is not.
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../wheel.h"
+
+// Out of 64 advances, how many oversleep past wheel_next()
+#define LATE_ADVANCES 8
+#define START 0x123456789ull
+
+uint32_t rng_state = 0xCA5CADE;
+
+uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+uint64_t rng64(void)
+{
+    const uint64_t high = rng();
+    return high << 32 | rng();
+}
+
+// A random distance that lands on the given level, WHEEL_LEVELS means
+// beyond the span of the whole wheel
+uint64_t level_delta(int level)
+{
+    const uint64_t low = level == 0 ? 1 : (uint64_t) 1 << (WHEEL_SLOT_BITS * level);
+    const uint64_t high = (uint64_t) 1 << (WHEEL_SLOT_BITS * (level + 1));
+    return low + rng64() % (high - low);
+}
+
+typedef struct {
+    size_t timers;
+    size_t advances;
+    size_t per_level[WHEEL_LEVELS + 2];  // then beyond the span and already due
+} Stats;
+
+// Returns 0 on the first timer that comes up wrong
+int check_round(size_t timers, Stats *stats)
+{
+    Wheel wheel;
+    wheel_init(&wheel, START);
+    wheel_reserve(&wheel, timers);
+
+    uint64_t *tick = malloc(timers * sizeof(*tick));
+    unsigned char *fired = calloc(timers, 1);
+    if (tick == NULL || fired == NULL) {
+        fprintf(stderr, "Could not allocate the timers\n");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < timers; ++i) {
+        // Every level, beyond the span, and a few already due
+        const int level = rng() % (WHEEL_LEVELS + 2);
+        stats->per_level[level] += 1;
+        tick[i] = level == WHEEL_LEVELS + 1 ? START - rng() % 1000 : START + level_delta(level);
+        wheel_schedule(&wheel, i, tick[i]);
+    }
+
+    size_t advances = 0, remaining = timers;
+    uint64_t prev = START;
+    int ok = 1;
+    while (ok && remaining > 0) {
+        const uint64_t next = wheel_next(&wheel);
+        if (next == WHEEL_NEVER) {
+            fprintf(stderr, "FAIL: %zu of %zu timers never come up\n", remaining, timers);
+            ok = 0;
+            break;
+        }
+        // Either right at the next event, or late by up to a few levels
+        const uint64_t now = rng() % 64 < LATE_ADVANCES ? next + level_delta(rng() % 3) : next;
+        wheel_advance(&wheel, now);
+        advances += 1;
+
+        uint32_t i;
+        while ((i = wheel_pop(&wheel)) != WHEEL_NONE) {
+            if (fired[i]) {
+                fprintf(stderr, "FAIL: timer %u of %zu for tick %llu came up twice\n",
+                        i, timers, (unsigned long long) tick[i]);
+                ok = 0;
+                break;
+            }
+            // The first advance that reaches the tick hands it out, and
+            // one right at wheel_next() must be exactly at it
+            const uint64_t due = tick[i] < START ? START : tick[i];
+            if (due > now || (due <= prev && prev != START) || (now == next && due != now && due > START)) {
+                fprintf(stderr, "FAIL: timer %u of %zu for tick %llu came up when advancing from %llu to %llu\n",
+                        i, timers, (unsigned long long) tick[i], (unsigned long long) prev, (unsigned long long) now);
+                ok = 0;
+                break;
+            }
+            fired[i] = 1;
+            remaining -= 1;
+        }
+        prev = now;
+    }
+
+    stats->timers += timers;
+    stats->advances += advances;
+
+    wheel_free(&wheel);
+    free(tick);
+    free(fired);
+    return ok;
+}
+
+int main(void)
+{
+    // Full slots everywhere, then sparse ones, where finding the next
+    // occupied slot has to go around the levels
+    static const size_t rounds[] = {200 * 1000, 1000, 50, 1};
+    Stats stats = {0};
+    for (size_t r = 0; r < sizeof(rounds) / sizeof(rounds[0]); ++r) {
+        for (int repeat = 0; repeat < (rounds[r] < 1000 ? 100 : 1); ++repeat) {
+            if (!check_round(rounds[r], &stats)) return 1;
+        }
+    }
+    printf("OK: %zu timers came up once each at their tick over %zu advances (", stats.timers, stats.advances);
+    for (int level = 0; level < WHEEL_LEVELS; ++level) printf("%zu on level %d, ", stats.per_level[level], level);
+    printf("%zu beyond the span, %zu already due)\n", stats.per_level[WHEEL_LEVELS], stats.per_level[WHEEL_LEVELS + 1]);
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Compares the CPU compositor of `sowon -c` with SDL's software renderer,
+// both drawing one HH:MM:SS clock into an offscreen surface at 1080p and
+// 4K. main.c is a single translation unit, so it gets included here with
+// its main() renamed.
+#define main sowon_main
+#include "../main.c"
+#undef main
+
+#define BENCH_FRAMES 120
+
+typedef enum {
+    FRAME_FULL = 0,     // everything is redrawn (resize, pause, color)
+    FRAME_WIGGLE,       // every cell moves to its next wiggle frame
+    FRAME_SECOND,       // the seconds digit changes, nothing wiggles
+    COUNT_FRAMES,
+} FrameKind;
+
+const char *frame_kind_name(FrameKind kind)
+{
+    switch (kind) {
+    case FRAME_FULL: return "full frame";
+    case FRAME_WIGGLE: return "wiggle step";
+    case FRAME_SECOND: return "next second";
+    case COUNT_FRAMES: break;
+    }
+    return "unknown";
+}
+
+typedef enum {
+    PATH_SDL_SOFTWARE = 0,  // SDL software renderer, everything every frame
+    PATH_CPU,               // SoftCanvas blended on the CPU
+    COUNT_PATHS,
+} Path;
+
+const char *path_name(Path path)
+{
+    switch (path) {
+    case PATH_SDL_SOFTWARE: return "SDL software renderer";
+    case PATH_CPU: return "CPU compositor";
+    case COUNT_PATHS: break;
+    }
+    return "unknown";
+}
+
+size_t frame_cells(LayoutCache *layout, Cell cells[CELLS_CAP], FrameKind kind, size_t frame, int w, int h)
+{
+    // 12:34:56, so the first seconds are not all zeros
+    size_t seconds = 45296;
+    size_t wiggle_index = 0;
+    switch (kind) {
+    case FRAME_FULL:
+    case FRAME_WIGGLE: wiggle_index = frame; break;
+    case FRAME_SECOND: seconds += frame;     break;
+    case COUNT_FRAMES: break;
+    }
+    return layout_cached(layout, cells, &seconds, 1, NULL, wiggle_index, w, h, 1.0f);
+}
+
+// Returns the mean milliseconds per frame
+double bench_path(Path path, FrameKind kind, int w, int h)
+{
+    SDL_Surface *surface = secp(SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888));
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *digits = NULL;
+    if (path != PATH_CPU) {
+        renderer = secp(SDL_CreateSoftwareRenderer(surface));
+        digits = load_digits_png_file_as_texture(renderer);
+        secc(SDL_SetTextureColorMod(digits, MAIN_COLOR_R, MAIN_COLOR_G, MAIN_COLOR_B));
+    }
+    const Glyphs sheet = {digits, SPRITE_CHAR_WIDTH, SPRITE_CHAR_HEIGHT};
+    const uint32_t color = (MAIN_COLOR_B << 16) | (MAIN_COLOR_G << 8) | MAIN_COLOR_R;
+    static LayoutCache layout;
+    layout.valid = 0;
+    Atlas atlas = {0};
+    SoftCanvas soft_canvas = {0};
+    framebuffer_resize(&soft_canvas.fb, w, h);
+
+    Uint64 start = 0;
+    // The first frame builds the atlas and the canvas, it is not measured
+    for (size_t frame = 0; frame <= BENCH_FRAMES; ++frame) {
+        if (frame == 1) start = SDL_GetPerformanceCounter();
+
+        Cell cells[CELLS_CAP];
+        const size_t cells_count = frame_cells(&layout, cells, kind, frame, w, h);
+        if (kind == FRAME_FULL) soft_canvas.valid = 0;
+
+        switch (path) {
+        case PATH_SDL_SOFTWARE: {
+            // One SDL_RenderCopy() per cell: SDL_RenderGeometry() is several
+            // times slower on the software renderer
+            const Glyphs *glyphs = atlas_glyphs(&atlas, renderer, &sheet, cells[0].dst_rect.w, cells[0].dst_rect.h);
+            secc(SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR_R, BACKGROUND_COLOR_G, BACKGROUND_COLOR_B, 255));
+            secc(SDL_RenderClear(renderer));
+            for (size_t i = 0; i < cells_count; ++i) render_digit_at(renderer, glyphs, &cells[i]);
+            SDL_RenderPresent(renderer);
+        } break;
+
+        case PATH_CPU: {
+            atlas_resample(&atlas, cells[0].dst_rect.w, cells[0].dst_rect.h);
+            soft_canvas_update(&soft_canvas, &atlas, cells, cells_count, color, NULL);
+            soft_canvas_blit(&soft_canvas, surface);
+        } break;
+
+        case COUNT_PATHS: break;
+        }
+    }
+    const double ms = (double) (SDL_GetPerformanceCounter() - start) * 1000.0
+        / (double) SDL_GetPerformanceFrequency() / BENCH_FRAMES;
+
+    free(soft_canvas.fb.pixels);
+    free(atlas.pixels);
+    if (atlas.glyphs.texture) SDL_DestroyTexture(atlas.glyphs.texture);
+    if (digits) SDL_DestroyTexture(digits);
+    if (renderer) SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    return ms;
+}
+
+int main(void)
+{
+    // Offscreen surfaces only, no display needed
+    secc(SDL_Init(0));
+    decode_embedded_images();
+
+    static const struct {
+        const char *name;
+        int w, h;
+    } resolutions[] = {
+        {"1080p", 1920, 1080},
+        {"4K", 3840, 2160},
+    };
+
+    printf("ms per frame, mean of %d frames\n", BENCH_FRAMES);
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); ++r) {
+        printf("%-6s %-32s", resolutions[r].name, "");
+        for (FrameKind kind = 0; kind < COUNT_FRAMES; ++kind) printf(" %12s", frame_kind_name(kind));
+        printf("\n");
+        for (Path path = 0; path < COUNT_PATHS; ++path) {
+            printf("       %-32s", path_name(path));
+            for (FrameKind kind = 0; kind < COUNT_FRAMES; ++kind) {
+                printf(" %12.3f", bench_path(path, kind, resolutions[r].w, resolutions[r].h));
+                fflush(stdout);
+            }
+            printf("\n");
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
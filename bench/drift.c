@@ -0,0 +1,114 @@
+// Long run simulation of the timers: 120 hours of wakeups as the main loop
+// would schedule them, with oversleeping, pauses and countdowns, checked
+// tick by tick against an independent count of the running time. Exits
+// with 1 on the first mismatch. main.c is a single translation unit, so it
+// gets included here with its main() renamed.
+#define main sowon_main
+#include "../main.c"
+#undef main
+
+#define SIMULATED_HOURS 120
+// How late (in ms) a simulated wakeup may be
+#define OVERSLEEP_MAX 3
+
+uint32_t rng_state = 0x50A0;
+
+uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+int check(int ok, const char *what, Uint64 hour_ticks, Uint64 now)
+{
+    if (!ok) fprintf(stderr, "FAIL: %s at %.6f h\n", what, (double) now / (double) hour_ticks);
+    return ok;
+}
+
+// Returns 0 on a mismatch
+int simulate(Mode mode, float initial_time, Uint64 freq)
+{
+    const Uint64 hour = 60 * 60 * freq;
+    const Uint64 end = SIMULATED_HOURS * hour;
+    Uint64 now = 0;
+    Timer timer;
+    timer_restart(&timer, mode, initial_time, 0, now);
+    const Uint64 duration = timer.duration;
+
+    Uint64 running = 0;          // the reference, summed from the steps
+    float integrated = 0.0f;     // what the old float time base would show
+    size_t prev_seconds = timer_seconds(&timer, now);
+    size_t wiggle_index = 0;
+    float wiggle_cooldown = WIGGLE_DURATION;
+    Uint64 countdowns = 0;
+    Uint64 toggle_at = hour + rng() % hour;
+    Uint64 steps = 0;
+    while (now < end) {
+        const int timeout = next_change_timeout(&timer, now, wiggle_cooldown);
+        const Uint64 dt = ((Uint64) timeout + rng() % (OVERSLEEP_MAX + 1)) * freq / 1000 + rng() % 1000;
+        now += dt;
+        if (!timer.paused) {
+            running += dt;
+            integrated += (float) dt / (float) freq;
+        }
+        update_wiggle(&wiggle_index, &wiggle_cooldown, (float) dt / (float) freq);
+        steps += 1;
+
+        if (now >= toggle_at) {
+            timer_toggle_pause(&timer, now);
+            // Pauses of up to 10 minutes, hours of running in between
+            toggle_at = now + (timer.paused ? rng() % (10 * 60 * freq) : hour + rng() % hour);
+        }
+
+        const int over = timer_update(&timer, now);
+        const size_t seconds = timer_seconds(&timer, now);
+        if (mode == MODE_COUNTDOWN) {
+            const Uint64 left = running < duration ? duration - running : 0;
+            if (!check(seconds == left / freq, "countdown differs from the reference", hour, now)) return 0;
+            if (!check(over == (!timer.paused && left == 0), "countdown over at the wrong time", hour, now)) return 0;
+            // Keep counting down from the top
+            if (left == 0) {
+                timer_restart(&timer, mode, initial_time, timer.paused, now);
+                running = 0;
+                countdowns += 1;
+                prev_seconds = timer_seconds(&timer, now);
+                continue;
+            }
+            if (!check(prev_seconds - seconds <= 1, "countdown skipped a second", hour, now)) return 0;
+        } else {
+            if (!check(seconds == running / freq, "time differs from the reference", hour, now)) return 0;
+            if (!check(seconds - prev_seconds <= 1, "time skipped a second", hour, now)) return 0;
+        }
+        prev_seconds = seconds;
+    }
+
+    if (mode == MODE_COUNTDOWN) {
+        printf("countdown: %llu wakeups over %d h, %llu countdowns ended on time\n",
+               (unsigned long long) steps, SIMULATED_HOURS, (unsigned long long) countdowns);
+    } else {
+        printf("ascending: %llu wakeups over %d h, shows %.3f s of %.3f s running, a float time base would show %.3f s\n",
+               (unsigned long long) steps, SIMULATED_HOURS,
+               (double) timer_displayed(&timer, now) / (double) freq,
+               (double) running / (double) freq, integrated);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+
+    // `-p -e 0` must wait for the unpause
+    Timer timer;
+    timer_restart(&timer, MODE_COUNTDOWN, 0.0f, 1, 0);
+    if (!check(!timer_update(&timer, freq), "paused countdown is over", 1, 0)) return 1;
+    timer_toggle_pause(&timer, 2 * freq);
+    if (!check(timer_update(&timer, 2 * freq), "unpaused countdown is not over", 1, 0)) return 1;
+
+    if (!simulate(MODE_ASCENDING, 0.0f, freq)) return 1;
+    if (!simulate(MODE_COUNTDOWN, 25.0f * 60.0f, freq)) return 1;
+    printf("OK: no drift\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Compares clock_glyphs() with the divisions and the snprintf() of the
+// title it replaced, for batches of timers. Every value up to 100 hours
+// and a spread of longer ones first get checked against the divisions.
+// main.c is a single translation unit, so it gets included here with its
+// main() renamed.
+#define main sowon_main
+#include "../main.c"
+#undef main
+
+#define BENCH_TIMERS 1024
+#define BENCH_ROUNDS 2000
+
+// What the render loop did per timer: / and % for every field and digit
+size_t scalar_glyphs(size_t t, Uint8 glyphs[CHARS_CAP])
+{
+    size_t n = 0;
+    size_t hours = t / 60 / 60;
+    const size_t minutes = t / 60 % 60;
+    const size_t seconds = t % 60;
+    if (hours < 100) {
+        glyphs[n++] = (Uint8) (hours / 10);
+        glyphs[n++] = (Uint8) (hours % 10);
+    } else {
+        Uint8 digits[CHARS_CAP];
+        size_t digits_count = 0;
+        for (; hours > 0; hours /= 10) digits[digits_count++] = (Uint8) (hours % 10);
+        while (digits_count > 0) glyphs[n++] = digits[--digits_count];
+    }
+    glyphs[n++] = COLON_INDEX;
+    glyphs[n++] = (Uint8) (minutes / 10);
+    glyphs[n++] = (Uint8) (minutes % 10);
+    glyphs[n++] = COLON_INDEX;
+    glyphs[n++] = (Uint8) (seconds / 10);
+    glyphs[n++] = (Uint8) (seconds % 10);
+    return n;
+}
+
+int check_seconds(size_t t)
+{
+    Uint8 expected[CHARS_CAP], glyphs[1][CHARS_CAP];
+    size_t length;
+    const size_t expected_length = scalar_glyphs(t, expected);
+    clock_glyphs(&t, 1, glyphs, &length);
+    if (length != expected_length || memcmp(glyphs[0], expected, length) != 0) {
+        fprintf(stderr, "ERROR: clock_glyphs() differs from the divisions for %zu seconds\n", t);
+        return 0;
+    }
+    return 1;
+}
+
+double ns_per_timer(Uint64 start)
+{
+    return (double) (SDL_GetPerformanceCounter() - start) * 1e9
+        / (double) SDL_GetPerformanceFrequency() / ((double) BENCH_TIMERS * BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    size_t checked = 0;
+    for (size_t t = 0; t <= CLOCK_RECIPROCAL_MAX + 3600; ++t, ++checked) {
+        if (!check_seconds(t)) return 1;
+    }
+    for (size_t t = CLOCK_RECIPROCAL_MAX; t < SIZE_MAX / 3; t = t * 3 + 1, ++checked) {
+        if (!check_seconds(t)) return 1;
+    }
+    if (!check_seconds(SIZE_MAX)) return 1;
+    printf("OK: %zu values format the same with clock_glyphs() and the divisions\n", checked + 1);
+
+    static size_t seconds[BENCH_TIMERS];
+    static Uint8 glyphs[BENCH_TIMERS][CHARS_CAP];
+    static size_t lengths[BENCH_TIMERS];
+    // Countdowns and clocks, all under 100 hours like nearly every timer
+    uint32_t state = 0x600D;
+    for (size_t i = 0; i < BENCH_TIMERS; ++i) {
+        state = state * 1664525 + 1013904223;
+        seconds[i] = state % (24 * 60 * 60);
+    }
+
+    volatile size_t sink = 0;
+    printf("ns per timer, %d timers, mean of %d rounds\n", BENCH_TIMERS, BENCH_ROUNDS);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (size_t round = 0; round < BENCH_ROUNDS; ++round) {
+        for (size_t i = 0; i < BENCH_TIMERS; ++i) lengths[i] = scalar_glyphs(seconds[i] + round, glyphs[i]);
+        sink += glyphs[round % BENCH_TIMERS][lengths[0] - 1];
+    }
+    printf("    %-24s %8.2f\n", "divisions", ns_per_timer(start));
+
+    char title[TITLE_CAP];
+    start = SDL_GetPerformanceCounter();
+    for (size_t round = 0; round < BENCH_ROUNDS; ++round) {
+        for (size_t i = 0; i < BENCH_TIMERS; ++i) {
+            const size_t t = seconds[i] + round;
+            snprintf(title, sizeof(title), "%02zu:%02zu:%02zu - sowon", t / 60 / 60, t / 60 % 60, t % 60);
+            sink += (size_t) title[7];
+        }
+    }
+    printf("    %-24s %8.2f\n", "snprintf() title", ns_per_timer(start));
+
+    static size_t shifted[BENCH_TIMERS];
+    start = SDL_GetPerformanceCounter();
+    for (size_t round = 0; round < BENCH_ROUNDS; ++round) {
+        for (size_t i = 0; i < BENCH_TIMERS; ++i) shifted[i] = seconds[i] + round;
+        clock_glyphs(shifted, BENCH_TIMERS, glyphs, lengths);
+        sink += glyphs[round % BENCH_TIMERS][lengths[0] - 1];
+    }
+    printf("    %-24s %8.2f\n", "clock_glyphs()", ns_per_timer(start));
+
+    (void) sink;
+    return 0;
+}
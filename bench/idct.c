@@ -0,0 +1,84 @@
+// Decodes JPEGs with stb_image built with its AVX2 kernels, with SSE2 only
+// (-DSTBI_NO_AVX2) and without SIMD (-DSTBI_NO_SIMD), and compares the
+// pixels of every build with the first one. Exits with 1 on the first
+// difference. Without AVX2 on the CPU the first build runs SSE2 as well,
+// the output says which kernels each build ran.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stbi_variant.h"
+
+unsigned char *read_file(const char *filepath, int *size)
+{
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open file `%s`\n", filepath);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    const long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (n < 0) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    unsigned char *bytes = malloc(n > 0 ? n : 1);
+    if (bytes == NULL || fread(bytes, 1, n, f) != (size_t) n) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    fclose(f);
+    *size = (int) n;
+    return bytes;
+}
+
+int main(int argc, char **argv)
+{
+    const StbiVariant *variants[] = {&stbi_simd, &stbi_no_avx2, &stbi_no_simd};
+    const size_t variants_count = sizeof(variants) / sizeof(variants[0]);
+    if (argc < 2) {
+        fprintf(stderr, "Usage: idct <file.jpg>...\n");
+        return 1;
+    }
+    for (int arg = 1; arg < argc; ++arg) {
+        int size;
+        unsigned char *bytes = read_file(argv[arg], &size);
+        for (int desired = 1; desired <= 4; ++desired) {
+            int w0, h0, n0;
+            unsigned char *base = variants[0]->load(bytes, size, &w0, &h0, &n0, desired);
+            if (base == NULL) {
+                fprintf(stderr, "FAIL: %s could not decode `%s`: %s\n",
+                        variants[0]->name, argv[arg], variants[0]->failure_reason());
+                return 1;
+            }
+            for (size_t v = 1; v < variants_count; ++v) {
+                int w, h, n;
+                unsigned char *pixels = variants[v]->load(bytes, size, &w, &h, &n, desired);
+                if (pixels == NULL || w != w0 || h != h0) {
+                    fprintf(stderr, "FAIL: %s decodes `%s` differently from %s\n",
+                            variants[v]->name, argv[arg], variants[0]->name);
+                    return 1;
+                }
+                const size_t count = (size_t) w * h * desired;
+                for (size_t i = 0; i < count; ++i) {
+                    if (pixels[i] != base[i]) {
+                        fprintf(stderr, "FAIL: `%s` at %d channels: pixel (%zu, %zu) channel %zu is %u with %s, %u with %s\n",
+                                argv[arg], desired, i / desired % w, i / desired / w, i % desired,
+                                base[i], variants[0]->name, pixels[i], variants[v]->name);
+                        return 1;
+                    }
+                }
+                variants[v]->image_free(pixels);
+            }
+            variants[0]->image_free(base);
+        }
+        free(bytes);
+        printf("%s: the same with", argv[arg]);
+        for (size_t v = 0; v < variants_count; ++v) {
+            printf("%s %s (%s)", v == 0 ? "" : v + 1 == variants_count ? " and" : ",",
+                   variants[v]->name, variants[v]->jpeg_kernels());
+        }
+        printf("\n");
+    }
+    return 0;
+}
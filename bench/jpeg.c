@@ -0,0 +1,84 @@
+// Decodes JPEG files to RGBA with stb_image built with its AVX2 kernels,
+// with SSE2 only and without SIMD, and reports how long each takes.
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stbi_variant.h"
+
+#define DEFAULT_RUNS 20
+
+double now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec * 1e3 + (double) now.tv_nsec * 1e-6;
+}
+
+unsigned char *read_file(const char *filepath, int *size)
+{
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open file `%s`\n", filepath);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    const long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (n < 0) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    unsigned char *bytes = malloc(n > 0 ? n : 1);
+    if (bytes == NULL || fread(bytes, 1, n, f) != (size_t) n) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    fclose(f);
+    *size = (int) n;
+    return bytes;
+}
+
+int main(int argc, char **argv)
+{
+    int first = 1;
+    int runs = DEFAULT_RUNS;
+    if (argc > 2 && strcmp(argv[1], "-r") == 0) {
+        runs = atoi(argv[2]);
+        first = 3;
+    }
+    if (first >= argc || runs <= 0) {
+        fprintf(stderr, "Usage: jpeg [-r <runs>] <file.jpg>...\n");
+        return 1;
+    }
+
+    const StbiVariant *variants[] = {&stbi_no_simd, &stbi_no_avx2, &stbi_simd};
+    for (int arg = first; arg < argc; ++arg) {
+        int size;
+        unsigned char *bytes = read_file(argv[arg], &size);
+        for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v) {
+            double best = 0.0, total = 0.0;
+            int w = 0, h = 0;
+            for (int i = 0; i < runs; ++i) {
+                const double start = now_ms();
+                int n;
+                unsigned char *pixels = variants[v]->load(bytes, size, &w, &h, &n, 4);
+                const double elapsed = now_ms() - start;
+                if (pixels == NULL) {
+                    fprintf(stderr, "Could not load file `%s`: %s\n", argv[arg], variants[v]->failure_reason());
+                    return 1;
+                }
+                variants[v]->image_free(pixels);
+                if (i == 0 || elapsed < best) best = elapsed;
+                total += elapsed;
+            }
+            printf("%s %dx%d, %d runs, %-12s (%-4s): best %.2f ms, mean %.2f ms, %.1f Mpixel/s\n",
+                   argv[arg], w, h, runs, variants[v]->name, variants[v]->jpeg_kernels(),
+                   best, total / runs, (double) w * h / best * 1e-3);
+        }
+        free(bytes);
+    }
+    return 0;
+}
@@ -0,0 +1,274 @@
+// Decodes PNG files with stb_image the way sowon does (RGBA, from memory)
+// and reports how long it takes. `make bench` runs it on digits.png, pass
+// bigger files to see the inflate and unfilter throughput. With -u it also
+// times the unfiltering of generated stored images, one filter type at a
+// time, with and without SIMD. With -f it times a large generated image
+// written with full flushes on 1, 2, 4 and one thread per CPU.
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define STBI_ONLY_PNG
+#define STBI_PNG_THREADS
+#define STB_IMAGE_IMPLEMENTATION
+#include "../stb_image.h"
+#include "pngenc.h"
+#include "stbi_variant.h"
+
+#define DEFAULT_RUNS 20
+// The large image decodes fewer times
+#define FLUSH_RUNS 5
+// Rows between the full flushes of the large image
+#define FLUSH_ROWS 64
+
+double now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec * 1e3 + (double) now.tv_nsec * 1e-6;
+}
+
+const char *shift(int *argc, char ***argv)
+{
+    assert(*argc > 0);
+    const char *result = *argv[0];
+    *argc -= 1;
+    *argv += 1;
+    return result;
+}
+
+void usage(FILE *stream)
+{
+    fprintf(stream, "Usage: png [-r <runs>] [-t <threads>] [-u <size>] [-f <size>] [<file.png>...]\n");
+    fprintf(stream, "    -u    time the unfiltering of generated <size>x<size> images\n");
+    fprintf(stream, "    -f    time a generated <size>x<size> image with full flushes on several threads\n");
+}
+
+uint32_t rng_state = 0xBE7C;
+
+uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Best time of the runs in ms
+double variant_best_ms(const StbiVariant *variant, const Bytes *png, int desired, int runs)
+{
+    double best = 0.0;
+    for (int i = 0; i < runs; ++i) {
+        const double start = now_ms();
+        int w, h, n;
+        unsigned char *pixels = variant->load(png->items, (int) png->count, &w, &h, &n, desired);
+        const double elapsed = now_ms() - start;
+        if (pixels == NULL) {
+            fprintf(stderr, "Could not load generated image: %s\n", variant->failure_reason());
+            exit(1);
+        }
+        variant->image_free(pixels);
+        if (i == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+// The images are stored, not compressed, so inflating them is little more
+// than a copy and the unfiltering is most of the decoding
+void bench_unfilter(int side, int runs)
+{
+    static const struct {
+        const char *name;
+        int color_type;
+        int desired;
+    } formats[] = {
+        {"RGBA", 6, 0},
+        {"RGB", 2, 0},
+        {"RGB->RGBA", 2, 4},
+    };
+    static const char *filter_names[] = {"none", "sub", "up", "avg", "paeth"};
+
+    printf("unfilter %dx%d, stored, best of %d runs: %s -> %s\n",
+           side, side, runs, stbi_no_simd.name, stbi_simd.name);
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+        printf("  %-10s", formats[f].name);
+        for (int filter = 1; filter < 5; ++filter) {
+            const PngHeader header = {side, side, 8, formats[f].color_type, 0};
+            const size_t size = png_filtered_size(&header);
+            const size_t row_size = png_row_size(&header, side) + 1;
+            unsigned char *filtered = malloc(size);
+            assert(filtered != NULL);
+            for (size_t i = 0; i < size; ++i) {
+                filtered[i] = i % row_size == 0 ? (uint32_t) filter : rng() & 0xFF;
+            }
+            Bytes png = {0};
+            png_encode(&png, &header, NULL, 0, filtered, size, 0, 0);
+            free(filtered);
+
+            const double scalar = variant_best_ms(&stbi_no_simd, &png, formats[f].desired, runs);
+            const double simd = variant_best_ms(&stbi_simd, &png, formats[f].desired, runs);
+            printf("  %s %6.2f -> %5.2f ms", filter_names[filter], scalar, simd);
+            fflush(stdout);
+            bytes_free(&png);
+        }
+        printf("\n");
+    }
+}
+
+unsigned char *read_file(const char *filepath, int *size)
+{
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open file `%s`\n", filepath);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    const long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char *bytes = malloc(n > 0 ? n : 1);
+    assert(bytes != NULL);
+    if (n < 0 || fread(bytes, 1, n, f) != (size_t) n) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    fclose(f);
+    *size = (int) n;
+    return bytes;
+}
+
+// A gradient with some noise, filtered with sub the way an encoder would,
+// compressed with a full flush every FLUSH_ROWS rows
+void generate_flushed(Bytes *png, int side)
+{
+    const PngHeader header = {side, side, 8, 6, 0};
+    const size_t row_size = png_row_size(&header, side) + 1;
+    unsigned char *filtered = malloc(row_size * side);
+    assert(filtered != NULL);
+    unsigned char *pixels = malloc(row_size);
+    assert(pixels != NULL);
+    for (int y = 0; y < side; ++y) {
+        unsigned char *row = &filtered[row_size * y];
+        for (int x = 0; x < side; ++x) {
+            unsigned char *p = &pixels[x * 4];
+            p[0] = (x + y) >> 4;
+            p[1] = ((size_t) x * y) >> 12;
+            p[2] = x > 0 && rng() % 8 != 0 ? p[-2] : rng() & 0xFF;
+            p[3] = 255;
+        }
+        row[0] = 1;             // sub
+        for (size_t i = 0; i < row_size - 1; ++i) {
+            row[1 + i] = pixels[i] - (i >= 4 ? pixels[i - 4] : 0);
+        }
+    }
+    png_encode(png, &header, NULL, 0, filtered, row_size * side, 1, row_size * FLUSH_ROWS);
+    free(pixels);
+    free(filtered);
+}
+
+void bench_flushed(int side)
+{
+    Bytes png = {0};
+    generate_flushed(&png, side);
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("full flushes %dx%d RGBA, %.1f MB, a flush every %d rows, best of %d runs:\n",
+           side, side, png.count / 1e6, FLUSH_ROWS, FLUSH_RUNS);
+
+    // One thread per CPU is the default, 0
+    const int threads[] = {1, 2, 4, 0};
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        stbi_set_png_threads(threads[t]);
+        double best = 0.0;
+        for (int i = 0; i < FLUSH_RUNS; ++i) {
+            const double start = now_ms();
+            int w, h, n;
+            stbi_uc *pixels = stbi_load_from_memory(png.items, (int) png.count, &w, &h, &n, 4);
+            const double elapsed = now_ms() - start;
+            if (pixels == NULL) {
+                fprintf(stderr, "Could not load generated image: %s\n", stbi_failure_reason());
+                exit(1);
+            }
+            stbi_image_free(pixels);
+            if (i == 0 || elapsed < best) best = elapsed;
+        }
+        if (threads[t] == 0) {
+            printf("  %ld thread(s), one per CPU: %.2f ms\n", cpus, best);
+        } else {
+            printf("  %d thread(s): %.2f ms\n", threads[t], best);
+        }
+        fflush(stdout);
+    }
+    bytes_free(&png);
+}
+
+int main(int argc, char **argv)
+{
+    shift(&argc, &argv);
+    int runs = DEFAULT_RUNS;
+    int threads = 1;
+    int unfilter_side = 0;
+    int flush_side = 0;
+    while (argc > 0 && argv[0][0] == '-') {
+        const char *flag = shift(&argc, &argv);
+        if (argc == 0) {
+            usage(stderr);
+            fprintf(stderr, "ERROR: no value provided for flag `%s`\n", flag);
+            exit(1);
+        }
+        const char *value = shift(&argc, &argv);
+        if (strcmp(flag, "-r") == 0) {
+            runs = atoi(value);
+        } else if (strcmp(flag, "-t") == 0) {
+            threads = atoi(value);
+        } else if (strcmp(flag, "-u") == 0) {
+            unfilter_side = atoi(value);
+        } else if (strcmp(flag, "-f") == 0) {
+            flush_side = atoi(value);
+        } else {
+            usage(stderr);
+            fprintf(stderr, "ERROR: unknown flag `%s`\n", flag);
+            exit(1);
+        }
+    }
+    if ((argc == 0 && unfilter_side == 0 && flush_side == 0) || runs <= 0 || threads <= 0 || unfilter_side < 0 || flush_side < 0) {
+        usage(stderr);
+        fprintf(stderr, "ERROR: expected a file, -u or -f, runs, threads and sizes above 0\n");
+        exit(1);
+    }
+    stbi_set_png_threads(threads);
+
+    while (argc > 0) {
+        const char *filepath = shift(&argc, &argv);
+        int size;
+        unsigned char *bytes = read_file(filepath, &size);
+
+        double best = 0.0, total = 0.0;
+        int w = 0, h = 0;
+        for (int i = 0; i < runs; ++i) {
+            const double start = now_ms();
+            int n;
+            stbi_uc *pixels = stbi_load_from_memory(bytes, size, &w, &h, &n, 4);
+            const double elapsed = now_ms() - start;
+            if (pixels == NULL) {
+                fprintf(stderr, "Could not load file `%s`: %s\n", filepath, stbi_failure_reason());
+                exit(1);
+            }
+            stbi_image_free(pixels);
+            if (i == 0 || elapsed < best) best = elapsed;
+            total += elapsed;
+        }
+
+        printf("%s %dx%d, %d runs, %d thread(s): best %.2f ms, mean %.2f ms, %.1f Mpixel/s\n",
+               filepath, w, h, runs, threads, best, total / runs,
+               (double) w * h / best * 1e-3);
+        free(bytes);
+    }
+
+    if (unfilter_side > 0) bench_unfilter(unfilter_side, runs);
+    if (flush_side > 0) bench_flushed(flush_side);
+
+    return 0;
+}
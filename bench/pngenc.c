@@ -0,0 +1,339 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pngenc.h"
+
+#define DEFLATE_WINDOW 32768
+#define DEFLATE_MIN_MATCH 3
+#define DEFLATE_MAX_MATCH 258
+#define DEFLATE_STORED_MAX 65535
+#define HASH_BITS 15
+// Bytes of image data per IDAT chunk
+#define IDAT_MAX (1024 * 1024)
+
+static void bytes_reserve(Bytes *bytes, size_t extra)
+{
+    if (bytes->count + extra <= bytes->capacity) return;
+    size_t capacity = bytes->capacity == 0 ? 4096 : bytes->capacity;
+    while (capacity < bytes->count + extra) capacity *= 2;
+    bytes->items = realloc(bytes->items, capacity);
+    assert(bytes->items != NULL);
+    bytes->capacity = capacity;
+}
+
+void bytes_append(Bytes *bytes, const void *data, size_t size)
+{
+    if (size == 0) return;
+    bytes_reserve(bytes, size);
+    memcpy(bytes->items + bytes->count, data, size);
+    bytes->count += size;
+}
+
+void bytes_free(Bytes *bytes)
+{
+    free(bytes->items);
+    memset(bytes, 0, sizeof(*bytes));
+}
+
+static void bytes_append_u32be(Bytes *bytes, uint32_t x)
+{
+    const unsigned char be[4] = {x >> 24, (x >> 16) & 0xFF, (x >> 8) & 0xFF, x & 0xFF};
+    bytes_append(bytes, be, sizeof(be));
+}
+
+int png_channels(const PngHeader *header)
+{
+    switch (header->color_type) {
+    case 0: return 1;
+    case 2: return 3;
+    case 3: return 1;
+    case 4: return 2;
+    case 6: return 4;
+    }
+    assert(0 && "unreachable");
+    return 0;
+}
+
+size_t png_row_size(const PngHeader *header, int width)
+{
+    return ((size_t) width * png_channels(header) * header->bit_depth + 7) / 8;
+}
+
+void png_pass_size(const PngHeader *header, int pass, int *width, int *height)
+{
+    static const int x0[PNG_PASSES] = {0, 4, 0, 2, 0, 1, 0};
+    static const int y0[PNG_PASSES] = {0, 0, 4, 0, 2, 0, 1};
+    static const int dx[PNG_PASSES] = {8, 8, 4, 4, 2, 2, 1};
+    static const int dy[PNG_PASSES] = {8, 8, 8, 4, 4, 2, 2};
+    if (!header->interlaced) {
+        *width = pass == 0 ? header->width : 0;
+        *height = pass == 0 ? header->height : 0;
+        return;
+    }
+    *width = header->width > x0[pass] ? (header->width - x0[pass] + dx[pass] - 1) / dx[pass] : 0;
+    *height = header->height > y0[pass] ? (header->height - y0[pass] + dy[pass] - 1) / dy[pass] : 0;
+    // A pass without pixels has no scanlines at all
+    if (*width == 0 || *height == 0) *width = *height = 0;
+}
+
+size_t png_filtered_size(const PngHeader *header)
+{
+    size_t size = 0;
+    for (int pass = 0; pass < PNG_PASSES; ++pass) {
+        int w, h;
+        png_pass_size(header, pass, &w, &h);
+        size += (png_row_size(header, w) + 1) * h;
+    }
+    return size;
+}
+
+typedef struct {
+    Bytes *out;
+    uint64_t bits;
+    int count;
+} BitWriter;
+
+// Deflate puts the bits of a byte LSB first
+static void put_bits(BitWriter *w, uint32_t value, int count)
+{
+    w->bits |= (uint64_t) value << w->count;
+    w->count += count;
+    if (w->count >= 32) {
+        bytes_reserve(w->out, 4);
+        for (int i = 0; i < 4; ++i) {
+            w->out->items[w->out->count++] = w->bits & 0xFF;
+            w->bits >>= 8;
+        }
+        w->count -= 32;
+    }
+}
+
+static void align_to_byte(BitWriter *w)
+{
+    put_bits(w, 0, (8 - w->count % 8) % 8);
+    while (w->count > 0) {
+        bytes_reserve(w->out, 1);
+        w->out->items[w->out->count++] = w->bits & 0xFF;
+        w->bits >>= 8;
+        w->count -= 8;
+    }
+}
+
+// Huffman codes go MSB first, so they are written reversed
+static uint32_t reverse_bits(uint32_t code, int count)
+{
+    uint32_t result = 0;
+    for (int i = 0; i < count; ++i) {
+        result = (result << 1) | (code & 1);
+        code >>= 1;
+    }
+    return result;
+}
+
+typedef struct {
+    uint16_t code;
+    uint8_t count;
+} HuffCode;
+
+static HuffCode fixed_litlen[288];
+
+static void fixed_litlen_init(void)
+{
+    if (fixed_litlen[0].count != 0) return;
+    for (int x = 0; x < 288; ++x) {
+        uint32_t code;
+        int count;
+        if (x < 144)      { code = 0x30 + x;          count = 8; }
+        else if (x < 256) { code = 0x190 + (x - 144); count = 9; }
+        else if (x < 280) { code = x - 256;           count = 7; }
+        else              { code = 0xC0 + (x - 280);  count = 8; }
+        fixed_litlen[x].code = reverse_bits(code, count);
+        fixed_litlen[x].count = count;
+    }
+}
+
+static const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+static void put_symbol(BitWriter *w, int symbol)
+{
+    put_bits(w, fixed_litlen[symbol].code, fixed_litlen[symbol].count);
+}
+
+static void put_match(BitWriter *w, size_t length, size_t dist)
+{
+    int l = 28;
+    while (length_base[l] > length) --l;
+    put_symbol(w, 257 + l);
+    put_bits(w, length - length_base[l], length_extra[l]);
+    int d = 29;
+    while (dist_base[d] > dist) --d;
+    put_bits(w, reverse_bits(d, 5), 5);
+    put_bits(w, dist - dist_base[d], dist_extra[d]);
+}
+
+static uint32_t hash3(const unsigned char *p)
+{
+    return ((p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// One fixed Huffman block of bytes[start, end), matching only within it
+static void deflate_fixed_block(BitWriter *w, const unsigned char *bytes, size_t start, size_t end, int final, uint32_t *head)
+{
+    put_bits(w, final, 1);
+    put_bits(w, 1, 2);
+    for (size_t i = 0; i < (1 << HASH_BITS); ++i) head[i] = UINT32_MAX;
+
+    size_t i = start;
+    while (i < end) {
+        size_t length = 0, dist = 0;
+        if (end - i >= DEFLATE_MIN_MATCH) {
+            const uint32_t h = hash3(&bytes[i]);
+            const uint32_t candidate = head[h];
+            head[h] = (uint32_t) (i - start);
+            if (candidate != UINT32_MAX && i - start - candidate <= DEFLATE_WINDOW) {
+                const size_t from = start + candidate;
+                const size_t max = end - i < DEFLATE_MAX_MATCH ? end - i : DEFLATE_MAX_MATCH;
+                while (length < max && bytes[from + length] == bytes[i + length]) ++length;
+                dist = i - from;
+            }
+        }
+        if (length >= DEFLATE_MIN_MATCH) {
+            put_match(w, length, dist);
+            for (size_t k = 1; k < length && i + k + DEFLATE_MIN_MATCH <= end; ++k) {
+                head[hash3(&bytes[i + k])] = (uint32_t) (i + k - start);
+            }
+            i += length;
+        } else {
+            put_symbol(w, bytes[i]);
+            i += 1;
+        }
+    }
+    put_symbol(w, 256);
+}
+
+static void deflate_stored_blocks(BitWriter *w, const unsigned char *bytes, size_t start, size_t end, int final)
+{
+    do {
+        const size_t n = end - start < DEFLATE_STORED_MAX ? end - start : DEFLATE_STORED_MAX;
+        put_bits(w, final && start + n == end, 1);
+        put_bits(w, 0, 2);
+        align_to_byte(w);
+        const unsigned char len[4] = {n & 0xFF, n >> 8, ~n & 0xFF, (~n >> 8) & 0xFF};
+        bytes_append(w->out, len, sizeof(len));
+        bytes_append(w->out, &bytes[start], n);
+        start += n;
+    } while (start < end);
+}
+
+void zlib_compress(Bytes *out, const unsigned char *bytes, size_t size, int compress, size_t flush_every)
+{
+    fixed_litlen_init();
+    const unsigned char header[2] = {0x78, 0x01};
+    bytes_append(out, header, sizeof(header));
+
+    uint32_t *head = NULL;
+    if (compress) {
+        head = malloc(sizeof(*head) << HASH_BITS);
+        assert(head != NULL);
+    }
+
+    BitWriter w = {out, 0, 0};
+    size_t start = 0;
+    do {
+        const size_t end = flush_every == 0 || size - start <= flush_every ? size : start + flush_every;
+        const int final = end == size;
+        if (compress) {
+            deflate_fixed_block(&w, bytes, start, end, final, head);
+        } else {
+            deflate_stored_blocks(&w, bytes, start, end, final);
+        }
+        if (!final) {
+            // A full flush: an empty stored block, and no match across it
+            put_bits(&w, 0, 3);
+            align_to_byte(&w);
+            const unsigned char empty[4] = {0x00, 0x00, 0xFF, 0xFF};
+            bytes_append(out, empty, sizeof(empty));
+        }
+        start = end;
+    } while (start < size);
+    align_to_byte(&w);
+    free(head);
+
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < size; ++i) {
+        a = (a + bytes[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    bytes_append_u32be(out, (b << 16) | a);
+}
+
+static uint32_t crc_table[256];
+
+static uint32_t crc32_update(uint32_t crc, const unsigned char *bytes, size_t size)
+{
+    if (crc_table[1] == 0) {
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crc_table[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) crc = crc_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void png_chunk(Bytes *out, const char type[4], const unsigned char *data, size_t size)
+{
+    bytes_append_u32be(out, (uint32_t) size);
+    bytes_append(out, type, 4);
+    bytes_append(out, data, size);
+    uint32_t crc = crc32_update(0, (const unsigned char *) type, 4);
+    crc = crc32_update(crc, data, size);
+    bytes_append_u32be(out, crc);
+}
+
+void png_encode(Bytes *out, const PngHeader *header,
+                const unsigned char *palette, int palette_size,
+                const unsigned char *filtered, size_t size,
+                int compress, size_t flush_every)
+{
+    assert(size == png_filtered_size(header));
+    static const unsigned char signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+    bytes_append(out, signature, sizeof(signature));
+
+    const unsigned char ihdr[13] = {
+        header->width >> 24, (header->width >> 16) & 0xFF, (header->width >> 8) & 0xFF, header->width & 0xFF,
+        header->height >> 24, (header->height >> 16) & 0xFF, (header->height >> 8) & 0xFF, header->height & 0xFF,
+        header->bit_depth, header->color_type,
+        0, 0,                   // deflate, adaptive filtering
+        header->interlaced,
+    };
+    png_chunk(out, "IHDR", ihdr, sizeof(ihdr));
+    if (header->color_type == 3) png_chunk(out, "PLTE", palette, (size_t) palette_size * 3);
+
+    Bytes idat = {0};
+    zlib_compress(&idat, filtered, size, compress, flush_every);
+    for (size_t i = 0; i < idat.count; i += IDAT_MAX) {
+        png_chunk(out, "IDAT", &idat.items[i], idat.count - i < IDAT_MAX ? idat.count - i : IDAT_MAX);
+    }
+    bytes_free(&idat);
+    png_chunk(out, "IEND", NULL, 0);
+}
@@ -0,0 +1,51 @@
+#ifndef PNGENC_H_
+#define PNGENC_H_
+
+#include <stddef.h>
+
+// A small PNG writer for the generated images of the benchmarks and the
+// checks. It takes the scanlines already filtered, so the images can have
+// any filter type on any row, and it writes them either stored or
+// compressed with the fixed Huffman codes and greedy LZ77 matches. That is
+// enough to give the decoder realistic work without depending on zlib.
+
+typedef struct {
+    unsigned char *items;
+    size_t count;
+    size_t capacity;
+} Bytes;
+
+typedef struct {
+    int width, height;
+    int bit_depth;
+    int color_type;             // 0 gray, 2 RGB, 3 palette, 4 gray+alpha, 6 RGBA
+    int interlaced;             // Adam7
+} PngHeader;
+
+#define PNG_PASSES 7
+
+void bytes_append(Bytes *bytes, const void *data, size_t size);
+void bytes_free(Bytes *bytes);
+
+int png_channels(const PngHeader *header);
+// Bytes in a scanline of width pixels, without its filter type byte
+size_t png_row_size(const PngHeader *header, int width);
+// The size of an Adam7 pass, or of the whole image when not interlaced
+// (then only pass 0 is there)
+void png_pass_size(const PngHeader *header, int pass, int *width, int *height);
+// Bytes of all the scanlines with their filter type bytes
+size_t png_filtered_size(const PngHeader *header);
+
+// Appends a zlib stream of the bytes. Stored when compress is 0. When
+// flush_every is not 0 a full flush follows every flush_every bytes of
+// input, so no match reaches back past it.
+void zlib_compress(Bytes *out, const unsigned char *bytes, size_t size, int compress, size_t flush_every);
+
+// Appends a whole PNG file of the filtered scanlines. palette holds
+// palette_size RGB triples and is only written for color type 3.
+void png_encode(Bytes *out, const PngHeader *header,
+                const unsigned char *palette, int palette_size,
+                const unsigned char *filtered, size_t size,
+                int compress, size_t flush_every);
+
+#endif // PNGENC_H_
@@ -0,0 +1,54 @@
+// One build of stb_image behind a StbiVariant called VARIANT. The Makefile
+// compiles this file once per variant with the flags of that variant.
+// stb_image is static here, so the builds don't clash, and most of it goes
+// unused.
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "../stb_image.h"
+#include "stbi_variant.h"
+
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x) STRINGIFY_(x)
+
+static unsigned char *variant_load(const unsigned char *bytes, int size, int *w, int *h, int *n, int desired)
+{
+    return stbi_load_from_memory(bytes, size, w, h, n, desired);
+}
+
+static unsigned short *variant_load_16(const unsigned char *bytes, int size, int *w, int *h, int *n, int desired)
+{
+    return stbi_load_16_from_memory(bytes, size, w, h, n, desired);
+}
+
+static const char *variant_failure_reason(void)
+{
+    return stbi_failure_reason();
+}
+
+static void variant_image_free(void *pixels)
+{
+    stbi_image_free(pixels);
+}
+
+static const char *variant_jpeg_kernels(void)
+{
+#ifdef STBI_AVX2
+    if (stbi__avx2_available()) return "AVX2";
+#endif
+#ifdef STBI_SSE2
+    if (stbi__sse2_available()) return "SSE2";
+#endif
+#ifdef STBI_NEON
+    return "NEON";
+#endif
+    return "C";
+}
+
+const StbiVariant VARIANT = {
+    STRINGIFY(VARIANT),
+    variant_load,
+    variant_load_16,
+    variant_failure_reason,
+    variant_image_free,
+    variant_jpeg_kernels,
+};
@@ -0,0 +1,24 @@
+#ifndef STBI_VARIANT_H_
+#define STBI_VARIANT_H_
+
+// stb_image built several times with different SIMD flags, so one program
+// can decode the same bytes with each build and compare them. Every build
+// is a separate object of stbi_variant.c, see the Makefile.
+typedef struct {
+    const char *name;
+    unsigned char *(*load)(const unsigned char *bytes, int size, int *w, int *h, int *n, int desired);
+    unsigned short *(*load_16)(const unsigned char *bytes, int size, int *w, int *h, int *n, int desired);
+    const char *(*failure_reason)(void);
+    void (*image_free)(void *pixels);
+    // "AVX2", "SSE2", "NEON" or "C": what the JPEG kernels run on this CPU
+    const char *(*jpeg_kernels)(void);
+} StbiVariant;
+
+// Everything the CPU has, AVX2 included
+extern const StbiVariant stbi_simd;
+// SSE2 or NEON, but not AVX2
+extern const StbiVariant stbi_no_avx2;
+// The generic C code
+extern const StbiVariant stbi_no_simd;
+
+#endif // STBI_VARIANT_H_
@@ -0,0 +1,189 @@
+// Decodes generated PNGs of every color type, bit depth, filter type and
+// interlace mode, and the PNG files it is given, with stb_image built with
+// and without SIMD, and compares the pixels. Exits with 1 on the first
+// difference.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pngenc.h"
+#include "stbi_variant.h"
+
+#define IMAGE_HEIGHT 11
+// Filter types 0 to 4 on every row, then cycling through them, then random
+#define FILTER_CYCLE 5
+#define FILTER_MODES 7
+
+const char *filter_mode_names[FILTER_MODES] = {"none", "sub", "up", "avg", "paeth", "cycling", "random"};
+
+uint32_t rng_state = 0x0F117E5;
+
+uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    int color_type;
+    int bit_depth;
+} Format;
+
+const Format formats[] = {
+    {0, 1}, {0, 2}, {0, 4}, {0, 8}, {0, 16},
+    {2, 8}, {2, 16},
+    {3, 1}, {3, 2}, {3, 4}, {3, 8},
+    {4, 8}, {4, 16},
+    {6, 8}, {6, 16},
+};
+
+// Around the 16 byte vectors and a few pixels over them
+const int widths[] = {1, 2, 3, 5, 8, 15, 16, 17, 31, 33, 64, 257};
+
+// Random bytes make random pixels whatever the filters, so the scanlines
+// don't need to be filtered from anything
+void generate_scanlines(const PngHeader *header, int filter_mode, unsigned char *filtered)
+{
+    size_t row = 0;
+    for (int pass = 0; pass < PNG_PASSES; ++pass) {
+        int w, h;
+        png_pass_size(header, pass, &w, &h);
+        const size_t row_size = png_row_size(header, w);
+        for (int y = 0; y < h; ++y, ++row) {
+            if (filter_mode < FILTER_CYCLE) {
+                *filtered++ = filter_mode;
+            } else if (filter_mode == FILTER_CYCLE) {
+                *filtered++ = row % 5;
+            } else {
+                *filtered++ = rng() % 5;
+            }
+            for (size_t i = 0; i < row_size; ++i) *filtered++ = rng() & 0xFF;
+        }
+    }
+}
+
+// Returns 0 when the variants decode the bytes differently
+int compare_variants(const char *label, const unsigned char *bytes, int size)
+{
+    const StbiVariant *base = &stbi_no_simd;
+    const StbiVariant *simd = &stbi_simd;
+    for (int depth16 = 0; depth16 <= 1; ++depth16) {
+        for (int desired = 0; desired <= 4; ++desired) {
+            int w[2], h[2], n[2];
+            void *pixels[2];
+            if (depth16) {
+                pixels[0] = base->load_16(bytes, size, &w[0], &h[0], &n[0], desired);
+                pixels[1] = simd->load_16(bytes, size, &w[1], &h[1], &n[1], desired);
+            } else {
+                pixels[0] = base->load(bytes, size, &w[0], &h[0], &n[0], desired);
+                pixels[1] = simd->load(bytes, size, &w[1], &h[1], &n[1], desired);
+            }
+
+            int ok = 1;
+            if (pixels[0] == NULL || pixels[1] == NULL) {
+                fprintf(stderr, "FAIL: %s (%d bit, %d channels): %s could not decode it: %s\n",
+                        label, depth16 ? 16 : 8, desired,
+                        pixels[0] == NULL ? base->name : simd->name,
+                        pixels[0] == NULL ? base->failure_reason() : simd->failure_reason());
+                ok = 0;
+            } else if (w[0] != w[1] || h[0] != h[1] || n[0] != n[1]) {
+                fprintf(stderr, "FAIL: %s (%d bit, %d channels): %dx%dx%d with %s, %dx%dx%d with %s\n",
+                        label, depth16 ? 16 : 8, desired,
+                        w[0], h[0], n[0], base->name, w[1], h[1], n[1], simd->name);
+                ok = 0;
+            } else {
+                const size_t count = (size_t) w[0] * h[0] * (desired ? desired : n[0]) * (depth16 ? 2 : 1);
+                const unsigned char *a = pixels[0], *b = pixels[1];
+                for (size_t i = 0; i < count; ++i) {
+                    if (a[i] != b[i]) {
+                        fprintf(stderr, "FAIL: %s (%d bit, %d channels): byte %zu is %u with %s, %u with %s\n",
+                                label, depth16 ? 16 : 8, desired, i, a[i], base->name, b[i], simd->name);
+                        ok = 0;
+                        break;
+                    }
+                }
+            }
+            if (pixels[0] != NULL) base->image_free(pixels[0]);
+            if (pixels[1] != NULL) simd->image_free(pixels[1]);
+            if (!ok) return 0;
+        }
+    }
+    return 1;
+}
+
+unsigned char *read_file(const char *filepath, int *size)
+{
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open file `%s`\n", filepath);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    const long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (n < 0) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    unsigned char *bytes = malloc(n > 0 ? n : 1);
+    if (bytes == NULL || fread(bytes, 1, n, f) != (size_t) n) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    fclose(f);
+    *size = (int) n;
+    return bytes;
+}
+
+int main(int argc, char **argv)
+{
+    size_t images = 0;
+    for (int i = 1; i < argc; ++i) {
+        int size;
+        unsigned char *bytes = read_file(argv[i], &size);
+        if (!compare_variants(argv[i], bytes, size)) return 1;
+        free(bytes);
+        images += 1;
+    }
+
+    unsigned char palette[256 * 3];
+    for (size_t i = 0; i < sizeof(palette); ++i) palette[i] = rng() & 0xFF;
+
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+        for (size_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); ++wi) {
+            for (int interlaced = 0; interlaced <= 1; ++interlaced) {
+                for (int filter_mode = 0; filter_mode < FILTER_MODES; ++filter_mode) {
+                    const PngHeader header = {
+                        widths[wi], IMAGE_HEIGHT,
+                        formats[f].bit_depth, formats[f].color_type,
+                        interlaced,
+                    };
+                    const size_t size = png_filtered_size(&header);
+                    unsigned char *filtered = malloc(size);
+                    if (filtered == NULL) {
+                        fprintf(stderr, "Could not allocate %zu bytes\n", size);
+                        return 1;
+                    }
+                    generate_scanlines(&header, filter_mode, filtered);
+                    Bytes png = {0};
+                    png_encode(&png, &header, palette, 1 << header.bit_depth, filtered, size, images % 2, 0);
+
+                    char label[128];
+                    snprintf(label, sizeof(label), "%dx%d, color type %d, %d bit%s, filter %s",
+                             header.width, header.height, header.color_type, header.bit_depth,
+                             interlaced ? ", interlaced" : "", filter_mode_names[filter_mode]);
+                    if (!compare_variants(label, png.items, (int) png.count)) return 1;
+                    bytes_free(&png);
+                    free(filtered);
+                    images += 1;
+                }
+            }
+        }
+    }
+
+    printf("OK: %zu PNGs decode the same with %s and %s\n", images, stbi_simd.name, stbi_no_simd.name);
+    return 0;
+}
@@ -0,0 +1,107 @@
+// Compares the timing wheel of the timer server with the linear scan of
+// the deadlines it replaced: 1M countdowns, 1 ms ticks, 10 s of them. The
+// scan is too slow to run for all of them, so it only runs the first
+// SCAN_TICKS and both report the time per tick.
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../wheel.h"
+
+#define TIMERS (1000 * 1000)
+#define TICKS (10 * 1000)
+#define SCAN_TICKS 200
+#define NEVER UINT64_MAX
+
+uint32_t rng_state = 0x3EE1;
+
+uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+double now_us(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec * 1e6 + (double) now.tv_nsec * 1e-3;
+}
+
+// What server_tick() used to do on every wakeup. Returns the expired count.
+size_t scan_tick(uint64_t *deadline, size_t count, uint64_t now)
+{
+    size_t expired = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (deadline[i] <= now) {
+            deadline[i] = NEVER;
+            expired += 1;
+        }
+    }
+    return expired;
+}
+
+size_t wheel_tick(Wheel *wheel, uint64_t now)
+{
+    size_t expired = 0;
+    wheel_advance(wheel, now);
+    while (wheel_pop(wheel) != WHEEL_NONE) expired += 1;
+    return expired;
+}
+
+// The deadlines are 1 to spread ticks away from the start
+void bench(const char *name, uint64_t spread)
+{
+    const uint64_t start = 1000;
+    uint64_t *deadline = malloc(TIMERS * sizeof(*deadline));
+    assert(deadline != NULL);
+    for (size_t i = 0; i < TIMERS; ++i) {
+        deadline[i] = start + 1 + ((uint64_t) rng() << 32 | rng()) % spread;
+    }
+
+    Wheel wheel;
+    wheel_init(&wheel, start);
+    wheel_reserve(&wheel, TIMERS);
+    double begin = now_us();
+    for (uint32_t i = 0; i < TIMERS; ++i) wheel_schedule(&wheel, i, deadline[i]);
+    const double schedule_ns = (now_us() - begin) * 1e3 / TIMERS;
+
+    size_t wheel_expired = 0, wheel_expired_scanned = 0;
+    begin = now_us();
+    for (uint64_t t = 1; t <= TICKS; ++t) {
+        wheel_expired += wheel_tick(&wheel, start + t);
+        if (t == SCAN_TICKS) wheel_expired_scanned = wheel_expired;
+    }
+    const double wheel_us = (now_us() - begin) / TICKS;
+
+    size_t scan_expired = 0;
+    begin = now_us();
+    for (uint64_t t = 1; t <= SCAN_TICKS; ++t) {
+        scan_expired += scan_tick(deadline, TIMERS, start + t);
+    }
+    const double scan_us = (now_us() - begin) / SCAN_TICKS;
+
+    if (scan_expired != wheel_expired_scanned) {
+        fprintf(stderr, "ERROR: %s: the scan expired %zu timers in %d ticks, the wheel %zu\n",
+                name, scan_expired, SCAN_TICKS, wheel_expired_scanned);
+        exit(1);
+    }
+    printf("%-20s scan %9.3f us/tick, wheel %9.3f us/tick, %zu expired, scheduling %.1f ns/timer\n",
+           name, scan_us, wheel_us, wheel_expired, schedule_ns);
+
+    wheel_free(&wheel);
+    free(deadline);
+}
+
+int main(void)
+{
+    printf("%d timers, %d ticks of 1 ms\n", TIMERS, TICKS);
+    bench("all due within 10 s", TICKS);
+    bench("spread over 24 h", 24ull * 60 * 60 * 1000);
+    return 0;
+}
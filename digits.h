@@ -0,0 +1,3992 @@
+#ifndef PNG_digits_H_
+#define PNG_digits_H_
+#define PNG_digits_EMBEDDED
+size_t digits_width = 1650;
+size_t digits_height = 570;
+uint32_t *digits_data = NULL;
+size_t digits_png_size = 127418;
+unsigned char digits_png[] = {
+137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,6,114,0,0,2,58,8,6,0,0,0,19,252,214,
+22,0,0,0,9,112,72,89,115,0,0,46,35,0,0,46,35,1,120,165,63,118,0,0,32,0,73,68,65,84,120,1,
+236,157,7,216,229,68,249,197,233,189,119,16,216,165,35,93,144,106,1,20,145,34,130,72,71,20,81,64,1,65,1,225,
+47,210,193,138,32,210,165,75,151,222,69,58,210,65,122,47,75,95,218,210,123,91,252,255,206,71,178,220,239,219,91,82,
+38,247,38,55,231,125,158,115,147,155,204,188,243,206,153,201,100,122,198,25,199,98,6,204,128,25,48,3,102,192,12,152,
+1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,
+25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,
+152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,
+128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,
+12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,
+204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,
+192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,
+6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,
+102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,
+96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,
+3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,
+51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,
+48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,
+1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,
+25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,
+152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,
+128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,
+12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,
+204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,
+192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,
+6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,
+102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,
+96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,
+3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,
+51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,
+48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,
+1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,
+25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,
+152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,
+128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,232,9,3,227,246,36,212,62,11,244,127,255,251,223,198,68,105,
+35,176,32,152,30,140,15,198,3,146,183,193,59,224,5,112,187,48,238,184,227,158,197,209,98,6,204,128,25,48,3,102,
+192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,16,
+154,1,6,110,230,1,167,128,23,193,104,144,86,62,196,195,179,224,15,96,190,208,246,89,159,25,48,3,245,96,128,242,
+99,156,8,211,112,156,178,30,177,118,44,205,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,
+152,1,51,96,6,204,64,189,24,240,138,156,132,233,77,39,233,114,56,253,13,248,38,152,60,161,183,36,206,62,193,209,
+3,224,111,172,212,57,33,137,7,187,49,3,102,160,158,12,68,229,144,202,160,197,35,76,204,113,82,48,13,248,16,60,
+15,180,250,239,49,112,13,184,19,60,2,6,132,50,38,62,245,209,12,152,1,51,96,6,204,128,25,48,3,102,192,12,
+152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,208,31,12,208,113,186,62,120,26,100,89,121,131,183,196,242,
+41,46,31,3,115,244,7,115,142,69,17,12,144,63,22,4,151,0,173,6,251,8,188,7,70,130,191,128,97,69,132,105,
+157,189,99,128,52,213,138,155,111,130,35,193,8,160,213,124,105,228,21,28,159,11,214,1,189,139,136,67,54,3,102,192,
+12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,102,192,12,132,102,128,78,207,
+45,193,115,160,219,242,49,1,250,27,58,161,19,180,15,244,145,47,118,5,175,181,201,144,239,115,239,162,62,136,106,109,
+163,64,250,197,91,165,233,184,50,184,24,40,93,243,202,39,40,120,4,108,15,102,168,45,193,142,120,46,6,200,59,113,
+254,156,146,243,217,192,184,13,215,114,233,182,103,51,96,6,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,
+48,3,102,192,12,152,129,214,12,120,159,157,33,220,208,41,181,55,151,182,3,211,15,185,213,237,191,175,16,224,10,108,
+133,164,45,146,44,53,103,128,124,185,42,20,104,128,111,170,4,84,220,79,190,89,52,129,59,59,41,25,3,234,20,71,
+180,117,218,110,96,5,48,9,8,45,215,161,240,24,242,200,169,161,21,91,95,181,25,136,242,159,34,49,27,248,6,88,
+16,44,4,180,117,159,48,51,24,15,104,123,81,125,147,233,45,48,26,104,139,63,189,179,222,3,31,0,109,23,122,23,
+184,1,104,123,191,143,193,56,222,218,79,44,88,204,128,25,48,3,102,192,12,152,1,51,96,6,204,128,25,48,3,245,
+99,128,246,230,60,196,122,56,80,199,199,19,224,41,160,126,233,129,142,16,183,23,97,194,98,6,204,64,50,6,40,80,
+182,6,175,131,50,137,102,209,31,145,44,6,118,213,207,12,144,15,94,74,153,49,175,233,103,62,250,37,110,164,105,188,
+194,65,199,241,192,126,160,221,170,43,110,7,145,55,208,242,199,126,225,209,241,200,207,0,249,97,99,112,2,120,10,188,
+3,66,136,182,12,125,11,252,11,236,5,230,0,99,242,124,126,171,173,193,12,152,1,51,96,6,204,128,25,48,3,102,
+192,12,152,1,51,96,6,202,192,64,99,91,143,243,121,192,14,224,20,240,56,80,159,86,227,110,35,218,54,94,159,10,
+120,23,252,23,28,9,214,2,110,47,150,33,49,109,131,25,40,43,3,20,18,75,3,109,57,84,102,185,190,172,252,217,
+174,226,25,32,99,30,150,33,115,234,165,184,102,241,214,57,132,60,12,144,70,113,37,229,75,156,223,153,33,157,243,120,
+209,54,142,231,1,173,172,176,212,140,1,210,125,24,248,13,184,29,168,2,221,13,209,119,189,148,207,119,5,51,213,140,
+114,71,215,12,152,1,51,96,6,204,128,25,48,3,102,192,12,152,1,51,208,183,12,208,198,219,20,156,8,94,0,154,
+152,158,86,62,192,195,77,96,3,208,183,60,57,98,102,32,15,3,181,221,90,141,66,97,58,136,187,16,44,15,180,85,
+76,217,229,57,150,25,206,81,118,35,109,95,88,6,200,167,218,206,232,25,144,165,179,253,66,242,204,218,97,45,178,182,
+144,12,68,149,147,109,209,185,7,208,182,85,189,16,149,131,59,145,87,30,239,69,224,14,179,123,12,144,223,244,14,217,
+20,108,2,22,0,19,129,94,201,243,4,172,188,247,7,160,50,206,91,175,137,4,139,25,48,3,102,192,12,152,1,51,
+96,6,204,128,25,136,24,160,254,174,126,128,37,192,87,128,182,61,86,125,94,219,26,11,147,2,245,118,171,63,235,117,
+240,22,120,21,104,155,227,135,192,21,180,241,180,245,177,197,12,20,194,0,249,115,10,20,255,0,108,0,150,6,250,31,
+66,180,53,247,213,224,111,224,95,177,66,242,115,124,234,163,25,48,3,117,98,128,194,230,239,160,113,73,31,127,43,33,
+47,98,229,23,234,148,86,117,143,43,233,125,102,142,156,233,142,249,146,103,32,210,246,96,80,134,178,232,52,236,200,50,
+88,88,114,134,235,109,30,105,26,175,248,154,139,243,227,192,243,160,108,50,2,131,118,6,245,78,44,199,222,12,152,1,
+51,96,6,204,128,25,48,3,102,160,246,12,80,39,214,118,219,171,130,163,129,86,206,107,133,194,104,144,69,222,198,211,
+83,64,237,0,117,182,91,204,64,46,6,200,71,113,251,242,251,156,95,10,138,222,22,254,73,194,216,17,12,132,155,203,
+120,123,54,3,102,160,122,12,240,240,111,8,158,5,85,22,117,122,205,80,61,246,109,113,22,6,72,235,60,91,30,61,
+153,37,76,251,41,142,1,210,51,174,248,140,203,249,233,64,219,155,149,69,78,40,46,230,214,220,11,6,200,88,202,111,
+191,5,35,203,146,201,90,216,161,101,247,151,246,130,35,135,217,61,6,72,99,229,71,117,78,204,14,166,239,94,200,14,
+201,12,152,1,51,96,6,204,128,25,48,3,229,100,32,170,31,169,142,52,43,248,61,208,183,68,138,18,77,32,188,13,
+252,31,240,4,225,114,102,137,82,89,69,62,137,251,47,116,92,2,28,14,158,4,250,22,106,183,68,131,69,250,214,78,
+169,184,177,49,102,160,87,12,212,102,93,26,15,253,185,144,188,22,152,160,87,100,7,12,119,20,75,10,253,125,129,128,
+132,150,81,21,121,118,23,236,250,83,14,219,174,34,159,172,146,195,191,189,6,102,32,170,124,104,233,251,145,96,171,192,
+234,243,170,251,0,5,191,6,135,197,138,188,116,57,102,162,26,199,33,149,219,245,177,250,119,96,190,106,88,63,96,229,
+131,252,254,10,92,174,127,206,127,98,161,63,132,188,57,57,49,249,46,216,20,104,91,144,103,193,238,224,70,167,51,44,
+88,250,130,1,242,249,36,68,68,101,174,182,21,209,22,55,202,247,179,131,79,192,8,240,6,24,31,188,67,190,127,147,
+163,197,12,152,1,51,96,6,106,206,0,239,14,13,168,252,22,168,238,222,205,9,187,239,19,222,189,224,36,112,34,120,
+15,184,254,45,18,44,99,24,136,218,151,27,115,97,75,176,12,80,221,166,23,242,50,129,174,71,253,201,223,15,239,5,
+251,14,179,84,12,244,253,64,14,5,207,178,48,174,65,156,217,74,197,124,126,99,158,166,16,27,158,95,141,53,148,149,
+1,242,238,40,108,203,83,153,251,11,121,68,29,243,150,146,48,16,85,132,46,198,156,53,75,98,210,80,51,212,185,186,
+1,184,69,55,200,63,58,88,42,194,64,148,191,180,95,246,81,64,223,193,233,229,55,112,178,178,246,28,30,183,7,231,
+57,255,101,165,176,28,254,162,252,56,28,107,126,2,148,31,213,81,161,60,169,130,229,83,160,142,131,31,59,157,97,193,
+82,9,6,200,211,202,187,202,195,26,140,153,16,232,191,38,103,8,18,109,81,58,55,80,39,135,6,106,38,3,179,130,
+209,64,171,164,223,6,242,251,14,80,29,79,83,75,245,44,124,28,225,35,63,15,48,97,49,3,102,192,12,244,49,3,
+81,253,40,142,225,14,156,236,12,52,232,223,75,209,228,131,27,192,241,188,135,206,239,165,33,14,187,183,12,52,228,79,
+213,113,246,5,235,129,5,128,254,247,90,238,35,127,46,214,107,35,28,190,25,232,53,3,253,176,58,165,41,135,20,64,
+106,60,157,12,190,7,202,80,232,52,181,51,199,197,97,196,241,38,10,178,21,114,232,176,215,146,50,64,218,126,19,211,
+242,110,61,163,1,3,75,185,24,56,3,115,214,40,151,73,131,172,209,199,51,119,4,26,204,177,84,143,129,213,49,249,
+111,64,51,194,171,42,106,200,30,11,102,4,71,87,53,18,117,182,155,247,151,162,63,21,216,28,108,7,230,2,67,235,
+155,234,216,86,71,182,197,12,148,146,129,40,31,203,54,181,33,4,13,214,40,47,175,8,212,161,177,56,152,22,76,3,
+84,94,197,131,148,26,76,151,251,161,162,60,31,235,209,10,88,117,154,105,54,244,11,224,30,160,14,180,171,9,119,96,
+128,135,250,253,192,131,196,53,139,25,48,3,102,192,12,84,156,129,134,119,202,164,68,101,97,176,50,208,32,206,76,64,
+19,3,122,45,122,159,105,247,154,111,99,235,127,56,238,3,244,94,242,196,62,145,80,47,249,58,209,253,49,88,27,40,
+95,148,73,22,37,127,30,130,65,154,244,55,32,212,151,226,83,31,205,64,109,24,232,203,92,207,195,173,206,200,187,193,
+116,53,72,201,235,41,188,84,216,90,250,136,1,242,240,141,68,39,207,32,221,7,228,11,85,20,45,61,100,128,116,108,
+12,253,80,254,168,83,179,236,162,45,96,182,6,154,145,85,118,91,107,109,223,144,252,245,115,200,216,7,168,67,177,31,
+228,53,34,177,43,208,160,206,128,56,63,198,76,148,251,72,190,252,50,22,238,15,86,2,234,212,30,42,31,113,225,10,
+160,60,251,172,211,117,40,61,254,95,22,6,200,203,95,193,150,229,129,142,139,2,13,218,104,162,152,6,117,180,178,70,
+47,201,70,240,55,177,168,130,16,67,131,60,122,46,222,2,15,131,171,192,197,60,27,247,114,180,152,1,51,96,6,218,
+50,16,213,7,245,238,93,0,204,13,52,41,102,106,160,58,161,142,42,179,52,88,240,33,120,29,188,1,94,6,15,10,
+148,53,215,112,180,20,196,0,233,179,16,170,215,4,235,128,89,192,12,64,131,255,218,142,179,172,242,46,134,157,15,254,
+72,254,184,191,172,70,218,174,252,12,68,229,135,242,227,38,224,23,64,3,141,205,234,239,92,46,133,168,252,250,17,184,
+80,214,184,29,33,22,44,117,99,160,239,122,233,40,136,180,149,218,77,64,21,150,58,136,26,129,7,81,128,237,92,135,
+200,214,37,142,228,99,53,232,243,204,206,185,131,60,161,10,189,165,135,12,68,21,35,89,240,103,240,75,144,39,77,165,
+167,91,162,134,221,194,174,24,117,139,238,108,225,52,228,175,189,208,160,119,128,190,203,208,79,242,16,145,81,131,66,157,
+154,174,168,139,132,146,74,148,23,213,33,241,19,240,91,160,142,138,102,117,204,55,185,126,4,248,29,229,139,58,9,44,
+102,160,20,12,144,135,53,64,179,66,132,69,56,170,51,84,157,160,147,71,232,86,135,155,234,127,239,128,167,193,165,224,
+80,158,149,151,56,90,42,194,0,121,105,74,76,213,150,122,11,2,13,0,206,3,148,151,148,182,55,131,139,193,99,96,
+180,235,89,176,96,233,200,64,67,125,111,25,28,171,147,117,57,160,137,171,51,131,185,128,202,39,117,188,102,233,255,80,
+95,194,115,224,81,112,58,184,134,124,249,4,71,75,14,6,162,52,211,106,134,45,192,182,64,131,107,19,0,137,182,212,
+212,100,128,42,200,40,140,60,7,252,6,168,3,221,245,113,145,208,71,66,94,221,131,232,108,4,52,224,88,21,81,89,
+181,137,140,245,123,180,42,73,102,59,67,50,208,172,145,29,82,127,87,117,81,8,29,73,128,91,131,110,197,75,21,159,
+184,193,165,125,175,213,240,82,199,132,182,196,154,1,168,34,223,141,151,244,199,132,179,45,133,216,49,28,45,21,103,128,
+124,172,78,217,189,115,68,67,249,82,31,130,59,55,135,14,123,13,192,64,84,137,223,20,85,42,155,84,30,84,73,182,
+39,15,105,21,145,165,164,12,68,249,75,171,26,52,80,216,111,131,56,49,235,151,113,178,186,254,184,162,30,83,82,174,
+99,148,15,181,2,250,15,64,229,157,58,190,135,138,222,75,207,128,29,193,121,224,127,85,73,79,226,55,27,246,170,179,
+236,57,108,86,135,134,165,79,24,32,109,191,72,84,180,226,70,157,237,58,87,199,168,234,239,154,193,62,49,232,181,40,
+191,221,9,52,235,244,31,228,63,15,126,246,58,69,154,132,31,149,129,106,123,206,9,214,6,107,130,37,129,222,203,241,
+150,123,113,219,84,171,158,95,5,167,128,191,146,166,35,57,90,204,192,32,6,162,60,165,107,107,0,149,81,170,7,197,
+229,83,150,193,26,188,39,22,189,171,207,2,106,3,60,45,95,228,83,29,44,9,25,32,253,52,176,182,10,216,13,168,
+44,104,124,159,168,62,84,69,66,239,193,238,3,192,169,206,15,176,208,7,66,62,253,5,209,216,22,44,80,193,232,168,
+62,180,56,24,225,252,88,193,212,179,201,102,32,102,128,130,232,40,208,13,249,136,64,110,5,3,35,192,113,248,173,142,
+184,91,11,60,4,62,5,69,138,182,161,177,244,1,3,100,146,55,115,102,148,129,74,119,31,80,81,249,40,144,142,11,
+129,39,115,166,103,175,188,223,69,192,19,131,113,98,84,62,65,250,44,2,164,203,42,224,85,208,207,162,119,238,70,160,
+207,82,175,127,162,67,218,204,6,206,6,31,131,102,162,250,207,189,96,121,80,153,136,99,235,250,224,60,240,50,144,60,
+11,78,5,171,86,38,18,54,116,44,6,72,191,225,96,93,240,59,112,41,120,20,188,3,202,44,79,96,220,17,96,57,
+80,149,149,189,99,113,223,143,23,72,143,241,192,252,224,207,224,97,208,170,28,228,214,32,121,143,127,135,1,173,4,179,
+212,156,1,242,65,92,215,94,155,243,3,192,253,224,93,80,116,255,1,65,180,148,231,185,179,47,168,121,234,36,139,190,
+120,138,48,55,199,19,193,235,160,223,68,229,214,63,193,228,32,142,111,50,130,236,170,20,12,68,105,247,107,142,170,87,
+84,93,14,38,2,165,224,213,70,152,1,51,144,129,1,30,96,61,196,69,138,42,81,106,192,239,156,193,188,1,47,248,
+157,3,140,2,69,202,205,89,237,179,191,114,48,64,230,248,81,206,12,242,9,254,53,27,208,82,2,6,72,139,27,115,
+166,103,18,239,69,54,242,182,194,0,87,212,75,144,151,26,77,136,210,100,56,199,39,65,29,228,22,34,217,72,129,207,
+75,192,128,210,4,124,1,252,27,232,221,211,76,84,62,105,16,103,73,48,80,150,148,192,244,142,38,96,235,65,224,45,
+208,76,30,225,226,86,29,149,216,65,105,24,32,189,166,2,43,40,221,192,137,224,30,208,42,207,114,171,180,114,49,150,
+173,9,220,249,95,130,220,69,58,204,10,246,1,35,64,150,252,164,65,226,47,131,18,196,198,38,116,147,1,165,57,152,
+20,172,14,212,143,161,73,162,239,128,178,201,104,12,58,7,12,7,149,121,135,119,51,45,227,176,224,71,131,186,74,207,
+219,129,120,235,103,249,47,145,211,100,50,231,137,56,3,84,224,72,122,237,0,238,3,253,34,26,240,174,0,243,54,209,
+12,132,103,160,138,203,58,7,177,192,195,187,15,23,246,28,116,49,220,31,149,12,247,130,181,88,178,247,108,8,181,216,
+123,55,122,180,12,176,8,209,126,171,218,98,237,168,34,148,91,103,241,12,144,63,180,77,94,188,127,110,150,0,47,37,
+253,181,165,131,165,7,12,12,169,76,252,26,19,254,8,66,111,129,160,231,252,73,112,1,208,214,7,218,214,113,5,176,
+57,208,222,217,121,242,15,222,7,201,109,252,91,54,190,226,165,203,49,19,189,59,70,121,108,114,44,184,8,172,92,176,
+37,163,209,175,50,233,101,160,124,166,227,40,160,109,68,181,245,198,116,64,249,109,70,160,125,192,181,253,148,182,161,154,
+10,132,156,53,46,59,54,37,255,253,147,163,165,36,12,144,23,103,193,148,99,129,182,124,105,85,206,61,193,189,141,129,
+202,146,1,41,123,57,66,188,244,13,159,159,130,118,121,248,97,238,255,12,92,87,246,248,96,99,109,37,202,163,218,50,
+109,105,176,26,88,17,180,202,171,220,170,132,252,27,43,255,64,190,187,174,18,214,246,161,145,228,171,73,137,214,250,224,
+87,64,223,83,202,90,239,210,187,237,55,224,0,151,35,176,208,199,66,158,105,140,221,182,252,249,6,88,9,168,30,85,
+5,57,3,35,245,46,247,54,107,77,82,43,74,95,109,161,118,24,88,78,52,53,113,214,111,151,94,39,66,199,128,93,
+93,126,149,59,105,201,159,235,97,225,46,64,121,180,27,159,125,232,22,33,122,135,174,74,254,187,186,91,1,58,28,51,
+96,6,2,48,64,161,180,25,40,74,94,64,241,98,1,204,28,75,5,122,143,5,69,205,162,127,122,172,0,125,161,18,
+12,144,39,94,2,121,68,157,171,150,30,50,64,226,13,204,76,226,184,4,8,189,164,94,101,198,3,64,219,46,196,225,
+12,61,254,144,123,173,102,145,115,43,181,104,9,253,138,192,51,174,122,152,175,26,131,38,45,38,3,199,129,34,102,251,
+41,189,181,53,204,249,64,51,215,231,3,227,131,68,233,31,187,227,184,24,216,29,132,156,97,122,85,35,15,62,239,45,
+3,164,237,204,224,92,208,110,22,250,43,220,215,32,79,169,5,27,27,203,209,111,241,255,109,144,68,84,151,43,117,220,
+234,106,28,233,162,21,56,42,135,180,125,218,227,160,159,228,3,34,115,24,208,160,185,165,203,12,192,187,234,119,42,251,
+180,237,85,94,81,189,238,16,208,229,88,56,184,162,25,80,154,54,96,2,206,183,0,151,131,144,117,116,212,117,85,126,
+69,104,69,83,87,73,253,226,5,156,14,138,168,155,163,182,180,162,58,224,241,64,171,19,199,228,249,74,38,98,31,25,
+221,152,22,156,159,4,66,188,175,80,83,74,209,0,149,197,12,212,142,129,172,51,136,122,78,20,197,136,102,133,252,163,
+0,67,222,67,167,102,186,237,95,128,238,1,149,232,254,41,246,235,99,151,218,154,35,244,140,141,57,209,125,48,97,252,
+178,40,251,173,55,60,3,164,217,147,104,157,41,135,102,173,210,240,86,47,57,8,12,236,85,179,212,167,9,168,243,13,
+116,29,201,115,189,91,59,157,228,163,147,184,63,9,208,140,176,118,179,201,219,169,105,188,167,89,167,107,128,235,26,47,
+250,188,55,12,144,190,10,120,21,240,125,16,98,86,185,20,190,0,110,2,87,128,75,193,115,96,64,200,111,241,105,162,
+99,131,251,123,241,112,47,246,234,61,170,206,70,205,56,254,1,200,243,76,44,141,62,233,122,190,33,28,254,90,186,205,
+0,233,160,15,120,31,8,214,2,173,102,246,105,37,215,65,224,95,160,74,242,71,140,85,252,146,200,215,146,56,178,155,
+98,24,136,202,67,138,131,113,199,244,44,114,77,239,189,201,192,15,129,234,68,90,45,209,111,162,143,102,235,189,172,50,
+246,152,198,248,247,91,68,203,20,31,184,214,202,211,159,131,159,1,173,70,76,250,130,84,254,84,121,168,246,165,206,85,
+71,19,98,255,19,112,110,233,79,6,190,71,180,54,7,95,5,85,89,121,131,169,45,69,117,207,191,182,188,91,239,27,
+43,18,125,213,137,66,212,205,197,164,218,245,239,130,15,129,234,233,58,127,20,168,44,121,21,168,44,209,234,119,189,239,
+134,131,41,193,156,64,255,133,110,137,234,128,63,6,42,19,149,223,101,175,165,28,12,40,61,254,0,22,40,135,57,99,
+172,208,42,26,245,107,168,190,166,60,156,87,86,69,193,159,243,42,177,127,51,96,6,186,192,0,149,233,41,64,210,143,
+73,226,52,145,104,70,193,63,186,96,254,152,32,8,239,15,64,179,177,66,139,26,11,150,138,48,64,226,223,17,32,3,
+156,92,145,232,246,181,153,164,163,102,35,253,31,8,245,92,75,207,205,96,113,208,145,59,185,137,160,253,172,67,201,109,
+40,26,208,219,209,0,59,40,148,129,40,29,206,200,153,176,154,45,168,111,190,29,1,190,85,164,193,232,143,243,163,142,
+154,33,175,217,168,121,158,141,93,165,211,210,59,6,224,127,98,160,186,203,135,160,157,252,135,155,170,171,245,206,216,132,
+33,203,198,8,91,114,84,93,48,169,200,109,158,9,24,9,45,180,179,161,12,192,187,102,184,207,14,180,157,99,156,126,
+19,242,127,19,112,55,8,221,70,64,101,233,228,76,44,82,231,153,165,64,6,224,120,92,160,239,216,232,253,213,169,220,
+195,201,24,209,10,87,125,139,224,111,96,93,176,48,24,6,190,6,46,2,90,89,165,50,228,175,160,192,24,88,117,55,
+24,80,26,70,88,48,74,211,199,56,230,169,239,224,189,116,162,157,6,66,76,18,235,70,146,20,30,6,92,196,105,174,
+111,5,142,200,153,90,170,155,191,10,46,1,251,130,101,64,172,191,99,92,26,220,106,213,254,90,224,88,160,239,216,36,
+93,97,140,211,220,114,53,26,84,94,118,180,215,14,138,101,128,52,56,8,116,51,237,9,174,165,232,219,95,154,120,178,
+55,88,7,204,6,226,188,173,235,121,229,145,98,217,180,118,51,96,6,130,48,192,147,62,17,80,129,16,82,94,70,217,
+176,32,6,166,84,66,184,87,134,140,72,131,46,173,8,176,148,156,1,210,235,178,134,52,203,122,58,102,6,125,201,163,
+219,247,230,145,128,115,0,149,39,33,68,229,220,111,65,92,217,233,200,95,131,219,41,57,87,131,32,132,200,142,1,27,
+58,26,96,7,133,50,64,58,104,48,228,233,140,137,250,26,254,78,5,154,49,216,19,33,108,229,163,227,64,214,206,13,
+149,151,61,177,221,129,14,116,150,107,155,61,109,173,210,169,113,248,6,110,190,81,21,206,148,167,192,36,64,29,111,105,
+228,121,28,87,37,154,125,101,39,188,127,11,156,14,182,83,196,56,234,221,171,237,67,84,206,169,115,188,14,50,130,72,
+122,37,118,129,57,27,126,213,41,249,3,240,56,72,250,222,82,157,233,10,240,125,48,214,42,84,174,197,229,205,111,56,
+215,150,202,154,156,81,96,44,172,186,27,12,144,134,90,53,172,180,212,96,71,191,138,218,55,173,86,225,118,131,230,210,
+132,1,15,122,142,5,245,75,93,4,178,136,202,20,109,65,123,1,216,24,196,58,115,199,179,65,215,116,156,107,39,152,
+115,64,168,118,33,170,90,202,241,220,201,109,191,21,164,99,64,156,71,88,136,227,53,96,52,232,165,232,61,120,27,216,
+26,204,14,98,251,134,30,119,231,94,94,121,19,5,51,129,116,164,217,181,25,48,3,221,101,128,135,244,190,188,79,123,
+131,127,21,114,151,117,55,6,99,135,134,13,183,55,216,20,234,244,173,177,67,242,149,50,49,64,66,159,2,146,54,12,
+91,229,11,117,90,12,43,83,188,234,108,11,105,241,239,86,9,149,242,250,83,184,223,52,45,151,248,105,172,32,29,157,
+50,204,86,206,85,78,206,47,221,150,222,50,64,26,168,163,64,21,214,164,242,62,14,175,7,219,128,222,26,79,232,178,
+33,194,141,28,179,136,202,187,158,199,163,174,6,192,253,170,96,100,135,132,211,59,77,29,234,149,233,236,193,86,229,203,
+191,131,180,242,0,30,234,154,29,122,22,111,56,159,20,40,189,180,146,65,179,150,55,5,154,121,252,46,168,139,124,68,
+68,53,176,189,58,208,150,58,150,192,12,192,235,84,96,111,160,129,233,36,162,21,54,90,137,184,6,152,168,147,57,184,
+81,185,35,183,251,233,220,82,45,6,162,244,83,26,174,13,52,112,167,250,86,191,203,165,68,176,90,9,85,144,181,226,
+33,194,177,25,19,253,19,252,157,7,230,146,158,110,9,97,237,4,238,0,31,131,34,68,117,192,83,186,21,31,135,243,
+25,3,112,174,252,248,13,240,48,232,149,124,72,192,170,23,107,247,132,121,65,252,140,180,59,170,93,17,66,86,64,137,
+179,131,25,48,3,101,101,128,7,116,203,16,79,122,164,67,51,102,214,43,75,92,177,69,246,132,22,237,79,111,41,33,
+3,36,244,254,32,239,32,142,42,97,107,151,48,122,181,50,137,52,136,43,40,27,112,174,74,76,30,81,158,184,5,44,
+5,82,243,40,63,13,24,198,121,94,123,80,49,32,42,123,83,219,99,15,97,25,32,13,150,3,111,15,164,72,251,31,
+117,182,239,11,102,0,99,242,68,88,107,210,107,107,176,101,53,206,213,136,77,43,234,40,73,31,176,125,228,102,0,222,
+53,171,83,157,14,157,222,91,47,226,70,91,8,229,14,179,91,10,176,85,229,173,6,9,211,138,58,239,186,101,166,195,
+137,24,128,243,13,129,6,110,142,0,154,205,249,24,168,139,104,32,95,179,183,53,195,122,17,48,53,240,55,86,2,62,
+29,240,169,119,230,76,224,31,32,73,231,188,38,187,140,0,154,121,60,121,64,83,172,170,68,12,144,182,99,234,82,156,
+79,12,84,47,190,15,20,213,33,142,234,82,137,6,143,127,14,74,148,42,189,51,69,60,0,13,196,38,169,147,227,108,
+144,168,204,208,234,45,149,223,3,249,170,219,49,33,220,85,128,6,230,146,148,113,56,75,37,202,43,191,3,99,158,153,
+110,199,175,110,225,193,245,175,65,150,122,44,222,114,203,203,104,208,251,114,121,144,40,63,199,238,56,46,4,66,136,234,
+68,117,75,246,202,198,87,105,53,4,243,241,127,71,112,38,184,7,168,94,127,57,248,35,208,0,229,32,247,149,141,120,
+93,13,39,1,23,4,89,58,126,240,54,72,212,9,241,64,217,120,196,166,121,64,232,202,224,235,101,139,167,237,25,152,
+149,190,13,105,173,74,92,94,249,149,249,236,61,3,36,98,252,114,201,187,178,78,229,155,94,96,177,190,220,145,67,215,
+227,32,132,168,195,44,183,61,86,144,143,1,210,96,90,160,173,88,134,138,202,147,183,192,53,224,151,96,32,15,229,11,
+45,188,239,216,174,232,56,130,99,90,81,60,245,209,96,75,151,25,128,247,117,65,167,6,191,210,231,111,93,54,45,119,
+112,216,124,21,200,34,123,225,41,119,248,86,144,156,1,248,158,0,104,75,181,81,64,51,63,179,148,35,120,171,156,60,
+143,197,167,1,117,164,46,9,38,78,206,154,93,166,97,0,110,231,6,151,128,36,109,50,117,226,158,0,212,134,43,229,
+123,55,77,220,237,182,53,3,113,250,114,220,30,220,13,234,38,39,16,97,231,241,40,139,192,197,68,224,223,32,139,220,
+138,39,13,22,7,107,239,181,206,185,237,239,96,195,215,193,181,64,245,183,144,162,178,113,115,224,60,211,62,9,50,221,
+141,121,141,142,154,184,23,106,226,38,170,18,137,250,44,52,144,253,11,144,186,62,130,159,56,239,79,199,121,167,182,5,
+78,58,138,58,252,51,113,105,79,221,103,64,105,21,65,147,34,126,11,238,7,173,68,91,66,30,7,150,2,46,79,186,
+159,92,249,66,36,209,166,0,143,130,188,162,25,2,251,231,179,166,56,223,178,45,111,4,155,248,255,89,113,22,91,115,
+90,6,72,31,205,224,74,210,56,108,146,148,131,46,121,235,188,180,228,23,224,158,20,137,95,68,107,112,174,242,37,171,
+168,194,187,119,104,19,209,121,110,86,131,134,248,211,50,252,208,230,89,95,74,6,148,6,224,138,33,105,163,124,183,27,
+152,44,165,186,158,56,199,206,248,153,57,126,72,60,146,254,221,178,39,134,215,60,80,18,231,166,4,9,244,28,110,230,
+175,10,85,216,170,188,184,1,200,210,0,214,115,183,140,116,88,186,199,0,124,127,11,60,10,84,143,234,180,58,12,39,
+165,22,117,156,9,202,75,234,200,208,214,92,90,113,51,18,40,142,154,28,162,213,55,7,130,173,192,23,193,184,221,99,
+187,94,33,193,173,202,131,197,129,120,239,148,183,116,255,17,176,9,152,16,196,239,181,122,145,86,163,216,146,198,155,2,
+205,20,14,221,225,141,202,82,139,202,39,117,162,77,15,6,242,121,141,146,189,101,84,225,98,11,144,69,212,222,43,221,
+55,4,177,105,115,240,88,150,8,181,241,243,4,247,212,81,223,146,71,223,200,198,128,56,141,160,149,93,26,84,233,150,
+188,75,64,23,130,239,129,216,134,212,145,104,244,203,185,58,234,243,202,137,40,72,109,135,61,244,134,1,165,21,208,164,
+153,235,64,82,121,8,135,107,131,222,24,93,194,80,171,178,28,255,0,184,155,47,39,127,111,226,127,238,113,199,29,247,
+181,156,122,10,243,142,109,187,147,57,127,64,0,195,2,6,242,35,116,29,21,80,159,85,101,100,128,180,93,10,175,135,
+131,16,207,221,131,25,205,176,183,98,24,248,37,106,39,204,168,90,43,231,118,5,199,100,244,223,206,219,85,220,252,94,
+59,7,9,239,77,155,208,157,157,21,207,128,38,35,124,1,44,24,5,165,142,61,109,177,248,251,232,127,85,14,215,99,
+232,143,51,24,59,94,6,63,246,146,131,1,222,93,123,225,125,153,14,42,62,229,254,25,224,209,14,238,202,118,123,79,
+12,234,248,61,139,38,70,191,65,157,237,182,38,215,125,169,32,6,200,135,147,160,122,27,48,59,80,61,170,76,173,185,
+143,177,231,109,240,14,248,8,188,23,65,109,14,217,26,223,255,132,115,137,220,232,154,68,71,93,87,89,254,46,144,31,
+225,37,160,231,233,9,242,154,158,47,75,1,12,144,175,98,173,43,115,114,8,88,24,40,45,90,137,210,74,117,171,157,
+72,151,210,237,240,208,202,104,95,79,199,64,67,190,88,11,159,122,7,46,1,42,243,237,183,116,177,109,233,250,113,238,
+28,68,62,63,178,165,139,250,222,216,62,69,212,71,227,54,206,59,207,113,254,159,20,126,187,229,244,68,2,18,246,3,
+138,219,84,32,175,204,133,130,19,193,119,243,42,178,255,177,24,208,59,234,68,176,62,232,70,187,232,101,194,249,55,80,
+91,243,97,202,4,14,217,69,254,27,202,88,213,145,242,202,176,188,10,236,191,171,12,108,78,104,202,75,179,166,8,85,
+253,30,199,131,125,128,234,106,181,151,16,15,78,161,36,242,144,175,75,0,91,230,12,68,21,237,37,41,52,212,112,42,
+187,124,19,3,31,1,241,11,63,175,189,26,60,176,244,152,1,242,241,170,152,112,30,152,48,144,41,55,5,210,99,53,
+249,25,88,14,21,43,102,84,243,2,254,54,3,234,20,40,66,238,13,164,116,58,244,104,48,199,219,53,6,34,52,139,
+154,168,226,123,29,126,191,3,126,8,102,2,234,248,187,20,84,77,148,55,213,57,153,182,1,226,15,123,119,49,165,121,
+119,105,0,103,91,208,169,78,162,142,235,191,119,209,180,16,65,253,21,37,11,101,84,84,84,153,157,209,156,254,246,70,
+62,84,175,193,183,192,202,96,210,40,182,186,214,109,81,175,255,251,64,229,174,240,26,24,5,222,2,79,129,167,129,38,
+142,141,4,234,248,208,64,140,202,184,143,40,191,229,215,82,78,6,148,183,142,0,243,128,118,249,234,3,238,159,6,118,
+37,61,95,225,104,233,95,6,22,35,106,123,3,213,183,66,181,221,80,85,9,185,21,43,213,102,253,27,249,92,234,174,
+187,183,0,0,32,0,73,68,65,84,121,222,2,3,188,135,98,30,212,166,255,98,252,39,193,81,239,132,201,193,68,96,
+24,184,24,93,223,131,91,189,75,202,38,123,96,208,245,224,47,96,209,0,198,137,171,77,193,169,1,116,89,197,231,12,
+156,207,105,55,6,200,84,167,209,36,173,3,129,234,58,69,136,202,152,169,114,42,142,235,133,57,213,216,123,40,6,26,
+202,203,161,42,247,225,194,78,64,101,98,90,81,127,148,182,18,84,127,212,201,177,103,202,210,248,212,199,178,48,64,34,
+13,3,218,102,32,171,104,249,243,185,101,137,79,82,59,176,89,123,51,135,148,245,147,134,109,119,197,48,64,98,190,19,
+50,65,209,181,97,49,150,90,107,26,6,72,135,73,192,45,25,211,246,105,252,125,5,12,52,14,116,12,45,145,238,247,
+56,134,16,53,106,45,102,32,55,3,100,70,229,249,25,64,150,237,0,180,250,205,210,37,6,72,163,27,65,18,185,23,
+71,227,130,46,89,150,61,24,217,8,180,133,82,158,237,28,118,204,110,129,125,166,97,32,74,175,153,57,62,12,186,189,
+173,145,194,211,150,103,111,129,23,129,190,141,113,42,208,183,200,150,7,169,247,134,79,19,119,187,45,142,1,210,78,229,
+192,120,64,91,117,168,62,214,73,180,37,210,158,192,29,70,197,37,75,207,52,147,174,113,93,124,1,206,79,1,122,230,
+235,38,234,127,248,22,208,128,131,101,8,3,240,18,231,17,13,196,164,145,203,113,188,43,184,15,220,15,206,6,90,97,
+90,90,193,190,25,193,89,64,219,152,230,149,123,74,27,209,138,24,70,2,196,121,111,82,206,181,181,89,167,237,63,243,
+164,153,116,107,91,188,29,192,100,160,16,150,164,55,194,75,28,243,138,250,98,10,177,211,74,179,49,160,244,104,130,35,
+185,150,165,237,143,183,65,50,146,127,250,172,193,152,48,178,89,105,95,133,49,64,226,232,99,112,89,69,157,151,149,237,
+240,193,246,247,179,70,188,137,191,107,10,75,36,43,110,203,0,105,49,23,120,189,73,154,228,185,228,45,54,218,178,222,
+157,155,36,224,248,224,23,32,75,37,87,21,36,205,116,47,84,8,67,47,184,80,141,81,15,228,20,154,90,245,81,30,
+229,203,89,56,102,233,148,253,117,125,152,234,109,76,73,159,45,65,210,242,109,159,40,93,123,107,116,130,208,35,59,175,
+226,152,85,212,177,63,103,130,160,236,36,39,3,240,172,119,152,58,148,142,1,89,202,11,188,37,22,117,94,52,226,53,
+254,63,4,20,246,166,96,120,206,232,216,123,137,24,32,61,149,183,214,2,73,6,113,52,169,240,87,160,244,59,89,148,
+136,226,74,153,66,218,42,63,236,1,158,5,253,34,154,68,168,188,155,164,227,76,223,184,155,6,84,42,221,186,101,172,
+120,137,48,156,227,27,32,141,104,240,95,254,245,97,239,137,116,94,118,137,236,149,205,219,131,188,19,2,245,94,221,175,
+65,103,217,163,95,58,251,26,184,59,153,243,34,101,4,202,119,233,6,1,132,163,252,165,190,148,119,65,94,81,159,113,
+55,204,118,24,9,24,80,90,52,129,234,210,31,131,80,162,137,7,147,131,129,176,18,152,101,39,221,98,128,68,217,13,
+168,224,207,34,35,186,101,103,81,225,16,105,141,88,134,146,50,46,221,45,138,186,82,233,37,1,243,172,40,107,149,254,
+241,30,235,165,138,107,157,140,33,97,244,210,88,8,60,209,42,145,218,92,191,135,123,139,128,194,41,83,24,224,25,144,
+87,244,226,157,165,112,131,29,64,45,24,32,47,41,95,78,8,178,52,14,215,174,5,73,37,136,36,233,147,164,131,19,
+103,3,43,91,102,230,88,137,202,52,118,110,4,62,4,89,229,142,18,36,79,45,76,32,129,52,27,116,51,160,193,179,
+172,109,2,188,38,22,205,242,211,108,235,129,129,27,142,83,3,53,20,213,249,230,189,27,250,36,215,145,150,90,137,243,
+29,144,164,211,94,245,248,157,65,221,182,215,234,147,212,238,28,13,210,118,37,112,61,72,50,224,129,179,82,137,38,107,
+105,16,70,29,153,199,130,253,192,250,64,43,6,85,118,29,0,146,200,121,56,170,196,59,188,115,138,134,119,17,115,195,
+81,147,86,210,202,190,225,45,42,86,35,17,28,200,11,209,81,3,156,122,7,231,17,181,151,191,0,156,199,50,36,93,
+196,219,25,28,71,131,34,68,245,253,223,131,73,64,6,11,211,123,81,56,64,131,155,121,243,22,42,254,119,27,72,111,
+132,125,20,194,128,210,98,8,118,231,127,200,65,28,212,13,200,207,249,117,153,82,72,42,102,84,74,130,124,21,100,121,
+168,149,65,14,203,24,108,233,188,17,151,60,29,13,120,31,36,105,62,38,85,58,46,170,102,16,204,47,11,210,206,216,
+25,148,96,109,254,188,81,53,62,250,205,94,210,102,92,112,8,72,91,161,186,3,63,3,131,56,28,11,167,69,97,128,
+167,64,8,249,82,225,6,59,128,90,48,64,102,84,190,252,82,134,76,169,78,22,125,195,192,82,48,3,240,172,173,101,
+146,202,241,56,172,76,69,26,91,53,152,158,71,142,43,152,126,171,143,24,32,145,84,151,122,40,74,172,162,6,114,244,
+142,60,17,172,3,230,1,179,1,111,159,213,167,185,144,180,85,89,245,13,48,2,116,18,109,167,230,65,156,254,205,11,
+211,146,190,255,0,26,172,43,187,168,254,163,65,155,59,193,73,96,87,176,28,152,18,12,74,33,253,143,48,19,199,81,
+160,147,168,207,229,155,96,144,30,255,249,156,1,113,19,65,252,167,149,173,63,215,84,205,51,34,172,1,172,143,210,70,
+124,136,123,229,217,1,30,171,201,66,239,172,134,55,13,166,169,12,8,45,42,31,254,10,166,7,113,30,239,74,68,27,
+194,211,123,54,175,120,32,167,43,169,150,44,16,18,115,76,94,226,92,147,11,66,246,105,55,230,21,79,64,72,150,36,
+221,113,69,202,104,246,221,227,141,41,148,240,92,13,189,105,186,99,101,119,66,33,62,23,36,140,123,18,103,255,236,142,
+213,14,133,196,208,76,63,45,103,47,74,70,154,229,222,49,64,162,234,229,52,23,120,58,69,2,171,3,234,162,110,91,
+77,152,178,85,251,250,135,144,111,118,219,126,135,215,159,12,144,25,149,47,191,154,33,83,106,224,116,142,254,100,165,60,
+177,130,99,117,114,38,93,45,245,62,110,23,6,3,149,246,242,196,226,115,75,98,219,162,163,26,195,121,6,4,228,119,
+229,207,181,251,172,40,6,224,121,113,160,25,168,121,210,11,239,99,137,244,169,19,255,104,176,49,88,1,204,13,188,226,
+162,168,196,44,145,94,210,89,229,213,3,160,147,168,12,220,19,56,95,148,40,253,66,153,66,186,106,224,54,239,160,62,
+42,10,19,77,78,125,22,92,1,182,3,75,128,129,247,172,142,157,36,114,123,32,199,36,114,123,39,125,117,191,15,137,
+226,126,26,144,101,48,99,205,170,243,23,197,255,100,142,121,68,131,96,165,173,43,150,41,141,98,158,162,227,94,28,179,
+76,112,199,91,75,81,221,253,4,48,119,175,226,77,216,202,11,51,131,16,43,53,110,151,62,75,57,24,136,210,86,233,
+251,11,16,98,235,60,212,52,149,55,184,58,5,40,71,196,235,110,5,9,113,124,211,100,106,125,81,47,212,190,156,29,
+73,188,84,184,133,146,167,235,158,183,186,17,127,18,107,13,80,228,32,142,242,195,181,221,136,139,195,104,206,0,252,235,
+197,180,27,80,167,114,18,81,126,56,24,52,87,88,224,85,133,9,158,0,33,100,201,2,77,181,234,26,49,64,102,84,
+190,252,81,134,76,249,36,126,106,196,84,111,162,10,199,119,165,72,155,91,123,99,101,242,80,149,103,34,104,118,114,154,
+1,248,102,52,60,153,60,100,187,204,202,0,196,79,13,254,15,132,250,198,155,58,10,30,4,106,99,108,3,214,2,94,
+221,151,53,129,42,230,143,180,142,203,128,89,57,87,199,248,167,160,157,104,246,168,234,109,165,254,32,121,197,146,161,20,
+230,146,166,227,131,227,64,209,109,53,130,72,37,154,109,175,1,230,203,192,14,96,9,16,231,219,212,220,225,87,239,59,
+117,114,117,18,61,11,27,165,14,160,102,30,224,72,105,161,129,255,78,101,7,78,198,146,111,84,157,46,98,20,231,197,
+60,131,159,26,140,24,88,249,81,117,62,138,182,191,129,239,141,56,15,189,98,240,110,116,126,175,232,56,116,210,31,197,
+113,33,142,33,228,54,148,116,10,210,247,187,196,128,210,2,172,7,94,3,69,203,202,4,208,165,152,149,43,152,82,125,
+180,145,68,208,222,247,63,72,72,145,62,248,126,31,216,114,220,113,199,237,203,153,36,196,235,37,56,121,155,56,78,153,
+144,147,118,206,102,107,119,211,247,242,51,64,90,205,135,150,179,65,209,91,114,220,153,223,90,107,200,193,192,228,248,85,
+89,53,94,2,29,15,224,102,47,112,78,2,183,69,57,9,241,118,27,141,113,175,21,101,160,245,214,135,129,134,202,214,
+34,25,98,253,66,6,63,246,210,129,129,134,52,145,203,237,192,226,29,188,196,183,85,182,28,29,255,169,192,113,127,108,
+156,51,167,157,170,119,90,138,103,96,126,130,248,26,200,83,255,253,24,255,154,196,116,55,184,11,60,6,110,163,110,237,
+137,77,16,81,67,153,138,56,255,17,104,69,221,184,109,226,175,250,206,25,96,119,242,202,7,109,220,249,86,197,24,224,
+93,183,32,38,235,157,165,178,165,12,50,10,35,212,135,113,11,56,11,60,12,6,132,188,23,159,102,61,30,128,199,169,
+19,120,126,128,176,148,223,45,157,25,88,30,39,105,19,70,229,73,63,125,171,248,151,196,231,95,96,98,144,86,228,103,
+51,112,112,90,143,53,117,255,245,136,43,189,187,66,200,203,40,57,8,252,153,103,62,68,223,64,102,155,26,218,29,161,
+182,109,127,53,179,49,246,88,4,3,243,162,116,87,48,109,17,202,135,232,212,64,249,53,67,174,213,226,111,105,6,114,
+120,160,103,134,241,195,65,167,37,236,42,120,212,40,251,33,133,208,253,28,251,93,174,36,130,33,70,205,39,128,227,233,
+224,204,157,177,5,228,24,184,85,197,228,24,144,165,98,147,214,162,155,211,122,176,251,160,12,168,3,122,161,54,26,213,
+121,244,20,80,195,232,72,240,2,232,165,76,30,32,240,241,209,49,19,120,42,128,46,171,48,3,98,96,217,12,52,104,
+96,212,82,44,3,59,161,62,105,71,197,235,184,61,174,88,115,130,105,87,153,29,162,46,117,114,48,139,172,168,29,3,
+26,200,81,167,107,22,121,5,79,143,2,13,186,169,147,244,74,234,190,79,115,180,212,144,129,168,195,72,19,111,212,1,
+185,33,80,125,166,149,168,141,121,53,216,133,60,243,78,43,71,190,94,61,6,200,7,63,199,234,125,192,140,61,180,254,
+35,194,214,128,178,58,157,46,4,87,1,77,76,29,135,252,166,67,46,137,242,186,116,44,13,190,159,80,217,41,9,221,
+217,217,56,227,168,99,61,173,168,188,153,46,173,167,18,187,87,222,253,55,248,110,70,27,87,193,159,7,114,58,147,55,
+27,78,84,191,86,255,104,94,209,123,237,38,240,125,202,153,151,242,42,11,236,127,238,64,250,252,190,14,68,100,32,53,
+91,160,231,203,129,116,117,82,179,64,39,7,253,122,191,52,3,57,16,124,40,248,66,7,162,63,225,254,241,96,7,10,
+162,186,204,146,218,141,248,134,232,124,16,181,154,217,232,129,28,49,17,80,168,56,107,21,153,94,182,157,6,33,67,133,
+170,78,10,75,239,24,88,145,160,39,107,18,188,6,112,52,235,87,179,224,46,5,239,133,104,152,161,39,175,180,235,180,
+200,171,219,254,205,64,86,6,102,207,224,81,157,30,150,226,24,248,61,170,135,165,80,127,94,10,183,189,118,186,45,6,
+204,144,211,8,205,102,172,82,156,115,70,183,167,222,53,113,64,72,42,106,31,104,70,230,131,224,102,112,18,239,223,71,
+56,90,204,128,24,80,167,182,6,114,38,214,159,54,162,78,118,117,248,151,173,179,171,141,201,190,213,140,129,134,65,13,
+221,62,13,172,7,186,213,78,83,152,177,188,207,137,38,160,106,224,70,125,24,122,143,4,25,184,145,158,88,134,196,247,
+143,92,79,50,137,235,113,220,29,24,235,240,177,35,3,179,118,116,209,220,65,47,242,93,115,75,50,94,85,123,182,33,
+143,109,143,154,85,193,36,25,212,173,144,193,79,223,123,105,224,86,113,85,31,195,9,96,94,253,201,41,170,27,157,74,
+250,109,158,83,79,81,222,191,18,72,177,87,228,4,34,50,171,154,134,60,172,85,56,63,201,170,39,131,191,175,102,240,
+99,47,161,24,32,225,87,3,218,143,184,157,104,127,72,141,238,213,78,136,119,136,143,128,137,219,61,106,71,94,193,17,
+22,167,64,251,26,119,75,6,102,110,21,28,45,171,111,195,0,9,125,53,104,220,35,89,223,233,210,158,193,91,131,105,
+64,188,143,112,27,45,221,185,21,217,18,98,127,82,125,20,49,107,3,166,59,145,117,40,165,103,160,225,217,152,145,115,
+61,55,105,68,91,141,122,111,237,2,82,25,94,85,102,233,155,124,207,131,164,162,111,132,169,238,86,128,69,97,85,98,
+163,242,91,146,111,5,224,172,173,92,30,214,50,107,107,197,0,169,160,239,227,116,42,35,244,30,86,253,248,117,112,45,
+248,89,43,125,190,94,95,6,200,23,139,131,135,65,39,81,59,115,253,250,50,213,95,49,39,45,245,94,91,26,232,35,
+216,141,117,118,254,22,46,250,22,136,190,217,160,114,108,42,80,56,185,10,35,194,154,28,59,149,157,56,25,144,63,21,
+110,88,159,4,0,91,115,128,172,223,85,234,187,119,19,92,220,50,144,131,210,255,40,111,206,211,39,217,34,88,52,224,
+36,126,126,117,60,53,61,173,77,125,40,191,238,14,130,217,25,74,145,108,138,144,228,221,140,211,142,178,51,46,66,153,
+103,61,25,24,16,255,17,244,222,235,166,232,125,155,193,226,234,123,233,249,138,28,136,159,2,26,15,1,19,181,161,115,
+36,247,214,102,52,249,142,54,110,250,249,214,27,68,46,239,76,82,241,163,45,161,44,129,24,32,239,106,21,217,54,96,
+188,64,42,147,168,241,64,78,18,150,138,117,163,217,117,146,209,224,81,240,103,112,17,120,85,51,150,74,38,90,229,56,
+101,0,155,62,68,199,11,1,244,88,133,25,16,3,223,4,105,235,31,143,242,124,121,198,85,113,249,71,229,88,154,193,
+218,103,72,143,203,138,51,39,168,102,197,109,234,0,26,79,14,160,195,42,194,49,160,149,249,247,1,173,136,62,186,132,
+239,223,112,49,181,166,212,12,68,13,123,109,105,164,149,134,243,119,80,160,250,220,233,224,130,14,238,124,187,58,12,108,
+138,169,127,0,115,116,201,100,229,33,173,232,210,202,155,35,40,143,122,181,157,227,254,132,159,100,5,136,250,86,246,6,
+150,100,12,44,140,179,36,171,156,154,105,155,170,217,197,138,95,59,27,251,151,205,16,7,229,205,85,192,136,12,126,235,
+224,101,103,34,169,21,164,121,229,61,20,236,7,202,62,88,27,162,127,83,92,245,170,188,85,216,150,193,12,108,57,248,
+111,225,255,198,47,60,132,146,6,144,182,35,165,136,104,252,10,165,243,182,81,252,95,238,173,75,133,232,217,54,110,250,
+253,214,115,68,48,68,65,183,104,191,19,213,173,248,209,64,60,138,176,182,2,221,238,185,255,168,91,113,116,56,45,25,
+80,167,192,59,96,20,208,246,5,122,62,203,42,211,96,88,25,202,249,178,242,99,187,122,195,192,154,4,155,182,236,252,
+71,111,76,173,69,168,139,19,203,53,82,198,180,244,171,83,162,142,220,121,136,87,214,189,220,27,41,121,147,63,167,54,
+94,240,121,161,12,116,154,32,115,51,161,171,30,246,111,240,186,7,113,10,77,139,42,43,223,0,227,87,6,157,222,55,
+15,225,70,245,57,215,177,33,161,138,18,149,247,177,233,234,91,216,27,116,163,3,93,109,129,43,193,177,224,106,208,75,
+249,49,129,47,150,208,128,243,40,55,227,137,105,9,189,212,218,217,204,57,98,191,96,14,191,101,245,170,9,140,106,15,
+107,96,38,173,44,156,214,67,77,220,175,66,60,119,3,19,231,140,175,250,40,126,13,84,71,42,179,124,17,227,166,15,
+96,160,38,57,235,29,110,233,61,3,218,230,108,88,15,204,208,96,142,38,83,212,74,122,218,193,71,165,107,46,216,222,
+17,180,170,96,107,102,212,15,169,104,188,85,171,84,25,59,178,55,114,105,137,177,47,167,190,50,109,106,31,246,48,22,
+3,228,219,43,184,168,151,109,47,68,47,103,75,111,25,208,243,120,19,248,95,5,58,143,38,151,157,160,85,25,203,173,
+68,242,114,34,87,118,100,6,146,49,240,205,100,206,198,184,210,74,156,127,141,249,231,147,208,12,108,143,194,52,147,69,
+212,104,250,71,104,35,10,210,183,59,122,53,43,63,175,220,73,121,239,21,177,121,89,76,224,159,58,150,86,234,207,2,
+90,181,81,94,231,222,209,224,108,210,68,179,78,45,102,160,25,3,106,243,236,0,38,109,118,179,225,218,187,156,107,213,
+222,83,13,215,124,90,93,6,52,224,174,45,242,178,116,48,39,141,181,86,169,223,5,206,5,127,7,111,149,164,61,240,
+91,108,233,52,8,142,147,113,94,1,255,167,19,75,98,6,242,116,78,166,169,95,37,54,168,199,14,31,33,124,13,4,
+102,121,206,190,208,99,219,203,24,188,234,169,71,128,188,125,117,154,140,240,71,202,163,178,15,226,40,13,86,212,79,0,
+81,153,247,102,0,61,86,145,159,1,77,158,209,160,74,55,69,109,5,61,55,122,175,213,74,90,53,146,186,69,194,193,
+4,164,25,227,205,228,22,46,174,71,65,244,73,179,155,53,187,118,49,241,221,54,64,156,39,9,160,163,214,42,232,96,
+80,39,254,10,61,36,65,13,78,75,15,25,136,26,107,26,28,169,130,104,75,137,188,131,56,138,231,107,85,136,172,109,
+172,4,3,235,96,101,218,153,141,15,226,103,100,37,98,87,33,35,121,159,201,90,13,246,126,55,165,217,35,40,7,53,
+152,93,118,81,103,193,106,129,140,60,61,144,30,171,233,204,192,34,56,209,76,205,86,239,46,13,228,104,171,69,15,226,
+116,230,178,206,46,126,66,228,231,235,64,128,10,193,75,192,89,29,220,249,118,9,25,136,222,97,178,76,237,219,165,193,
+129,224,203,160,85,217,193,173,92,242,36,190,175,1,218,58,237,142,92,154,194,123,214,196,216,185,19,170,213,106,28,183,
+39,19,146,21,57,155,42,157,243,65,174,135,13,250,215,63,127,212,113,154,133,151,78,131,235,253,195,80,242,152,28,143,
+211,78,239,171,78,218,62,198,129,202,192,223,117,114,88,146,251,33,38,169,43,42,170,11,190,93,146,56,213,221,12,189,
+135,187,45,239,16,96,45,23,125,244,108,32,135,202,215,170,144,190,122,139,148,214,104,242,183,169,100,120,16,7,34,224,
+225,178,134,202,106,11,202,18,93,158,34,145,43,59,106,202,0,105,160,217,39,243,55,189,153,254,162,26,143,89,26,26,
+222,83,54,61,215,117,246,17,234,133,90,203,23,100,157,51,78,129,113,223,12,221,73,102,140,54,154,112,108,227,31,159,
+7,101,96,59,180,165,157,45,122,99,80,11,138,83,246,51,84,107,101,71,94,121,159,122,216,49,121,149,216,127,98,6,
+212,17,59,111,27,215,207,113,207,157,144,109,8,242,173,1,6,126,193,111,167,153,161,90,109,124,0,248,96,192,135,127,
+170,200,192,212,24,173,180,214,234,171,180,239,178,36,241,29,133,163,255,2,173,188,185,32,137,135,30,185,217,137,112,147,
+180,43,85,118,238,213,35,27,171,28,108,158,85,36,115,86,57,226,109,108,215,138,156,44,210,179,254,199,44,198,22,225,
+103,72,191,222,190,132,145,118,66,213,80,179,212,175,244,79,176,219,208,27,37,254,191,108,32,219,158,69,207,27,129,116,
+89,77,62,6,66,108,149,151,214,130,23,105,163,105,236,160,118,210,147,130,148,194,75,157,56,26,49,158,176,5,227,71,
+146,32,238,56,28,76,142,182,244,72,219,249,53,88,131,255,101,98,128,252,170,85,99,247,131,60,149,184,198,176,31,231,
+207,220,32,73,133,187,209,159,206,159,28,122,193,255,205,64,27,6,22,105,115,47,205,173,71,211,56,182,91,51,208,134,
+129,175,182,185,215,236,214,211,92,60,191,217,13,95,11,194,192,22,41,181,168,46,114,104,74,63,189,114,190,121,160,128,
+239,12,164,199,106,58,48,64,125,75,51,235,53,75,179,221,0,220,19,220,247,236,203,14,92,214,245,118,212,65,118,36,
+241,239,212,121,170,142,175,227,192,29,226,138,118,167,14,150,138,48,16,165,243,116,152,123,48,88,31,168,236,8,37,42,
+95,238,3,218,158,232,34,240,70,217,242,71,20,127,76,27,144,131,248,157,45,58,239,116,208,106,156,23,58,57,242,253,
+177,24,24,57,214,149,228,23,166,36,189,150,199,249,205,177,151,178,229,167,216,174,148,199,86,253,120,41,213,212,218,249,
+146,196,94,19,170,242,190,128,212,78,210,68,185,42,201,124,129,140,125,49,144,30,171,201,207,192,107,249,85,164,214,160,
+109,78,107,41,189,26,24,80,133,107,161,22,140,127,200,245,63,180,184,87,231,203,33,70,26,243,190,36,234,202,191,86,
+193,132,26,196,121,10,93,219,130,172,207,158,58,48,44,102,32,41,3,179,38,117,216,193,157,7,114,58,16,228,219,137,
+24,216,9,87,51,37,114,249,185,163,171,57,245,196,142,207,249,8,121,246,61,148,181,91,249,208,44,172,199,232,128,40,
+245,192,134,58,184,128,86,227,132,122,111,95,219,140,8,95,43,132,129,121,208,170,198,125,187,78,89,77,104,121,167,144,
+208,173,180,31,24,88,138,72,108,154,32,34,154,77,174,137,131,85,248,222,97,130,232,212,206,137,6,113,14,1,27,129,
+118,229,69,82,98,180,11,136,234,186,251,129,47,145,47,190,2,78,6,165,27,196,25,18,161,97,252,255,209,144,107,173,
+254,170,47,225,240,86,55,125,189,45,3,90,153,149,85,180,50,48,212,234,131,172,54,20,225,79,131,225,89,228,211,44,
+158,250,208,207,196,196,233,48,160,239,123,228,17,125,195,113,93,48,48,33,65,199,10,200,26,216,56,89,32,59,31,150,
+158,138,196,59,80,148,75,171,230,158,30,88,118,73,15,194,44,69,144,89,59,147,51,27,79,227,90,171,128,254,8,90,
+133,125,37,15,226,75,153,3,232,95,143,163,3,68,173,21,231,1,84,247,159,10,242,234,58,224,93,98,166,198,66,8,
+185,129,188,61,23,138,242,204,152,120,51,132,33,214,81,27,6,230,14,16,83,149,61,183,5,208,99,21,53,100,128,50,
+84,157,234,130,26,178,91,167,164,64,157,181,218,246,198,82,12,3,155,160,54,109,189,160,212,131,56,13,52,109,195,121,
+136,214,172,58,247,142,111,208,235,211,98,25,88,26,245,179,181,9,66,233,161,9,45,111,183,113,227,91,245,102,64,29,
+99,83,38,160,224,6,220,60,151,192,157,157,148,136,129,168,62,49,61,38,105,64,98,67,144,119,85,192,171,232,184,8,
+124,7,44,0,246,4,154,192,87,21,81,126,79,218,78,189,157,118,232,45,85,137,88,201,236,204,155,39,214,42,89,124,
+66,152,147,117,0,66,147,182,45,159,173,110,215,74,173,60,242,20,158,55,207,163,160,71,126,87,34,220,16,117,116,153,
+127,163,126,44,165,96,224,223,93,182,66,19,114,84,151,171,165,104,80,165,219,162,153,51,154,61,210,76,52,66,127,68,
+179,27,190,54,208,104,157,220,60,116,135,1,26,10,234,112,212,76,175,137,2,133,120,15,149,231,175,69,186,22,205,161,
+243,214,28,126,237,181,6,12,168,145,27,201,164,28,167,138,255,228,56,170,194,237,134,95,14,2,237,117,128,1,237,95,
+159,118,25,189,42,103,15,153,191,176,12,68,101,196,12,104,253,118,74,205,42,92,142,75,233,167,23,206,127,66,160,11,
+7,10,88,43,144,52,112,96,41,152,129,40,95,174,64,48,179,180,9,74,147,89,158,38,77,212,120,179,152,129,1,6,
+26,234,61,63,230,130,6,3,59,137,6,4,143,237,228,200,247,203,197,64,148,206,26,184,249,13,88,23,100,237,199,208,
+202,148,199,193,145,224,159,148,39,121,86,91,160,162,103,178,10,33,127,51,97,232,122,127,159,144,208,173,157,141,205,192,
+139,99,95,74,117,37,84,157,36,85,160,5,59,206,218,198,124,173,96,187,170,160,126,53,140,84,159,104,30,121,3,207,
+219,131,251,242,40,233,145,95,77,36,11,33,170,11,234,27,102,150,114,48,240,104,151,205,184,134,240,242,14,178,119,217,
+228,138,6,71,5,108,34,240,52,104,37,207,115,35,212,50,187,138,178,212,220,108,120,121,166,21,105,41,174,107,160,204,
+210,129,1,248,60,20,140,78,193,107,39,167,231,52,6,137,227,247,59,121,104,113,223,233,215,72,164,207,155,50,64,222,
+137,87,64,172,214,34,31,165,189,252,96,172,179,105,128,190,104,6,90,48,16,231,155,232,152,246,29,246,9,254,214,108,
+212,209,34,24,95,78,201,64,196,233,65,28,211,202,211,41,131,234,137,115,34,117,125,218,136,181,113,175,143,199,90,186,
+192,0,105,48,13,248,15,248,180,77,122,232,125,212,143,29,98,93,96,184,63,131,32,63,196,117,158,241,57,127,170,77,
+222,105,188,117,111,127,178,209,223,177,34,1,199,5,63,3,239,52,38,102,138,243,23,113,123,10,248,122,213,153,34,14,
+202,247,215,129,164,50,178,234,113,238,165,253,144,60,3,200,154,239,148,70,234,87,216,0,12,148,87,189,140,75,136,176,
+137,199,183,65,187,119,53,183,91,202,158,33,108,168,146,14,152,136,223,83,58,78,14,238,104,201,78,178,27,31,227,108,
+39,80,234,252,20,219,215,112,156,145,115,149,193,161,228,89,20,149,154,131,42,229,211,60,182,70,233,48,29,199,87,67,
+37,110,2,61,170,15,228,49,187,210,126,211,110,169,145,55,178,63,68,193,28,109,148,92,193,172,152,247,218,220,175,243,
+45,205,138,207,45,100,246,41,114,43,233,99,5,240,115,5,209,219,22,132,120,54,84,178,92,68,158,254,254,16,202,38,
+30,242,223,127,205,64,17,12,104,155,136,16,114,71,8,37,214,81,107,6,52,123,182,221,187,191,25,57,55,82,118,94,
+2,170,180,231,115,179,120,148,245,218,183,50,24,118,127,6,63,133,123,81,37,190,1,43,19,224,114,1,3,253,71,64,
+93,86,213,158,1,165,219,108,96,220,22,206,84,167,122,0,104,22,170,197,12,12,101,96,47,46,12,27,122,177,201,255,
+209,92,59,176,201,117,95,42,63,3,243,96,226,175,192,228,41,76,85,191,194,157,96,51,234,19,179,128,31,128,255,164,
+240,95,86,167,122,135,47,147,194,184,179,83,184,181,211,177,25,120,133,75,121,250,98,212,175,176,197,216,106,43,123,229,
+171,88,222,234,93,221,46,82,122,143,215,125,187,110,109,135,184,100,59,146,58,220,19,135,122,158,171,248,30,59,13,187,
+147,124,195,174,3,5,99,110,87,113,53,210,24,227,251,240,68,171,237,186,181,139,203,249,132,245,247,62,228,48,113,148,
+66,116,86,39,10,140,70,246,36,56,220,7,180,42,244,181,204,189,214,137,209,129,200,87,59,220,79,114,91,220,207,158,
+196,97,29,221,144,71,111,36,222,90,166,222,42,143,166,161,69,171,103,14,163,177,240,221,70,79,132,241,211,28,250,213,
+248,180,152,129,164,12,172,152,212,97,7,119,143,116,184,239,219,102,160,29,3,234,152,221,169,157,131,38,247,62,230,154,
+235,3,77,136,9,116,73,13,240,44,171,26,78,14,20,126,145,106,126,139,242,172,219,237,12,181,235,5,46,92,55,244,
+162,255,23,198,192,170,104,158,190,141,118,117,94,104,171,69,111,171,214,134,164,154,222,210,118,124,219,37,140,251,19,184,
+251,71,66,183,118,86,46,6,212,17,62,111,7,147,84,78,188,5,254,11,14,0,26,240,88,138,246,216,41,28,251,73,
+118,38,50,234,91,73,34,31,226,72,223,20,178,228,99,32,239,119,106,191,78,240,75,228,51,161,52,190,87,201,104,201,
+71,248,187,44,163,223,126,240,166,122,142,182,133,204,35,183,82,158,109,12,74,61,209,77,19,172,134,136,6,113,146,110,
+5,57,196,107,203,191,151,180,188,227,27,189,98,224,242,46,4,172,246,217,239,192,88,153,172,11,97,215,47,8,30,230,
+173,65,187,37,152,35,185,31,170,241,221,119,4,195,205,173,32,175,136,255,164,149,190,190,227,176,93,132,224,229,190,188,
+228,54,248,215,114,87,85,176,199,18,174,159,217,224,46,237,169,42,226,22,51,208,146,1,50,84,60,51,253,11,156,191,
+149,54,131,181,112,191,108,172,183,101,192,190,97,6,154,48,16,229,155,11,90,228,171,118,151,111,145,95,75,49,12,192,
+237,73,237,200,111,113,239,21,174,79,81,140,69,249,180,98,87,92,238,45,197,249,219,45,236,207,114,249,218,124,150,217,
+119,18,6,72,24,109,151,164,109,107,110,0,31,129,102,162,250,171,210,118,61,224,122,108,18,98,107,226,134,252,160,231,
+255,92,144,68,148,143,182,5,53,97,167,191,162,73,186,169,110,208,74,148,182,47,129,99,193,210,96,66,16,191,27,250,
+130,136,134,248,44,193,249,123,32,169,92,223,23,4,244,48,18,16,173,188,244,207,164,132,183,113,119,186,116,85,93,136,
+131,234,132,89,228,81,60,85,61,250,169,237,87,156,35,220,148,133,180,6,63,218,30,242,75,169,13,232,129,135,40,190,
+113,188,119,230,127,171,250,93,67,244,82,157,74,223,34,96,32,140,30,68,209,65,54,48,16,167,3,199,233,193,149,160,
+40,249,0,197,59,130,56,111,53,88,81,175,211,110,14,156,252,6,106,219,173,116,56,157,145,101,173,202,177,52,103,32,
+72,90,193,241,7,205,213,215,247,42,5,193,99,196,126,222,64,12,104,166,232,86,240,124,74,11,125,95,107,113,61,201,
+101,63,31,73,88,178,27,49,176,60,152,50,0,21,175,163,99,68,0,61,86,81,79,6,180,18,103,141,148,81,87,25,
+186,87,74,63,118,158,142,129,36,31,3,31,170,241,97,222,107,239,12,189,88,178,255,63,197,158,144,131,77,39,149,44,
+126,253,106,142,118,7,80,158,156,27,180,170,235,170,231,71,239,163,7,128,39,181,64,130,101,12,3,235,112,150,244,61,
+51,146,114,236,240,49,62,125,82,53,6,94,198,96,149,5,141,253,9,218,1,225,21,112,33,56,18,220,11,62,33,157,
+57,244,173,236,64,204,38,77,17,187,115,83,184,181,211,214,12,220,196,173,13,90,223,78,116,103,77,92,205,10,52,163,
+188,50,162,78,211,6,249,1,231,211,53,252,79,115,170,231,179,174,162,21,130,218,66,54,171,104,103,150,67,192,93,89,
+21,244,200,223,66,132,171,45,49,39,12,28,190,182,217,189,63,176,78,171,203,200,64,195,59,87,223,200,209,187,120,62,
+48,103,70,117,237,188,29,78,88,7,181,115,224,123,1,25,32,49,215,2,237,62,30,175,143,26,87,98,116,57,32,45,
+169,84,193,79,222,17,124,84,12,126,11,167,50,160,79,29,67,201,189,3,196,132,249,209,108,209,101,219,81,197,253,52,
+51,168,134,90,21,98,123,189,118,230,249,94,197,25,32,195,196,179,19,206,27,154,121,50,254,191,186,65,103,197,217,177,
+249,69,51,208,152,87,56,95,16,232,35,148,105,229,34,60,120,118,85,224,196,138,57,229,184,24,80,157,43,173,108,19,
+216,164,96,234,136,72,92,238,105,166,98,40,121,13,69,218,22,208,82,48,3,240,172,15,255,30,8,222,7,173,68,51,
+47,47,7,83,23,108,142,213,87,140,1,242,196,221,173,50,77,147,235,218,138,195,82,81,6,72,207,175,131,219,129,86,
+156,191,14,238,3,71,0,173,80,153,0,196,239,130,138,198,176,181,217,13,113,155,139,115,181,55,147,202,40,28,182,26,
+32,111,29,160,239,12,98,0,14,149,183,230,4,47,131,188,114,241,32,229,21,248,67,132,199,60,91,156,95,150,131,128,
+125,164,171,110,66,156,151,2,121,235,168,3,171,185,170,192,159,108,108,192,37,156,23,33,202,135,99,194,169,91,158,42,
+115,124,163,116,209,110,92,111,6,78,248,191,163,111,178,50,199,189,239,108,131,240,255,118,72,196,167,185,239,74,70,155,
+148,135,159,199,58,112,152,228,182,102,45,89,34,6,32,236,209,36,164,37,116,243,72,39,98,209,163,173,67,180,244,63,
+171,188,216,41,12,223,175,55,3,100,172,184,66,51,34,107,38,27,226,239,247,177,206,122,51,235,216,39,97,32,206,43,
+209,81,157,174,105,69,13,228,225,96,32,31,39,9,211,110,146,49,16,115,202,241,112,144,86,52,240,83,196,172,170,100,
+198,119,112,133,109,202,47,63,77,27,169,14,238,111,239,16,172,111,7,96,32,74,59,61,243,183,129,118,3,140,234,184,
+220,13,76,28,32,88,171,232,3,6,200,11,122,238,183,1,73,235,213,218,10,72,51,225,45,21,101,32,74,243,25,57,
+106,59,29,77,22,153,21,140,7,42,26,163,228,102,43,142,17,78,227,152,70,180,29,88,242,128,236,178,41,3,226,48,
+66,210,109,28,219,165,209,71,220,220,164,65,103,211,48,203,116,177,193,214,5,56,127,23,100,149,175,224,177,76,81,235,
+138,45,196,57,239,4,203,103,208,49,155,184,171,2,127,177,157,28,149,207,149,223,139,144,95,162,52,126,46,187,146,142,
+14,36,25,3,13,233,178,49,231,170,123,229,21,13,130,238,13,6,182,76,77,102,69,255,187,42,124,240,4,194,151,130,
+198,197,59,80,121,19,75,164,188,109,84,123,146,66,236,9,238,129,156,136,99,242,229,149,156,106,201,95,8,121,136,252,
+171,101,163,157,100,97,28,228,89,235,255,110,167,0,124,223,12,192,128,202,220,97,1,152,80,153,124,108,0,61,86,81,
+114,6,40,15,151,193,68,97,5,48,71,4,109,81,245,49,208,82,120,29,245,145,87,149,65,218,14,226,30,48,18,220,
+13,158,3,207,128,70,217,155,63,43,55,94,72,120,174,45,111,158,74,232,214,206,178,49,240,229,12,222,94,229,29,55,
+52,141,51,168,41,212,203,86,129,181,159,26,88,159,213,53,103,96,34,46,47,10,190,8,198,111,238,100,96,43,37,149,
+63,250,206,131,202,34,139,25,136,25,248,21,39,73,235,213,87,225,182,82,219,25,197,145,244,241,51,6,120,15,233,100,
+84,132,207,46,214,235,119,30,162,187,90,138,40,171,199,252,140,20,238,237,180,51,3,127,198,201,154,64,239,174,172,162,
+122,245,254,224,116,80,181,81,141,95,99,115,214,25,241,15,227,183,106,219,130,97,114,122,161,93,213,232,105,117,254,164,
+121,110,27,253,234,92,237,241,61,193,243,250,83,33,89,2,91,15,0,202,239,161,69,237,209,75,99,165,209,187,33,254,
+235,99,121,24,80,25,119,1,184,28,44,15,180,149,114,26,121,27,199,87,131,63,128,91,211,120,180,219,0,12,80,144,
+157,15,218,137,102,82,173,27,32,168,190,86,1,71,47,180,35,49,225,61,55,128,201,37,112,117,105,66,190,58,57,83,
+222,61,57,105,198,195,173,150,255,231,145,155,146,134,101,119,245,100,128,204,165,252,125,100,158,76,214,224,247,193,122,178,
+88,143,88,147,206,179,128,63,2,173,152,253,16,100,21,125,116,80,51,197,238,1,135,0,229,191,44,91,72,62,80,15,
+230,187,31,75,210,35,158,177,54,39,231,74,175,180,114,69,247,173,78,30,34,145,249,54,248,56,109,164,218,184,127,135,
+123,33,6,195,147,71,162,166,46,225,121,122,112,48,104,151,126,154,205,121,163,220,214,148,38,71,187,9,3,228,7,173,
+194,107,183,109,55,183,199,136,102,144,47,7,154,104,242,37,51,80,126,6,148,119,193,81,32,141,60,137,227,129,247,127,
+249,99,88,110,11,99,30,163,227,117,64,165,7,239,0,0,32,0,73,68,65,84,28,67,136,250,200,42,145,62,145,157,
+147,114,124,62,71,196,213,62,168,68,124,243,230,198,56,158,209,241,218,28,156,201,171,58,194,43,37,216,172,186,157,218,
+133,69,201,93,40,30,200,75,58,90,202,205,64,148,86,90,65,173,213,247,73,228,41,28,233,125,167,237,192,203,29,185,
+30,90,87,232,138,28,136,87,67,184,211,8,180,62,108,124,109,15,57,168,74,208,33,62,224,91,251,21,57,228,201,221,
+72,240,111,7,72,116,13,138,237,202,12,128,191,166,208,181,100,10,183,205,156,126,216,236,162,175,153,129,33,12,124,125,
+200,255,172,127,53,251,217,210,103,12,80,6,106,133,236,207,192,134,96,218,0,209,155,24,29,241,42,158,197,50,234,123,
+15,127,59,103,244,107,111,201,25,208,71,193,149,94,105,69,179,40,203,44,202,207,33,235,179,143,241,110,127,186,204,17,
+238,35,219,166,35,46,154,173,218,110,150,222,59,220,215,251,72,31,182,181,152,129,152,129,95,114,210,46,223,196,238,116,
+212,44,240,91,26,47,248,220,12,84,140,129,73,177,183,83,159,202,208,40,93,55,244,130,255,7,97,224,12,180,124,13,
+36,93,13,216,42,208,181,184,161,149,57,187,183,114,80,178,235,187,98,79,214,237,41,213,135,113,68,201,226,211,13,115,
+212,214,202,211,46,215,238,7,155,118,195,208,44,97,180,232,100,215,10,156,11,65,214,54,97,18,83,244,12,90,170,197,
+128,158,127,13,74,106,1,135,202,79,237,84,164,9,90,170,219,191,25,225,110,142,106,115,170,206,255,24,176,244,138,1,
+30,238,3,64,39,81,130,89,58,48,0,137,89,102,56,15,229,254,173,14,193,244,245,109,200,208,62,202,33,62,186,245,
+18,122,190,154,150,172,0,97,39,94,253,147,214,54,187,239,15,6,200,99,203,130,118,51,155,185,157,72,180,218,236,155,
+253,193,138,99,17,51,64,154,174,9,110,74,148,3,186,231,72,121,77,223,109,137,205,244,49,48,3,226,54,194,41,28,
+179,200,170,129,77,10,162,142,136,40,94,243,1,125,244,58,164,120,80,49,72,10,181,87,66,130,77,12,190,15,180,34,
+80,229,64,43,121,130,27,105,59,48,219,7,238,187,149,101,128,188,160,231,126,43,144,116,53,142,190,189,180,78,228,175,
+178,241,182,225,245,102,128,252,187,29,72,35,122,62,150,2,3,239,255,122,179,23,62,246,240,250,120,154,196,104,227,246,
+13,238,105,171,182,82,11,54,234,219,20,143,182,137,71,167,91,55,227,32,174,139,150,58,174,33,140,107,136,171,86,142,
+100,21,61,195,90,197,16,194,164,66,116,200,182,38,56,149,107,69,138,86,216,46,4,92,182,21,146,170,86,90,21,6,
+146,206,100,202,26,159,77,18,120,252,87,2,55,118,210,122,239,240,52,220,104,143,205,58,203,41,68,126,170,156,4,140,
+96,166,238,204,224,134,12,122,52,155,42,143,188,158,199,179,253,214,130,129,109,136,101,136,153,233,207,160,71,251,201,91,
+42,204,64,92,201,141,142,95,36,42,135,1,237,81,91,38,185,15,99,182,45,147,65,125,108,203,114,25,226,166,89,82,
+183,101,240,215,45,47,63,37,160,105,2,6,246,62,186,78,11,168,207,170,90,51,160,153,189,154,145,60,17,104,213,83,
+161,213,207,35,192,127,129,197,12,196,12,108,193,73,210,54,172,86,215,157,31,123,244,209,12,84,148,129,173,82,218,253,
+4,238,239,144,31,218,172,41,189,218,121,2,6,142,79,224,38,137,147,169,113,116,52,245,244,69,27,235,236,73,60,118,
+217,141,38,184,204,151,49,76,189,223,143,142,253,214,40,63,106,229,129,86,29,100,149,59,241,88,202,85,76,113,94,109,
+18,177,179,185,182,113,147,235,33,47,61,66,30,122,80,249,168,70,121,41,36,127,214,213,39,12,36,173,4,167,142,46,
+15,184,150,211,205,212,193,227,167,220,191,168,131,27,223,254,140,129,16,31,10,251,168,230,100,230,217,82,109,52,220,29,
+203,11,99,222,44,28,242,60,168,163,34,111,7,251,205,89,194,182,159,90,49,144,103,249,118,35,81,231,53,254,241,121,
+229,25,24,78,12,148,166,58,150,77,230,192,160,131,193,146,101,51,172,15,237,17,215,105,229,77,222,123,111,164,245,212,
+69,247,26,8,8,41,106,28,62,31,82,161,117,181,100,96,30,238,172,20,221,109,213,211,168,149,228,234,140,124,53,114,
+231,131,25,88,31,10,150,78,65,195,63,99,183,238,244,137,153,240,177,10,12,196,157,165,28,215,192,222,5,83,218,124,
+119,74,247,118,158,142,129,99,112,126,111,58,47,45,93,207,198,157,51,193,240,150,46,186,124,163,33,239,105,213,195,228,
+4,255,243,28,38,188,64,217,123,130,202,223,154,149,193,63,131,179,172,253,119,154,84,180,83,14,206,123,225,245,32,2,
+253,30,104,85,159,11,101,147,39,102,132,98,210,122,42,205,64,97,3,57,176,178,1,232,212,113,173,153,158,247,87,154,
+193,106,25,255,98,181,204,13,110,109,214,151,169,58,18,214,160,242,177,101,14,139,86,196,111,222,23,219,179,57,194,183,
+215,62,100,96,72,69,251,59,68,113,120,128,104,106,229,158,102,212,88,250,135,129,125,136,202,2,37,141,206,180,216,181,
+3,184,156,252,124,34,152,33,206,215,37,181,183,170,102,105,34,67,150,119,96,153,87,227,124,139,56,205,23,56,65,78,
+13,172,207,234,154,48,192,51,174,213,209,95,2,179,71,183,91,213,143,70,114,255,90,234,95,173,86,236,68,222,125,168,
+17,3,90,193,153,180,253,170,65,232,80,51,231,107,68,177,163,218,107,6,84,15,106,144,109,56,159,176,225,127,146,211,
+147,146,56,178,155,204,12,140,194,231,159,193,7,153,53,12,246,168,129,58,213,63,84,39,46,155,104,64,33,203,68,160,
+56,30,117,156,28,168,9,237,95,139,9,200,112,212,68,247,255,100,240,215,43,47,167,17,176,218,114,73,223,205,89,237,
+124,23,143,238,163,200,202,158,253,245,21,3,157,6,90,242,68,118,189,4,158,159,161,113,166,78,114,75,27,6,168,204,
+173,192,237,86,141,220,54,62,199,186,85,246,15,22,143,101,112,224,11,255,69,223,202,41,116,106,197,216,37,228,209,239,
+166,240,211,202,233,34,173,110,164,184,158,182,18,159,66,181,157,246,1,3,170,64,133,144,39,81,114,99,8,69,214,81,
+10,6,244,145,76,125,108,179,236,50,61,6,254,8,168,225,243,87,160,109,224,44,225,24,88,6,85,89,234,17,35,194,
+153,16,92,211,150,104,12,89,143,125,15,125,199,6,183,210,10,155,49,48,63,23,87,2,227,55,187,25,93,27,205,81,
+31,59,77,52,152,72,93,121,70,220,106,39,0,117,132,77,2,166,0,90,13,45,81,125,78,233,171,89,174,111,130,151,
+168,219,141,228,104,169,0,3,13,157,218,95,198,92,149,101,73,229,46,210,249,241,164,142,237,206,12,148,144,129,25,176,
+73,253,0,105,68,19,55,47,147,7,242,127,26,127,118,155,142,129,83,113,190,14,72,210,231,149,68,179,210,89,131,30,
+43,37,113,220,37,55,211,17,142,6,207,179,202,43,120,172,99,189,106,71,226,173,122,72,22,17,103,91,197,30,43,240,
+12,31,141,173,27,128,162,7,113,68,137,86,26,62,168,19,139,25,168,59,3,33,27,192,99,184,164,194,173,237,18,226,
+89,118,99,174,55,57,185,188,201,53,95,26,155,129,180,21,184,177,53,124,118,165,238,157,179,122,169,222,4,146,124,171,
+230,37,220,173,198,203,83,47,140,16,178,84,78,37,154,154,117,123,78,29,246,222,191,12,168,204,77,211,185,209,142,137,
+127,180,187,233,123,149,99,96,85,44,158,184,66,86,207,141,173,127,1,243,129,80,131,147,21,138,126,97,166,106,69,78,
+22,121,32,139,167,34,253,68,157,186,234,160,15,181,149,100,108,174,222,177,111,199,127,124,44,134,1,210,79,141,125,205,
+86,237,244,205,38,117,102,220,73,61,236,181,102,150,160,71,131,64,179,129,153,128,6,130,191,2,180,242,112,78,48,53,
+208,192,206,100,64,61,153,159,128,215,129,86,104,104,0,231,65,252,223,204,241,89,240,50,120,158,112,62,230,104,41,25,
+3,209,243,30,91,181,11,39,73,234,240,114,175,193,187,67,117,98,49,3,21,102,96,51,108,79,187,74,67,223,144,112,
+121,214,157,68,255,45,193,124,9,168,29,22,66,86,68,201,217,32,212,224,80,94,155,142,64,129,222,177,89,229,66,60,
+134,234,75,201,106,67,215,252,69,239,171,153,9,80,109,175,172,114,12,207,175,38,156,84,65,206,194,200,239,131,110,141,
+24,159,91,5,82,108,163,25,168,44,3,20,98,107,131,209,160,157,124,202,205,181,43,27,201,46,26,14,79,71,182,35,
+50,197,61,53,156,107,45,112,53,63,120,177,5,103,202,147,47,128,61,66,147,132,206,219,91,132,153,244,178,26,164,22,
+51,48,136,1,50,143,246,46,22,126,151,52,35,117,112,247,38,247,191,8,6,244,14,10,204,127,42,199,64,148,142,121,
+203,158,14,89,166,176,219,170,67,252,11,140,15,156,31,115,228,190,136,191,199,56,102,145,101,114,4,93,136,87,34,161,
+252,176,121,150,200,180,241,163,247,255,22,160,16,155,173,244,115,6,224,120,22,112,40,232,36,215,225,224,107,159,251,28,
+71,233,62,9,208,246,139,195,192,183,193,81,224,81,240,33,72,43,159,224,225,73,112,2,88,3,204,12,52,64,104,41,
+17,3,164,201,64,249,207,81,249,70,117,244,164,162,50,175,68,49,177,41,102,32,57,3,202,187,17,238,79,154,225,27,
+220,109,149,60,36,187,204,194,64,67,250,40,157,126,10,222,111,224,63,196,169,234,191,113,30,200,98,98,46,63,81,216,
+27,114,252,32,71,100,84,94,79,32,93,117,16,197,51,194,182,28,179,202,40,60,106,2,74,169,5,27,39,6,231,130,
+78,253,189,56,9,38,234,191,155,30,148,154,27,27,103,6,42,205,0,15,216,154,9,30,89,53,186,134,85,58,162,93,
+50,30,158,174,76,192,103,39,39,30,8,104,72,47,200,250,35,120,4,188,13,244,98,184,24,20,150,31,209,253,58,200,
+35,78,191,134,244,243,233,103,12,144,161,226,74,227,19,121,50,87,131,223,171,27,116,154,230,138,51,16,165,229,29,13,
+233,91,197,211,11,49,90,29,120,21,79,141,222,153,15,119,179,131,119,65,90,121,13,15,221,154,101,151,152,32,108,82,
+185,119,83,218,200,116,112,255,124,164,55,177,29,118,152,141,1,120,86,27,225,182,14,233,161,206,129,195,192,228,10,133,
+227,120,64,3,56,235,129,227,128,58,233,53,16,19,74,84,23,60,27,172,14,38,5,221,216,34,36,27,129,53,243,69,
+90,196,245,156,61,56,79,35,191,199,113,233,216,194,166,105,192,172,165,51,204,6,149,138,1,229,93,176,28,72,59,72,
+173,142,247,89,74,21,153,26,24,3,231,167,129,144,162,201,37,231,129,41,65,215,25,36,204,225,224,113,144,71,126,131,
+231,129,242,187,235,17,232,65,128,113,92,57,106,18,74,86,57,28,143,61,176,190,117,144,178,103,8,230,230,127,167,58,
+28,78,130,203,209,104,172,77,126,106,157,34,190,99,6,62,99,160,144,173,213,80,253,157,4,4,107,159,106,109,111,96,
+233,204,128,246,39,205,43,31,230,85,208,79,254,89,178,250,127,196,71,232,150,228,221,218,72,219,130,88,204,64,51,6,
+54,226,226,240,102,55,50,92,251,107,6,63,246,82,110,6,244,97,200,42,203,90,24,191,31,216,178,202,145,232,177,237,
+218,230,33,203,12,191,247,121,87,150,171,69,249,25,145,218,118,111,241,192,156,158,25,88,159,213,53,97,128,70,184,6,
+6,181,13,141,182,64,107,39,207,115,243,30,160,1,72,109,161,166,244,222,9,172,8,180,205,75,220,126,81,254,12,49,
+216,168,1,163,239,129,149,192,149,224,207,132,123,55,249,223,147,104,32,163,36,178,113,10,59,94,197,237,223,83,184,15,
+230,148,124,163,237,254,86,1,139,2,237,132,160,54,156,182,249,155,10,40,63,105,107,56,173,44,123,157,163,218,102,106,
+15,107,235,161,59,193,85,224,191,96,52,121,143,131,165,230,12,108,72,252,211,174,18,124,1,63,250,70,142,165,187,12,
+236,66,112,195,64,168,237,240,85,0,172,3,206,5,223,2,221,150,3,9,48,207,118,113,247,226,255,144,110,27,93,130,
+240,230,196,134,47,102,180,227,61,252,149,98,59,80,222,79,173,162,160,45,255,148,55,20,207,110,202,71,4,118,124,55,
+3,116,88,102,160,150,12,240,240,39,217,194,67,123,95,91,18,48,0,159,239,128,188,242,90,130,160,236,164,32,6,72,
+188,143,115,38,224,7,5,153,102,181,21,102,128,60,165,153,41,55,231,204,91,177,119,117,34,88,250,136,129,40,127,156,
+31,39,112,133,143,154,121,223,205,129,247,62,202,5,3,171,25,190,6,127,90,225,144,86,110,42,35,17,68,98,239,180,
+17,233,224,254,21,238,47,6,60,211,175,224,4,135,227,133,128,102,25,107,182,113,59,57,135,155,11,130,137,192,230,224,
+78,240,30,200,146,143,241,150,88,100,151,194,185,21,124,7,196,3,70,5,51,99,245,173,24,32,13,244,92,174,1,210,
+212,163,47,106,165,47,244,245,200,190,85,56,254,9,60,4,222,2,121,228,101,60,159,14,148,239,67,155,107,125,21,97,
+64,105,15,158,3,105,69,121,167,34,177,236,31,51,197,57,208,10,170,23,64,72,209,59,233,106,48,19,80,24,3,8,
+205,92,172,55,58,238,199,49,77,121,139,243,65,162,9,24,235,128,66,108,13,29,247,80,250,162,248,110,60,136,137,116,
+127,174,47,11,103,177,29,67,142,7,243,63,239,251,13,21,153,228,46,124,21,150,255,67,229,1,235,49,3,221,100,160,
+168,173,3,102,77,16,9,205,24,177,36,99,32,237,108,156,102,90,239,111,118,209,215,186,198,64,222,206,0,215,202,187,
+150,84,149,10,104,77,172,93,42,144,197,250,96,161,165,255,24,208,236,222,170,139,102,228,255,146,74,252,2,174,200,103,
+74,202,57,240,149,165,190,167,15,195,151,81,54,15,108,212,213,232,211,236,81,75,241,12,104,182,242,66,160,221,114,131,
+209,220,191,21,232,185,223,19,236,5,22,3,90,201,144,37,31,227,45,177,200,46,133,179,36,208,172,211,109,40,115,166,
+230,104,233,45,3,219,17,124,210,122,180,62,242,174,180,43,84,200,23,155,131,11,8,68,19,19,47,3,154,145,191,32,
+152,18,228,17,173,222,209,74,235,19,128,6,153,79,0,171,129,90,117,138,230,33,176,79,252,174,78,60,146,244,167,12,
+141,174,223,101,67,25,233,222,255,91,8,106,15,240,78,192,32,245,78,90,25,104,213,112,136,254,160,78,166,125,3,7,
+219,130,164,229,109,51,125,199,178,162,240,124,173,42,172,225,202,66,165,85,86,81,153,95,70,209,42,232,127,131,95,128,
+188,239,183,172,241,59,50,171,71,251,51,3,253,202,64,158,66,186,41,39,84,52,167,225,70,146,45,60,158,111,170,192,
+23,7,49,0,159,234,128,153,112,208,197,108,127,250,161,51,47,91,204,251,195,151,150,148,90,204,192,80,6,118,227,66,
+136,242,225,57,42,219,127,24,170,220,255,251,130,129,255,16,11,117,52,205,80,241,216,104,123,48,229,209,117,43,30,143,
+94,152,159,117,11,132,82,172,228,85,7,102,131,108,198,121,214,248,52,168,25,115,170,56,106,176,96,64,106,216,233,16,
+71,189,240,35,233,168,1,146,101,65,167,244,187,3,55,26,196,217,18,108,12,212,137,208,109,81,251,104,126,176,35,208,
+170,160,147,200,27,47,119,219,8,135,55,192,128,218,65,203,164,224,226,17,220,94,155,194,125,98,167,81,30,222,25,15,
+155,130,5,18,123,204,238,112,122,188,110,14,52,176,163,237,215,246,3,151,2,75,255,51,176,54,81,76,59,112,173,151,
+165,6,21,115,203,144,247,174,234,95,211,1,13,80,76,5,230,2,42,207,181,133,219,125,64,118,106,0,245,109,48,32,
+53,126,151,30,11,1,226,106,127,16,162,125,54,192,39,63,43,2,13,20,233,157,168,50,174,40,57,4,197,211,230,80,
+254,20,126,127,151,195,127,213,189,170,222,144,69,62,192,211,73,89,60,22,236,103,7,244,255,31,152,165,224,112,218,169,
+87,159,241,25,177,131,26,151,45,49,5,62,154,129,1,6,130,15,228,160,117,35,160,217,3,157,228,134,78,14,124,127,
+128,129,239,6,226,225,168,64,122,172,38,37,3,84,134,213,25,145,87,62,205,171,192,254,171,207,192,144,134,213,207,136,
+145,58,197,66,200,49,33,148,88,71,41,25,208,64,206,121,32,68,57,212,235,8,126,7,3,212,136,61,189,215,134,84,
+44,124,117,186,100,145,71,179,120,42,216,207,134,232,79,82,199,76,106,198,89,52,10,31,78,234,216,238,114,49,176,24,
+190,23,1,147,180,209,50,154,123,26,92,211,202,157,165,65,47,6,113,8,118,140,12,227,236,231,224,35,222,191,167,144,
+87,100,155,165,187,12,232,153,215,128,70,82,41,100,117,49,233,191,47,6,252,0,100,45,79,147,218,223,204,157,158,153,
+229,128,182,74,61,135,227,225,228,69,183,163,155,49,213,63,215,214,202,16,21,117,120,222,213,201,31,121,72,19,110,23,
+5,179,68,80,57,59,53,88,48,58,78,206,81,43,195,52,88,163,65,154,41,128,6,37,226,89,21,141,239,96,13,224,
+104,224,253,67,112,63,184,21,252,11,212,106,192,113,72,231,242,159,225,88,92,254,16,136,155,80,242,37,20,169,124,91,
+31,20,49,152,115,6,122,23,6,89,69,121,225,79,160,206,147,30,102,205,72,222,72,252,149,233,123,200,75,97,207,223,
+128,234,98,141,207,59,127,187,46,87,17,226,91,93,15,213,1,154,129,186,49,192,139,235,42,208,73,180,223,167,26,104,
+150,14,12,192,211,53,157,200,76,112,95,13,99,75,143,24,32,125,142,76,144,70,157,156,140,234,145,249,14,182,68,12,
+144,73,226,253,97,167,230,252,129,78,153,38,225,125,237,231,172,206,42,75,159,49,64,186,198,249,101,56,231,143,38,204,
+15,33,156,233,155,54,69,137,246,10,247,22,51,41,242,42,124,105,207,252,44,178,83,138,96,10,115,138,225,113,62,158,
+151,243,16,223,12,140,185,80,217,87,152,221,86,60,152,1,184,254,13,120,62,38,191,197,241,77,174,235,59,35,163,90,
+220,239,213,229,251,8,248,71,96,226,193,177,242,191,162,25,128,243,251,65,82,121,21,135,115,128,32,102,161,71,223,165,
+216,3,140,4,101,146,23,49,102,79,16,36,158,86,82,14,6,148,158,17,22,225,152,165,30,245,223,56,38,248,95,1,
+252,20,28,3,46,3,119,128,151,192,251,17,56,20,38,175,163,89,225,46,10,106,89,95,139,226,125,42,199,34,100,4,
+74,151,7,113,126,137,147,61,243,17,93,127,7,163,65,30,57,10,207,181,76,111,17,79,220,167,2,31,100,36,240,138,
+110,114,23,135,213,228,56,9,215,244,189,183,94,125,11,135,160,7,137,234,252,75,130,96,121,61,243,67,98,143,102,160,
+100,12,20,177,34,103,153,4,113,252,31,51,23,110,79,224,206,78,198,25,103,190,0,36,188,26,64,135,85,100,103,160,
+211,54,34,73,52,123,38,66,18,150,234,227,102,119,162,186,80,160,232,94,68,121,252,116,32,93,86,83,78,6,158,194,
+172,237,192,105,32,205,204,102,156,167,146,15,112,125,54,208,214,51,223,2,27,1,205,234,154,25,132,154,209,181,44,186,
+102,7,207,1,75,50,6,166,76,230,108,44,87,207,140,117,165,183,23,180,197,195,228,1,77,56,52,160,46,171,106,195,
+0,141,112,229,65,205,236,212,150,51,173,68,189,210,154,145,58,55,152,168,149,163,30,93,95,132,112,183,0,143,131,27,
+123,100,67,173,130,85,199,13,242,21,160,252,144,84,238,162,62,243,108,82,199,237,220,17,254,30,220,87,154,15,111,231,
+174,71,247,244,78,85,61,112,126,236,220,133,163,86,98,12,200,144,149,1,241,101,31,171,197,128,118,227,200,178,146,99,
+90,242,195,139,248,157,10,76,2,66,213,187,80,149,74,180,205,254,79,193,188,96,127,160,25,245,117,148,31,19,105,173,
+106,90,7,132,76,11,149,137,103,1,113,124,25,200,37,228,153,237,81,240,35,48,94,14,69,247,225,119,159,28,254,251,
+193,171,86,36,101,149,94,247,139,170,110,253,75,240,115,240,133,172,145,40,192,223,69,232,188,51,214,235,247,91,204,132,
+143,102,32,95,129,221,138,63,189,176,58,137,58,123,44,201,24,152,37,153,179,182,174,180,212,217,210,59,6,212,224,202,
+43,33,43,128,121,109,177,255,222,50,48,15,193,171,115,33,132,188,128,146,125,67,40,178,142,242,49,160,10,111,3,46,
+143,210,122,84,65,150,62,137,94,53,0,54,3,47,129,83,192,119,128,182,25,88,3,92,2,66,12,72,107,75,144,173,
+129,37,57,3,89,59,197,203,182,165,231,42,201,163,220,209,229,163,184,248,75,71,87,118,16,138,129,133,81,52,63,104,
+183,162,69,61,247,218,222,103,2,144,68,148,63,213,113,162,45,125,222,3,250,126,195,235,224,53,160,9,76,58,87,153,
+163,123,26,32,202,43,26,148,254,33,157,94,234,36,181,116,135,129,141,9,38,73,187,82,214,40,255,28,161,147,60,66,
+250,174,1,174,69,135,58,37,135,131,178,202,132,24,182,41,56,13,148,169,227,173,172,124,85,201,174,245,50,26,171,14,
+126,181,57,245,204,148,161,221,184,18,118,104,192,113,49,80,71,249,136,72,175,11,174,41,32,242,122,230,79,2,63,202,
+163,155,178,110,27,252,255,14,180,123,55,119,10,98,36,14,84,22,169,77,89,103,153,141,200,143,151,145,0,113,216,11,
+81,62,58,8,60,4,246,7,101,122,151,188,143,61,135,0,139,25,48,3,77,24,72,218,88,106,226,117,236,75,188,12,
+54,228,106,146,25,36,106,84,89,58,48,0,159,154,1,152,132,207,14,154,198,249,103,39,7,190,95,40,3,73,27,161,
+237,140,248,184,221,77,223,171,21,3,154,69,62,93,160,24,31,77,71,255,115,129,116,89,77,201,25,32,173,15,225,189,
+162,206,206,61,193,176,64,230,234,125,174,217,150,187,161,191,213,164,1,205,24,212,214,30,234,96,80,67,65,13,190,60,
+229,226,55,240,175,217,210,150,100,12,168,131,51,139,100,93,201,147,37,172,78,126,86,199,193,2,157,28,37,188,175,247,
+233,254,228,87,117,178,88,10,102,128,231,94,33,172,8,58,189,183,212,241,24,67,126,154,137,148,41,253,84,142,189,4,
+52,48,253,38,208,192,141,174,61,11,52,89,76,131,59,26,112,153,1,204,10,134,71,71,149,65,154,169,174,246,79,218,
+142,78,205,88,93,27,60,78,156,254,66,254,201,250,92,161,194,146,144,129,213,18,186,147,51,173,74,57,55,133,251,1,
+167,81,254,212,185,210,247,112,160,142,215,50,149,125,152,211,86,244,108,93,14,54,0,15,180,117,233,155,165,102,128,50,
+69,219,7,41,239,205,91,106,67,211,25,183,18,206,183,7,63,77,231,173,175,92,107,69,206,177,64,207,104,72,153,17,
+101,7,3,245,21,29,159,86,49,121,77,147,173,246,5,83,164,245,219,224,94,239,221,93,200,187,90,145,83,119,153,15,
+2,38,204,72,130,86,210,117,83,84,55,250,61,248,46,80,189,168,140,114,51,70,9,22,51,96,6,138,102,128,23,194,
+222,32,137,220,93,180,45,253,160,31,34,143,72,66,102,7,55,101,155,81,219,15,73,147,42,14,164,207,107,29,210,40,
+201,237,59,82,5,106,199,125,201,0,25,101,87,144,101,223,236,102,121,236,89,46,78,212,151,68,57,82,109,25,32,221,
+39,7,23,128,119,65,86,249,16,143,231,128,111,131,129,189,139,219,6,202,205,216,29,199,111,129,151,65,86,249,24,143,
+243,116,10,207,247,63,99,0,174,46,204,72,180,182,89,232,185,96,187,242,78,214,56,52,139,250,89,210,105,233,14,3,
+112,61,62,184,28,168,204,104,39,250,126,166,208,76,226,123,250,174,145,246,242,95,19,204,2,38,0,227,13,193,184,252,
+23,26,175,203,6,237,253,190,44,208,119,11,178,214,203,244,13,129,91,192,156,221,97,175,190,161,192,241,87,65,167,60,
+131,147,49,162,111,129,165,38,76,126,192,42,224,110,80,101,185,11,227,151,79,77,128,61,148,138,1,210,112,147,42,103,
+194,22,182,171,174,169,50,187,84,92,119,211,24,226,62,13,184,8,228,253,14,13,42,198,146,183,184,178,59,24,83,207,
+238,20,55,220,46,9,158,3,121,68,117,241,131,65,167,224,106,113,31,30,86,203,65,230,255,137,199,24,69,16,134,110,
+109,189,168,239,102,253,27,40,207,148,89,244,45,47,181,21,11,229,164,8,158,173,211,12,84,146,1,30,182,139,19,150,
+8,87,87,50,130,93,54,26,46,243,190,96,149,28,175,116,217,108,7,55,132,1,210,32,196,199,153,111,28,162,214,127,
+107,192,0,121,103,76,5,134,243,133,193,72,16,74,188,162,161,6,121,168,93,20,201,72,27,2,53,44,223,78,145,169,
+244,177,114,117,170,47,219,78,119,179,123,248,105,204,207,223,228,127,158,178,113,253,102,97,248,218,216,12,192,243,105,32,
+139,104,166,102,207,5,195,213,1,162,143,52,135,144,23,81,50,43,232,121,188,234,96,0,60,107,64,69,223,241,120,20,
+180,26,164,225,86,71,121,15,23,103,130,229,128,242,67,166,89,175,248,211,128,206,212,96,113,160,143,11,103,233,84,211,
+32,208,206,32,235,22,42,117,72,250,220,113,132,223,163,64,82,81,135,226,64,167,79,210,128,113,175,247,209,116,224,56,
+144,230,29,136,243,210,138,6,76,245,193,237,164,52,216,93,73,24,32,205,230,4,7,130,87,64,63,202,241,68,170,36,
+108,119,223,12,197,61,194,201,28,179,188,119,240,214,86,84,159,222,30,196,225,12,58,54,198,24,55,122,255,141,0,121,
+229,88,20,12,132,211,168,191,174,231,112,49,15,208,0,68,22,185,31,79,99,210,44,47,135,13,186,84,223,249,49,184,
+20,140,2,85,145,115,49,116,12,31,58,183,152,1,51,80,32,3,60,100,106,168,37,145,51,10,52,163,111,84,67,164,
+26,38,121,229,246,190,33,164,162,17,33,1,63,200,155,136,248,255,79,69,163,111,179,115,48,64,186,55,86,98,84,9,
+11,37,183,163,168,74,91,135,228,96,209,94,147,48,64,126,216,22,168,226,252,20,208,106,25,65,157,167,250,127,51,208,
+108,103,53,6,134,131,129,124,153,68,111,59,55,232,73,211,81,135,243,65,242,187,118,186,125,239,115,6,96,237,148,65,
+204,37,255,163,45,59,122,46,152,187,69,114,147,219,186,212,64,194,14,61,143,80,141,12,128,239,137,128,202,141,215,65,
+86,121,6,143,191,6,115,131,96,131,39,145,190,67,57,166,157,153,170,85,177,55,128,180,91,179,213,40,229,243,71,21,
+126,31,4,73,69,121,36,213,123,9,247,90,157,117,125,210,0,42,228,238,36,108,205,159,0,214,80,40,3,74,35,160,
+242,81,101,155,234,88,33,218,138,168,41,173,60,139,101,133,114,90,102,229,138,123,3,246,231,60,107,135,63,94,91,138,
+242,208,1,160,49,172,65,229,34,247,102,3,26,52,200,43,183,162,96,114,48,72,127,153,211,160,104,219,34,46,94,203,
+72,172,234,167,3,101,183,244,164,149,40,236,56,221,151,231,191,242,152,86,15,103,181,7,175,61,147,55,8,89,19,128,
+226,248,56,143,165,205,16,118,95,11,6,180,71,116,72,209,62,212,73,68,251,89,91,218,48,64,225,165,125,184,67,164,
+143,63,18,214,134,231,46,221,202,52,115,116,136,109,250,104,175,165,190,12,28,68,212,191,29,40,250,250,118,128,246,247,
+127,59,144,62,171,233,3,6,200,15,250,54,128,48,70,120,15,233,155,1,239,198,23,180,127,123,96,217,17,125,155,128,
+44,131,138,243,5,182,165,159,213,105,15,243,44,50,44,139,167,2,252,132,218,91,255,90,108,251,91,1,246,89,101,107,
+6,180,125,231,74,32,235,55,177,180,21,179,6,20,47,166,252,121,149,99,48,65,223,19,148,113,7,70,10,183,228,56,
+113,66,229,250,30,193,23,193,156,248,127,186,128,114,49,161,25,253,233,12,78,21,177,101,64,154,237,51,245,29,182,68,
+18,233,215,182,145,187,129,25,19,121,170,150,35,125,227,231,28,112,65,181,204,238,111,107,163,124,23,71,242,135,156,8,
+90,217,156,231,251,36,177,190,42,28,103,193,200,105,65,45,219,179,67,222,19,218,6,109,52,92,168,28,154,10,132,18,
+189,195,126,1,84,136,238,50,84,41,97,206,207,181,115,193,194,67,239,165,252,255,16,238,245,109,149,49,237,131,148,254,
+251,217,185,218,214,202,231,105,69,13,172,31,128,175,129,227,73,171,19,57,62,11,58,137,222,147,95,5,139,128,149,193,
+92,96,106,160,122,74,85,229,159,60,47,143,86,213,120,219,109,6,186,197,64,136,129,130,70,91,147,126,111,33,73,193,
+212,168,183,142,231,63,14,16,105,85,18,46,10,160,199,42,242,49,160,151,115,94,121,63,175,2,251,175,44,3,107,96,
+249,86,32,212,76,228,171,168,32,253,179,178,108,216,240,174,49,64,62,41,186,145,246,30,145,185,19,172,152,33,82,106,
+144,90,146,49,48,42,153,179,177,92,205,59,214,149,46,94,136,58,190,100,195,162,1,130,253,0,29,171,4,208,99,21,
+233,24,152,14,231,139,129,180,157,10,234,136,186,21,28,10,206,165,44,82,250,5,23,244,62,69,62,59,12,197,250,240,
+239,70,41,2,80,231,235,55,192,169,224,163,20,254,236,52,25,3,63,194,89,210,54,229,199,184,77,179,211,195,95,112,
+175,206,206,164,250,113,26,76,148,143,85,151,211,4,175,79,65,218,231,2,47,29,69,19,48,246,32,95,223,192,241,85,
+242,120,71,15,118,208,21,6,150,38,148,173,193,234,96,182,174,132,88,174,64,38,192,28,229,123,203,103,12,236,197,97,
+4,248,51,152,249,179,75,65,126,53,152,243,43,160,114,96,219,88,35,229,129,38,91,159,2,22,142,175,101,60,62,131,
+191,29,40,87,94,202,232,191,223,189,221,66,4,231,204,24,73,21,214,195,193,190,96,15,160,186,197,43,64,92,171,189,
+164,126,61,213,61,102,2,74,95,165,245,84,160,159,10,249,23,136,207,1,192,98,6,204,64,7,6,244,82,13,41,126,
+65,135,99,243,235,1,84,189,192,139,246,141,0,122,172,162,247,12,188,216,123,19,108,65,15,24,152,135,48,143,4,170,
+176,133,16,85,6,119,15,161,200,58,204,64,32,6,52,217,32,203,64,78,17,29,96,129,162,84,58,53,154,61,153,69,
+190,64,227,127,98,234,17,90,197,215,43,89,143,128,213,112,205,43,167,161,64,29,167,150,46,49,64,222,209,51,58,12,
+124,1,168,243,58,141,220,141,227,195,193,153,228,191,79,210,120,76,235,22,253,143,96,235,113,248,211,128,211,66,9,253,
+43,62,107,130,243,128,7,114,18,146,150,194,217,114,41,220,170,94,115,117,51,247,164,107,227,101,117,150,106,192,71,239,
+155,162,59,190,212,225,246,52,120,24,156,25,157,171,67,238,9,160,188,51,41,152,6,124,13,104,178,142,226,171,142,214,
+180,207,9,94,154,202,82,92,221,19,236,208,244,174,47,22,206,64,148,247,38,35,160,77,192,79,192,18,96,18,80,87,
+209,74,156,151,235,26,249,22,241,62,137,235,79,129,227,129,218,123,161,68,253,123,91,2,229,55,229,61,189,131,47,1,
+139,131,60,162,244,219,22,92,145,71,73,159,251,189,129,248,109,16,32,142,234,83,21,212,254,87,61,170,46,242,79,34,
+250,120,93,34,235,120,154,129,210,48,64,165,69,251,59,38,145,141,75,99,116,9,13,129,192,73,128,246,224,206,43,199,
+148,48,122,181,50,137,4,156,35,111,34,70,254,221,249,94,131,156,67,90,55,238,7,171,109,91,238,10,148,127,164,70,
+101,202,94,53,160,209,81,172,8,3,228,71,229,247,133,192,71,32,173,60,82,145,104,246,220,76,136,157,17,124,152,150,
+224,200,253,194,189,138,0,225,43,127,60,148,209,238,70,111,138,251,4,96,160,124,237,85,124,234,22,46,124,107,255,252,
+159,130,180,121,239,57,252,108,7,212,217,221,21,33,44,125,244,126,23,144,180,238,173,143,85,63,13,180,146,199,18,144,
+1,56,93,0,164,201,51,250,64,252,152,103,59,62,31,114,92,138,255,119,130,34,69,223,167,184,7,252,9,104,32,37,
+145,224,118,192,118,142,223,3,55,130,44,239,67,188,141,37,163,184,18,178,115,56,81,124,236,232,51,6,224,126,123,112,
+239,88,169,82,223,11,87,17,117,103,143,136,1,113,209,128,121,57,191,18,132,22,189,167,142,1,55,5,80,172,111,173,
+124,31,140,41,107,157,152,131,25,136,184,153,137,227,75,192,146,158,1,125,23,79,223,13,27,76,172,255,153,1,51,208,
+148,129,80,51,127,84,168,47,68,8,73,103,56,205,216,212,26,95,140,25,216,130,147,241,227,63,25,143,159,226,79,91,
+7,88,122,203,64,168,70,126,222,252,208,91,22,28,122,22,6,78,197,147,102,240,133,146,91,153,121,188,79,40,101,214,
+99,6,2,49,240,32,122,178,204,104,215,44,53,75,50,6,70,225,236,221,100,78,199,114,245,157,177,174,116,239,194,210,
+4,21,98,11,189,107,208,83,232,170,142,238,81,82,169,144,52,27,120,65,144,166,254,162,178,224,116,112,62,239,171,247,
+57,118,69,8,235,53,2,186,12,60,151,48,64,181,159,166,7,83,184,211,33,33,99,201,157,253,4,167,73,183,61,211,
+202,151,115,58,168,214,236,232,11,193,151,58,184,203,122,91,101,235,217,96,37,176,56,121,105,87,112,7,231,137,4,183,
+227,68,56,143,227,87,240,180,25,120,38,145,231,246,142,212,254,112,59,176,61,71,193,238,170,28,136,240,115,142,35,80,
+124,48,88,52,88,0,213,87,116,86,245,163,16,46,6,13,207,189,158,127,173,64,248,46,56,23,124,28,46,148,129,21,
+126,42,79,151,207,169,243,77,252,239,2,58,149,181,57,131,233,11,239,90,181,116,93,95,196,36,89,36,66,141,186,232,
+93,126,32,200,210,30,76,102,169,93,153,129,62,99,64,13,145,80,162,37,235,73,197,3,57,237,153,218,166,253,237,68,
+119,71,80,49,248,32,145,75,59,42,146,129,80,179,198,213,40,176,212,131,1,13,136,95,0,212,160,15,37,218,122,100,
+183,80,202,172,199,12,4,102,64,91,206,164,149,174,117,242,166,53,172,164,238,239,201,104,215,183,51,250,11,225,237,100,
+148,132,168,167,158,18,27,163,206,19,75,215,24,152,140,144,212,121,158,116,32,71,29,2,183,1,109,167,150,116,64,5,
+231,193,68,229,144,58,170,100,71,146,206,9,197,111,5,80,231,237,146,136,126,112,89,38,133,70,237,167,127,83,236,190,
+201,160,218,118,220,59,10,204,22,187,9,120,212,0,142,234,106,234,36,93,31,220,2,66,136,182,150,153,11,104,96,49,
+73,62,108,23,166,102,208,127,177,9,47,237,252,248,94,54,6,212,118,191,15,28,1,230,6,126,217,64,66,36,87,113,
+212,0,189,165,53,3,239,113,235,251,96,111,160,178,37,148,228,205,135,178,229,215,188,147,143,85,253,41,70,40,227,250,
+84,207,95,137,215,219,125,26,183,56,90,154,252,242,50,200,155,191,98,125,55,112,114,92,252,199,71,51,96,6,58,51,
+16,162,129,60,16,10,5,251,53,157,131,27,227,98,226,49,103,62,105,198,192,240,102,23,83,94,59,51,165,123,59,47,
+134,129,188,179,96,98,171,238,141,79,124,236,123,6,244,236,106,102,86,168,202,145,102,183,252,30,92,7,44,102,160,140,
+12,188,154,193,40,205,222,178,36,103,32,235,100,128,37,233,4,212,7,235,187,38,47,231,110,18,0,0,32,0,73,68,
+65,84,132,55,45,80,199,207,2,1,2,125,133,250,233,41,238,124,8,192,100,122,21,83,226,101,142,20,222,52,56,251,
+119,240,64,10,63,33,157,62,143,50,117,204,167,41,91,134,227,190,107,91,192,17,86,223,138,6,27,244,236,19,193,165,
+82,68,242,210,54,110,119,225,158,234,62,210,25,82,62,68,153,6,89,190,74,185,178,14,184,47,46,95,116,204,43,145,
+46,237,170,176,58,56,9,232,60,171,204,142,199,149,229,89,252,90,194,49,16,229,87,241,186,42,184,2,205,135,130,69,
+194,133,208,55,154,52,40,175,65,128,55,67,60,31,125,195,74,235,136,168,204,210,42,154,145,173,157,116,237,142,6,151,
+246,6,199,116,45,196,10,7,20,149,221,26,236,186,153,104,156,81,225,168,180,51,93,239,63,245,83,252,13,76,223,206,
+97,138,123,106,3,254,60,133,123,59,53,3,102,0,6,130,13,228,80,137,89,35,5,163,179,164,112,91,43,167,240,184,
+24,17,206,187,101,204,104,94,34,254,166,74,57,114,142,182,21,9,33,154,221,101,233,127,6,52,19,115,221,192,209,188,
+4,125,135,4,214,105,117,102,32,55,3,13,141,122,53,22,211,74,254,30,179,180,33,86,219,125,154,201,54,141,49,157,
+154,63,155,54,94,8,125,78,189,39,222,146,70,71,213,127,84,102,125,35,80,56,89,227,29,40,248,122,170,33,29,245,
+124,170,174,159,116,16,80,189,204,23,129,255,128,44,229,1,222,242,73,84,30,61,141,150,103,19,106,82,28,231,7,147,
+37,116,111,103,157,25,208,10,167,52,109,32,229,153,102,178,5,23,213,14,210,96,98,40,81,30,189,15,124,143,188,178,
+58,184,59,148,226,102,122,148,31,193,230,220,211,118,75,10,59,171,108,148,213,163,253,181,101,64,229,155,234,236,231,128,
+85,192,120,192,50,152,129,151,249,171,45,230,250,181,83,123,112,108,115,252,139,158,247,120,197,139,242,213,234,64,171,20,
+122,37,234,176,255,51,248,75,175,12,168,120,184,106,119,235,125,209,47,162,252,112,19,208,68,211,13,193,58,32,233,106,
+107,156,182,149,3,185,251,80,91,23,190,105,6,204,192,88,12,132,172,116,232,1,79,42,195,147,58,172,161,59,85,120,
+242,74,63,189,56,242,114,209,107,255,111,5,50,224,237,64,122,172,166,68,12,12,233,192,60,13,211,54,0,33,203,101,
+205,10,218,162,68,81,182,41,102,160,25,3,105,234,15,177,255,23,226,19,31,19,49,112,59,174,180,69,70,22,217,54,
+139,167,12,126,212,25,118,23,88,62,131,223,102,94,52,147,253,164,102,55,124,173,112,6,38,36,4,13,226,36,233,72,
+87,39,245,27,224,100,240,162,58,180,122,40,170,107,93,11,146,118,156,43,142,138,171,37,12,3,122,246,147,102,0,109,
+133,119,113,147,96,191,207,53,117,62,38,201,123,77,188,55,189,244,14,87,15,33,111,46,6,254,213,212,69,113,23,215,
+71,245,3,57,212,207,139,223,73,114,248,183,87,24,24,82,95,223,146,75,234,212,84,157,125,10,96,25,155,1,189,203,
+247,0,234,164,181,164,103,64,125,57,235,130,211,65,150,58,114,250,16,63,247,241,1,167,251,68,248,252,170,207,210,48,
+112,63,142,127,1,70,165,241,84,66,183,202,11,23,1,189,135,180,229,251,229,224,135,224,75,32,132,136,167,63,133,80,
+100,29,102,160,110,12,4,235,48,164,98,171,109,48,146,202,52,73,29,214,208,93,136,130,241,239,53,228,173,172,81,158,
+32,132,97,41,159,175,16,65,90,71,247,24,152,148,160,46,1,154,225,18,82,180,44,127,7,160,14,50,139,25,40,51,
+3,89,102,117,133,26,36,47,51,47,33,109,123,20,101,119,102,84,56,47,157,88,235,100,244,155,212,219,214,56,60,5,
+204,151,212,67,2,119,207,224,166,89,71,111,2,175,118,146,147,129,137,241,175,65,142,36,117,32,109,255,121,53,184,13,
+232,188,151,242,46,129,107,155,164,164,3,57,211,227,214,3,57,57,83,76,157,228,145,172,25,159,36,56,54,155,193,171,
+129,160,195,64,168,237,212,100,152,58,84,191,75,61,252,151,28,123,37,59,17,112,214,206,220,89,241,187,82,175,12,239,
+179,112,23,32,62,23,0,229,177,185,250,44,110,161,162,115,47,138,14,0,155,131,163,129,37,59,3,26,4,216,4,232,
+249,127,49,187,154,84,62,85,206,252,141,242,238,15,32,94,33,148,74,129,29,143,97,224,58,206,118,3,111,142,185,82,
+157,19,245,29,156,5,52,120,163,85,56,23,129,88,254,47,62,201,121,124,31,255,226,39,207,246,161,57,77,176,119,51,
+80,93,6,130,13,228,80,9,95,33,5,13,195,82,184,173,141,83,56,92,130,200,78,147,51,194,31,243,226,61,42,167,
+14,123,15,199,192,220,33,84,145,55,190,26,66,143,117,148,142,1,117,118,105,203,129,53,64,176,242,24,93,111,131,61,
+40,11,110,119,69,28,38,44,101,103,96,178,12,6,190,156,193,79,221,189,168,131,58,139,104,160,109,215,44,30,19,250,
+217,25,119,154,65,63,115,66,247,73,157,105,128,220,210,27,6,52,184,161,250,108,146,213,21,234,48,56,29,188,170,247,
+85,143,229,35,194,191,25,36,221,222,77,101,87,200,119,119,143,163,223,243,224,245,77,151,164,114,227,16,135,139,243,255,
+68,48,203,144,235,89,255,42,15,236,71,158,212,42,156,107,178,42,9,228,239,114,244,220,145,67,215,252,57,252,218,235,
+103,12,108,204,225,82,160,78,205,137,62,187,84,203,95,117,186,126,2,52,200,57,18,220,10,206,1,170,35,124,11,168,
+189,186,11,207,204,189,42,207,99,112,205,146,130,129,152,183,232,120,56,94,213,78,20,215,226,189,40,137,59,214,67,117,
+212,23,101,103,149,244,30,139,177,123,130,151,42,98,244,211,216,169,129,234,165,129,86,28,14,157,0,182,57,215,52,160,
+29,66,212,95,217,56,64,228,242,34,4,171,214,81,27,6,146,204,148,75,74,198,8,28,234,229,146,164,21,166,25,232,
+150,177,25,8,177,252,248,134,177,213,250,74,15,25,152,60,80,216,89,58,58,3,5,109,53,161,24,104,152,117,42,149,
+115,128,179,193,50,250,19,80,70,163,235,119,224,132,128,58,173,202,12,20,201,64,150,242,237,129,34,13,234,83,221,234,
+12,216,17,100,153,48,242,101,202,175,117,233,84,56,55,20,55,81,121,168,14,32,117,140,133,172,143,202,68,205,42,61,
+73,39,150,158,48,160,244,212,150,67,157,218,4,26,56,185,7,252,135,188,213,243,89,153,216,64,182,252,159,102,62,107,
+112,41,137,253,69,118,170,97,66,173,228,155,196,118,250,132,49,86,61,231,202,33,110,79,228,127,168,1,139,167,208,165,
+201,48,167,112,44,139,168,211,43,205,164,201,70,187,23,108,252,227,243,206,12,68,239,167,216,225,111,56,17,166,140,47,
+244,193,81,229,173,6,161,245,44,189,14,62,0,42,143,85,254,169,67,255,93,160,78,93,173,38,120,7,60,31,157,63,
+206,241,25,160,193,172,215,192,128,240,172,196,167,62,22,195,128,182,170,91,14,252,25,108,7,66,247,165,41,253,15,5,
+7,1,75,78,6,134,60,15,135,80,158,188,140,202,189,65,168,65,144,156,22,14,242,174,29,14,110,3,154,80,163,119,
+158,202,129,86,162,137,87,33,38,175,60,129,158,253,90,5,226,235,102,192,12,116,102,64,13,173,32,66,129,245,146,90,
+63,40,75,242,38,159,16,167,75,224,231,238,32,129,247,143,146,165,114,70,69,252,31,146,83,135,189,135,101,32,212,114,
+218,251,194,154,101,109,61,102,96,17,194,63,13,44,26,216,14,53,204,254,9,254,20,88,175,213,153,129,224,12,124,86,
+101,24,80,155,182,65,170,142,135,255,6,55,168,79,21,170,65,25,113,173,78,151,243,193,230,25,162,170,250,162,202,149,
+115,51,248,29,228,37,178,101,14,46,158,8,190,49,232,102,184,63,15,17,111,53,76,45,189,97,64,171,184,38,76,16,
+244,43,184,81,158,210,22,50,101,17,181,99,94,5,179,130,78,237,164,79,112,227,193,28,72,8,32,90,81,147,164,13,
+169,160,212,177,124,149,78,144,137,193,133,96,9,253,201,41,74,203,27,193,214,148,31,15,230,212,21,218,187,226,168,206,
+214,73,50,40,78,58,64,150,65,117,95,123,17,111,103,130,149,64,136,206,75,212,116,77,212,57,171,1,26,13,202,104,
+240,69,131,211,170,3,140,0,26,148,121,4,168,141,250,17,121,93,131,55,150,106,48,176,11,102,222,10,14,4,195,2,
+153,172,114,229,183,224,160,64,250,172,102,108,6,206,224,210,121,224,31,96,77,48,5,232,165,168,60,184,5,104,240,230,
+164,132,134,236,142,187,133,18,186,109,231,76,3,69,191,7,42,159,44,102,192,12,100,100,160,83,3,37,173,218,52,141,
+153,85,80,126,119,218,0,250,213,61,29,27,95,34,110,83,231,140,223,11,84,198,206,207,169,195,222,203,201,64,175,95,
+248,229,100,165,154,86,173,134,217,127,7,115,22,96,254,101,232,220,180,0,189,86,105,6,138,100,96,166,148,202,213,121,
+122,125,74,63,118,254,25,3,26,64,86,25,145,164,147,125,40,103,250,86,206,201,212,51,54,27,122,35,229,255,111,227,
+254,40,48,60,165,191,52,206,115,15,56,165,9,204,110,199,98,64,237,1,77,44,104,39,163,185,169,206,196,11,200,83,
+237,220,117,251,158,236,86,71,231,23,65,167,118,210,199,184,233,20,79,156,88,18,48,176,120,2,55,177,19,117,70,199,
+178,23,39,171,198,127,114,28,149,150,167,144,23,183,200,161,35,184,87,61,27,209,224,183,58,221,213,241,165,1,198,180,
+18,106,119,128,180,225,86,202,125,196,179,108,158,7,40,31,108,9,102,4,101,23,149,163,234,220,215,228,133,135,35,168,
+12,27,211,47,83,178,50,22,211,44,57,24,248,15,126,95,6,195,114,232,104,244,170,213,87,238,63,106,100,164,152,243,
+15,81,187,17,248,30,80,61,90,3,58,19,129,110,136,234,91,154,56,115,5,248,23,229,193,105,73,2,109,40,19,167,
+194,253,230,32,68,101,237,88,194,63,46,73,248,118,211,159,12,52,228,43,69,112,118,48,3,88,24,44,0,36,122,143,
+93,13,6,38,25,248,253,37,74,198,150,78,13,148,177,125,180,191,162,17,214,73,219,59,25,115,87,3,57,127,25,243,
+207,39,71,4,160,96,171,0,58,172,34,44,3,179,4,82,167,70,197,99,129,116,89,77,239,24,248,49,65,107,22,213,
+180,5,152,160,202,153,244,91,204,64,191,51,240,92,191,71,48,116,252,26,42,193,87,80,129,214,76,243,52,157,166,141,
+230,108,136,255,7,208,247,199,198,139,237,206,135,84,216,15,198,237,79,64,145,147,19,52,19,249,212,118,54,249,94,225,
+12,168,61,160,78,103,117,30,140,223,34,180,145,92,215,32,206,64,67,173,133,155,94,93,126,143,128,199,116,130,246,202,
+136,154,133,155,102,64,255,209,136,155,13,57,110,31,128,39,173,192,218,7,28,26,64,87,145,42,62,200,168,124,154,140,
+254,106,227,45,122,79,141,71,132,215,0,123,130,37,65,171,178,139,91,165,17,149,83,107,82,142,142,40,141,69,54,164,
+72,6,190,129,242,163,129,250,5,66,137,86,158,169,236,211,192,130,165,0,6,26,234,224,210,126,30,229,205,121,28,151,
+3,59,128,21,192,156,32,164,104,112,238,109,112,47,184,18,92,138,13,15,112,76,36,67,234,237,242,243,91,16,34,207,
+169,47,107,95,41,180,212,154,129,175,19,251,13,192,138,64,147,166,244,238,29,58,72,168,213,164,175,129,171,200,143,234,
+227,58,5,12,200,144,231,41,190,92,187,99,232,129,156,143,97,48,233,64,142,18,208,242,57,3,75,124,126,154,233,236,
+57,50,245,37,153,124,218,83,145,12,104,246,67,8,121,41,132,18,235,232,46,3,67,42,66,135,19,250,230,96,178,2,
+172,184,27,157,27,83,6,168,51,194,98,6,170,196,128,6,20,210,206,22,190,179,74,17,44,161,173,135,96,211,177,96,
+104,165,57,137,169,90,201,179,43,101,219,61,148,55,255,74,226,33,114,179,8,71,149,129,95,5,170,176,23,41,119,161,
+252,137,34,3,176,238,142,12,104,48,237,30,160,116,152,175,133,235,251,185,126,70,139,123,189,188,172,142,81,213,221,146,
+12,228,168,161,153,196,93,47,227,83,149,176,23,75,97,168,86,32,124,1,236,13,210,190,63,240,50,72,52,176,253,51,
+112,253,160,171,229,252,243,70,70,179,62,205,232,175,78,222,212,39,162,124,176,39,152,177,66,17,215,123,60,116,127,78,
+133,162,95,43,83,215,37,182,135,129,44,171,242,58,17,165,1,204,179,193,122,157,28,250,126,48,6,110,65,147,160,126,
+1,13,162,125,9,124,29,104,96,77,19,27,166,3,237,38,195,104,96,95,101,187,240,36,208,42,60,77,114,184,14,220,
+6,158,5,3,146,179,227,91,147,146,55,139,84,229,57,188,139,231,93,128,251,180,242,176,88,65,191,81,127,152,242,249,
+166,96,59,176,32,232,180,26,77,99,10,170,231,253,16,252,0,104,37,219,95,193,13,192,2,3,161,95,252,122,48,167,
+74,200,236,36,36,234,215,41,88,254,147,208,125,223,58,131,135,109,136,220,36,57,35,248,135,156,254,237,189,24,6,94,
+14,164,214,51,173,2,17,217,3,53,122,17,29,3,54,6,69,116,96,222,142,94,205,74,245,32,14,36,88,42,199,192,
+242,88,156,246,185,80,7,177,37,59,3,199,227,117,91,176,100,70,21,154,221,125,18,117,151,159,113,60,167,131,142,137,
+185,191,31,216,18,200,95,55,228,244,110,4,226,48,90,51,64,221,254,19,242,135,6,92,53,96,248,27,48,52,237,239,
+230,218,201,32,84,29,9,85,193,68,3,51,234,32,73,50,64,147,101,48,52,152,161,125,166,72,101,69,82,249,47,14,
+247,7,234,12,200,42,234,252,82,27,244,39,224,137,172,74,186,236,47,13,71,141,166,125,210,248,199,231,131,25,160,172,
+154,130,43,251,0,189,211,212,217,212,45,209,64,176,202,64,117,184,106,86,126,218,186,16,94,198,81,231,232,211,58,177,
+244,53,3,219,16,187,223,129,161,239,210,144,145,254,46,202,180,66,228,111,33,149,90,215,216,12,12,25,88,121,15,23,
+103,69,24,112,76,153,164,178,94,131,57,83,2,77,114,24,14,244,172,191,8,94,0,170,159,168,111,72,255,81,55,110,
+146,250,10,78,51,201,47,240,149,119,240,80,246,29,0,206,207,100,129,61,85,157,1,149,45,42,195,190,157,49,34,122,
+55,106,32,91,249,112,55,112,45,168,189,132,30,200,121,0,70,91,205,188,27,74,182,26,63,122,89,168,18,93,119,81,
+35,55,143,188,77,1,126,68,30,5,246,91,122,6,180,252,246,242,210,91,105,3,135,50,176,4,23,78,4,139,15,189,
+17,232,191,102,223,220,8,52,187,97,102,42,126,106,128,142,15,102,4,42,223,39,4,26,72,82,5,74,101,238,36,224,
+163,232,191,94,138,106,220,235,191,102,252,168,65,249,33,248,24,168,82,249,74,116,254,6,199,81,64,3,245,175,3,185,
+85,37,242,62,32,253,114,63,32,67,42,166,241,101,31,205,64,59,6,190,220,238,102,147,123,202,127,23,55,185,238,75,
+233,24,56,24,231,199,1,61,195,89,100,6,60,253,3,168,140,219,163,133,130,95,115,93,3,70,195,90,220,47,226,178,
+202,170,179,138,80,108,157,169,25,120,13,31,39,1,165,201,198,64,157,17,234,60,191,21,104,16,231,138,130,59,31,8,
+34,147,232,93,153,116,165,141,202,163,34,59,80,50,69,160,130,158,52,168,60,109,66,187,53,200,38,172,159,208,125,51,
+103,170,235,28,13,182,175,88,189,69,3,14,89,196,19,125,90,176,70,189,121,22,110,29,6,212,209,148,245,125,216,66,
+251,160,203,42,251,84,175,86,95,201,99,224,34,112,63,249,239,41,108,248,78,244,159,67,106,145,94,61,15,150,62,98,
+128,60,209,24,155,223,242,103,55,160,54,94,145,162,252,191,23,184,23,92,83,100,64,214,221,158,1,202,5,189,163,52,
+192,43,121,240,179,67,203,223,65,153,165,165,171,108,55,102,195,155,6,184,243,202,237,40,216,39,175,18,251,175,6,3,
+67,202,47,173,166,81,25,182,96,0,235,151,71,199,142,232,191,153,163,158,17,141,98,234,80,75,9,61,144,115,8,44,
+174,147,130,201,213,82,184,237,75,167,100,196,133,136,152,10,201,60,162,25,143,150,114,50,16,234,25,43,178,113,81,78,
+230,42,104,213,144,23,215,143,136,194,159,192,204,5,70,69,101,199,47,11,212,223,74,181,42,141,234,232,82,190,212,30,
+188,111,129,143,136,191,26,169,239,68,24,201,241,25,240,38,208,128,147,6,129,212,128,213,255,1,169,243,203,55,230,192,
+199,129,61,162,211,208,240,16,142,239,73,227,193,110,7,51,16,61,119,39,243,188,110,194,157,60,245,176,201,241,175,202,
+249,15,193,245,224,9,48,63,88,0,204,7,116,191,219,114,19,241,211,0,130,165,199,12,144,14,122,79,188,72,62,59,
+147,227,221,64,179,75,117,77,239,131,39,184,175,9,3,101,20,217,168,9,16,73,90,135,122,159,121,181,67,254,84,84,
+89,161,201,37,73,68,29,215,251,129,172,229,139,234,41,251,146,255,14,77,18,88,137,220,40,63,78,147,209,158,17,25,
+253,245,181,55,202,38,181,193,255,14,212,57,52,126,224,200,234,61,164,1,180,91,192,21,224,223,228,185,151,57,54,147,
+169,155,93,76,120,205,237,195,132,68,85,212,217,225,216,253,19,48,113,151,236,159,150,112,14,229,217,88,149,163,222,213,
+3,66,222,141,79,125,172,23,3,234,219,157,46,103,148,95,196,255,86,57,117,216,123,53,25,208,187,117,119,160,118,97,
+40,89,11,69,91,128,35,67,41,172,170,158,80,157,204,3,241,167,144,191,134,130,95,13,154,164,122,39,195,253,138,248,
+187,174,170,4,6,176,251,8,116,36,109,188,52,11,238,29,248,219,241,255,217,59,11,184,91,138,250,141,211,221,221,32,
+221,41,157,18,34,72,55,72,8,40,161,127,9,1,81,64,5,21,144,148,18,9,5,4,36,37,165,59,37,165,187,238,
+165,187,27,46,240,255,62,175,187,215,115,207,125,207,57,219,117,158,223,231,243,188,123,222,179,147,223,153,51,59,59,51,
+59,59,216,9,127,87,9,2,26,188,200,194,238,205,34,16,135,81,8,1,13,0,233,226,178,9,210,231,38,154,122,244,
+227,5,25,83,7,47,236,228,205,217,35,179,154,204,121,15,13,65,55,211,254,223,194,241,38,52,96,190,81,8,73,244,
+205,113,74,114,58,107,204,220,102,213,166,198,140,182,145,206,53,209,172,129,172,153,82,228,78,109,129,252,255,32,69,24,
+89,122,61,35,203,192,28,86,122,2,180,235,31,19,202,253,233,67,42,44,4,213,105,13,152,235,216,203,62,192,129,39,
+114,122,81,234,125,94,253,9,77,208,68,185,31,18,239,37,123,7,57,168,139,199,248,118,39,116,235,160,103,43,248,37,
+253,164,48,85,203,243,97,162,240,159,24,71,5,112,123,12,247,125,225,20,174,226,121,50,82,191,53,202,111,189,19,23,
+173,10,214,130,166,23,144,22,154,60,129,196,251,62,212,115,225,82,80,190,26,60,79,106,234,83,219,154,73,64,79,138,
+169,189,138,210,46,102,73,96,62,2,59,21,173,158,101,160,14,171,118,4,212,70,126,63,101,170,213,62,106,193,215,131,
+41,195,177,247,122,18,56,136,100,103,57,137,19,82,248,17,31,60,145,19,210,200,240,248,20,97,105,96,32,170,157,131,
+195,105,163,58,110,160,187,164,55,35,33,138,186,173,40,11,211,221,23,71,6,48,110,108,185,9,75,147,231,197,240,124,
+69,154,0,236,183,16,2,115,19,203,95,209,178,133,196,86,191,72,116,179,42,125,11,173,140,222,71,255,66,39,162,219,
+144,173,191,8,108,68,118,227,76,118,106,64,234,132,254,66,148,107,110,111,34,244,3,209,81,40,78,57,224,188,146,166,
+129,180,139,42,153,50,39,170,78,4,52,168,59,21,138,50,120,166,21,247,95,214,41,115,21,77,171,38,131,163,240,86,
+242,39,64,113,7,222,117,237,80,31,99,11,250,229,47,113,172,163,109,150,48,209,95,225,239,234,132,126,155,236,237,15,
+100,174,211,36,142,234,139,164,73,195,47,130,227,56,28,245,123,215,196,201,221,232,53,116,39,122,82,74,185,16,73,97,
+39,53,149,175,173,121,4,212,151,89,7,69,109,23,187,17,208,53,42,238,147,91,43,227,103,47,116,88,183,128,125,174,
+209,4,14,37,119,105,218,38,193,209,61,254,41,250,96,235,59,2,187,145,227,229,114,202,245,2,57,133,91,171,96,199,
+200,33,181,55,19,102,156,137,156,105,24,232,254,41,29,32,61,58,218,87,70,190,247,32,195,105,26,200,23,224,182,79,
+95,65,171,89,102,41,227,36,171,231,6,203,229,140,131,125,233,239,202,37,208,54,73,247,127,164,230,0,20,62,157,82,
+110,226,234,17,251,196,36,115,75,180,38,58,27,137,97,109,173,165,62,104,160,73,191,253,183,144,6,1,6,44,229,141,
+126,24,76,147,142,59,196,204,76,184,210,181,175,247,196,141,201,172,163,243,160,62,158,68,189,213,66,129,31,163,184,131,
+163,29,195,46,233,196,13,196,171,85,253,54,19,72,67,64,191,131,233,80,148,173,150,94,197,221,240,54,62,77,164,125,
+238,55,78,219,19,119,96,243,51,216,30,137,180,42,184,206,150,116,101,244,80,50,237,58,58,114,201,235,169,172,217,131,
+175,53,97,163,122,242,46,122,29,189,140,52,65,243,44,122,10,105,242,111,44,52,252,233,151,140,251,115,147,19,118,82,
+203,99,44,39,105,90,236,47,33,129,150,251,7,133,160,129,239,117,81,156,118,81,254,218,77,245,250,18,116,22,210,19,
+216,97,125,231,99,79,83,189,82,155,249,0,186,182,167,107,59,104,26,129,173,201,208,226,41,51,117,59,254,183,107,13,
+35,227,118,179,53,104,127,174,22,129,105,73,206,78,40,175,235,147,38,166,119,65,199,32,91,86,4,184,16,205,134,190,
+70,113,76,29,167,190,51,0,189,19,7,82,155,91,49,254,81,223,65,171,97,134,41,167,175,218,202,46,201,191,26,232,
+30,201,8,104,52,52,125,112,92,129,227,110,104,31,180,57,154,8,77,139,166,30,201,163,191,200,132,0,108,71,65,75,
+161,167,81,220,118,15,47,182,22,2,226,119,35,90,8,137,107,38,101,148,103,32,97,58,131,227,28,28,247,67,215,161,
+55,144,236,69,116,41,218,5,121,130,143,194,128,67,168,111,243,249,51,20,199,78,196,113,45,234,70,158,245,46,235,176,
+3,166,39,196,41,136,10,186,213,117,118,69,148,53,30,135,215,103,4,168,67,227,163,231,80,175,190,155,174,89,27,162,
+52,11,178,250,140,238,224,217,133,225,158,40,15,123,153,64,119,64,225,117,103,240,4,84,248,219,32,237,234,211,39,237,
+99,30,23,230,191,194,217,44,60,105,48,25,3,77,21,104,18,142,210,168,168,208,62,70,16,223,41,28,147,218,147,120,
+44,156,159,35,204,150,128,202,16,169,78,234,30,34,11,251,148,64,14,66,97,219,55,39,159,111,71,113,219,145,231,240,
+51,67,182,185,117,104,85,39,64,153,63,139,210,216,75,120,94,2,133,245,175,208,118,181,234,124,155,158,62,202,253,87,
+105,42,79,68,191,215,171,126,217,50,38,0,212,23,34,22,64,171,179,227,51,78,70,165,131,35,227,91,180,102,62,193,
+103,237,243,108,171,1,1,202,86,47,129,79,107,135,18,192,95,209,29,232,77,244,9,82,184,81,59,100,114,255,20,58,
+30,121,208,33,97,189,129,93,216,33,153,129,207,187,34,181,117,81,203,0,167,182,8,4,174,194,205,172,40,97,41,21,
+231,77,105,12,180,19,199,123,81,55,123,156,147,219,163,208,79,113,9,173,72,76,173,121,231,179,202,57,142,169,13,155,
+11,249,102,32,227,242,12,152,142,195,241,95,168,215,224,53,78,42,105,186,190,185,110,100,92,55,250,45,184,160,14,205,
+194,241,131,30,181,92,215,125,77,68,123,161,76,6,149,4,142,191,236,193,59,238,105,181,99,87,163,133,50,72,94,169,
+65,144,7,181,107,26,172,79,98,95,226,105,101,228,182,177,212,82,236,28,121,80,54,103,39,41,220,192,207,195,10,195,
+86,111,2,148,225,132,232,159,65,153,166,61,188,69,0,59,163,129,223,189,142,161,241,249,116,52,12,197,177,107,113,172,
+62,162,219,145,16,100,195,142,97,217,6,199,19,57,166,177,15,241,188,13,26,169,254,53,12,155,179,211,129,0,101,127,
+19,202,219,134,16,65,135,20,248,235,196,4,128,170,21,0,113,77,157,238,205,19,71,90,51,143,228,85,43,28,146,154,
+111,30,107,84,222,20,178,202,171,74,166,167,5,188,231,109,130,58,4,183,185,209,153,232,109,100,203,143,192,49,4,157,
+160,132,138,245,162,52,162,125,145,110,154,162,152,38,35,206,69,147,161,98,19,91,129,216,148,231,64,107,112,252,28,197,
+177,43,43,144,133,70,38,129,66,8,203,69,71,213,207,34,39,167,213,247,251,8,165,53,175,58,111,100,237,44,54,83,
+84,194,177,208,90,168,87,251,164,223,136,250,1,211,20,155,194,102,198,6,199,159,162,172,76,237,201,95,154,66,138,188,
+28,134,146,182,201,207,52,133,67,83,243,65,217,234,186,123,62,74,106,15,224,177,169,120,250,38,95,148,225,25,73,43,
+64,155,191,231,249,127,248,228,45,159,7,250,119,173,32,249,238,112,20,167,223,165,9,225,29,81,225,79,172,181,166,219,
+159,243,35,64,217,134,247,1,203,198,172,27,56,31,193,84,87,244,234,8,91,159,18,160,252,181,59,87,156,246,101,132,
+10,20,227,31,237,122,210,167,148,255,155,237,184,251,12,71,130,197,254,135,251,224,240,163,72,142,255,231,72,105,209,19,
+7,89,189,83,228,127,33,87,236,19,121,212,59,132,102,78,145,172,19,96,172,61,124,109,245,32,16,247,183,144,119,174,
+166,36,130,221,169,135,151,231,29,81,221,195,215,5,34,208,2,28,245,30,175,123,209,15,144,183,201,202,183,112,215,38,
+248,57,242,141,34,147,208,183,37,148,93,81,212,253,205,245,66,249,77,208,213,104,13,212,143,54,61,153,62,22,105,191,
+249,168,166,247,158,232,29,74,182,28,8,104,207,234,22,109,74,20,7,161,15,115,136,170,61,200,23,249,66,251,27,167,
+221,67,89,47,123,62,179,61,112,255,111,2,9,8,168,141,94,10,245,122,63,142,238,30,135,162,47,145,45,61,129,87,
+8,34,139,247,91,13,33,28,245,209,118,78,159,164,114,67,8,250,158,235,7,121,73,250,174,140,211,202,205,133,99,143,
+72,32,205,147,125,195,223,219,19,49,46,59,171,0,129,150,251,75,221,103,30,72,146,212,247,74,107,143,19,128,222,165,
+117,67,75,159,110,164,119,74,114,110,79,220,252,4,233,61,158,81,76,125,180,223,162,180,239,76,137,18,151,221,20,72,
+32,172,135,45,81,170,79,62,126,203,255,113,63,106,108,233,136,184,158,236,190,81,4,166,35,55,105,234,80,84,24,186,
+135,236,107,203,101,34,39,32,122,84,2,178,227,225,231,249,4,254,234,230,229,12,18,156,148,253,235,92,128,119,171,91,
+134,251,60,189,239,84,48,255,26,164,88,147,11,248,141,21,76,91,213,146,180,23,9,186,22,169,211,91,196,133,169,106,
+249,47,35,61,179,16,169,6,211,42,105,65,199,119,74,18,183,29,210,49,174,125,27,15,90,125,247,135,176,19,173,99,
+159,152,174,127,179,197,204,171,94,56,124,122,76,63,118,158,144,0,125,140,253,240,170,65,133,39,18,6,209,203,155,6,
+15,254,136,22,71,26,120,29,27,165,177,161,120,190,51,77,0,246,107,2,1,1,109,61,171,133,4,189,6,206,53,233,
+240,2,210,36,162,45,61,129,15,8,34,233,125,145,98,255,12,105,178,127,33,218,175,75,144,190,171,187,205,76,6,254,
+132,146,246,59,95,194,239,121,117,135,208,39,233,143,179,176,165,29,201,23,237,95,248,255,90,17,88,143,212,234,254,82,
+47,239,78,99,55,224,121,53,244,72,148,64,104,35,213,167,214,194,50,93,199,162,216,52,56,58,0,121,33,99,20,90,
+53,113,163,107,101,203,245,82,227,139,139,164,72,250,45,248,221,56,133,127,123,109,6,129,79,11,202,198,109,5,197,83,
+217,104,210,116,154,187,102,138,70,225,215,56,120,191,171,163,193,79,234,101,131,111,14,126,170,254,223,146,183,121,201,197,
+194,9,115,50,12,127,186,216,219,42,78,128,114,158,0,105,139,193,251,73,106,220,65,203,34,115,183,18,105,252,87,145,
+17,86,57,46,88,132,79,224,232,56,39,105,189,16,29,140,166,174,114,186,27,154,182,170,51,87,103,117,185,20,236,245,
+20,207,175,208,205,104,246,20,225,212,201,235,249,36,118,165,4,9,62,41,129,31,123,73,65,128,62,220,149,120,87,95,
+69,43,69,135,162,44,108,40,129,232,125,136,26,16,80,221,127,29,105,208,60,173,105,162,125,192,90,110,72,195,175,124,
+52,129,72,4,184,230,107,129,139,174,251,115,69,242,240,223,201,195,207,35,186,181,179,238,4,94,227,116,146,167,155,244,
+228,224,245,104,43,180,5,42,226,73,66,162,201,207,130,126,232,4,196,160,254,167,38,115,146,218,5,120,124,42,169,103,
+251,43,148,128,158,4,76,106,154,196,180,213,151,128,250,88,147,164,72,190,86,129,93,135,214,69,47,199,9,135,254,210,
+141,184,95,7,13,141,224,79,179,227,43,163,31,69,112,107,39,245,35,48,5,73,254,37,74,186,10,98,40,126,119,66,
+73,174,227,120,179,53,136,192,147,228,69,11,73,242,182,203,243,142,160,175,195,167,51,170,23,64,39,53,189,115,64,147,
+30,141,50,242,164,23,242,38,181,211,26,5,163,97,153,161,80,55,71,183,160,119,81,210,253,172,241,90,184,233,29,5,
+203,52,172,56,18,101,7,14,225,68,206,82,124,190,166,240,146,112,132,173,4,180,82,172,146,70,34,85,79,210,188,156,
+182,53,159,250,252,14,250,51,154,5,133,117,176,146,121,143,147,168,150,188,140,199,231,235,80,146,118,113,8,254,6,246,
+229,142,19,183,221,102,71,0,254,115,161,223,162,71,208,199,40,142,189,132,227,27,209,143,209,180,104,120,253,14,62,63,
+203,49,141,169,78,125,23,13,132,155,93,174,29,82,191,17,160,14,77,141,14,65,178,94,109,149,238,81,22,68,185,45,
+136,235,39,254,112,212,239,247,77,20,213,180,15,255,13,104,121,52,6,26,222,174,212,157,27,121,209,75,197,117,47,145,
+198,158,174,59,135,126,73,63,133,172,186,155,230,58,248,23,133,97,171,23,129,160,220,207,226,152,198,190,194,179,238,29,
+82,101,30,255,139,162,215,80,20,123,1,71,141,27,159,75,5,176,1,158,41,211,127,69,41,252,14,110,52,238,245,125,
+212,152,235,112,3,138,180,212,44,80,23,110,68,121,218,167,4,62,37,42,53,159,141,143,28,192,143,166,40,69,189,36,
+62,139,213,154,149,224,76,94,246,73,193,226,153,74,100,194,137,24,129,0,229,169,173,145,52,184,53,44,69,217,86,193,
+107,172,85,60,35,64,104,208,63,20,132,58,33,83,161,203,170,80,40,125,156,6,93,55,180,106,191,146,70,218,84,79,
+30,202,161,124,212,25,62,15,45,129,42,153,247,56,137,82,30,144,94,186,250,56,74,106,123,224,113,224,230,32,78,220,
+118,155,15,1,202,98,105,244,11,116,9,186,27,105,0,74,19,145,122,233,228,16,116,31,58,7,233,218,184,10,210,83,
+214,3,229,55,200,113,17,190,211,64,68,26,243,181,43,159,162,238,187,80,169,132,243,163,40,237,186,234,172,234,185,39,
+113,50,170,37,176,84,27,161,1,194,168,38,254,3,109,75,70,73,40,45,24,242,209,218,62,206,200,255,247,68,133,208,
+193,157,238,157,181,50,218,86,3,2,148,149,202,127,104,135,178,140,242,245,177,10,195,86,47,2,148,217,134,232,195,40,
+5,220,193,205,23,124,127,42,26,104,63,210,230,158,112,54,65,90,160,208,203,180,200,225,31,104,44,148,73,220,105,211,
+110,255,233,8,80,142,191,68,73,199,177,116,189,217,49,93,10,236,187,105,4,168,19,186,7,204,211,110,38,112,183,63,
+121,87,28,32,47,131,244,35,79,106,186,97,210,158,250,181,54,242,160,21,86,73,57,232,66,95,245,109,134,106,93,62,
+81,19,175,114,64,39,163,55,80,175,21,155,56,169,141,41,47,73,183,252,139,138,175,242,238,96,160,139,194,1,181,41,
+181,230,38,244,247,42,139,170,154,210,134,158,207,17,191,86,154,220,128,54,66,3,29,21,29,235,102,164,249,24,244,17,
+74,106,122,42,110,52,228,206,90,221,10,63,66,122,41,215,95,37,173,24,45,254,206,138,16,149,157,152,64,87,2,212,
+167,49,145,86,148,126,220,82,183,58,125,84,155,118,34,210,86,108,182,12,8,192,82,109,124,156,167,92,31,205,32,218,
+74,4,17,228,93,249,215,36,206,131,40,141,169,47,127,4,170,68,222,156,136,222,4,84,86,72,247,148,73,237,96,60,
+246,142,200,46,42,69,128,50,187,54,105,129,227,239,115,164,197,193,3,125,99,29,211,26,97,168,175,189,41,122,27,245,
+50,141,75,105,226,103,32,254,180,113,219,127,121,4,40,195,56,79,99,181,215,11,93,111,78,69,229,101,192,49,87,146,
+0,117,66,11,163,52,217,156,151,105,162,168,239,219,159,220,87,147,177,255,230,191,169,97,187,34,189,24,52,137,41,141,
+91,82,88,90,209,59,109,146,0,42,226,71,143,185,143,157,32,45,226,182,49,28,181,151,188,173,4,2,212,59,173,26,
+254,59,122,143,232,95,69,218,31,118,74,148,116,31,81,188,86,206,148,151,205,42,151,170,226,19,164,125,138,181,95,176,
+173,60,2,26,152,253,99,121,209,71,142,57,207,253,95,199,33,21,223,65,231,161,33,232,47,104,62,84,105,163,141,12,
+111,42,247,230,179,248,252,12,37,125,81,243,187,248,253,13,74,218,119,192,171,173,226,4,150,202,32,125,215,102,16,134,
+131,48,129,153,64,176,17,26,47,2,10,181,77,231,34,183,77,17,96,197,112,114,87,12,183,115,112,141,153,89,215,156,
+134,216,154,228,227,86,180,96,202,252,92,203,253,226,30,40,101,48,246,94,48,129,164,253,36,37,243,237,130,211,234,232,
+18,18,80,123,21,72,125,159,21,18,6,243,25,254,142,224,55,126,144,126,231,161,18,134,213,234,77,215,51,221,115,252,
+30,125,210,122,98,144,207,122,135,151,250,247,147,233,92,131,218,97,101,167,223,236,112,50,156,116,177,184,234,203,182,253,
+6,204,249,141,68,224,17,92,221,30,201,101,124,71,95,224,229,180,248,222,236,35,49,1,26,249,211,81,90,211,99,127,
+127,79,156,136,146,60,146,102,61,254,149,212,254,86,82,178,251,58,90,10,107,102,116,60,210,150,49,90,113,208,15,166,
+23,145,247,181,81,200,107,247,67,65,87,52,143,90,225,117,52,154,2,85,250,198,32,72,223,153,28,139,52,189,19,224,
+17,244,103,180,16,42,253,183,170,52,180,72,19,222,122,2,39,206,123,14,112,62,168,233,73,220,253,75,207,160,19,144,
+43,1,202,56,206,86,74,131,85,148,247,248,114,194,92,19,233,192,251,130,0,245,72,215,254,151,6,171,100,109,223,169,
+63,168,1,119,91,134,4,96,170,107,201,212,40,206,10,206,253,229,175,238,70,30,126,139,212,150,165,181,203,8,192,51,
+56,53,171,16,148,153,234,126,154,242,215,83,20,53,203,117,127,38,55,40,107,149,247,249,40,137,233,73,156,157,80,46,
+0,21,46,26,27,233,94,76,247,28,221,76,105,217,25,201,79,46,233,113,160,249,18,160,220,254,132,116,191,149,196,180,
+13,237,191,109,26,67,0,0,32,0,73,68,65,84,4,200,229,159,111,49,213,50,244,160,94,236,146,164,98,69,240,243,
+80,45,161,228,144,232,49,114,8,115,208,32,89,49,176,53,5,163,173,155,22,24,212,65,180,47,181,141,129,194,217,128,
+227,94,132,121,66,52,111,229,185,34,173,103,16,123,210,85,23,15,147,199,237,203,75,125,255,197,28,212,173,131,201,249,
+108,72,245,173,159,76,79,27,245,187,205,81,3,0,95,145,70,173,156,26,19,233,41,177,79,131,255,181,42,239,115,164,
+213,90,111,34,245,172,245,249,29,36,183,250,95,110,213,238,171,110,235,156,86,85,141,27,252,175,207,90,141,44,183,58,
+234,123,125,214,64,233,88,72,166,207,122,90,228,75,164,115,89,216,135,4,114,55,218,159,246,238,182,44,2,44,40,140,
+123,136,231,7,5,197,165,104,84,110,243,5,210,254,247,122,49,233,19,28,175,67,55,161,59,224,199,161,80,155,147,216,
+182,66,122,138,109,110,20,214,19,62,166,178,127,224,123,255,84,33,216,115,101,9,80,111,149,182,111,161,233,82,38,82,
+237,134,218,15,155,9,36,38,64,125,156,6,207,171,160,40,79,253,235,58,123,75,226,200,236,177,27,129,215,57,169,45,
+211,116,175,24,197,182,195,209,254,81,28,86,209,77,208,14,158,64,218,148,143,52,253,41,53,168,55,163,109,209,64,227,
+202,209,86,31,2,83,145,84,245,171,147,152,202,91,79,8,218,234,67,96,38,146,186,100,194,228,158,133,63,181,25,121,
+154,238,35,15,64,179,162,239,163,81,209,96,166,254,254,15,209,249,232,45,100,171,17,1,174,63,171,146,220,237,209,104,
+9,146,253,34,126,116,239,247,81,2,191,246,210,63,4,212,86,45,143,244,180,123,150,118,102,150,129,213,57,172,49,138,
+76,60,131,76,11,210,112,168,147,62,111,202,120,53,224,248,23,194,250,53,199,77,171,58,248,71,250,110,36,125,43,161,
+36,246,178,120,37,241,104,63,241,9,80,86,127,193,215,102,72,91,107,245,171,93,210,175,25,111,201,119,167,14,107,139,
+147,220,62,14,35,100,13,74,170,19,253,60,210,205,217,155,232,97,244,49,210,32,135,206,61,135,94,70,154,108,209,119,
+154,212,25,176,188,7,242,249,157,168,237,29,31,125,134,22,65,211,32,61,90,63,113,112,212,13,74,56,217,163,65,49,
+117,244,149,78,185,145,31,221,116,234,127,77,40,233,90,112,27,250,39,186,27,213,205,174,32,193,71,162,36,157,224,180,
+121,85,156,26,4,151,86,70,170,3,218,215,250,5,142,87,34,213,145,123,208,27,129,56,112,55,150,114,162,135,240,231,
+32,152,213,208,26,104,1,52,35,202,58,255,247,17,230,182,200,214,108,2,155,144,189,209,83,102,241,142,148,254,237,221,
+4,68,96,69,180,30,138,210,150,169,141,213,53,203,150,15,129,127,19,108,212,137,156,25,112,187,35,58,49,159,164,228,
+19,42,215,81,5,188,50,58,6,205,167,127,82,218,53,248,255,94,202,48,236,189,60,2,83,16,245,216,9,163,215,61,
+139,238,11,108,245,33,176,12,73,85,223,57,174,221,140,135,92,251,198,45,247,8,218,141,100,111,226,155,51,80,167,180,
+170,173,94,31,157,220,201,129,191,175,44,1,93,127,116,191,30,215,222,195,195,142,212,149,7,227,122,180,251,190,35,240,
+5,57,62,20,105,188,104,182,140,114,175,251,190,115,50,10,171,246,193,20,58,145,19,208,210,224,207,147,104,246,12,232,
+105,16,235,22,46,54,79,115,220,154,70,229,174,12,194,204,36,8,210,164,6,46,233,68,204,59,248,93,50,147,132,56,
+144,174,4,40,167,139,112,160,27,160,164,171,161,186,134,95,163,147,159,242,251,185,190,70,233,205,43,169,207,230,21,112,
+75,184,154,196,248,0,61,143,238,71,26,24,210,160,251,80,202,64,109,89,84,123,63,170,195,172,220,145,62,173,190,9,
+87,224,220,212,43,92,126,95,161,19,173,54,253,50,248,71,147,58,154,180,250,128,240,130,175,234,117,8,210,253,52,249,
+123,132,148,39,109,231,179,204,180,6,32,167,12,180,88,75,192,186,193,127,13,169,227,253,24,233,213,196,142,38,8,95,
+65,90,81,245,18,146,105,2,81,215,83,221,92,170,45,156,20,105,114,110,81,164,213,162,250,94,223,105,176,33,207,126,
+195,189,132,191,37,250,10,217,154,77,96,133,148,217,83,27,242,247,148,97,216,123,159,19,160,77,84,251,189,49,210,164,
+64,47,211,53,236,113,164,69,8,182,124,8,28,79,176,59,160,40,215,25,117,32,246,65,181,154,200,33,189,127,68,154,
+128,154,4,165,49,213,71,181,129,187,164,9,196,126,75,39,160,126,154,250,60,73,22,54,168,147,253,86,233,57,112,2,
+226,16,208,56,88,92,211,253,222,230,113,61,165,116,255,24,254,53,153,115,22,26,183,67,88,99,241,189,250,236,231,35,
+221,103,216,106,64,128,126,207,159,73,230,60,9,146,170,5,153,127,64,87,38,240,107,47,253,73,64,227,91,234,163,168,
+175,162,69,11,105,236,19,60,159,132,52,110,102,43,147,0,141,136,246,86,204,218,94,36,192,61,75,206,215,22,164,225,
+163,20,25,211,128,154,45,103,2,148,207,121,232,179,20,229,212,52,175,231,229,140,188,22,193,83,168,122,63,203,195,25,
+23,238,199,132,119,13,210,94,180,223,71,51,34,239,41,91,139,26,209,61,145,148,227,33,168,206,22,238,141,28,30,203,
+204,203,227,68,190,52,26,248,109,232,104,107,38,129,160,140,181,226,51,141,61,209,76,58,206,85,145,4,168,128,191,65,
+122,154,49,138,61,137,35,13,90,217,114,36,0,227,184,239,21,61,10,63,149,191,110,144,198,153,208,181,40,139,235,237,
+251,132,115,24,202,177,36,28,116,17,4,40,195,213,80,82,123,23,143,69,36,211,113,100,64,64,101,133,206,74,80,216,
+133,79,86,7,105,29,131,227,133,232,235,46,105,214,152,215,247,50,192,227,32,10,32,64,89,237,139,244,126,163,184,38,
+63,251,32,143,95,20,80,78,77,139,130,122,179,37,138,218,215,198,233,72,166,126,211,41,200,245,175,42,149,131,194,208,
+197,44,139,14,45,193,140,96,26,160,191,27,45,83,84,94,137,107,3,244,60,74,99,122,217,97,235,106,234,162,146,223,
+23,241,192,118,50,116,46,138,243,50,85,156,55,222,188,138,38,248,5,80,210,186,64,28,148,81,137,235,29,38,187,5,
+97,250,194,211,192,86,134,178,93,18,61,131,108,233,8,220,131,247,9,26,88,69,156,165,65,8,80,214,43,160,110,3,
+3,81,106,211,57,131,4,237,175,42,70,128,130,76,251,212,65,110,57,34,109,171,163,251,162,84,54,220,232,94,229,239,
+104,234,220,18,228,128,7,8,192,120,71,20,167,125,248,4,247,155,163,202,246,179,72,219,126,40,205,32,6,222,135,219,
+179,124,218,196,213,165,25,4,40,203,237,134,151,108,252,15,111,224,165,25,32,250,32,23,42,43,116,85,204,98,214,181,
+71,79,197,23,106,65,90,149,222,69,209,91,168,147,169,173,62,9,141,134,10,77,163,35,139,71,128,242,81,159,39,201,
+34,170,97,248,251,155,202,55,84,188,152,237,186,223,9,4,245,230,39,28,181,155,73,18,187,26,79,174,127,85,171,72,
+20,138,10,53,207,39,35,20,182,158,212,57,14,141,151,101,254,9,79,55,14,154,48,210,138,251,180,166,21,13,218,210,
+198,150,3,1,216,158,142,62,77,91,72,13,244,255,37,121,218,35,7,228,181,12,18,22,186,72,204,128,116,193,72,106,
+154,208,253,25,170,37,3,39,58,58,1,149,49,250,45,178,37,35,160,27,192,107,209,76,40,58,120,187,172,53,1,202,
+58,139,201,114,109,135,101,171,40,1,202,88,131,58,83,161,194,7,160,162,32,33,93,106,115,174,64,234,3,69,49,109,
+77,233,58,23,5,110,74,55,112,214,117,117,104,148,66,105,113,243,18,159,103,69,41,99,207,214,59,233,209,83,216,122,
+218,52,11,211,128,238,117,104,66,148,109,66,29,90,105,4,40,203,77,81,82,83,221,42,45,237,142,56,30,1,149,21,
+186,55,65,97,159,16,47,166,244,174,131,180,42,189,186,150,159,140,212,95,239,100,15,112,98,90,148,62,98,135,144,11,
+1,202,102,74,244,28,138,107,186,238,28,153,75,162,28,104,223,16,160,14,169,45,145,214,68,151,33,77,14,70,181,11,
+112,56,51,10,195,232,27,110,181,200,40,5,179,20,122,22,21,97,106,144,52,105,242,50,186,30,105,128,95,131,10,139,
+160,21,144,46,68,19,161,121,5,143,227,42,104,73,180,39,186,24,169,211,164,39,103,20,78,86,246,42,1,45,92,139,
+194,170,89,34,225,170,149,125,221,86,146,100,85,134,117,12,71,141,232,153,53,43,210,92,147,11,143,240,34,177,34,159,
+111,66,113,76,19,198,71,160,169,209,64,56,185,38,214,129,151,78,32,40,231,177,56,254,21,217,226,17,208,0,234,217,
+40,252,205,149,94,158,78,64,49,4,40,115,245,163,210,152,250,96,211,20,147,90,199,18,151,0,101,51,58,90,16,109,
+134,146,188,76,55,110,148,177,220,147,166,73,208,193,40,234,202,212,207,113,251,71,249,139,21,145,29,39,34,0,103,93,
+19,116,207,21,215,180,45,238,180,137,34,205,216,19,233,88,8,233,30,83,117,39,11,123,155,64,196,36,227,148,58,184,
+178,9,80,166,91,164,168,32,183,187,78,148,93,130,209,227,87,89,161,243,18,148,183,38,81,244,228,250,119,80,161,247,
+151,65,124,243,113,252,0,117,50,245,201,52,142,22,29,134,93,22,74,128,178,185,186,83,225,117,249,94,245,238,34,84,
+104,90,29,89,243,9,80,167,54,71,106,211,186,237,146,244,33,231,79,68,179,52,159,72,3,114,24,20,150,158,160,41,
+219,212,112,201,194,227,127,255,203,231,239,203,13,40,186,74,102,129,226,58,14,85,161,62,229,83,115,210,133,42,46,122,
+129,161,173,133,0,76,134,15,42,243,89,55,226,127,67,221,6,123,52,25,118,51,250,5,242,32,79,11,203,126,248,72,
+153,135,245,101,10,62,107,50,39,203,9,126,130,107,172,105,127,255,82,223,103,215,15,245,179,74,121,164,188,195,223,138,
+158,210,248,52,101,205,214,138,214,42,101,175,239,211,66,121,140,137,180,8,74,171,62,53,216,164,246,240,140,170,129,33,
+77,122,154,97,55,164,119,75,68,181,59,112,248,157,170,229,165,169,233,129,181,218,10,213,167,7,81,92,211,192,128,252,
+22,134,71,113,181,104,102,62,95,136,62,66,89,152,238,67,111,68,243,160,129,120,10,203,152,35,42,132,0,229,250,3,
+148,212,52,56,91,72,58,29,73,122,2,42,43,164,235,79,82,251,28,143,183,162,117,210,167,38,90,8,196,165,52,143,
+138,30,64,157,76,237,221,10,40,90,160,118,149,59,1,149,69,139,206,231,115,92,211,181,231,12,228,235,78,238,165,213,
+127,17,132,245,138,227,122,232,52,244,20,10,237,89,62,156,137,54,65,174,127,117,170,30,20,216,220,72,55,233,77,31,
+16,83,3,121,69,157,202,166,78,105,133,237,62,200,147,56,64,104,51,213,187,33,200,219,169,69,168,208,112,210,5,100,
+85,164,213,184,151,35,13,232,92,134,244,152,249,78,72,147,61,3,23,25,29,109,253,77,128,58,112,44,202,106,0,135,
+160,26,105,234,160,109,138,250,187,178,244,89,238,85,222,129,182,231,152,214,142,33,128,62,35,88,205,236,170,28,208,196,
+232,251,232,56,164,193,158,79,144,38,235,254,142,70,173,74,202,73,139,38,154,118,65,154,72,86,95,40,138,233,201,193,
+13,171,146,135,126,74,7,220,215,69,73,182,174,214,19,127,75,22,197,138,184,244,27,152,29,253,3,117,91,181,206,233,
+88,246,26,174,127,91,84,62,28,79,57,4,40,227,52,79,228,252,25,255,229,36,220,177,198,38,160,178,66,211,32,77,
+200,164,49,141,145,169,47,253,43,52,3,138,157,150,40,30,20,110,160,241,56,62,130,58,153,198,91,214,65,81,130,181,
+155,2,8,168,44,2,237,206,177,219,83,15,156,30,212,110,228,219,48,140,2,82,236,40,250,153,0,117,77,11,112,230,
+68,115,33,191,106,164,238,149,129,66,92,24,233,253,51,81,111,182,112,90,27,211,141,161,247,155,204,177,146,194,247,213,
+218,212,134,252,19,170,223,144,86,159,222,133,246,201,17,187,131,54,129,190,38,192,239,75,157,222,173,209,115,200,54,34,
+1,61,189,166,213,163,122,113,234,192,205,65,95,87,150,62,203,124,88,230,28,47,66,105,76,215,51,61,241,209,103,4,
+171,153,93,202,97,18,164,167,111,244,142,18,13,22,180,46,194,122,136,255,11,27,80,239,70,136,116,104,18,103,87,164,
+190,80,107,26,249,183,171,105,85,224,28,221,194,246,185,124,8,192,93,215,137,63,117,45,157,206,39,223,224,212,79,81,
+62,137,11,66,37,252,245,209,37,40,203,5,28,10,75,3,244,149,123,231,79,174,48,251,52,112,202,121,51,164,235,90,
+18,59,4,79,125,74,174,126,217,86,89,5,122,44,73,97,119,240,163,73,148,251,209,111,145,38,148,51,233,95,7,225,
+232,9,86,173,152,191,1,169,15,223,201,180,5,210,234,168,126,133,210,208,20,171,44,208,214,40,201,226,2,109,255,55,
+65,16,70,38,245,169,161,152,157,45,19,48,129,110,4,104,68,166,69,186,224,117,187,128,112,186,54,246,10,41,93,187,
+91,158,125,46,29,1,248,38,189,241,171,77,37,10,18,170,193,8,173,234,209,138,197,231,144,126,39,119,162,11,144,24,
+172,155,142,164,125,155,128,9,196,33,192,111,46,188,73,91,150,207,90,157,219,148,235,22,89,73,101,154,88,223,47,14,
+75,187,109,22,1,202,63,252,109,104,192,63,141,189,210,44,50,245,205,13,133,184,0,186,20,117,122,194,69,79,230,92,
+132,198,47,51,151,196,63,27,250,27,122,19,197,177,151,113,188,20,26,163,204,244,247,107,220,112,87,155,161,129,68,61,
+229,149,196,116,253,189,30,205,135,194,246,39,53,78,194,154,6,29,137,244,228,79,156,73,65,156,119,53,77,132,94,131,
+150,64,169,211,233,0,234,65,128,178,214,19,202,73,109,111,60,214,35,163,78,229,240,54,136,50,59,32,105,129,247,240,
+167,133,194,26,15,184,12,237,138,22,67,3,241,246,194,31,184,83,123,59,63,210,228,205,193,232,65,164,235,120,47,123,
+18,7,51,162,94,209,248,124,65,4,40,139,229,145,22,52,196,177,175,113,172,107,230,152,5,37,211,209,152,128,9,164,
+32,80,249,155,147,81,71,29,245,85,242,55,47,141,202,130,28,15,69,43,160,113,81,221,236,51,18,124,54,249,217,174,
+110,9,175,97,122,87,173,97,154,59,37,89,189,162,47,209,71,232,1,116,31,186,17,61,67,93,122,138,163,205,4,76,
+160,34,4,248,77,134,41,185,157,15,183,115,221,186,148,227,190,104,94,52,58,234,55,251,130,12,171,189,218,11,61,220,
+111,153,119,126,255,75,128,223,65,136,98,126,62,76,17,254,147,240,248,116,66,127,246,150,17,1,202,115,52,130,90,0,
+237,141,190,139,198,70,131,153,250,234,203,35,109,67,250,39,218,199,175,7,115,148,215,119,65,58,55,37,252,237,209,18,
+104,194,24,113,169,207,245,59,244,32,233,30,22,195,159,157,102,68,32,184,158,106,165,183,202,240,58,52,67,204,160,117,
+205,93,25,221,137,110,70,127,68,183,161,216,70,26,150,193,211,6,104,69,164,235,249,120,40,43,211,239,226,33,244,107,
+116,89,75,63,34,171,240,29,78,181,9,116,106,63,163,164,250,141,40,142,236,166,114,4,206,36,69,223,67,186,46,101,
+105,26,215,251,86,160,239,115,252,28,125,136,94,164,13,123,139,163,222,203,172,227,167,104,106,52,41,154,8,233,230,101,
+226,224,255,169,56,234,218,61,22,26,126,83,195,231,78,166,14,158,218,216,151,58,57,240,247,249,19,160,124,91,35,89,
+146,127,206,70,83,182,126,217,227,179,174,67,39,161,157,123,184,243,105,19,48,1,19,72,78,128,198,234,71,232,41,164,
+167,17,170,110,90,17,118,7,154,57,121,142,237,51,14,1,88,191,83,245,74,209,35,125,90,149,119,50,90,23,77,16,
+39,239,118,107,2,38,80,29,2,252,126,195,21,120,91,241,89,215,129,126,50,189,235,110,11,20,50,168,78,193,56,37,
+133,18,104,169,3,26,208,79,107,63,45,52,241,142,108,36,2,20,224,244,232,36,20,101,203,14,245,129,245,68,197,34,
+168,176,201,108,226,90,25,233,169,137,71,81,92,211,189,133,222,119,150,118,210,113,36,118,254,34,62,1,202,65,215,16,
+93,67,211,246,237,213,183,126,10,29,136,86,67,122,178,102,248,245,169,229,243,140,124,94,11,105,69,250,133,72,239,170,
+145,223,172,77,171,159,159,70,63,68,195,211,17,159,144,125,212,153,0,101,191,2,74,106,155,224,177,206,217,239,219,180,
+83,110,63,64,105,219,180,164,245,38,75,127,175,18,152,38,204,109,37,18,160,12,116,13,209,118,104,59,160,215,81,28,
+83,63,237,28,228,235,80,137,101,232,168,77,160,239,8,208,232,236,134,30,67,90,181,85,37,83,167,255,114,52,109,223,
+21,74,201,25,134,185,182,249,168,171,233,98,58,125,201,8,29,189,9,152,64,14,4,248,109,235,198,237,78,164,61,173,
+155,104,106,191,180,197,194,238,104,242,28,16,58,200,26,18,160,46,132,55,135,215,240,57,141,105,128,93,79,103,219,74,
+34,0,255,73,144,38,228,222,66,81,77,237,221,254,72,43,126,115,53,226,88,6,237,136,110,68,73,218,217,47,241,119,
+37,154,51,215,132,58,240,200,4,40,139,176,253,216,131,207,89,221,235,125,69,88,186,79,211,214,51,170,203,218,142,232,
+121,244,54,202,42,14,130,234,104,47,112,70,215,201,200,28,236,176,153,4,168,3,51,32,245,157,146,216,58,120,106,38,
+152,134,231,74,229,134,180,53,94,150,239,215,34,184,66,77,91,187,31,132,178,124,66,177,225,37,159,79,246,40,3,109,
+139,167,197,7,113,175,95,234,39,253,54,159,84,57,84,19,48,1,19,136,72,128,134,104,102,116,60,210,10,60,221,140,
+105,181,83,145,166,248,134,162,195,35,38,217,206,114,32,0,255,167,139,44,244,140,227,58,45,7,36,14,210,4,76,160,
+2,4,104,43,194,1,169,149,248,124,42,138,51,24,138,243,202,154,110,230,174,70,235,163,48,143,21,32,238,36,84,129,
+64,75,157,80,255,40,141,105,229,103,21,178,212,183,105,128,191,218,46,77,70,199,181,251,241,144,249,34,21,194,212,224,
+133,222,129,242,93,180,53,210,100,225,167,40,137,105,162,240,102,180,106,223,22,112,5,51,78,121,12,191,166,240,249,103,
+168,206,139,181,212,134,29,166,60,217,76,64,4,168,11,115,161,164,246,67,60,26,100,13,9,168,220,2,237,201,49,202,
+211,173,56,171,148,41,205,71,160,201,81,13,75,160,25,73,22,123,52,14,58,6,69,121,159,17,206,134,155,220,31,218,
+12,18,206,133,9,244,31,1,237,165,217,24,99,95,225,231,201,204,79,194,12,209,56,205,203,231,237,208,74,72,79,198,
+104,133,176,94,224,165,61,63,163,236,251,137,179,174,246,37,103,245,238,27,237,109,124,17,241,31,209,213,181,79,22,69,
+224,223,68,52,123,81,145,117,136,71,117,227,117,164,223,152,246,161,141,82,223,238,166,14,253,16,183,54,19,48,129,6,
+18,104,217,251,254,38,178,119,19,215,40,229,114,63,180,54,90,12,21,182,245,16,113,101,97,207,17,200,101,72,139,23,
+94,108,201,95,22,97,59,140,102,17,88,132,236,164,29,200,191,167,89,72,234,149,27,218,43,109,245,250,29,244,237,152,
+41,87,67,183,48,90,128,48,222,164,157,208,187,179,98,25,254,212,135,26,31,77,130,180,127,191,164,207,122,66,107,21,
+164,119,241,164,121,10,80,125,182,123,209,225,164,79,239,99,177,85,132,64,219,117,229,88,234,130,222,95,164,193,167,58,
+109,125,247,26,233,189,2,237,71,126,244,238,87,155,9,132,4,84,31,222,69,122,95,73,92,251,86,92,15,118,95,57,
+2,234,63,107,44,233,151,40,109,31,169,136,204,125,69,36,79,160,163,209,169,104,24,178,21,76,128,235,96,24,163,222,
+177,181,47,250,49,26,39,252,50,194,241,125,220,236,205,245,232,196,8,110,237,196,4,76,160,130,4,26,53,145,211,206,
+151,198,233,49,190,219,179,253,123,26,63,77,240,232,69,173,122,241,233,114,104,58,52,25,210,77,170,110,20,71,67,122,
+233,151,248,232,230,78,29,44,189,48,78,47,137,123,28,157,140,198,32,252,167,57,218,170,71,224,55,36,105,93,148,251,
+54,30,45,89,87,253,80,125,184,11,29,67,221,208,228,222,128,81,223,206,229,195,58,168,211,5,86,157,160,127,227,103,
+197,1,15,254,99,2,38,208,79,4,254,64,102,37,13,68,110,129,86,66,179,34,189,104,180,138,246,34,137,186,27,157,
+137,174,66,186,1,181,153,64,47,2,107,224,64,125,170,52,118,121,26,207,246,155,154,192,178,132,176,58,138,59,225,28,
+46,100,217,27,191,99,209,39,210,132,156,70,33,66,241,113,192,66,119,250,39,252,172,118,80,253,115,245,159,52,105,179,
+2,210,182,103,179,33,125,159,133,105,98,233,1,116,52,253,176,127,101,17,160,195,200,149,192,169,132,62,20,29,133,170,
+190,213,226,75,164,241,98,116,24,117,235,5,142,54,19,104,39,240,1,95,188,141,146,76,228,104,28,195,86,67,2,180,
+7,173,169,62,142,235,226,245,124,113,2,90,26,105,209,113,213,76,99,21,67,144,218,179,83,208,83,72,99,101,163,180,
+229,69,95,217,138,33,160,5,45,251,162,221,81,167,49,166,193,82,242,58,95,254,156,114,59,107,176,147,254,206,4,76,
+192,4,76,192,4,74,35,64,135,232,100,164,61,176,243,50,109,221,247,20,210,234,192,158,131,9,184,217,20,105,59,146,
+214,189,75,181,253,199,35,104,164,201,198,210,192,57,98,19,48,129,210,8,208,22,132,91,45,124,155,207,191,68,106,51,
+222,70,101,154,218,81,189,135,238,44,164,237,139,70,69,3,233,44,13,148,35,174,21,129,160,190,92,203,49,141,169,30,
+234,93,2,181,202,123,83,18,11,119,253,238,181,159,255,123,40,173,169,239,163,151,241,234,61,33,67,208,19,232,25,164,
+119,148,12,69,47,163,55,145,218,190,60,183,156,209,118,200,122,55,197,85,72,19,68,182,26,17,160,204,102,71,215,33,
+245,199,171,100,106,171,84,159,127,142,180,56,208,102,2,29,9,80,71,212,159,74,178,93,37,222,190,57,79,254,109,245,
+39,160,114,12,180,3,199,7,81,21,76,215,71,93,139,111,66,63,65,179,160,129,116,214,159,120,189,115,64,57,140,141,
+14,68,113,183,83,123,22,63,43,215,59,247,78,189,9,152,128,9,152,64,163,9,112,161,186,28,233,134,42,173,233,102,
+95,47,69,213,196,205,41,72,91,32,37,54,252,207,141,22,78,28,128,61,154,128,9,244,5,1,218,9,221,48,77,136,
+244,238,153,131,208,29,104,40,210,64,104,30,166,118,78,131,167,183,161,191,163,159,162,197,145,111,220,250,162,198,229,147,
+201,160,254,60,199,49,141,105,112,223,245,48,159,34,234,25,42,236,23,66,23,32,245,135,178,48,133,19,74,253,180,240,
+115,251,49,139,184,58,133,241,25,39,78,65,202,219,104,61,33,216,65,37,9,80,118,187,162,33,168,108,211,187,226,110,
+71,91,87,18,148,19,85,73,2,212,23,93,215,14,69,73,236,74,60,85,50,95,78,84,58,2,148,235,94,232,33,164,
+107,98,81,166,107,177,22,156,14,65,154,36,220,13,45,138,244,228,135,173,34,4,40,143,113,208,1,72,215,156,56,166,
+69,43,218,238,223,102,2,38,208,0,2,35,60,215,217,128,252,56,11,38,48,2,1,46,88,127,225,139,77,81,212,71,
+214,213,35,214,54,105,122,212,253,78,116,13,143,158,254,153,163,205,4,76,192,4,74,37,64,123,22,198,63,11,31,102,
+71,75,33,109,49,52,13,154,3,233,209,122,13,72,106,21,176,110,188,212,150,105,59,43,125,175,125,173,213,174,105,123,
+4,109,135,246,38,250,24,233,187,71,209,67,72,91,59,188,134,6,204,219,37,132,36,124,76,67,128,122,171,237,143,30,
+76,19,6,126,47,64,27,41,12,215,75,81,40,214,40,195,13,137,241,39,168,41,43,57,223,34,47,71,32,109,45,242,
+50,117,74,237,163,173,134,4,130,235,162,174,127,191,67,223,69,147,21,152,13,213,27,189,227,228,28,116,42,122,204,237,
+19,20,108,145,9,4,245,119,99,60,156,23,217,211,255,28,170,207,182,170,235,220,255,128,52,229,83,80,47,148,29,213,
+141,31,162,37,80,30,239,5,211,61,129,218,48,245,209,110,70,218,58,89,219,166,233,30,97,248,117,209,117,12,26,37,
+91,80,39,198,35,25,127,64,59,35,221,219,69,49,109,165,246,87,202,112,191,40,142,237,198,4,76,192,4,76,192,4,
+42,65,128,11,223,20,232,47,72,219,152,189,139,244,24,170,164,85,237,250,255,113,116,41,218,18,77,85,137,68,59,17,
+38,96,2,38,16,147,0,237,215,192,19,11,193,113,172,224,56,49,199,57,209,140,49,131,179,115,19,200,132,0,117,79,
+91,133,164,181,95,19,128,159,200,201,164,68,226,7,2,251,205,209,13,105,11,177,2,254,181,226,248,18,180,34,154,60,
+62,9,251,168,26,1,202,177,245,186,183,48,255,107,203,99,109,221,151,215,74,118,213,33,133,175,251,6,189,215,206,102,
+2,137,9,80,135,84,127,199,64,111,161,184,166,45,75,19,199,109,143,245,33,64,57,107,43,45,141,83,252,21,61,138,
+212,6,37,177,207,241,164,167,110,180,149,233,133,104,91,228,107,97,197,171,2,101,164,118,66,79,226,104,119,6,141,95,
+69,49,109,59,170,167,112,180,208,193,102,2,38,208,48,2,126,34,167,97,5,234,236,152,128,9,152,128,9,152,128,9,
+152,64,85,8,112,19,121,60,105,209,234,193,52,54,31,158,31,83,0,94,25,154,6,99,50,191,148,225,138,248,220,27,
+173,145,44,132,74,248,122,150,84,156,140,174,162,14,165,125,66,172,18,25,114,34,58,19,160,206,238,196,217,205,145,182,
+67,214,83,170,105,236,83,60,15,65,247,161,243,169,63,151,166,9,204,126,77,160,157,0,245,245,70,190,91,169,253,251,
+30,255,159,198,249,109,125,77,236,65,169,129,167,169,47,122,26,99,17,52,47,154,19,205,130,38,65,122,42,95,79,210,
+124,137,52,206,23,182,93,111,243,89,215,192,167,168,47,122,2,223,86,35,2,148,247,184,36,119,127,244,51,164,207,189,
+236,35,28,156,138,126,143,222,116,27,209,11,151,207,155,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+12,16,224,6,244,50,148,198,94,195,243,240,85,247,198,90,60,1,248,235,201,230,163,145,86,243,214,205,180,114,249,44,
+164,167,138,180,45,137,173,143,8,80,230,99,162,157,208,185,232,89,20,62,249,160,39,118,180,98,89,166,167,108,244,142,
+56,153,234,203,51,72,79,220,28,130,54,66,115,247,17,50,103,181,4,2,212,177,36,79,174,238,140,191,18,82,235,40,
+77,192,4,138,32,160,223,55,26,29,237,139,62,66,189,76,215,181,33,104,71,52,30,26,232,59,23,145,86,199,97,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,208,0,2,220,72,106,11,143,52,118,23,158,125,51,90,114,
+93,160,12,182,66,67,80,93,236,109,18,122,29,250,5,210,187,196,108,38,160,118,68,131,91,75,161,197,208,2,104,93,
+180,36,154,14,205,139,70,67,38,101,2,133,18,160,206,77,142,110,71,81,237,14,28,78,141,10,77,167,35,51,1,19,
+40,142,128,126,223,72,91,234,233,85,0,189,236,51,28,92,140,230,47,46,133,142,201,4,76,192,4,76,192,4,76,192,
+4,76,192,4,76,192,4,76,160,81,4,184,169,124,179,215,221,103,143,243,39,114,222,19,57,37,215,10,202,96,65,116,
+126,143,178,170,194,233,143,73,196,195,72,79,83,120,2,167,228,122,227,232,77,192,4,122,19,160,173,210,53,78,239,43,
+121,5,245,50,61,165,250,35,228,235,98,111,180,118,97,2,181,36,16,252,190,215,226,168,223,123,55,211,83,56,90,48,
+181,11,26,120,10,167,150,25,118,162,77,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,202,37,192,77,
+229,88,232,125,148,198,54,197,179,7,172,202,45,202,129,216,41,7,13,52,86,117,123,53,173,70,125,9,105,27,53,189,
+83,201,102,2,38,96,2,181,32,64,155,53,112,141,227,184,27,210,22,128,157,236,57,78,236,81,139,76,57,145,38,96,
+2,137,8,240,27,87,123,176,52,122,26,117,51,245,123,180,125,241,162,104,84,228,190,114,34,226,246,100,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,160,27,74,109,85,148,198,62,192,243,180,200,55,167,21,168,79,148,195,
+114,232,102,164,21,160,101,155,210,32,233,253,38,239,160,43,144,6,62,244,130,103,155,9,152,128,9,212,134,0,237,214,
+192,53,46,56,174,206,241,12,164,137,233,208,94,230,195,63,208,26,168,54,249,114,66,77,192,4,226,19,224,55,62,7,
+250,15,234,212,215,210,247,47,160,189,208,196,241,99,176,15,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,
+48,1,19,104,35,192,13,230,66,40,141,61,215,22,164,255,45,145,0,5,57,17,210,246,29,81,246,107,79,83,238,81,
+253,190,135,195,11,209,170,104,92,52,90,137,120,28,181,9,152,128,9,100,66,128,182,76,19,59,51,160,85,144,218,55,
+125,30,62,217,147,73,36,14,196,4,76,160,114,4,248,157,235,125,109,183,161,78,147,56,159,114,78,79,225,44,140,6,
+158,194,169,92,38,156,32,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,129,250,17,224,38,115,50,212,
+186,170,152,127,99,217,233,245,203,117,115,83,76,201,105,208,96,30,164,149,225,101,154,182,27,57,18,173,132,244,194,239,
+49,155,75,221,57,51,1,19,48,1,19,48,1,19,104,50,1,250,49,154,168,213,98,153,75,208,48,212,110,122,250,248,
+25,180,13,26,27,121,98,183,201,21,194,121,51,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,129,50,8,112,
+179,121,1,74,106,91,149,145,102,199,217,153,0,5,57,38,90,28,105,69,232,23,168,40,123,157,136,206,65,27,160,111,
+35,173,90,245,19,56,157,139,202,103,76,192,4,76,192,4,76,192,4,42,78,128,190,140,38,101,198,67,39,163,47,81,
+187,125,200,23,167,160,111,161,138,231,198,201,51,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,168,45,
+1,110,58,183,69,73,6,252,111,198,223,132,181,205,120,131,19,78,185,140,134,150,64,26,88,24,130,242,50,237,1,255,
+79,244,115,180,46,154,183,193,88,157,53,19,48,1,19,48,1,19,48,129,62,35,64,223,70,11,100,14,71,159,163,86,
+211,164,206,195,72,11,88,70,71,3,79,225,244,25,30,103,215,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,
+4,76,160,40,2,193,141,167,94,220,28,199,222,198,241,118,168,168,100,58,158,4,4,40,159,121,209,54,232,44,52,4,
+165,181,183,8,224,94,244,119,180,31,218,26,45,148,32,105,246,98,2,38,96,2,38,96,2,38,96,2,149,39,64,63,
+103,29,244,62,106,181,119,248,231,79,104,186,202,103,192,9,52,1,19,40,156,192,168,133,199,232,8,77,192,4,76,192,
+4,76,192,4,76,192,4,250,130,0,55,161,202,231,252,232,112,180,186,254,233,97,31,113,254,200,81,71,29,245,183,61,
+220,249,116,69,8,80,198,51,147,148,53,208,146,104,54,52,45,154,8,141,143,194,237,207,70,231,179,42,195,151,232,11,
+244,57,82,89,191,139,94,71,111,161,103,209,67,232,54,202,95,223,219,76,192,4,76,192,4,76,192,4,76,160,145,4,
+232,63,169,159,116,51,90,52,200,160,250,72,234,7,253,18,93,175,239,232,15,233,96,51,1,19,48,129,225,4,220,42,
+12,71,225,15,38,96,2,38,96,2,38,96,2,38,96,2,89,18,8,38,114,20,228,60,104,127,180,1,26,3,13,102,
+143,241,229,223,144,38,114,6,59,239,239,42,76,128,178,30,147,228,45,143,52,97,183,48,210,164,206,216,72,54,14,250,
+10,189,135,222,65,154,188,121,18,221,141,110,167,188,245,191,205,4,76,192,4,76,192,4,76,192,4,250,130,0,253,166,
+223,147,209,189,144,22,183,188,128,254,142,212,15,30,88,204,226,190,48,36,108,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,229,16,224,166,85,219,101,93,133,94,67,178,143,208,29,232,96,180,72,57,169,114,172,38,96,
+2,38,96,2,38,96,2,38,96,2,38,80,12,1,250,188,223,65,55,160,67,208,210,104,60,84,76,228,142,197,4,76,
+192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,162,18,208,205,42,154,22,77,22,124,246,75,92,163,194,
+179,59,19,48,1,19,48,1,19,48,1,19,48,129,218,18,160,239,59,129,250,192,181,205,128,19,110,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,73,104,84,127,0,0,32,0,73,68,65,84,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,
+38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,
+2,38,144,51,129,81,115,14,223,193,155,128,9,228,72,224,155,111,190,9,67,31,157,15,147,162,25,209,184,232,9,244,
+206,168,163,250,39,14,7,155,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,212,150,192,24,181,77,121,14,9,103,80,124,81,130,93,6,205,139,230,66,19,161,73,208,228,232,51,52,
+12,137,217,135,232,99,244,9,122,19,61,142,238,71,87,51,112,254,1,71,155,9,20,73,96,30,34,219,10,173,135,52,
+145,51,26,82,189,92,27,61,140,108,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,80,63,2,76,220,76,139,126,140,46,69,47,163,207,80,26,251,20,207,67,208,95,209,
+174,104,246,250,81,113,138,235,68,128,58,182,16,186,7,125,137,90,237,107,254,185,168,78,121,113,90,77,192,4,76,192,
+4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,96,20,6,183,23,65,
+251,162,7,209,71,40,111,123,133,8,206,64,91,32,151,128,9,164,34,160,58,212,162,117,249,60,20,117,178,151,56,49,
+13,74,21,167,61,155,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,148,71,160,241,47,208,104,25,196,158,26,204,135,161,239,34,125,46,218,52,154,254,44,250,39,250,51,122,9,
+141,226,119,152,136,130,45,42,129,150,250,252,107,252,252,28,105,235,191,78,246,17,39,180,221,218,245,174,103,157,16,213,
+251,251,150,250,160,109,33,181,197,222,52,104,10,52,49,26,11,141,131,62,69,239,163,247,144,218,157,119,208,243,212,137,
+7,57,218,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,160,
+92,2,12,116,206,137,142,67,239,162,170,216,155,36,228,116,52,119,185,116,28,123,221,8,80,103,244,68,206,33,40,202,
+54,128,218,110,109,125,249,177,53,131,128,202,18,141,139,190,139,14,66,183,35,61,121,53,12,197,181,135,241,112,10,210,
+100,159,205,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,138,
+33,192,160,100,184,245,212,236,124,62,13,105,210,164,170,246,49,9,187,12,173,131,6,210,93,12,37,199,82,87,2,212,
+19,213,105,189,255,38,138,105,34,103,45,84,215,236,246,125,186,85,118,129,166,226,184,61,186,28,189,128,178,52,213,167,
+215,209,217,104,35,20,198,217,247,252,13,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,
+192,4,76,192,4,170,64,160,113,91,171,105,16,18,219,13,253,31,154,77,255,212,192,62,35,141,183,162,189,217,238,232,
+254,26,164,215,73,44,136,64,80,159,195,216,78,229,195,86,104,244,240,139,8,199,141,112,115,129,183,86,139,64,170,130,
+78,40,255,245,73,214,58,104,45,164,45,211,242,54,53,160,151,161,211,209,63,93,111,242,198,237,240,77,192,4,76,192,
+4,76,192,4,76,192,4,76,32,59,2,109,247,143,147,19,242,194,104,6,52,41,154,18,141,139,38,10,142,99,112,252,
+26,125,130,116,143,169,207,31,162,215,209,35,232,58,238,7,116,110,184,17,254,242,252,179,49,122,11,253,206,247,11,195,
+209,248,131,9,152,128,9,152,128,9,228,78,160,246,19,57,109,29,21,229,231,34,180,38,26,51,119,122,217,71,240,1,
+65,106,0,245,24,244,180,130,119,199,72,20,250,215,90,234,183,222,137,243,27,164,206,118,28,251,30,142,175,118,61,138,
+131,172,60,183,65,121,235,70,107,7,180,9,154,29,197,153,184,195,121,38,166,27,182,203,209,102,72,55,116,3,230,122,
+20,146,240,209,4,76,192,4,76,192,4,76,192,4,76,192,4,138,39,16,220,47,104,66,70,239,253,213,123,49,103,66,
+51,35,109,219,62,21,210,36,205,244,104,50,164,49,17,77,220,36,181,97,120,212,187,54,111,66,15,160,240,157,156,127,
+230,243,21,220,27,104,65,170,205,4,76,192,4,76,192,4,76,160,32,2,77,154,200,89,14,102,71,35,189,244,187,238,
+246,44,25,56,10,29,231,129,211,186,23,101,186,244,7,29,245,63,16,202,30,72,47,174,143,99,175,224,120,1,244,142,
+235,81,28,108,197,185,109,153,168,83,164,211,161,31,163,237,144,110,200,170,96,67,73,132,38,16,207,80,98,92,143,68,
+193,102,2,38,208,74,32,104,199,212,159,212,32,146,38,162,159,71,47,186,189,128,130,173,111,9,4,191,139,177,0,160,
+39,93,191,68,225,128,235,187,124,254,8,233,183,162,115,47,162,207,253,123,129,130,205,4,76,96,128,64,208,126,104,162,
+102,14,164,182,98,78,164,9,26,77,162,232,90,59,62,210,36,77,220,123,67,188,164,182,97,132,112,38,218,129,118,75,
+109,155,205,4,76,192,4,76,192,4,76,160,64,2,77,153,200,89,15,102,127,66,179,20,200,46,239,168,190,32,130,43,
+209,190,232,209,48,50,223,232,133,36,250,227,72,71,126,123,114,170,73,189,9,18,228,248,6,234,203,42,9,252,217,75,
+65,4,130,27,53,173,164,211,100,137,158,126,209,100,78,213,236,115,18,116,34,58,136,250,164,109,22,108,38,96,2,38,
+48,156,0,237,152,250,146,122,130,240,23,104,22,244,24,58,148,246,226,95,28,109,38,208,8,2,193,245,90,121,209,53,
+91,171,221,23,68,243,34,13,170,134,3,171,90,245,174,9,155,209,208,216,72,110,245,251,208,192,167,254,215,202,120,13,
+124,126,29,252,207,97,96,11,35,173,104,215,164,206,16,244,46,122,3,61,132,158,67,119,161,87,220,255,135,130,205,4,
+26,66,160,165,61,209,182,103,154,168,89,10,105,178,102,54,164,182,69,247,125,146,218,148,170,218,51,36,108,109,218,166,
+39,170,154,64,167,203,4,76,192,4,76,192,4,154,72,64,55,23,181,54,58,66,90,189,126,24,210,170,148,38,218,243,
+100,74,249,211,227,203,94,17,47,8,13,182,150,142,189,114,185,1,210,0,122,210,119,163,108,70,231,250,92,5,100,171,
+38,1,202,91,79,224,236,134,52,24,84,117,211,234,187,95,162,151,195,132,122,96,41,36,225,163,9,244,47,1,218,177,
+69,201,253,197,104,198,128,130,6,164,111,71,27,161,215,221,78,4,84,124,168,21,129,160,63,246,109,18,189,56,90,26,
+105,171,83,173,144,159,30,21,57,184,250,41,241,105,65,197,147,232,22,116,45,191,169,107,57,218,76,192,4,42,74,160,
+237,126,46,76,165,38,124,53,97,179,36,82,187,162,39,108,52,137,51,30,170,171,61,65,123,52,79,93,19,239,116,155,
+128,9,152,128,9,152,64,29,9,212,110,34,167,173,99,164,9,142,159,162,34,111,168,202,40,103,221,192,105,101,235,94,
+116,150,134,150,145,0,199,89,12,129,150,250,189,12,49,106,18,70,29,252,36,118,31,158,86,162,190,124,152,196,179,253,
+228,67,160,165,124,23,33,6,61,105,181,28,210,202,221,186,216,37,36,116,189,48,177,212,175,240,163,143,38,96,2,125,
+70,32,104,207,52,0,117,6,90,31,181,54,8,31,240,255,202,232,63,110,39,160,96,171,60,129,160,62,175,74,66,87,
+68,171,35,77,220,104,69,188,158,162,169,146,125,69,98,222,66,183,162,243,248,125,157,95,165,196,57,45,38,96,2,60,
+94,247,141,214,51,12,60,157,247,29,142,107,161,37,208,52,104,66,212,36,211,181,126,82,218,33,61,101,104,51,1,19,
+48,1,19,48,1,19,40,128,64,235,77,119,1,209,165,143,162,101,32,244,120,66,251,17,170,218,13,86,250,76,118,14,
+225,38,78,253,30,221,16,58,241,0,73,72,162,57,71,234,248,180,228,230,106,164,247,219,36,49,221,61,252,2,29,238,
+250,145,4,95,126,126,40,91,109,199,178,23,210,4,244,164,249,197,148,107,200,26,52,218,68,49,184,126,229,202,217,129,
+155,64,165,9,4,253,177,45,73,228,9,104,252,182,196,126,204,255,107,162,91,154,210,78,144,95,13,192,125,77,126,148,
+55,91,205,9,80,158,170,179,171,33,45,168,208,228,141,86,149,107,98,178,78,247,70,154,212,185,20,29,79,189,188,142,
+163,205,4,76,160,0,2,193,245,175,61,38,181,29,107,4,210,66,6,61,165,218,180,137,27,178,52,130,233,158,115,118,
+218,31,109,3,105,51,1,19,48,1,19,48,1,19,40,128,64,157,110,86,6,112,4,29,167,67,248,103,79,84,167,149,
+236,89,21,231,80,2,218,9,105,160,223,3,169,130,208,32,11,6,22,52,81,167,149,91,73,237,9,60,106,64,194,245,
+35,41,193,140,252,181,221,232,45,70,176,7,34,173,244,173,179,13,35,241,135,161,125,154,50,64,91,231,194,112,218,77,
+160,44,2,180,111,90,93,124,25,82,219,214,110,218,14,106,29,116,93,157,219,9,242,168,45,112,54,70,26,236,215,117,
+85,3,231,143,161,91,208,185,232,193,58,231,143,244,247,141,81,150,83,146,217,101,145,38,24,23,70,243,162,246,9,72,
+190,170,165,61,68,170,15,166,46,158,83,203,212,59,209,38,80,51,2,109,253,123,189,219,102,15,180,18,210,231,126,178,
+215,201,236,76,180,61,122,183,175,205,4,76,192,4,76,192,4,76,160,0,2,99,20,16,71,214,81,104,18,227,103,168,
+31,39,113,196,114,22,116,26,218,30,93,129,108,205,34,112,50,217,73,51,137,243,37,254,127,211,44,36,141,200,205,206,
+228,98,95,52,125,3,114,163,235,134,218,224,103,209,223,26,144,31,103,33,33,129,150,129,140,185,9,66,117,91,79,156,
+77,133,166,70,225,22,34,99,241,89,117,102,116,244,53,210,86,161,218,22,72,199,247,209,155,232,21,116,63,122,17,13,
+55,15,144,15,71,81,185,15,148,189,202,115,55,180,80,135,196,233,169,149,23,58,156,171,197,215,228,113,111,18,186,29,
+106,31,152,91,150,239,36,109,151,115,50,58,22,217,42,70,32,104,159,102,38,89,122,122,95,219,213,106,194,113,98,212,
+68,91,144,76,253,130,60,191,64,187,249,239,38,102,208,121,50,129,10,18,248,1,105,218,6,45,143,198,169,96,250,138,
+72,210,189,68,226,73,156,34,72,59,14,19,48,1,19,48,1,19,8,8,84,254,137,156,224,70,44,44,176,165,249,112,
+49,210,64,81,191,219,59,0,216,145,27,182,127,246,59,136,166,228,159,186,174,213,189,90,249,155,230,119,121,57,254,53,
+184,52,96,30,8,13,73,148,115,12,218,47,61,133,163,1,79,109,217,210,36,251,15,153,209,32,167,86,2,15,152,235,
+91,72,162,25,199,182,235,175,50,165,237,0,53,32,186,8,90,10,45,128,84,175,245,189,6,246,211,152,158,224,208,228,
+142,38,115,110,67,154,216,185,8,189,133,6,53,215,183,65,177,20,242,37,117,67,253,177,11,145,38,236,6,179,167,249,
+114,113,244,126,29,203,137,252,253,142,180,235,201,239,113,81,55,211,100,228,65,232,208,208,81,29,243,27,166,189,206,199,
+150,246,42,156,188,89,131,252,104,130,99,204,58,231,43,102,218,245,206,156,77,99,250,177,115,19,48,129,54,2,45,237,
+73,219,153,129,54,69,125,223,13,209,244,40,205,61,91,123,216,117,251,95,11,54,86,66,247,250,186,151,109,209,181,212,
+191,9,8,57,236,119,107,49,194,116,72,227,96,83,32,245,155,245,148,176,174,113,31,34,237,152,160,173,238,180,56,234,
+9,116,39,82,63,237,83,151,15,20,108,185,17,104,169,175,170,163,122,130,93,11,252,212,255,210,253,225,132,72,245,88,
+109,165,234,171,38,126,63,67,207,35,221,227,169,190,106,76,97,40,186,23,125,236,250,10,5,155,9,244,32,80,249,206,
+71,75,195,160,1,129,179,208,236,61,242,148,246,244,39,4,48,26,18,27,53,50,90,97,51,54,210,197,81,171,138,171,
+100,239,146,152,253,209,49,97,162,220,240,133,36,234,117,164,158,239,71,138,247,71,105,6,67,181,178,125,33,244,42,242,
+182,106,130,80,176,181,180,87,138,89,237,197,17,104,23,253,211,80,59,142,124,253,44,204,155,219,159,144,68,51,142,212,
+103,117,200,191,139,150,64,218,134,232,91,168,200,65,81,117,248,213,209,191,6,93,133,46,65,195,205,245,109,56,138,66,
+63,80,47,52,121,167,69,53,171,162,78,253,200,243,57,183,25,210,59,101,56,212,199,200,223,190,164,86,215,228,168,43,
+172,53,153,163,129,61,13,152,248,218,43,8,5,88,219,245,118,6,162,212,4,134,86,200,171,173,82,191,189,31,77,3,
+36,27,243,155,211,123,115,108,38,96,2,9,9,180,181,47,10,101,1,180,63,90,5,77,140,108,255,125,34,117,7,129,
+168,219,117,190,106,133,215,82,223,230,39,109,90,132,176,34,90,20,105,0,124,66,148,212,52,126,21,246,163,175,161,156,
+212,119,179,153,64,42,2,45,245,245,123,4,164,251,68,221,15,204,142,212,247,210,56,106,82,123,1,143,79,160,43,145,
+250,212,250,223,237,139,32,216,76,160,141,64,229,239,174,131,134,66,157,167,147,208,82,109,233,79,243,175,86,44,72,239,
+161,33,232,122,164,89,96,29,223,65,106,132,180,13,140,46,158,19,33,177,82,58,52,195,28,30,213,96,77,134,210,12,
+190,227,61,149,105,0,97,111,116,162,66,113,71,74,20,234,101,212,241,63,144,226,189,208,88,41,83,254,11,202,255,176,
+148,97,216,123,10,2,45,29,27,133,114,38,210,160,82,147,77,237,207,183,209,51,202,164,219,31,81,168,143,181,213,87,
+37,124,14,180,50,90,47,248,60,43,199,170,244,19,116,189,126,27,105,82,231,2,116,161,235,27,20,74,48,234,205,22,
+68,171,62,217,248,29,162,215,4,220,222,148,207,17,29,206,87,234,235,182,223,193,154,36,238,31,104,146,152,137,84,63,
+114,65,244,145,235,101,76,114,17,157,83,78,147,227,116,106,244,1,122,21,206,95,241,221,106,124,222,21,233,9,49,245,
+199,109,163,140,114,7,108,150,49,8,19,48,129,228,4,90,174,11,43,18,202,78,104,109,212,233,154,151,60,162,250,250,
+188,139,164,111,142,116,237,115,255,95,16,98,88,75,253,146,175,45,145,6,196,117,61,211,147,54,26,131,202,195,212,143,
+214,34,224,107,209,69,92,39,206,205,35,18,135,217,60,2,45,245,85,253,44,45,154,89,31,105,145,95,56,70,202,199,
+204,77,125,189,129,69,124,212,213,179,50,15,221,1,154,64,205,9,84,101,128,166,35,70,26,14,117,154,116,161,209,205,
+117,94,233,213,133,77,3,15,31,161,87,144,158,104,208,133,238,51,164,56,53,81,243,5,210,119,111,161,7,209,221,232,
+117,164,14,158,86,231,108,128,194,153,104,62,22,106,74,215,46,232,76,26,186,66,35,118,100,233,8,80,191,183,33,4,
+61,213,160,21,55,105,76,19,144,171,186,252,211,32,76,239,183,165,163,115,10,161,109,141,202,156,228,77,159,161,104,33,
+92,136,179,13,229,212,245,47,26,176,170,184,10,234,171,38,226,54,67,154,192,209,68,78,218,182,136,32,114,183,207,137,
+65,157,251,223,161,251,58,197,230,250,216,137,76,242,239,169,51,19,226,91,19,29,26,212,234,100,186,249,90,13,254,234,
+39,85,222,90,218,237,5,72,172,250,155,243,36,76,244,169,248,219,206,245,46,33,189,54,111,45,229,50,6,167,214,69,
+63,70,243,163,183,209,243,104,90,180,8,234,135,235,44,217,140,108,218,89,96,121,234,97,199,182,49,114,72,118,104,2,
+125,74,128,246,71,109,203,129,104,121,84,135,126,81,145,37,53,148,200,180,80,237,223,138,212,215,60,81,136,103,212,175,
+117,240,161,251,68,141,35,105,242,166,104,251,146,8,245,212,195,111,41,191,7,138,142,220,241,85,155,64,75,255,75,9,
+157,20,109,132,84,95,23,66,186,15,40,210,244,84,217,127,208,225,232,159,138,216,109,142,40,216,250,157,64,165,71,253,
+105,68,116,115,182,7,210,96,77,209,219,36,124,67,156,146,76,23,187,55,209,227,72,55,70,79,35,221,68,94,135,90,
+109,42,254,217,29,105,166,250,91,173,39,10,248,172,201,167,141,104,216,6,58,85,5,196,231,40,18,16,104,187,48,106,
+96,66,3,63,186,64,166,177,23,241,172,11,235,187,190,176,165,193,152,222,111,80,190,122,186,74,55,127,99,166,15,177,
+22,33,232,169,198,213,144,247,200,174,69,113,113,97,251,230,27,13,88,111,143,190,131,244,148,233,88,168,142,166,186,167,
+129,247,253,208,91,237,25,112,123,216,78,36,253,255,212,157,25,8,229,81,52,81,151,208,212,87,90,28,254,31,119,113,
+83,153,83,45,215,101,13,106,104,85,108,82,123,23,143,235,145,239,91,146,6,96,127,255,35,208,82,46,43,241,237,105,
+104,102,100,139,70,96,55,234,225,209,209,156,218,85,150,4,168,183,90,128,168,62,249,188,72,253,192,155,40,11,181,137,
+182,10,17,104,105,95,218,83,165,9,98,245,41,182,66,69,15,88,182,167,165,138,255,63,67,162,54,163,78,107,96,213,
+22,145,64,80,223,86,196,185,234,213,234,104,58,52,26,42,219,222,33,1,167,161,95,33,45,90,30,48,202,55,252,232,
+99,31,18,8,234,171,174,97,26,211,88,21,169,239,95,182,169,126,94,131,142,164,126,222,88,118,98,28,191,9,152,64,
+7,2,106,64,208,50,232,85,84,134,125,77,164,159,160,7,209,238,104,70,212,243,130,139,27,165,123,12,180,3,122,24,
+13,67,69,217,163,68,52,11,82,26,6,212,1,175,191,46,137,64,88,46,28,151,68,175,160,180,246,41,1,108,134,92,
+222,37,149,105,107,180,148,195,54,232,99,212,111,118,56,25,110,69,225,207,21,36,64,25,109,128,46,70,186,182,53,201,
+110,33,51,107,162,225,215,62,125,182,101,79,0,174,251,34,245,143,186,217,9,156,204,62,242,156,66,84,90,209,207,209,
+23,40,173,29,150,83,50,251,54,88,10,228,134,180,133,210,135,254,181,114,213,86,16,1,234,151,218,144,49,209,138,232,
+74,244,14,82,123,242,37,122,8,205,90,80,82,28,77,68,2,148,201,8,253,5,254,159,12,169,47,251,58,178,13,78,
+224,42,190,214,216,76,68,202,253,235,76,140,90,180,24,159,47,65,31,161,170,154,210,183,56,26,72,119,255,150,92,127,
+230,60,44,247,224,184,4,199,179,208,135,168,138,246,44,137,210,216,236,240,223,88,127,150,154,115,109,2,21,37,192,143,
+115,82,116,53,234,53,96,128,147,76,77,19,47,106,184,110,69,91,163,113,81,226,139,26,126,183,68,15,162,162,242,241,
+143,48,189,58,218,170,69,32,40,155,249,57,62,129,210,154,234,212,95,145,47,100,37,21,115,43,123,62,47,141,94,67,
+253,104,234,84,233,253,5,182,10,17,160,76,212,54,140,134,118,68,143,161,34,23,22,16,93,161,54,132,216,214,71,110,
+15,115,172,131,240,125,9,117,51,189,183,100,59,148,99,42,178,13,154,180,206,135,94,64,89,152,158,86,178,101,68,128,
+2,217,27,53,185,221,202,162,206,13,22,198,207,50,42,2,7,211,131,0,240,117,205,25,15,29,128,180,248,176,253,126,
+79,109,226,182,61,130,241,233,130,9,80,38,195,251,10,124,94,23,221,139,108,131,19,208,184,200,113,104,22,52,192,173,
+224,226,170,93,116,1,39,77,140,156,139,170,60,129,67,242,134,155,250,65,91,161,218,241,118,130,211,17,80,153,35,221,
+67,221,140,180,72,184,234,246,25,9,60,26,185,61,74,87,244,246,109,2,217,18,8,126,148,27,115,204,235,194,167,78,
+182,110,12,181,82,74,13,129,26,44,173,192,185,15,29,140,86,68,19,160,212,25,83,24,129,116,51,154,213,64,1,65,
+117,52,229,237,40,228,134,45,117,233,101,31,0,229,50,42,82,61,203,194,188,125,75,246,69,20,43,68,10,49,252,125,
+207,194,103,77,216,246,179,233,61,97,182,10,17,160,50,170,83,126,87,31,85,202,55,200,235,192,77,40,199,10,149,68,
+51,146,2,211,253,34,214,165,85,235,196,159,180,94,20,49,95,81,156,125,218,140,210,46,63,23,192,62,31,121,18,39,
+74,173,27,209,205,243,252,187,96,249,37,216,31,41,128,245,212,232,84,164,251,201,118,211,61,217,221,40,237,22,202,253,
+1,179,192,92,82,38,234,191,171,236,52,208,222,143,79,210,147,237,158,166,113,18,13,236,234,61,65,182,46,4,96,20,
+222,15,234,168,197,33,255,68,239,163,186,153,210,172,215,26,216,250,132,0,229,61,23,186,28,125,142,234,100,106,159,206,
+70,125,82,82,206,166,9,140,72,160,146,27,96,242,131,28,135,100,94,130,190,59,98,114,19,255,247,53,62,63,68,218,
+67,95,171,37,159,68,207,161,247,145,94,202,251,57,122,29,61,197,158,139,250,156,153,181,53,46,211,16,240,81,104,29,
+52,110,102,145,140,28,144,242,180,57,186,194,123,156,142,12,167,200,111,218,202,95,91,243,169,94,175,149,65,26,158,37,
+140,77,41,95,239,81,156,1,204,164,65,180,148,239,241,132,177,115,210,112,26,226,239,82,234,163,222,251,100,43,137,64,
+75,125,156,147,36,252,14,229,125,173,41,41,167,93,163,125,131,179,255,135,206,247,245,175,43,167,216,39,169,95,175,225,
+105,234,30,30,95,225,188,6,145,223,174,58,255,224,247,178,54,105,213,123,150,178,236,147,173,79,120,23,87,61,255,164,
+177,146,70,185,232,253,1,127,66,243,84,50,129,213,79,212,159,168,123,63,175,126,50,235,159,66,234,234,124,228,226,4,
+180,52,210,123,93,219,237,41,190,208,251,75,31,110,63,225,255,203,37,64,217,169,191,122,8,154,171,220,148,84,50,246,
+97,164,234,78,244,23,234,238,89,149,76,97,197,18,21,244,39,148,170,125,145,158,136,236,213,87,146,219,170,218,103,36,
+236,143,232,128,48,129,238,207,132,36,154,115,164,206,78,73,110,246,68,59,160,73,106,154,51,205,226,252,13,233,190,111,
+248,24,174,235,107,77,75,211,201,174,55,1,93,8,209,242,232,93,148,198,180,10,74,79,244,220,142,246,69,11,35,237,
+127,59,88,71,187,48,104,196,175,252,109,136,158,69,121,154,246,100,158,189,176,140,57,162,65,9,80,6,173,43,116,206,
+204,168,192,181,90,102,195,65,35,244,151,133,18,8,202,119,35,142,131,173,196,204,168,184,107,19,204,75,133,194,119,100,
+35,17,8,234,227,138,28,181,53,104,63,219,35,100,126,165,145,0,249,139,196,4,224,121,104,196,10,117,117,226,72,10,
+246,72,126,244,78,139,59,35,230,43,142,179,19,112,92,112,110,154,17,29,220,182,65,189,182,239,195,137,173,3,1,237,
+107,63,105,51,106,67,117,115,1,227,209,209,90,232,113,164,251,205,193,76,79,136,106,49,133,173,66,4,40,147,105,144,
+126,39,77,123,87,32,89,74,109,218,66,237,26,148,197,130,195,10,149,122,254,73,129,217,106,72,125,207,166,216,91,100,
+100,107,52,48,142,145,63,65,199,80,36,1,202,85,215,175,7,81,83,76,247,40,195,199,220,138,100,233,184,76,192,4,
+2,2,252,8,199,64,103,160,175,80,18,147,63,237,81,124,50,90,5,77,136,42,243,195,110,73,203,244,124,190,12,229,
+185,109,196,153,174,88,229,18,104,41,111,93,96,244,226,211,44,236,208,114,115,229,216,67,2,20,166,218,150,7,178,40,
+212,134,132,241,189,128,73,136,200,199,2,9,192,254,59,168,136,45,60,235,80,93,47,42,16,125,163,163,162,176,103,68,
+122,121,119,47,211,128,230,122,117,129,65,90,181,200,39,15,123,130,64,235,130,161,50,233,132,217,79,80,148,122,150,71,
+153,213,61,204,23,201,192,239,209,248,149,41,208,134,38,4,198,163,163,157,208,43,168,147,105,146,96,15,164,39,241,109,
+21,33,64,121,104,92,224,110,100,27,153,192,189,124,181,100,69,138,170,242,201,128,213,240,177,37,62,255,9,53,113,123,
+190,251,201,215,88,202,171,173,25,4,40,203,177,145,198,164,62,66,77,178,247,200,204,54,104,224,119,217,140,210,114,46,
+76,160,59,129,202,109,173,198,15,112,9,146,124,57,154,162,123,210,71,58,171,171,140,182,253,56,29,253,29,233,113,246,
+175,170,254,104,29,249,221,139,116,238,143,198,67,89,155,246,106,223,6,157,31,6,92,117,30,97,58,155,114,212,5,5,
+219,25,29,137,198,209,63,25,216,42,148,227,13,25,132,227,32,82,18,160,124,245,40,175,182,75,44,245,73,191,32,27,
+218,82,81,91,238,61,137,180,229,158,30,49,86,27,48,55,82,187,186,24,202,163,157,33,216,225,182,63,159,6,30,197,
+119,91,51,156,73,110,31,130,246,37,12,127,37,62,232,218,55,83,248,69,159,31,181,165,234,79,208,137,33,7,215,201,
+144,68,188,35,245,236,82,124,104,11,178,94,166,126,215,92,85,231,28,252,110,38,36,173,218,106,119,198,94,153,74,112,
+254,61,252,204,11,135,87,19,248,237,27,47,109,237,151,158,50,62,25,53,245,105,18,181,71,50,13,236,127,133,116,125,
+30,11,201,62,65,186,31,211,36,204,135,72,110,199,70,50,109,113,51,6,210,181,91,231,212,169,212,185,215,145,234,215,
+243,232,74,137,250,246,54,71,91,142,4,168,179,42,7,109,91,167,123,183,137,58,68,165,242,211,66,186,29,40,19,149,
+179,173,2,4,40,187,253,72,198,110,104,242,10,36,167,106,73,80,61,221,4,233,90,63,74,213,175,225,74,99,217,22,
+92,191,86,34,29,199,160,249,145,218,240,38,154,182,88,251,149,235,68,253,139,150,58,171,173,64,117,109,90,184,254,185,
+25,52,7,55,242,237,247,208,23,174,175,131,242,241,151,13,35,160,155,131,170,217,174,36,104,178,152,137,250,24,247,23,
+163,67,248,225,62,28,211,111,217,206,15,35,1,95,162,253,209,196,40,75,27,151,192,246,65,87,33,221,0,218,138,39,
+176,57,81,30,132,178,154,196,249,136,176,158,41,62,27,142,49,36,16,116,222,245,175,126,95,219,163,178,38,113,52,24,
+164,65,156,155,208,5,232,90,218,63,181,37,29,141,180,63,201,201,57,59,58,72,127,98,169,244,65,56,132,4,4,116,
+237,248,37,154,41,129,223,166,122,209,128,233,238,232,196,166,102,176,136,124,209,102,108,72,60,171,71,140,235,166,136,238,
+170,224,76,117,35,143,73,28,229,109,18,180,52,186,80,255,216,122,18,88,14,23,135,160,58,78,226,188,71,186,213,191,
+126,13,189,132,212,71,211,4,203,139,232,125,244,50,210,228,139,174,213,186,62,171,173,126,23,233,123,213,19,157,147,59,
+153,250,20,90,124,33,83,251,165,115,146,108,28,174,239,154,212,177,149,68,128,182,80,229,115,0,218,25,105,210,173,147,
+61,196,137,95,83,94,159,119,114,224,239,243,39,208,210,87,215,111,73,237,203,174,104,204,252,99,174,76,12,170,127,26,
+31,209,81,247,11,211,163,78,147,13,47,112,238,46,228,73,28,65,136,102,90,40,180,63,154,50,154,243,218,186,218,130,
+148,31,133,94,175,109,14,156,112,61,165,242,11,48,104,50,91,139,152,154,106,223,33,99,27,160,115,154,154,65,231,203,
+4,90,9,84,106,34,135,70,70,63,192,53,144,58,26,186,121,233,212,225,224,212,128,201,205,115,104,127,116,46,234,58,
+136,201,249,170,154,46,144,111,160,163,81,220,39,145,122,229,105,97,28,236,140,14,237,229,208,231,211,19,104,185,113,80,
+96,171,34,61,137,163,155,245,172,236,19,110,14,213,225,182,149,79,64,171,215,244,251,42,218,52,72,164,201,217,147,168,
+11,119,198,140,124,49,220,171,51,174,85,165,121,216,60,121,4,234,48,123,18,216,19,23,81,7,219,123,6,214,32,7,
+154,180,252,41,250,115,131,242,84,116,86,246,39,194,177,34,68,170,193,108,245,101,234,96,211,145,200,159,229,156,208,185,
+115,14,191,73,193,171,44,102,171,120,134,84,191,223,70,247,32,45,166,121,4,61,30,104,96,130,133,235,49,255,246,52,
+77,240,132,246,94,248,33,56,134,147,56,250,87,79,117,180,154,39,113,90,105,20,252,153,190,189,38,110,254,128,118,66,
+227,116,137,94,253,171,221,221,79,239,66,168,216,83,106,87,206,66,75,20,27,109,174,177,13,11,66,127,135,163,164,201,
+227,33,72,237,146,218,40,29,223,66,207,81,15,181,213,252,82,124,62,15,117,107,160,254,131,91,213,93,91,7,2,109,
+247,247,167,226,108,51,212,173,45,232,16,82,237,190,214,2,177,237,209,65,181,75,121,31,39,184,165,190,234,218,117,1,
+90,13,105,82,187,233,166,9,251,115,154,158,73,231,207,4,68,160,50,19,57,52,56,19,145,158,95,163,9,149,48,172,
+91,135,67,231,117,147,115,43,218,13,61,128,234,110,234,104,202,142,69,113,159,72,26,240,216,229,143,110,60,142,65,190,
+17,236,2,41,227,83,186,121,56,9,77,147,113,184,158,196,201,24,104,156,224,90,58,70,242,166,206,66,81,166,27,183,
+123,209,105,232,100,212,62,200,195,87,189,141,27,53,237,137,123,19,46,215,236,237,58,145,11,181,227,182,226,9,108,87,
+124,148,181,136,81,253,136,141,209,241,72,11,63,108,49,8,208,86,252,10,231,218,50,36,138,169,125,210,192,118,29,236,
+47,36,50,235,69,51,237,249,246,164,118,59,145,193,255,95,133,175,215,27,252,84,105,223,170,173,208,130,137,231,209,237,
+232,6,116,11,215,79,173,110,183,245,25,1,218,65,221,147,29,134,182,68,221,38,181,85,63,254,136,110,70,182,242,9,
+172,79,18,14,71,179,150,159,148,88,41,208,164,177,38,117,95,67,154,160,209,100,205,203,232,169,64,255,225,56,38,237,
+81,235,196,47,95,141,104,186,95,145,176,31,160,25,70,60,59,194,127,95,240,223,37,35,124,227,127,58,17,24,135,19,
+90,24,180,53,234,135,65,241,144,195,143,249,224,137,156,144,70,61,142,170,159,154,192,62,31,117,251,253,215,35,55,209,
+83,185,16,78,23,71,247,68,247,98,151,38,80,79,2,149,153,200,1,159,158,94,208,15,79,13,79,175,73,28,13,106,
+94,142,126,66,71,230,21,142,181,53,210,223,154,246,179,232,116,169,195,166,149,51,225,132,86,235,249,164,159,191,133,199,
+125,208,111,146,6,96,127,177,8,204,137,107,149,161,184,103,109,47,100,29,160,195,75,68,96,5,124,205,151,200,103,60,
+79,186,193,186,19,237,135,110,109,107,47,226,133,244,63,215,154,8,202,115,34,71,92,30,253,95,116,254,148,51,1,45,
+102,152,46,231,56,210,4,175,145,4,93,232,6,70,20,130,207,105,194,139,235,119,69,60,124,23,93,29,215,99,63,187,
+167,47,50,21,249,143,58,89,253,53,110,53,96,86,201,109,89,130,193,44,37,79,246,125,244,189,129,79,249,254,153,60,
+223,224,27,19,186,158,114,24,171,228,220,232,158,226,69,164,69,97,186,249,191,2,61,152,209,245,150,160,108,117,37,16,
+180,131,71,144,254,77,209,152,93,242,161,29,33,254,142,78,164,222,132,215,186,46,206,125,42,107,2,109,237,252,111,9,
+95,215,175,73,179,142,39,163,240,212,230,124,140,158,71,15,35,77,212,220,223,242,255,71,61,218,31,249,143,106,107,227,
+80,125,176,78,246,1,39,180,16,195,214,155,192,149,56,89,169,183,179,194,92,168,239,165,113,179,188,109,102,126,95,186,
+215,56,74,17,245,168,155,121,167,197,225,15,66,160,173,253,211,162,202,157,208,239,208,216,131,56,111,242,87,227,146,185,
+141,145,250,114,54,19,104,52,129,210,39,114,90,26,30,109,13,163,149,14,189,46,72,234,188,156,131,126,142,222,68,77,
+179,171,200,208,33,72,157,208,110,55,13,113,243,189,9,30,116,195,172,129,97,91,190,4,254,70,240,90,17,144,135,61,
+145,71,160,14,51,54,1,173,112,203,115,240,73,237,220,29,232,96,164,27,135,44,77,109,140,86,242,169,179,147,181,141,
+78,128,179,35,79,228,100,77,118,240,240,116,189,220,106,240,83,185,127,171,107,137,110,34,223,66,175,163,247,208,131,232,
+125,164,239,222,64,47,33,45,78,208,96,202,187,72,11,20,102,70,147,32,77,20,232,169,136,197,131,207,51,113,28,15,
+229,97,11,19,168,39,114,226,145,221,15,231,83,71,244,242,24,238,52,248,93,7,59,144,68,230,217,118,135,12,180,138,
+223,214,157,192,26,156,94,172,187,147,92,206,234,250,250,26,186,14,221,142,46,100,96,74,237,148,172,35,100,165,0,0,
+32,0,73,68,65,84,205,4,134,19,224,254,116,122,254,57,22,105,32,188,219,253,178,174,131,234,87,105,87,9,245,173,
+108,229,18,248,35,209,239,134,170,52,128,169,241,138,23,208,227,72,237,142,182,50,123,132,99,222,166,5,22,234,115,117,
+51,77,98,171,175,102,107,33,208,50,62,165,111,167,69,103,162,149,80,209,246,13,17,170,79,253,54,26,138,238,68,42,
+47,77,0,126,136,212,151,150,190,66,186,175,211,83,174,11,160,121,208,248,40,11,211,68,224,166,232,168,44,2,115,24,
+185,18,80,159,74,215,173,165,80,183,9,220,92,19,81,114,224,43,151,28,191,163,79,73,128,246,87,227,73,170,191,75,
+160,25,144,218,186,199,208,243,158,72,134,66,96,221,58,166,161,155,34,142,171,17,201,162,72,133,214,205,116,145,250,39,
+250,63,164,193,162,166,154,6,26,38,71,187,103,152,193,185,8,107,11,116,90,134,97,58,168,145,9,232,102,110,185,145,
+191,206,236,155,59,213,185,116,35,150,25,207,36,1,169,221,220,48,137,199,136,126,116,163,119,12,58,33,143,114,38,204,
+207,168,67,26,180,210,32,69,30,230,1,204,60,168,14,30,230,28,124,61,247,224,167,50,251,86,43,141,63,66,207,33,
+221,240,171,35,117,47,186,155,186,244,50,199,184,246,159,208,67,219,141,178,6,93,212,118,174,136,244,251,210,53,171,87,
+159,0,39,145,108,53,92,29,18,201,165,29,105,59,22,149,193,118,49,80,92,26,195,109,153,78,119,38,114,13,112,20,
+97,163,21,17,73,93,227,160,142,233,58,161,173,251,198,44,40,15,159,16,207,83,232,108,116,5,109,87,17,131,168,5,
+101,205,209,100,73,32,184,46,233,218,122,18,90,1,117,251,45,107,144,245,65,164,137,3,79,6,2,161,100,251,23,241,
+127,31,149,53,128,169,250,240,57,26,130,238,67,122,202,70,247,133,234,55,233,92,145,54,39,145,105,209,89,47,123,75,
+247,5,189,28,245,249,249,35,200,127,81,131,195,186,86,61,143,180,248,232,97,116,11,122,134,50,226,48,168,233,158,177,
+213,254,161,127,104,199,38,225,240,67,180,43,154,5,165,181,69,8,64,12,110,72,27,144,253,231,66,64,247,75,27,33,
+77,100,207,130,250,217,22,163,254,171,190,222,223,229,119,211,207,124,42,151,247,160,223,165,113,234,213,209,146,232,91,72,
+215,76,141,13,132,246,26,31,254,131,219,139,41,215,191,134,95,250,88,34,1,10,99,28,116,7,250,10,117,179,175,57,
+121,51,154,26,13,236,251,170,99,211,172,53,111,124,190,27,101,105,234,80,218,50,36,64,225,12,175,139,124,62,50,203,
+194,26,36,44,189,223,100,52,148,97,14,28,84,28,2,98,143,246,69,121,216,155,4,122,32,26,11,13,212,171,56,105,
+139,227,150,240,239,67,121,217,78,4,28,39,57,118,155,144,0,156,183,66,195,50,46,200,183,9,239,97,116,58,218,26,
+77,143,90,219,185,225,159,19,38,123,184,183,78,225,6,223,207,199,49,171,122,250,152,194,180,69,35,0,171,91,81,84,
+123,25,135,83,161,104,129,151,224,74,105,67,83,162,231,80,81,118,99,9,89,173,77,148,20,194,202,72,125,154,60,77,
+225,107,241,203,79,209,116,181,129,227,132,150,74,128,186,178,112,80,111,122,221,151,226,236,155,103,209,82,40,179,235,98,
+169,153,175,81,228,173,204,249,60,59,186,5,105,172,160,104,251,156,8,159,68,71,163,213,208,64,93,40,27,37,233,56,
+3,69,177,19,202,78,107,21,227,7,92,248,155,254,51,159,163,180,5,81,88,15,230,70,97,171,31,117,25,218,22,101,
+210,159,34,156,48,253,163,243,249,100,148,69,30,126,165,112,109,213,32,208,82,198,26,55,216,1,189,129,202,176,47,136,
+244,53,52,4,221,131,174,67,170,207,127,71,103,6,250,107,112,60,159,163,6,227,223,66,121,182,215,235,16,126,53,10,
+202,169,24,137,128,202,38,208,68,28,127,141,158,64,81,235,131,220,189,132,52,102,150,247,98,214,145,210,238,47,90,8,
+80,0,63,64,159,162,94,246,44,14,22,110,241,218,200,143,228,49,172,216,58,206,143,212,208,101,101,106,104,139,90,81,
+210,200,242,105,207,20,60,195,242,58,136,207,234,204,231,105,90,13,111,43,145,0,133,171,242,190,55,227,66,86,231,90,
+55,160,179,22,149,53,226,82,7,43,47,219,147,128,139,202,74,95,199,3,103,117,98,162,118,124,218,203,91,245,78,109,
+214,51,232,34,244,7,180,12,26,31,13,180,107,101,195,13,210,113,23,199,180,166,235,232,68,101,231,167,202,241,195,39,
+188,150,253,156,207,170,27,81,173,242,131,64,100,68,121,59,33,106,134,50,114,119,73,149,203,187,236,180,193,120,63,20,
+167,158,69,45,22,221,79,104,32,97,23,212,232,133,95,101,151,97,147,226,167,174,168,141,24,21,45,143,52,241,31,229,
+186,170,235,138,182,27,178,149,64,0,246,225,53,107,90,62,199,89,124,128,243,212,166,251,233,71,209,254,104,46,20,166,
+101,248,177,104,36,109,105,152,155,255,223,71,189,76,245,124,243,162,211,90,135,248,224,162,178,220,0,125,128,242,48,45,
+154,186,20,45,139,114,71,66,28,87,161,180,118,22,1,228,158,86,71,16,141,128,202,34,208,26,28,95,65,69,216,59,
+68,242,16,58,10,109,131,230,67,211,70,75,241,255,92,225,71,105,95,11,105,252,227,75,148,181,233,183,251,191,8,253,
+169,82,4,84,54,72,253,116,93,71,211,152,30,122,216,166,82,153,235,167,196,0,127,72,132,210,251,16,55,154,240,233,
+39,52,3,121,37,207,90,253,48,12,101,101,167,245,29,196,28,51,76,161,168,33,218,4,69,233,48,167,45,195,235,115,
+204,138,131,142,64,128,2,212,227,186,89,118,56,62,38,188,35,209,64,103,44,66,18,50,113,66,124,255,68,121,217,94,
+4,156,73,58,29,72,119,2,112,62,14,69,25,112,82,89,127,134,158,70,55,162,61,208,178,221,67,47,255,44,105,212,
+239,98,74,20,53,143,56,237,104,243,149,159,163,106,166,0,98,3,237,15,199,73,208,208,142,4,71,62,241,38,95,229,
+245,94,163,204,96,145,198,57,209,235,35,39,63,215,111,180,21,139,109,16,2,80,87,125,187,32,67,250,154,144,190,23,
+253,6,105,80,119,160,62,15,18,181,191,50,129,145,8,132,245,133,163,250,119,122,130,43,202,245,230,19,220,233,58,154,
+213,246,159,35,165,203,95,116,39,0,123,253,206,167,67,15,160,162,76,131,165,39,163,202,245,159,72,211,64,187,23,28,
+181,18,62,138,125,218,157,114,255,158,5,158,120,106,192,58,75,211,226,133,167,208,239,208,44,104,120,153,229,77,154,184,
+52,225,248,1,74,99,183,225,57,239,164,58,252,8,4,84,14,129,244,4,151,234,84,94,166,49,15,13,182,255,3,105,
+194,104,66,20,33,133,221,157,40,140,22,173,205,103,141,135,100,105,59,17,88,247,68,248,108,41,4,40,151,73,145,234,
+83,86,227,219,207,17,214,54,104,160,78,149,146,169,146,34,45,252,29,57,130,220,98,23,241,121,230,150,255,7,251,168,
+151,72,106,191,207,243,6,59,217,7,223,29,76,30,215,64,203,103,148,87,53,194,51,177,183,224,11,25,133,215,239,193,
+44,8,128,35,81,17,171,189,135,246,59,236,10,228,127,79,210,144,85,187,249,58,97,109,143,46,47,33,95,121,14,62,
+76,90,66,126,250,53,74,237,29,219,113,227,108,206,189,140,254,140,180,71,187,246,65,175,227,83,125,122,73,176,222,211,
+147,246,5,245,234,75,216,186,19,248,53,167,123,245,201,90,67,56,133,127,180,159,123,213,77,237,246,84,5,39,82,239,
+99,177,13,78,96,76,190,158,103,240,83,177,191,213,123,4,182,167,109,83,91,103,51,129,164,4,116,45,213,228,235,18,
+168,219,53,85,225,15,67,186,47,61,150,122,167,119,183,218,202,33,48,53,209,106,108,96,161,156,163,255,130,240,181,53,
+249,177,72,229,94,117,91,148,4,234,93,25,81,236,201,40,142,250,212,205,223,200,119,86,239,212,211,59,136,254,131,52,
+94,112,33,42,252,93,183,180,85,79,50,254,115,15,81,167,217,153,165,136,177,14,225,177,69,39,112,22,78,231,136,238,
+60,146,75,77,240,62,128,110,67,167,163,71,168,63,28,178,179,182,240,254,69,221,60,153,208,119,205,46,134,17,222,173,
+146,97,176,14,42,9,129,150,241,127,109,133,118,46,90,48,73,56,29,252,232,125,58,191,68,106,223,30,235,224,166,145,
+95,103,53,32,153,4,206,46,120,90,11,245,106,25,222,192,205,33,72,3,57,253,106,170,156,215,163,113,50,0,160,193,
+12,93,196,79,203,32,172,190,11,162,165,33,82,222,103,68,103,163,233,245,79,1,230,23,12,22,0,185,61,138,150,50,
+159,128,115,43,180,159,79,248,255,43,248,219,140,142,204,173,9,253,167,245,54,126,218,0,186,248,127,183,203,57,159,202,
+150,128,174,143,154,160,24,109,144,96,159,225,187,229,144,38,12,235,108,99,146,248,17,86,128,36,200,204,135,248,25,146,
+192,95,63,121,81,71,120,187,24,25,126,7,183,90,104,82,89,11,218,110,189,240,121,147,130,19,169,193,221,59,11,142,
+179,78,209,205,64,98,213,23,77,107,106,251,126,196,117,244,229,180,1,217,127,223,19,208,125,230,242,168,215,61,169,174,
+69,215,160,125,169,119,26,224,183,21,68,160,165,47,174,24,117,63,124,41,90,66,255,228,100,159,16,174,22,193,28,135,
+110,204,41,142,60,130,253,45,129,142,23,49,224,71,35,186,235,11,103,45,117,108,85,50,156,69,191,225,99,194,185,2,
+29,67,123,161,65,241,178,77,245,89,99,64,73,109,202,164,30,237,47,23,2,167,18,234,119,50,10,249,51,194,185,23,
+93,135,78,161,190,22,189,240,239,133,140,242,17,6,227,186,26,146,168,206,113,93,146,162,5,51,179,229,144,36,77,16,
+169,31,183,118,14,97,87,54,200,193,6,127,138,72,236,34,68,162,142,70,148,137,164,155,113,55,164,136,68,85,56,142,
+127,147,54,113,200,202,54,204,42,160,62,15,71,157,251,121,11,98,160,27,138,91,10,138,203,209,4,4,90,58,245,250,
+70,43,220,166,11,78,165,57,188,132,231,117,80,89,147,56,74,251,132,250,147,147,61,151,83,184,14,118,100,2,26,192,
+252,102,228,175,71,249,156,239,46,67,3,11,32,232,144,23,190,250,111,144,52,37,253,106,9,60,106,181,116,26,211,128,
+155,110,82,108,157,9,28,200,169,73,58,159,30,233,204,25,212,171,247,84,183,42,110,154,108,154,184,224,52,234,55,57,
+180,224,56,235,20,221,2,36,86,11,35,210,154,218,63,189,240,52,109,56,246,223,223,4,254,72,246,119,70,81,238,137,
+181,74,121,119,218,61,45,162,176,149,67,64,11,145,46,64,234,27,228,97,31,17,168,194,255,54,210,253,242,141,104,4,
+171,240,117,111,105,18,186,218,8,137,237,254,207,121,221,79,247,229,217,201,200,181,250,13,105,174,81,186,103,63,23,169,
+142,110,130,170,48,137,67,50,82,143,167,165,97,162,248,109,217,17,216,159,160,182,66,81,174,91,157,98,85,231,73,253,
+168,163,209,236,72,139,25,14,64,69,79,226,16,229,40,115,233,79,134,166,5,124,182,234,16,88,147,164,28,129,242,152,
+196,9,115,185,42,31,214,8,255,241,49,7,2,220,112,141,129,244,34,210,40,166,61,136,181,21,88,223,237,121,23,162,
+15,243,206,81,47,224,212,75,92,179,176,33,97,248,62,198,35,0,252,112,79,79,189,240,47,202,62,218,89,148,151,194,
+120,3,197,75,172,93,167,38,32,230,45,186,153,207,105,77,251,19,127,31,149,218,166,17,255,208,180,25,233,226,127,73,
+229,207,150,63,1,56,139,245,96,47,184,212,59,187,182,66,99,163,252,19,146,83,12,74,59,58,28,165,181,87,9,32,
+167,84,214,63,88,216,172,137,226,244,47,244,178,211,89,170,158,115,210,184,18,82,63,178,104,123,156,8,171,142,167,180,
+244,193,230,16,212,218,127,210,103,189,231,38,174,93,141,135,82,175,165,165,65,116,196,169,9,4,117,103,63,142,122,127,
+92,20,83,191,73,3,229,182,18,8,192,126,224,183,206,241,252,40,133,149,192,141,222,209,112,41,154,27,149,144,195,116,
+81,42,205,232,74,20,213,116,29,159,34,93,172,205,242,13,15,49,220,17,125,129,146,152,222,39,114,3,90,172,138,100,
+72,151,238,25,210,216,135,120,174,98,214,26,159,38,113,111,209,186,124,86,89,164,177,23,241,172,5,92,149,48,210,162,
+151,214,103,105,27,16,88,37,242,214,239,137,160,28,166,71,207,100,89,184,93,194,210,19,101,182,188,8,0,62,206,75,
+182,111,202,43,29,117,9,23,94,173,13,247,53,93,42,110,156,83,186,105,94,170,46,12,170,148,206,160,60,118,229,152,
+180,147,23,167,156,90,221,94,166,184,109,197,18,16,243,64,179,115,76,251,146,72,117,240,127,213,18,102,177,153,105,137,
+45,131,188,16,68,71,155,131,51,45,177,249,99,94,4,224,60,14,58,8,105,226,38,52,213,211,165,81,94,209,22,22,
+174,242,128,244,146,205,180,118,45,1,20,150,238,186,69,4,155,184,55,80,255,168,67,30,201,87,156,65,173,180,117,172,
+213,191,6,26,235,128,168,148,52,194,230,223,45,176,244,242,103,253,198,117,125,140,107,251,224,97,224,26,93,74,70,28,
+105,173,9,80,119,212,151,143,250,130,101,13,154,109,90,235,12,215,60,241,193,111,253,48,142,73,218,10,188,117,52,133,
+167,193,247,85,81,216,231,175,29,45,210,190,16,106,237,11,242,111,87,123,172,118,153,204,57,193,208,210,75,184,175,239,
+74,109,240,147,26,87,209,117,108,29,84,217,107,18,105,27,13,37,89,52,129,183,225,166,39,106,109,5,19,128,126,216,
+54,205,207,231,231,135,151,70,252,15,111,226,229,4,52,85,193,89,232,26,29,233,121,55,126,86,58,250,80,29,159,30,
+117,141,211,39,243,35,32,246,129,38,231,120,15,42,202,134,17,209,122,249,229,172,90,33,167,121,28,47,82,78,128,25,
+22,164,142,219,227,105,173,72,30,71,25,69,47,218,218,35,162,219,126,113,118,40,25,213,222,235,105,77,123,161,108,150,
+54,144,62,245,191,37,249,254,29,26,51,101,254,181,183,123,28,243,118,85,113,104,101,239,118,107,130,156,48,101,176,151,
+176,29,195,193,218,146,33,84,202,240,18,121,167,29,30,15,143,99,36,242,220,219,211,48,156,124,208,219,153,93,100,68,
+64,219,133,105,79,88,189,32,242,6,116,53,90,31,221,129,154,96,11,145,9,61,238,159,214,238,75,27,64,19,253,7,
+253,51,109,205,16,103,245,168,126,223,135,87,153,71,144,47,229,105,185,146,210,121,87,73,241,214,37,218,73,131,132,234,
+46,251,63,232,25,20,247,154,164,237,18,213,222,213,121,219,72,37,223,86,48,129,160,125,208,253,229,65,72,253,161,40,
+118,14,142,46,136,226,208,110,114,35,176,49,33,239,136,226,182,21,221,18,244,52,39,127,138,86,70,215,117,115,88,131,
+115,187,147,198,137,98,164,243,226,24,110,251,197,233,212,100,116,145,152,153,125,11,247,123,114,95,55,31,186,180,204,251,
+187,8,233,86,123,151,118,252,194,79,113,69,0,157,163,147,147,9,123,166,4,225,235,126,241,50,180,44,117,116,39,244,
+70,130,48,50,243,18,92,135,195,49,226,141,8,56,206,214,206,189,210,241,5,249,123,89,191,69,91,233,4,246,39,5,
+223,46,48,21,163,19,215,178,5,198,215,236,168,90,126,168,90,5,48,4,69,53,173,164,108,54,156,4,185,131,73,154,
+89,248,86,246,30,104,136,192,95,117,176,69,90,229,174,253,216,211,154,86,238,196,93,121,48,176,197,96,132,36,219,73,
+134,4,40,167,176,252,31,73,89,232,143,227,127,218,12,147,150,56,40,210,177,108,202,188,116,243,62,132,147,3,204,18,
+39,208,30,77,32,32,64,93,58,163,91,101,139,120,78,171,115,86,65,230,218,70,64,76,208,19,40,142,93,209,22,76,
+229,254,37,51,202,151,86,28,150,97,122,90,215,79,37,118,169,21,240,185,63,40,24,253,54,119,66,131,109,15,25,56,
+233,120,120,162,75,20,62,101,2,29,9,80,163,182,67,113,158,176,190,15,247,89,14,50,117,76,155,79,116,38,64,25,
+60,137,178,50,221,131,157,136,198,67,97,63,191,118,125,215,150,180,235,73,146,215,80,84,83,219,187,66,103,218,253,121,
+6,38,107,163,168,91,45,234,105,82,141,85,205,128,106,1,44,72,107,154,39,218,52,126,225,39,114,74,40,109,213,49,
+164,167,144,85,239,226,154,218,78,77,132,87,198,72,79,107,187,123,71,220,12,245,112,255,80,101,50,218,167,9,9,202,
+119,91,142,69,239,96,164,170,113,97,191,96,207,253,137,156,22,144,103,242,121,150,150,255,187,125,252,156,147,122,217,150,
+109,100,2,183,140,252,85,162,111,102,165,162,79,159,200,103,127,122,210,42,167,227,80,22,204,238,39,156,56,47,95,214,
+10,232,135,145,173,28,2,154,217,159,51,69,212,31,227,119,63,244,106,138,48,178,244,58,115,150,129,181,133,245,90,219,
+255,254,215,4,34,19,224,154,212,218,177,159,28,143,81,159,224,237,22,135,126,119,215,119,115,208,199,231,126,66,222,227,
+180,109,122,82,90,171,216,171,110,90,173,184,121,73,137,124,156,85,128,79,123,37,96,87,250,199,114,246,110,116,45,210,
+234,185,36,139,28,188,24,9,112,182,222,4,218,174,43,59,225,227,72,20,245,9,235,119,112,251,123,126,207,239,245,142,
+201,46,178,38,16,148,221,152,28,207,35,236,56,215,170,78,73,249,154,19,55,162,117,40,211,29,209,39,106,171,91,213,
+201,99,197,191,223,150,244,233,105,146,168,246,33,121,206,106,60,33,106,156,117,112,55,3,137,140,242,196,138,250,149,191,
+70,107,160,151,80,93,108,9,18,154,230,137,182,55,241,239,241,136,114,74,123,41,162,221,19,197,25,187,253,18,247,103,
+161,185,248,189,159,207,177,138,182,10,137,90,52,227,132,221,150,113,120,14,46,25,129,125,241,22,165,61,77,22,122,103,
+95,227,119,62,213,172,51,105,26,243,56,36,86,195,241,122,49,60,168,115,113,103,12,247,253,228,84,13,241,150,25,100,
+120,10,194,208,170,138,151,51,8,171,31,130,184,152,76,102,113,161,185,137,112,244,120,107,156,231,61,95,199,125,157,58,
+138,36,183,81,246,127,228,38,205,133,232,79,248,175,210,150,28,234,12,230,101,47,230,21,176,195,237,59,2,135,145,227,
+44,86,65,215,125,187,148,60,11,254,231,4,30,231,90,116,7,55,131,117,184,65,58,152,124,105,241,69,25,230,65,142,
+30,212,169,67,167,48,48,171,190,172,22,57,36,25,76,212,242,231,127,244,136,198,167,77,160,157,192,22,124,113,32,138,
+186,144,106,96,226,154,250,122,81,123,64,254,191,48,2,99,17,211,222,40,206,24,66,167,196,105,240,253,111,148,167,6,
+224,107,111,154,228,106,49,45,202,136,99,154,72,183,141,76,160,87,191,65,109,130,158,74,254,53,245,232,241,145,189,87,
+254,155,111,165,76,225,123,41,253,219,123,114,2,90,76,28,110,75,27,37,20,213,213,237,209,217,81,28,151,232,70,99,
+44,106,231,179,180,155,179,12,204,97,37,34,112,60,190,102,75,228,51,189,167,233,210,7,81,143,16,138,154,200,57,20,
+28,227,70,68,50,12,119,42,124,219,224,4,52,40,165,253,88,53,17,147,214,202,250,129,165,77,119,209,254,255,64,132,
+43,101,16,169,58,125,186,129,184,36,102,88,247,196,116,111,231,217,17,24,159,160,86,74,17,156,6,245,126,147,194,127,
+30,94,103,204,35,208,32,204,155,114,12,219,65,55,148,64,219,128,132,114,185,28,218,52,131,236,234,61,26,231,102,16,
+78,163,130,8,120,31,64,166,102,141,145,49,177,212,234,170,74,90,75,29,154,155,4,126,175,196,68,158,81,98,220,181,
+137,154,65,48,189,60,94,101,181,96,130,68,191,130,159,107,18,248,179,151,254,37,160,54,65,139,106,38,139,136,64,43,
+153,255,72,61,61,34,162,123,59,203,152,64,208,166,175,76,176,187,162,52,139,169,180,203,199,213,104,63,202,179,137,19,
+237,234,43,205,130,226,216,35,113,28,247,145,219,209,200,235,168,29,242,171,54,97,28,180,54,154,133,250,121,3,199,211,
+209,0,75,234,22,31,43,111,243,166,76,225,147,41,253,219,123,68,2,45,125,90,249,216,11,45,22,209,171,156,233,201,
+195,45,209,133,250,167,194,166,250,184,90,198,233,211,100,99,213,243,157,113,150,171,21,28,117,87,79,254,109,88,98,170,
+166,44,49,238,66,163,214,5,43,111,251,25,17,196,185,81,187,15,247,23,43,81,53,185,40,42,169,69,218,39,68,246,
+84,70,17,206,149,81,56,77,14,70,19,47,186,128,166,237,161,189,72,24,91,32,93,176,162,222,72,226,116,192,174,208,
+95,255,30,254,11,163,224,191,155,16,223,52,9,227,212,106,227,159,162,17,150,205,37,12,43,75,111,105,59,242,221,210,
+242,68,183,147,62,103,2,17,9,104,240,108,188,136,110,187,57,187,149,147,87,117,115,208,167,231,180,170,239,135,40,206,
+117,237,102,174,65,119,86,145,87,219,13,239,46,164,49,238,53,54,171,108,233,233,217,59,178,10,172,15,194,209,64,195,
+132,9,242,169,251,4,155,9,68,37,176,60,14,79,66,83,69,245,128,187,11,105,239,126,23,195,189,157,102,79,96,116,
+130,252,5,154,60,69,208,26,100,223,26,173,75,121,54,113,18,71,104,126,132,196,42,142,233,137,72,219,200,4,180,72,
+224,171,145,191,30,248,70,147,137,234,51,233,233,1,13,170,107,108,224,52,164,250,85,23,155,41,101,66,235,240,68,118,
+202,44,86,210,187,158,158,143,99,207,210,222,233,26,54,124,219,200,56,158,11,116,187,31,113,105,193,108,150,246,32,129,
+105,210,213,86,30,129,205,137,58,78,127,43,235,148,78,166,201,164,182,123,195,172,227,168,68,120,69,76,228,168,19,22,
+53,30,13,120,158,94,9,50,213,78,68,86,29,176,190,153,177,140,90,156,250,209,183,72,171,110,118,67,105,31,249,124,
+151,48,118,225,130,250,0,199,117,80,28,27,134,99,175,40,143,67,44,91,183,155,37,12,78,109,217,95,41,243,91,43,
+216,145,154,46,97,158,122,121,211,42,152,187,123,57,242,121,19,232,65,224,47,156,95,188,135,155,40,167,191,192,209,177,
+81,28,246,161,155,3,201,115,156,27,122,221,20,29,93,3,78,122,242,123,253,18,211,169,167,110,63,40,49,254,186,69,
+173,197,45,73,236,172,36,158,236,167,111,9,156,64,206,227,60,137,124,13,238,147,246,253,250,22,114,14,25,215,96,208,
+114,9,195,213,206,21,199,33,245,37,206,75,24,70,29,188,105,209,194,50,49,19,250,34,247,37,149,92,148,17,51,31,
+121,56,127,145,64,227,12,2,107,66,231,40,164,73,157,58,216,220,41,19,249,76,74,255,246,30,159,192,201,120,153,38,
+166,183,83,99,186,47,195,249,124,68,170,113,182,172,173,234,91,201,101,157,223,74,132,215,50,118,58,17,9,218,164,228,
+68,105,210,253,219,37,167,161,158,209,183,20,164,6,196,181,15,118,28,27,82,207,92,23,151,106,96,138,235,82,232,235,
+56,96,59,184,253,119,113,41,175,71,76,112,10,39,114,166,229,243,83,29,184,197,249,250,99,28,239,173,220,115,92,6,
+125,17,199,51,110,95,64,3,105,170,7,193,102,165,18,246,111,198,44,175,208,249,163,42,183,170,25,105,90,22,101,209,
+118,132,249,108,61,62,93,181,252,58,61,213,38,64,229,9,219,219,240,184,9,223,125,212,90,169,82,124,190,181,218,185,
+47,54,117,45,172,103,229,243,171,49,185,106,96,179,178,214,146,183,221,98,230,43,107,231,138,191,178,156,170,144,176,150,
+178,90,155,207,95,37,40,128,119,241,51,150,194,177,153,64,55,2,212,145,49,209,205,40,142,221,211,45,76,159,43,134,
+0,5,182,6,122,35,78,193,5,110,63,225,120,54,90,184,152,148,150,23,11,121,84,191,233,0,20,215,220,55,234,80,
+108,128,156,25,233,190,59,174,169,223,250,11,20,246,101,59,196,80,222,215,164,109,30,244,41,74,99,115,224,185,188,76,
+244,81,204,226,140,22,66,239,161,56,166,50,158,173,234,168,72,227,133,113,50,21,209,237,227,184,155,9,85,61,251,141,
+75,159,152,7,218,129,99,21,236,80,18,209,56,206,237,25,138,250,164,76,187,191,40,255,47,137,163,141,163,56,108,113,
+211,228,85,51,45,217,76,253,81,171,62,191,78,29,202,40,163,76,155,65,24,77,13,226,159,100,108,142,148,153,83,25,
+29,204,202,167,67,130,112,118,227,168,89,226,56,246,68,28,199,118,155,13,1,53,254,104,45,66,155,60,65,136,159,226,
+103,159,4,254,138,240,162,213,141,113,182,83,138,147,38,61,206,108,51,129,164,4,180,114,86,79,208,100,241,152,253,39,
+132,115,120,210,132,52,220,223,190,228,47,206,234,62,173,78,213,187,37,234,96,59,149,152,200,247,137,251,178,18,227,175,
+91,212,219,147,224,36,247,32,218,42,233,139,186,101,214,233,45,133,128,86,230,174,16,35,230,103,113,251,195,24,238,237,
+52,7,2,244,189,39,38,216,99,208,20,49,130,87,155,112,35,210,10,111,61,201,243,0,234,7,83,94,227,154,119,121,
+232,76,236,37,78,37,185,151,81,191,85,239,211,61,190,115,208,165,159,249,14,41,24,39,69,42,94,198,239,243,41,252,
+219,107,124,2,251,227,69,237,97,28,211,184,145,174,101,149,178,96,92,37,28,236,215,211,18,171,228,144,64,181,109,47,
+228,16,174,131,140,78,96,195,232,78,115,117,25,119,188,53,215,196,228,21,120,146,155,168,168,105,209,32,202,4,81,29,
+227,78,219,81,104,128,193,214,155,128,6,12,222,232,237,172,167,139,52,23,244,158,129,215,216,193,129,164,125,153,148,233,
+215,52,240,69,76,226,252,33,184,120,233,66,188,116,130,48,53,104,97,43,144,128,202,43,176,109,57,38,153,244,184,0,
+127,151,132,129,84,236,184,102,142,233,185,33,199,176,29,116,179,9,104,245,216,153,104,170,140,178,121,33,225,84,245,55,
+152,81,22,163,7,211,210,166,137,243,186,209,125,14,184,124,128,235,216,149,49,253,148,225,252,103,68,58,103,25,17,7,
+113,62,204,209,219,142,116,41,128,150,122,56,30,206,86,236,226,180,219,169,115,186,157,244,57,19,8,250,220,7,64,34,
+206,86,198,175,226,94,219,129,60,106,130,165,19,152,151,20,104,161,225,231,232,227,64,250,172,119,151,180,47,98,212,189,
+240,191,208,90,92,167,86,70,215,163,126,121,167,168,174,229,186,166,199,49,45,52,187,57,142,135,62,115,171,58,246,15,
+212,94,207,162,96,208,192,225,143,145,182,254,212,54,175,85,179,184,139,171,219,211,175,9,46,47,162,104,167,146,223,255,
+139,18,244,74,9,130,63,35,129,159,162,189,236,74,132,218,130,43,75,123,153,192,142,206,50,64,135,21,155,192,212,248,
+88,48,182,175,124,60,104,82,190,241,54,70,78,57,220,156,112,151,140,25,246,181,184,31,22,211,79,63,59,87,131,165,
+142,110,26,155,152,27,158,201,233,244,190,157,38,144,134,249,253,63,242,179,123,6,121,186,158,48,54,106,25,184,248,62,
+255,207,144,32,92,15,142,39,128,150,145,151,197,18,132,243,24,126,182,74,224,175,40,47,115,231,20,145,86,237,251,37,
+223,57,193,109,120,176,90,80,160,73,156,172,6,225,159,39,172,29,26,206,44,105,246,126,142,199,201,99,120,214,239,250,
+176,24,238,203,116,186,37,145,39,153,120,207,42,205,154,60,180,69,35,160,193,174,73,162,57,29,193,149,6,117,181,80,
+194,102,2,221,8,104,128,91,253,248,49,187,57,106,57,167,133,132,234,251,223,215,242,157,63,150,71,64,125,201,101,145,
+174,85,239,32,77,62,76,138,102,68,163,35,221,251,106,33,234,115,232,42,164,243,253,104,155,145,233,184,11,114,223,228,
+158,255,225,126,132,21,35,207,215,196,112,219,238,84,227,106,26,3,211,83,207,43,183,159,44,249,255,185,82,198,127,103,
+74,255,246,30,143,192,78,56,143,219,79,210,68,219,233,241,162,41,220,245,252,196,24,119,65,89,148,68,234,62,242,221,
+40,14,237,38,55,2,203,17,178,218,190,42,216,131,85,72,68,237,210,16,172,132,122,144,99,28,211,62,217,27,160,218,
+229,183,232,4,139,81,160,203,57,102,97,179,23,157,135,170,198,7,204,111,163,151,50,128,250,111,194,152,5,133,101,165,
+227,149,9,194,125,31,63,19,40,28,91,113,4,196,27,45,135,226,190,75,70,123,36,175,23,248,31,40,251,226,82,221,
+57,166,150,244,104,175,221,47,81,30,166,223,77,231,68,248,140,9,12,66,128,58,163,246,237,214,12,43,228,231,132,181,
+53,170,204,239,111,144,108,23,254,85,192,99,10,142,113,247,218,190,167,240,196,38,136,144,124,233,125,10,73,222,183,130,
+183,76,76,239,82,155,10,185,222,117,41,191,144,15,199,135,80,18,123,26,79,75,162,5,144,6,116,109,38,48,240,155,
+163,62,132,71,253,14,135,162,168,166,62,209,190,40,244,111,162,38,80,89,2,45,245,116,34,62,191,131,226,218,95,43,
+155,185,138,36,12,160,106,11,244,46,182,180,118,63,1,44,130,6,218,150,162,179,23,198,27,28,87,230,152,198,212,183,
+254,22,42,37,47,69,179,43,43,190,144,47,199,81,209,91,40,174,61,130,135,74,150,81,152,46,142,151,198,205,84,4,
+247,79,226,102,82,52,144,119,29,109,197,18,8,216,239,199,177,10,166,241,56,253,134,138,133,80,66,108,113,87,114,68,
+73,226,79,113,164,217,214,56,246,34,142,189,154,49,14,177,81,70,185,45,158,243,65,93,15,227,219,247,6,61,211,159,
+95,254,137,108,79,159,50,235,218,10,109,45,52,180,45,156,184,191,9,121,127,151,149,83,31,105,155,0,91,225,4,180,
+210,45,14,120,93,45,206,161,172,46,86,121,133,42,60,213,109,17,182,93,196,150,226,180,86,139,229,97,15,229,17,168,
+195,108,60,129,115,200,161,86,240,100,101,127,33,160,170,175,70,203,42,175,113,195,57,20,15,19,199,240,164,254,193,1,
+49,220,151,233,244,23,68,158,71,127,54,106,158,110,199,161,182,248,233,151,45,125,162,114,25,204,157,182,173,157,123,176,
+19,17,190,155,13,55,90,21,172,235,205,16,174,111,183,163,35,209,234,40,175,107,91,132,100,217,73,133,8,28,73,90,
+102,142,152,30,109,159,116,54,253,181,3,195,62,155,142,54,19,168,1,129,93,73,163,158,82,138,99,186,79,249,87,28,
+15,125,236,54,139,29,6,22,134,223,121,104,149,10,112,220,46,101,26,30,199,255,144,148,97,216,123,116,2,234,211,198,
+121,122,62,12,89,125,209,42,155,182,247,91,61,227,4,106,59,196,99,185,118,107,204,172,50,227,47,25,231,177,46,193,
+77,85,145,132,190,66,93,248,166,31,250,115,153,220,248,114,3,21,206,128,106,133,220,206,40,110,184,218,134,202,22,143,
+128,182,2,72,107,42,167,170,252,232,210,230,37,149,127,234,240,49,4,160,1,134,52,246,40,158,245,72,181,182,2,104,
+53,93,180,102,104,253,34,226,231,44,58,146,17,163,178,179,22,2,250,93,172,216,242,127,148,143,218,2,239,71,81,28,
+150,232,102,221,28,227,190,36,199,176,29,116,67,8,180,244,21,38,228,243,77,100,75,91,78,102,101,119,17,208,62,89,
+5,214,176,112,180,109,221,70,49,243,116,23,157,224,203,98,250,41,212,121,80,159,22,39,82,169,44,211,224,216,233,101,
+69,94,195,120,127,72,154,163,110,121,213,158,189,214,81,118,109,179,164,62,219,238,232,42,244,48,245,225,36,228,85,195,
+192,232,83,251,53,249,222,52,70,222,111,196,237,214,49,220,219,169,9,84,133,192,106,9,18,242,49,215,116,247,213,163,
+129,187,58,154,179,158,174,102,199,133,222,153,243,131,158,46,243,117,160,133,124,105,108,248,211,217,253,48,56,154,6,84,
+70,126,181,152,52,137,157,159,196,83,65,126,38,32,158,253,209,88,25,199,247,16,117,242,184,140,195,116,112,201,8,84,
+229,85,29,234,219,245,133,197,157,112,25,9,138,110,164,91,76,51,200,243,181,252,31,229,163,102,82,79,138,226,208,110,
+70,88,237,249,106,6,60,84,254,51,101,16,78,173,131,160,14,175,76,6,126,136,210,252,30,158,197,255,38,92,76,30,
+81,39,39,20,223,201,182,250,127,246,206,3,76,150,162,236,194,228,36,57,73,150,12,138,130,128,128,36,137,10,8,72,
+18,20,17,16,49,43,72,144,95,68,68,130,68,3,136,138,72,22,144,32,74,22,16,228,2,146,115,206,233,194,37,93,
+114,206,224,255,158,161,123,153,187,119,119,167,187,186,186,167,167,231,124,207,115,182,103,103,170,190,170,122,171,166,186,186,
+170,186,231,131,67,238,191,143,230,142,225,8,49,8,168,15,211,224,59,171,169,238,119,206,26,184,139,225,66,238,10,203,
+146,221,55,9,116,121,150,128,14,99,2,16,208,46,82,253,206,197,42,17,105,220,131,175,13,232,119,95,79,251,94,29,
+109,3,4,126,195,171,105,6,254,235,252,66,191,141,179,127,231,96,181,8,161,11,222,143,116,49,39,15,208,214,78,79,
+219,93,23,243,209,11,73,235,2,126,147,146,50,170,187,124,190,141,238,66,255,66,121,38,244,9,110,235,113,2,203,147,
+255,31,161,73,50,150,67,227,54,181,23,155,9,244,4,129,182,249,22,245,117,203,6,100,250,230,128,56,253,26,229,104,
+10,126,94,164,194,207,138,159,191,80,127,251,171,14,83,69,242,157,197,141,198,218,243,101,9,56,66,152,191,142,240,153,
+63,138,64,160,237,251,173,205,191,139,7,184,212,38,226,171,20,175,166,215,63,218,104,247,9,229,47,162,189,141,175,189,
+35,250,179,171,98,4,238,45,22,61,90,236,255,70,243,84,115,71,69,38,174,135,42,218,214,67,189,217,225,189,135,248,
+92,59,105,235,218,241,116,200,126,215,62,126,45,82,202,239,71,242,211,203,110,242,78,114,13,46,235,125,188,161,201,9,
+77,32,12,101,75,13,245,102,134,247,250,166,35,202,192,162,202,32,235,146,216,228,25,19,28,75,56,77,6,220,154,49,
+124,183,130,105,113,234,163,37,37,254,24,126,135,107,251,37,37,105,183,61,74,64,23,180,218,233,24,178,155,116,184,34,
+63,193,7,59,32,125,23,109,109,4,146,9,3,253,104,244,106,109,111,103,121,121,53,23,130,154,12,175,187,77,74,6,
+187,189,211,245,244,186,67,170,81,254,246,32,47,51,150,156,159,41,240,255,69,244,55,218,255,61,104,59,164,223,147,40,
+57,89,187,239,50,129,131,73,95,231,151,44,166,71,74,111,65,31,247,112,77,39,188,178,148,193,97,250,151,128,54,7,
+102,189,70,105,167,164,199,82,218,58,16,80,159,128,94,37,152,230,6,116,125,31,195,180,217,100,39,116,100,12,103,57,
+125,104,129,187,200,124,159,22,189,175,204,153,166,131,135,19,216,150,168,33,245,245,40,241,94,15,79,54,110,76,141,185,
+218,180,6,222,127,24,55,133,150,183,163,249,174,158,89,130,95,187,12,35,160,133,68,109,4,236,166,93,65,226,231,116,
+51,3,85,166,29,210,81,12,151,63,117,60,139,12,247,225,8,239,123,96,49,2,156,17,62,210,228,105,209,69,24,93,
+217,214,166,211,31,161,172,165,124,196,9,102,34,116,32,206,245,28,219,80,211,66,228,86,104,184,137,124,45,226,44,24,
+224,92,187,12,30,8,136,231,40,197,9,44,141,139,44,219,249,117,11,169,38,144,47,41,158,100,233,30,86,38,5,237,
+134,46,195,90,59,128,9,184,251,210,0,0,32,0,73,68,65,84,202,112,108,159,189,77,160,109,16,175,1,253,199,41,
+205,69,40,230,99,176,94,194,223,110,40,214,99,48,112,213,56,83,31,53,117,142,82,105,92,161,221,168,189,96,59,147,
+201,178,22,168,179,148,95,227,167,223,102,9,232,48,45,2,218,240,82,149,77,76,66,186,38,57,20,233,194,110,123,100,
+107,38,1,77,144,126,38,99,209,244,219,95,154,160,189,54,99,120,7,51,129,186,17,88,49,32,67,186,222,63,57,32,
+94,63,71,209,181,221,55,144,230,91,98,152,174,193,190,133,52,14,174,202,180,128,180,66,193,196,254,67,124,181,31,111,
+184,46,8,50,67,116,221,57,31,90,95,117,93,108,211,134,43,205,181,77,155,161,252,121,130,188,65,224,253,242,68,112,
+216,210,9,116,123,49,81,253,148,126,175,250,229,210,75,218,148,4,218,38,106,174,227,117,94,123,159,8,43,160,214,170,
+109,83,152,148,93,142,132,215,167,242,194,30,38,188,86,201,251,206,96,49,33,218,16,189,60,12,151,44,111,223,69,160,
+69,209,192,174,131,193,32,249,108,223,44,142,134,8,243,164,252,218,170,39,0,247,115,134,168,143,193,111,61,203,27,90,
+192,171,181,145,199,180,109,94,48,184,0,17,255,215,247,200,125,120,173,91,66,119,50,151,182,11,142,171,161,135,81,76,
+123,29,103,63,64,105,27,239,78,33,107,156,42,108,230,68,207,161,60,54,220,166,132,218,149,148,66,133,140,59,243,176,
+232,20,246,34,2,212,142,75,93,50,36,54,109,218,146,215,26,243,119,203,222,37,225,235,209,198,117,225,227,124,20,35,
+64,93,170,125,205,141,158,66,89,237,140,98,169,58,182,9,116,135,0,13,92,237,125,102,244,74,214,198,222,22,78,19,
+108,182,28,4,96,151,158,191,86,228,245,253,109,44,99,188,188,25,39,203,162,52,141,28,57,203,22,52,241,173,243,110,
+17,123,135,200,3,249,204,150,178,67,133,16,128,179,218,194,70,5,42,107,125,249,168,139,37,229,81,153,246,43,80,166,
+145,162,254,189,46,101,117,62,88,233,253,176,47,235,230,117,217,229,202,71,63,217,36,145,10,251,73,252,124,42,192,215,
+104,86,205,188,155,59,0,28,81,166,11,139,54,94,172,88,126,198,115,92,243,55,22,38,127,251,34,237,126,8,49,237,
+124,216,153,246,171,223,102,24,201,86,26,233,195,17,62,123,122,132,207,252,81,185,4,158,235,224,254,14,62,223,29,157,
+213,33,92,157,62,142,253,92,218,180,108,79,242,98,84,250,143,143,205,34,208,54,32,82,63,249,5,180,4,210,29,107,
+51,161,233,209,44,72,183,81,191,133,100,207,160,23,145,158,213,172,190,241,62,164,59,38,126,134,20,39,150,41,189,3,
+233,127,15,139,229,176,161,126,190,65,185,102,204,81,54,141,128,79,200,17,190,43,65,147,118,169,93,201,75,117,37,3,
+31,36,170,59,151,142,234,98,250,189,150,244,182,100,56,203,157,174,101,149,107,98,28,235,174,141,147,105,63,186,238,208,
+248,237,166,178,18,179,223,202,8,28,71,74,89,239,202,123,132,176,63,174,44,103,78,200,4,226,19,216,2,151,121,238,
+176,77,115,112,75,250,194,199,220,4,116,189,175,243,215,225,72,119,150,199,176,79,227,68,19,209,59,163,127,198,112,56,
+140,143,239,13,243,126,214,183,239,38,224,117,89,3,59,92,97,2,250,126,135,216,107,140,103,206,9,137,88,114,156,85,
+240,255,131,146,210,208,93,62,182,250,17,184,148,44,197,124,242,70,214,18,106,222,97,135,172,129,29,46,33,160,11,106,
+164,31,112,11,177,51,12,50,63,1,64,139,249,34,40,198,238,198,208,133,134,252,25,175,81,12,216,253,30,189,135,242,
+218,91,68,56,11,77,137,134,44,145,222,79,164,231,178,231,221,13,77,148,150,29,203,223,33,253,251,205,114,9,192,125,
+19,244,34,26,108,47,241,198,73,104,62,212,170,227,114,115,82,220,123,146,207,229,56,134,180,117,162,117,180,243,9,145,
+182,247,226,25,182,135,174,18,104,175,75,94,175,132,246,64,183,160,161,190,15,188,221,21,211,206,250,195,80,87,89,245,
+66,226,48,122,36,103,13,141,233,5,174,202,35,250,103,206,178,197,14,62,186,23,218,64,55,243,152,212,147,234,106,25,
+244,70,236,10,40,232,79,125,218,65,72,139,209,182,30,36,64,221,109,141,180,99,60,139,189,73,160,77,81,15,150,212,
+89,54,129,129,29,207,167,103,105,236,67,132,249,174,25,22,35,0,83,93,247,95,53,4,219,34,111,61,79,228,239,163,
+98,153,27,34,54,62,23,71,186,115,189,136,253,132,200,61,113,189,59,4,130,158,122,43,225,172,223,245,11,177,59,235,
+86,88,10,49,21,186,54,164,48,25,226,140,173,91,121,251,61,63,212,89,58,23,180,54,175,139,246,59,25,154,192,120,
+65,246,76,243,208,79,117,17,235,55,114,54,15,132,118,108,96,60,71,155,96,130,215,128,160,29,161,69,76,35,135,183,
+139,56,232,197,184,124,209,63,70,190,55,68,121,219,255,24,226,236,132,54,64,122,54,103,39,91,131,0,121,118,67,183,
+251,123,188,253,31,191,174,148,192,5,164,246,71,244,4,210,247,67,171,252,167,161,85,209,215,209,195,168,151,108,61,50,
+155,183,173,103,45,223,169,89,3,58,92,79,16,208,157,138,251,32,221,117,246,31,180,23,210,93,56,211,161,58,216,123,
+100,66,187,176,202,218,225,85,135,50,22,206,67,50,152,85,95,53,87,78,103,234,231,122,193,180,3,95,119,228,116,211,
+180,155,214,150,141,192,79,8,54,69,182,160,149,133,82,159,182,11,210,196,220,214,149,165,234,132,10,19,72,250,55,221,
+37,186,55,202,250,100,137,51,8,219,43,253,91,97,70,118,208,88,2,159,11,40,217,43,196,57,47,32,158,163,140,75,
+64,215,253,186,158,82,63,162,177,104,12,155,1,39,7,163,50,126,151,112,71,252,78,89,32,147,186,246,61,174,64,124,
+71,205,71,96,105,130,47,148,47,202,64,232,75,7,94,213,231,197,1,100,101,217,146,178,115,123,73,126,237,54,144,0,
+119,132,181,126,67,139,163,230,208,206,13,116,19,26,237,36,34,106,110,160,239,44,235,0,120,36,48,95,224,195,185,71,
+10,48,204,103,47,240,254,69,195,124,230,183,59,19,152,131,32,19,119,14,54,98,8,61,230,98,218,17,67,52,243,195,
+149,41,150,248,101,53,13,222,46,65,63,162,131,202,51,137,191,110,214,4,134,8,119,227,16,239,249,173,106,8,104,145,
+84,147,217,122,116,154,38,12,239,79,244,190,78,84,61,104,107,150,148,231,103,241,91,245,201,186,164,162,244,183,91,38,
+198,116,14,223,21,125,25,205,90,83,26,239,146,47,253,88,239,207,107,154,191,186,101,235,219,100,40,207,2,238,155,132,
+63,180,110,133,24,38,63,27,241,190,250,230,110,153,198,175,199,117,43,241,30,75,87,99,173,178,206,65,49,80,44,136,
+147,195,233,3,245,168,155,253,208,51,169,211,30,61,223,167,217,111,250,113,15,10,56,79,198,66,62,72,184,45,50,134,
+117,48,19,168,43,1,141,207,102,10,200,220,125,196,25,19,16,207,81,198,39,160,197,141,205,208,17,104,43,52,57,42,
+106,242,241,13,206,65,154,143,209,163,208,158,147,195,144,243,143,22,185,19,83,59,89,39,253,39,240,248,95,226,233,58,
+207,86,13,1,205,77,229,25,179,183,231,234,166,246,127,186,241,186,173,237,41,121,205,13,127,67,47,74,178,107,74,242,
+107,183,113,8,28,131,27,61,250,122,129,56,238,70,244,114,57,159,238,67,127,169,185,218,190,179,208,14,163,29,212,198,
+252,19,226,231,113,226,245,37,244,118,120,5,94,191,95,32,110,123,212,183,219,255,233,147,215,43,80,206,137,51,148,85,
+108,174,68,26,180,105,81,166,227,34,206,160,19,217,103,136,19,98,239,17,169,99,90,33,142,29,167,51,1,13,158,209,
+91,232,122,116,46,186,23,245,234,34,142,118,123,45,210,185,212,65,33,174,132,203,179,40,221,133,17,228,196,145,186,71,
+128,254,106,81,116,20,57,184,21,233,46,151,186,46,226,168,79,252,51,109,109,43,183,55,72,116,54,77,78,47,215,57,
+216,56,33,174,227,191,209,227,188,83,223,127,190,219,229,172,93,74,59,188,171,203,121,232,149,228,191,79,70,67,239,76,
+174,170,140,186,91,72,207,214,62,15,45,84,85,162,78,39,152,192,28,196,220,54,99,236,119,8,183,39,138,117,205,148,
+49,89,7,51,129,232,4,62,31,232,241,210,192,120,142,214,70,160,125,236,201,235,239,240,209,143,81,172,133,14,205,163,
+105,161,238,66,164,254,173,168,125,3,7,69,54,187,104,254,227,79,105,38,84,118,91,233,4,150,12,76,65,155,220,46,
+14,140,91,70,52,141,247,212,118,116,215,108,25,166,115,250,191,202,112,108,159,113,8,208,95,164,79,182,121,61,142,199,
+97,189,104,211,251,22,164,119,207,176,33,26,254,193,36,17,202,183,102,160,143,179,3,227,57,218,7,4,102,139,0,66,
+63,24,253,96,4,63,77,114,161,237,44,218,113,115,41,210,196,97,232,201,113,58,226,47,138,66,236,85,34,221,18,18,
+209,113,76,96,16,129,21,249,95,139,57,101,216,25,101,56,181,207,106,8,176,128,163,11,209,93,144,38,253,235,108,26,
+180,31,141,182,175,115,38,107,150,183,237,200,143,118,121,230,177,90,127,159,219,54,73,104,131,196,199,243,20,44,114,216,
+215,240,167,71,14,218,178,17,232,165,199,32,170,109,141,66,59,162,127,100,43,158,67,117,129,192,175,73,51,235,184,230,
+26,198,241,39,150,153,199,182,190,73,215,212,218,9,255,17,180,20,154,7,105,195,226,211,104,44,210,108,232,104,242,51,
+134,163,205,4,242,18,208,134,194,188,166,73,222,211,243,70,114,248,76,4,254,66,40,109,186,252,3,90,56,83,140,206,
+129,212,111,92,134,52,222,61,191,115,240,15,67,180,245,67,122,179,232,121,247,102,250,169,255,124,232,221,175,42,32,16,
+186,137,228,9,242,54,186,130,252,101,77,226,84,2,150,121,93,249,40,109,243,234,172,153,113,184,174,17,56,132,148,167,
+70,187,161,41,75,200,133,250,201,13,209,139,37,248,238,25,151,26,116,6,89,114,194,208,106,255,124,65,14,38,152,224,
+166,192,120,142,246,1,129,185,34,128,120,155,206,240,241,8,126,122,205,133,78,50,218,217,52,127,146,113,237,60,17,7,
+237,198,212,42,255,85,232,21,84,196,214,34,114,222,137,180,52,189,178,87,176,211,116,124,108,62,129,109,74,42,162,38,
+38,142,47,201,183,221,150,72,128,115,183,46,22,254,136,86,67,147,150,152,84,12,215,239,225,228,112,228,69,156,124,52,
+53,184,205,99,207,19,88,147,17,181,180,65,19,20,95,38,147,161,231,214,24,229,251,59,227,166,91,99,56,234,3,31,
+59,80,70,237,206,236,37,211,216,250,79,104,122,116,84,47,101,188,201,121,109,235,3,116,254,90,39,99,89,95,38,220,
+238,25,195,230,10,70,126,180,232,183,58,90,2,125,10,105,241,70,109,93,237,230,93,52,220,245,245,155,196,213,24,95,
+27,233,110,67,186,246,184,19,233,81,49,183,160,215,233,95,56,216,76,96,130,246,31,153,95,10,30,179,7,48,81,251,
+210,53,173,173,28,2,23,226,118,125,116,8,210,117,191,238,172,41,106,154,4,63,142,126,226,151,28,53,254,109,89,142,
+126,225,155,68,152,247,131,88,65,127,181,161,245,136,160,152,142,84,132,192,98,129,145,199,6,198,43,35,218,94,56,93,
+163,12,199,109,62,175,215,120,32,199,247,161,45,170,95,86,76,224,87,164,55,21,210,53,188,198,72,177,236,24,28,237,
+137,94,140,229,176,87,253,12,55,208,204,90,158,13,9,24,114,210,210,32,247,178,172,137,56,220,144,4,66,6,116,131,
+29,245,235,163,6,46,7,196,150,232,11,72,109,241,90,164,221,39,154,204,138,101,203,20,112,244,72,129,184,142,106,2,
+237,4,150,110,255,39,226,235,115,241,165,193,190,173,135,8,48,248,213,36,248,158,40,244,130,161,234,210,78,72,130,159,
+68,43,35,245,219,182,97,8,232,194,38,177,173,56,106,39,120,30,187,132,192,90,52,235,133,139,163,175,229,41,88,228,
+176,175,226,79,187,112,109,217,8,232,162,190,136,105,140,170,118,89,245,130,243,172,164,121,0,223,41,213,247,41,168,101,
+158,56,72,73,84,123,108,235,219,148,240,222,40,235,221,56,218,152,245,95,69,42,98,164,175,235,220,207,161,245,208,103,
+144,198,85,154,156,24,238,250,119,164,107,107,61,198,79,146,13,190,142,123,144,247,110,33,61,221,13,166,5,99,181,127,
+155,9,136,192,198,104,184,246,54,18,161,235,71,250,208,159,133,19,104,59,31,220,135,151,47,242,189,213,216,96,75,52,
+101,184,215,129,152,58,7,29,132,180,105,229,247,3,239,102,123,161,73,211,144,182,146,122,87,155,57,38,253,199,199,114,
+9,36,231,55,109,140,159,44,48,165,235,2,227,197,142,246,75,28,238,138,116,221,86,150,233,66,231,228,178,156,219,111,
+60,2,109,253,227,110,180,241,209,120,222,7,169,95,43,98,154,31,61,20,223,191,43,226,164,239,227,170,211,73,116,4,
+199,16,123,138,72,237,59,77,250,158,105,30,0,9,187,195,66,192,15,138,115,79,158,116,29,182,51,129,180,93,115,188,
+125,16,235,60,255,94,32,63,54,19,200,75,64,237,166,77,171,241,250,125,20,219,222,195,225,186,40,111,246,28,190,98,
+2,170,163,54,125,151,215,79,163,94,180,103,201,244,1,21,227,235,169,228,224,147,214,245,233,1,21,188,77,26,191,142,
+133,78,243,198,113,115,84,70,159,134,219,76,118,102,29,249,212,37,79,16,76,219,160,142,90,8,41,98,255,38,242,28,
+72,190,150,64,63,65,119,160,183,80,85,246,4,9,173,140,90,229,170,11,231,126,203,71,202,159,227,34,232,25,148,197,
+20,110,46,148,27,151,226,160,133,208,174,232,92,52,22,85,109,99,72,80,215,216,171,228,46,128,35,52,130,0,117,223,
+234,119,146,227,189,28,67,108,83,34,185,255,170,160,69,36,156,191,198,81,223,221,88,166,243,221,209,168,99,9,20,6,
+253,16,233,26,45,212,222,37,98,107,60,216,49,65,7,136,66,0,222,170,183,77,66,43,140,120,155,203,71,213,166,52,
+219,164,126,230,85,84,182,233,92,236,254,172,234,202,142,144,30,245,182,25,186,52,176,129,104,14,224,56,52,59,138,144,
+155,62,119,33,136,137,238,225,24,98,26,144,248,139,24,216,142,18,118,106,208,69,237,134,192,44,56,218,48,4,168,144,
+244,187,241,114,129,202,57,70,126,108,38,144,151,64,91,251,83,59,252,75,129,54,56,82,212,199,210,116,242,230,207,225,
+171,37,144,214,19,199,237,209,75,168,151,77,23,167,151,163,21,144,199,15,109,77,41,229,193,113,122,244,2,202,99,26,
+32,79,142,106,203,52,205,27,199,51,80,183,76,92,245,120,27,219,48,4,224,147,142,127,116,44,50,6,186,117,144,175,
+118,191,159,229,179,19,145,218,109,21,118,35,137,44,134,134,41,181,223,46,155,128,216,39,210,194,70,86,59,46,107,190,
+112,152,250,215,241,59,232,60,244,6,170,131,105,98,85,215,204,63,71,31,67,89,139,229,112,61,78,64,117,157,104,126,
+142,111,162,188,166,49,223,36,168,199,73,244,70,246,197,57,209,220,28,175,66,177,76,125,192,113,104,96,156,198,235,86,
+90,34,147,190,230,56,33,210,185,179,136,105,19,234,128,239,222,32,223,219,185,76,120,239,18,88,105,218,216,164,254,161,
+114,8,73,190,213,86,118,69,175,160,42,236,28,18,113,251,172,188,182,139,39,152,212,219,60,28,127,129,174,65,89,236,
+62,2,29,140,22,47,158,131,102,122,24,233,246,239,44,37,158,37,75,160,33,194,232,153,173,182,98,4,230,45,22,189,
+21,187,232,239,192,68,200,66,35,93,172,70,169,138,60,11,242,142,70,82,113,161,170,38,176,106,73,9,254,167,36,191,
+118,91,14,129,239,227,118,111,52,109,57,238,43,243,170,71,69,172,132,78,69,123,162,163,145,109,92,2,219,242,239,244,
+227,190,213,241,191,235,185,77,253,173,142,161,186,31,64,143,33,210,185,181,91,118,38,156,110,234,86,226,61,150,174,30,
+123,48,77,96,158,245,40,53,61,182,121,192,244,136,6,46,228,210,255,175,225,133,52,29,250,14,250,17,154,27,149,245,
+56,15,45,222,109,143,190,139,108,221,35,160,246,164,71,155,101,177,231,9,180,127,150,128,73,152,249,57,170,126,245,216,
+198,57,81,89,109,9,215,185,109,98,98,44,140,126,133,54,69,191,70,127,67,182,254,33,176,17,69,157,60,160,184,15,
+18,71,143,0,212,157,108,139,114,156,22,189,141,52,150,210,252,143,230,0,244,100,142,49,104,34,250,89,207,205,0,34,
+130,137,231,26,232,48,180,57,10,169,59,162,13,152,250,128,173,209,2,104,109,244,26,106,89,219,121,81,255,239,132,22,
+111,125,16,246,71,143,114,220,39,44,170,99,21,36,240,137,192,248,239,16,239,233,192,184,49,162,169,189,236,130,138,182,
+241,44,121,209,32,240,228,44,1,29,166,126,4,52,142,199,30,69,251,208,111,29,192,81,143,171,85,187,215,99,5,245,
+200,53,61,146,82,125,157,2,234,92,116,59,186,12,141,78,226,242,210,22,133,128,78,28,104,113,244,54,10,177,191,19,
+169,253,194,44,74,190,250,197,73,194,174,232,174,11,213,219,31,251,133,89,85,229,76,234,102,103,193,45,96,223,36,110,
+85,89,118,58,13,34,160,118,147,104,25,142,161,253,51,81,135,53,237,12,251,60,114,255,221,3,237,134,122,90,29,61,
+138,154,102,175,83,160,35,122,160,10,42,201,34,44,210,239,253,191,2,42,90,19,225,181,182,164,124,123,6,148,45,86,
+20,61,98,171,200,230,140,90,243,141,149,185,164,158,212,22,139,60,98,227,252,212,79,167,124,165,225,56,170,109,196,124,
+156,13,238,198,49,245,55,171,116,202,143,63,47,135,0,236,213,166,126,60,78,141,140,252,207,63,20,167,147,17,102,41,
+164,235,209,172,143,107,35,104,215,77,119,102,104,87,242,199,58,149,207,159,247,54,1,234,88,237,94,186,30,133,152,238,
+98,214,152,125,164,199,145,42,76,170,209,188,190,14,157,134,126,128,244,253,72,243,208,219,48,187,144,251,132,221,14,28,
+99,222,61,170,182,176,116,123,189,36,175,39,226,248,32,42,98,87,18,217,245,93,113,91,73,152,159,29,88,113,58,119,
+181,234,172,236,108,167,233,36,199,105,56,158,137,212,191,84,101,3,101,37,193,178,139,107,255,38,208,19,4,180,43,35,
+212,180,187,99,210,192,200,47,42,158,87,216,242,211,107,235,188,166,206,31,123,188,24,119,143,247,142,223,136,65,64,59,
+102,138,216,147,69,34,59,174,9,64,224,171,40,180,127,30,9,224,157,124,120,209,72,1,252,89,173,8,28,72,110,180,
+91,189,105,166,157,59,223,230,124,120,20,154,69,231,197,182,115,99,211,202,154,181,60,186,19,103,197,172,129,147,112,218,
+217,121,102,206,56,221,10,190,110,183,18,38,93,253,184,230,192,46,216,46,230,163,23,146,62,137,76,134,46,122,189,75,
+220,131,3,10,185,39,113,180,179,239,79,168,140,221,169,234,111,116,71,132,173,123,4,126,152,49,233,215,9,247,75,133,
+77,207,11,67,28,117,135,194,137,4,185,20,109,138,102,70,189,98,218,249,172,59,147,70,81,134,45,84,54,91,51,9,
+36,115,36,51,80,186,69,2,75,168,57,158,116,135,243,112,46,20,38,149,22,7,151,65,95,70,234,75,255,139,238,69,
+127,70,171,32,91,126,2,135,16,101,99,116,87,254,168,67,198,248,12,239,158,130,150,29,244,233,14,252,63,255,160,247,
+242,252,171,187,178,127,157,39,130,195,70,37,160,59,140,67,76,223,239,170,77,125,193,149,104,3,84,101,250,234,143,108,
+38,96,2,109,4,116,242,14,181,208,11,53,165,247,112,104,162,142,55,64,64,183,162,21,181,7,138,58,112,252,33,9,
+204,49,228,187,217,223,212,99,33,108,38,80,132,192,186,69,34,143,16,183,87,38,125,71,40,66,115,63,26,52,97,181,
+63,37,109,250,111,122,108,75,25,79,111,110,141,230,42,217,151,8,157,247,98,240,81,226,60,150,43,149,238,4,94,142,
+100,139,60,50,164,72,174,239,36,242,239,139,56,232,163,184,179,81,86,77,90,133,218,141,68,188,48,107,100,77,116,182,
+73,143,9,210,221,101,154,100,208,36,125,236,71,7,235,46,215,245,211,62,22,255,182,234,8,108,72,82,243,101,76,78,
+19,166,250,206,14,101,75,243,166,38,65,111,64,91,160,208,199,255,17,181,235,166,73,219,163,208,169,180,201,185,210,118,
+169,163,173,25,4,168,75,45,226,236,135,186,213,78,53,207,163,199,250,125,15,233,110,223,211,209,167,213,198,36,91,102,
+2,154,128,94,18,157,140,244,248,178,162,182,32,14,254,129,214,111,115,180,99,219,235,144,151,231,19,105,224,250,46,89,
+68,12,241,227,56,97,4,102,13,139,22,165,61,229,73,250,167,4,86,59,249,84,158,72,17,194,106,147,207,9,169,31,
+183,207,148,132,143,253,78,160,200,66,78,104,167,35,230,122,166,163,45,156,128,234,45,198,110,123,47,228,132,215,193,112,
+49,53,240,46,178,3,254,13,226,235,185,144,54,19,8,37,176,2,17,117,145,31,219,180,192,120,88,108,167,246,87,10,
+129,207,226,117,43,84,228,28,95,74,198,74,112,186,18,62,175,70,186,184,237,103,211,243,134,243,154,118,213,245,130,125,
+139,76,78,214,133,140,106,151,234,190,92,52,234,188,108,235,76,64,19,203,147,119,14,54,100,8,77,112,13,236,8,46,
+112,161,174,223,124,216,18,233,251,160,246,45,191,49,76,229,218,44,134,35,251,200,77,96,59,98,76,146,49,214,95,134,
+9,183,23,239,159,141,190,130,166,30,38,76,175,189,61,5,25,86,155,60,30,105,1,211,214,195,4,146,5,146,207,114,
+220,29,221,68,81,30,70,90,68,169,131,105,81,103,35,116,5,250,27,154,11,217,70,32,160,115,88,155,222,38,232,215,
+208,239,208,203,35,68,203,250,145,230,25,212,215,109,138,116,247,84,145,250,120,149,248,191,69,182,238,17,208,239,130,132,
+88,105,243,169,73,127,148,222,217,170,121,5,245,73,251,163,233,67,50,90,48,206,24,190,75,250,157,74,63,205,169,32,
+72,71,111,22,129,34,147,60,69,46,170,95,111,22,198,202,75,179,40,41,22,189,157,81,147,178,99,42,207,121,243,19,
+212,96,106,154,130,197,244,247,163,32,192,62,143,174,139,133,24,11,189,131,49,158,197,32,106,108,58,144,210,209,86,91,
+2,218,109,60,71,109,115,23,63,99,90,184,250,45,23,30,179,182,95,124,196,79,166,214,30,87,13,200,221,85,1,113,
+186,17,101,141,110,36,74,154,39,210,207,157,220,165,180,107,159,108,251,119,141,215,51,145,225,181,10,100,250,58,88,255,
+51,61,191,132,248,73,227,38,199,91,240,177,18,210,227,37,95,10,241,55,68,156,117,120,175,159,250,213,33,16,84,247,
+86,210,190,22,33,197,101,51,166,170,9,201,211,7,133,93,149,255,213,207,253,28,53,181,238,86,163,108,127,64,75,32,
+91,143,16,72,218,247,164,28,191,138,78,37,219,143,161,203,209,62,104,73,148,247,14,91,162,148,110,90,208,209,53,134,
+30,237,183,86,82,134,210,19,109,80,2,187,80,150,173,208,227,17,202,52,59,62,180,152,179,117,65,95,163,136,175,5,
+58,91,247,8,76,30,152,180,190,143,101,154,206,41,255,66,106,35,234,147,186,117,225,175,197,99,155,9,152,192,32,2,
+69,22,114,138,12,48,138,164,59,168,8,125,249,239,98,148,122,226,130,37,127,146,139,221,183,11,250,112,244,241,9,20,
+189,144,242,206,223,241,153,250,157,124,4,214,207,23,60,83,104,237,250,57,50,83,72,7,234,54,1,237,210,93,189,219,
+153,232,66,250,95,34,205,191,118,33,221,58,36,57,45,153,152,39,32,35,183,6,196,169,44,74,50,73,164,254,108,222,
+202,18,253,48,161,177,188,220,255,195,127,253,170,3,129,83,248,60,235,93,19,131,93,189,207,27,199,14,126,51,210,255,
+187,225,71,109,72,119,234,20,53,45,86,249,206,135,162,20,243,197,223,138,224,89,239,160,25,77,88,109,82,75,237,48,
+94,156,129,150,71,69,175,153,82,159,117,61,126,138,140,157,132,102,173,107,6,251,61,95,233,162,71,114,84,155,60,1,
+61,136,78,70,155,161,57,81,104,31,74,212,74,109,33,82,59,6,45,93,105,170,205,72,236,44,138,177,42,186,35,66,
+113,102,192,71,145,201,252,23,136,255,203,246,124,104,35,132,173,114,2,186,198,14,177,104,155,54,7,245,79,235,146,153,
+243,208,53,232,139,40,116,161,137,168,133,77,119,176,29,95,216,139,29,152,64,3,9,20,89,80,41,18,119,182,6,178,
+172,178,72,90,21,47,106,154,164,176,197,39,48,95,65,151,26,84,217,76,32,148,128,118,12,23,121,180,223,112,233,222,
+205,7,87,15,247,161,223,175,21,1,45,244,235,135,191,235,102,154,172,13,189,88,201,90,150,207,19,80,143,153,232,55,
+219,132,2,231,189,160,123,139,56,207,244,0,168,111,146,199,110,204,44,28,201,132,134,38,217,108,157,9,104,82,111,181,
+206,193,134,13,113,59,159,28,49,236,167,197,63,184,28,23,203,162,59,139,187,106,77,106,68,112,99,23,25,9,108,154,
+49,156,130,105,226,73,166,243,128,238,194,249,62,234,198,99,96,72,182,43,166,243,254,201,76,200,205,172,73,57,91,237,
+8,104,238,67,147,230,55,162,203,208,215,81,25,227,117,220,86,98,115,144,138,22,240,103,119,123,235,204,59,185,83,52,
+125,220,218,3,196,208,245,154,250,172,110,126,89,245,91,59,186,123,213,214,93,2,161,143,219,211,194,239,236,17,179,190,
+11,190,110,70,103,34,181,79,109,12,236,182,41,63,247,119,59,19,78,223,4,234,72,160,200,98,204,187,5,10,84,135,
+142,161,64,246,187,30,117,222,8,57,184,52,130,15,187,24,159,128,30,241,83,196,90,119,228,120,71,76,17,132,125,29,
+247,103,148,190,140,73,207,191,244,53,213,222,42,252,188,53,204,238,24,242,244,109,180,32,58,16,141,69,101,152,118,93,
+111,131,148,86,63,217,114,1,133,125,158,243,140,158,59,29,16,181,178,40,186,72,93,177,178,212,62,76,232,92,94,238,
+241,225,191,126,213,129,192,25,124,174,239,94,136,105,129,247,247,33,17,59,197,25,52,113,246,10,225,151,65,69,23,47,
+23,237,148,174,63,143,70,96,97,60,205,147,195,219,191,9,187,61,250,43,90,62,71,188,38,5,93,157,194,28,219,164,
+2,245,106,89,218,118,184,127,129,215,90,240,208,29,24,123,162,165,208,164,168,9,54,63,133,24,133,214,167,140,31,245,
+130,78,174,42,125,140,208,186,243,65,139,41,239,229,138,25,39,176,210,255,97,28,87,246,82,144,128,198,39,33,166,49,
+242,183,66,34,42,14,223,215,89,208,247,144,198,112,186,155,245,32,244,105,36,191,117,48,141,15,255,92,135,140,56,15,
+38,80,71,2,69,22,114,222,42,80,160,69,10,196,117,212,9,38,152,47,2,4,239,192,136,0,113,8,23,11,12,241,
+94,158,183,158,206,19,216,97,251,155,128,46,154,218,164,93,168,218,117,28,219,238,195,161,46,52,108,189,65,160,78,231,
+87,93,156,94,128,62,137,142,65,143,162,93,145,118,114,238,143,218,31,131,195,191,81,108,74,188,252,4,205,21,197,91,
+111,56,9,217,64,208,218,52,80,243,226,109,65,254,102,169,56,143,58,7,239,207,34,64,55,119,201,86,92,228,66,201,
+105,161,173,200,226,198,93,196,175,100,226,153,58,85,155,255,117,161,210,78,48,129,198,120,51,23,244,225,232,217,8,108,
+76,176,201,179,5,157,224,69,194,173,141,116,94,153,61,99,156,166,6,211,78,234,163,154,90,184,186,150,171,109,44,174,
+113,249,20,228,83,139,138,183,162,127,161,175,160,153,80,211,236,89,10,244,59,116,5,253,107,235,55,52,155,86,192,10,
+202,179,25,105,236,134,94,171,32,173,246,36,14,225,159,119,210,55,210,141,15,233,255,62,86,74,224,137,2,169,237,66,
+220,204,79,234,161,111,90,25,253,1,233,174,213,135,144,22,74,54,68,51,160,186,153,242,119,106,221,50,229,252,152,64,
+93,8,20,89,113,45,50,225,60,163,0,208,137,180,110,49,173,11,140,30,202,199,130,5,243,170,69,184,11,11,250,112,
+244,161,9,76,59,244,219,153,223,13,189,189,54,115,2,14,216,88,2,154,32,207,58,233,145,7,194,105,4,46,210,223,
+231,73,203,97,139,19,152,181,184,139,40,30,198,224,229,87,232,136,33,188,105,151,149,46,92,15,69,154,112,90,11,21,
+25,143,16,125,28,211,78,238,3,145,22,2,250,193,166,14,40,100,47,60,54,108,171,128,114,21,137,162,73,141,67,153,
+208,208,5,174,45,27,129,61,8,86,228,110,156,125,179,37,19,39,20,117,251,107,174,61,126,137,183,143,4,122,212,100,
+135,164,9,76,91,185,4,54,207,225,94,27,19,119,70,69,54,40,230,72,174,99,80,45,4,119,235,118,71,125,31,183,
+160,157,223,202,241,15,154,160,181,85,70,96,49,82,210,2,206,151,208,108,149,165,218,157,132,94,32,89,45,80,93,218,
+157,228,123,59,213,65,223,203,131,248,190,190,73,137,116,62,173,98,193,239,94,210,209,2,156,173,30,4,116,183,94,168,
+77,67,196,235,104,63,242,113,13,186,31,105,99,131,230,3,180,169,65,115,134,106,83,218,112,51,93,34,14,149,219,235,
+164,168,235,188,201,114,164,236,69,156,28,176,28,180,255,8,20,153,56,121,187,0,174,186,76,52,21,40,66,215,162,206,
+73,202,161,23,160,105,166,245,72,21,45,230,216,34,17,224,4,42,79,243,163,162,109,91,39,58,155,9,228,37,160,139,
+169,85,242,70,202,16,94,119,80,236,158,33,156,131,212,135,128,6,238,221,52,157,91,206,70,95,229,60,163,5,155,97,
+141,126,243,41,62,92,15,105,194,126,111,244,49,20,203,214,197,255,10,56,27,152,148,31,116,225,28,43,157,174,250,161,
+140,83,146,129,144,11,255,87,187,154,241,17,18,79,206,167,26,231,44,59,66,176,50,62,58,22,167,149,46,44,148,81,
+136,138,125,46,93,32,189,203,137,123,74,129,248,161,81,199,18,81,227,181,16,211,98,223,115,33,17,29,39,27,129,228,
+251,175,223,14,201,115,62,40,186,137,42,91,230,198,13,165,243,219,51,72,237,225,78,244,18,122,18,105,19,195,227,72,
+239,255,15,233,186,96,30,244,241,228,181,218,158,254,215,130,224,164,168,12,155,2,167,63,66,255,69,90,208,177,69,38,
+144,180,211,212,235,114,188,248,5,90,25,117,163,45,166,249,168,234,168,69,156,189,208,165,74,176,137,99,43,149,171,98,
+211,198,38,77,194,31,134,230,69,101,217,123,56,62,136,58,83,223,100,171,7,129,107,200,134,230,85,243,44,114,180,231,
+92,243,185,159,78,212,254,126,93,94,107,204,117,59,90,51,71,134,20,71,119,11,217,76,192,4,134,33,80,100,33,71,
+171,189,161,246,209,208,136,142,55,129,38,166,166,44,200,97,96,98,171,160,31,71,31,151,192,244,252,27,186,51,53,245,
+164,19,151,205,4,242,18,208,173,213,69,219,222,80,105,234,130,194,214,91,4,30,235,82,118,53,169,165,29,97,123,34,
+61,111,57,143,29,79,224,127,163,99,208,218,104,34,84,212,180,243,236,91,168,233,231,187,89,40,163,206,61,121,173,238,
+231,154,31,80,160,144,59,141,242,114,72,195,107,34,214,139,214,41,141,108,71,77,182,107,50,58,196,180,32,178,127,72,
+196,8,113,52,193,174,201,244,16,83,223,164,239,220,243,33,145,29,39,51,1,157,7,212,135,215,201,222,37,51,90,164,
+209,194,200,117,232,2,38,67,111,230,24,100,44,4,204,71,196,175,35,149,85,147,112,83,161,152,182,48,206,52,54,84,
+26,182,114,8,124,17,183,63,68,107,32,237,128,239,7,123,144,66,238,71,219,215,120,205,22,151,192,249,184,251,60,250,
+39,90,60,174,235,1,111,231,186,238,6,88,116,253,5,117,161,60,92,194,249,224,17,142,11,117,61,67,241,51,160,5,
+156,31,163,191,229,116,125,9,225,31,207,25,199,193,77,160,175,8,20,153,44,41,242,8,40,173,56,207,219,87,164,227,
+21,86,131,197,162,118,79,81,7,142,63,36,1,237,176,43,186,195,165,95,46,4,134,4,232,55,131,8,232,34,125,201,
+160,152,35,71,26,205,199,190,80,27,153,81,29,63,189,169,11,153,210,228,214,207,185,32,89,2,157,161,11,147,228,226,
+100,196,172,164,225,146,163,22,22,214,69,135,163,88,119,140,110,140,175,165,80,147,77,227,41,77,48,230,53,213,89,157,
+109,147,10,51,167,93,245,223,67,58,218,178,19,208,68,123,232,117,196,217,124,239,255,221,222,7,100,79,182,112,200,105,
+10,120,152,152,184,186,51,222,86,46,129,13,203,117,159,217,187,22,236,206,67,218,20,48,11,237,117,126,180,17,210,239,
+104,5,47,226,40,117,226,63,140,246,225,229,138,72,147,182,7,34,221,209,83,244,58,2,23,3,182,30,19,132,11,162,
+129,223,83,28,248,196,47,114,17,104,103,200,235,47,19,249,74,116,38,210,98,78,63,92,187,61,69,57,143,69,106,175,
+190,54,0,66,73,246,0,126,53,118,189,166,4,255,47,225,243,151,37,248,181,203,226,4,70,21,119,81,43,15,186,243,
+235,44,206,113,58,183,109,132,242,60,45,226,53,194,239,139,90,134,143,244,165,143,38,96,2,109,4,66,47,192,228,66,
+59,111,245,60,207,16,211,128,71,119,150,216,242,19,248,84,254,40,227,197,184,112,188,119,252,70,12,2,115,225,164,232,
+217,70,147,4,54,19,200,67,96,119,2,23,233,203,135,75,235,84,6,79,207,104,0,149,106,184,128,126,191,86,4,254,
+69,110,202,184,0,28,170,144,154,228,58,14,173,132,14,64,49,76,187,91,119,70,69,54,139,164,249,208,68,243,102,233,
+63,13,61,46,65,185,38,9,40,91,232,248,45,32,169,220,81,22,32,70,25,139,211,67,101,68,143,179,216,19,93,49,
+212,135,126,111,68,2,154,116,126,101,196,16,67,127,168,187,113,98,245,23,67,167,48,242,187,147,142,252,113,199,79,95,
+239,24,194,1,138,18,88,176,168,131,2,241,95,36,174,174,147,182,66,51,51,254,89,23,29,141,244,126,116,75,198,87,
+15,114,220,21,205,65,2,127,66,177,30,125,169,115,160,206,167,182,56,4,190,128,155,107,209,73,104,5,84,180,47,193,
+69,173,77,227,132,187,208,47,144,22,112,190,137,234,126,55,47,89,236,61,75,250,129,244,122,75,119,61,45,143,46,138,
+92,146,147,72,231,214,200,62,237,46,14,129,227,112,211,148,177,133,198,134,187,208,214,54,100,209,91,231,180,77,81,30,
+187,156,184,119,164,223,137,60,17,29,214,4,250,137,64,208,228,159,190,88,216,24,244,118,1,88,26,12,217,242,19,208,
+4,71,17,211,110,12,159,196,139,16,28,62,238,98,195,127,148,249,19,77,112,216,76,32,43,129,223,17,112,225,172,129,
+115,132,187,159,176,123,230,8,239,160,245,33,160,201,38,77,50,148,57,81,175,52,254,128,86,65,219,160,71,81,76,211,
+68,214,30,40,70,25,180,91,182,201,54,103,96,225,98,44,148,5,38,221,49,218,246,132,152,172,99,168,226,1,222,199,
+197,137,140,105,15,75,47,24,147,241,109,113,207,253,225,65,143,40,11,89,52,214,68,232,13,93,68,164,201,237,80,123,
+141,136,247,134,70,118,188,76,4,180,136,51,119,166,144,241,2,233,196,220,147,244,0,0,32,0,73,68,65,84,92,163,
+118,169,137,234,89,209,90,244,5,39,160,152,119,199,224,54,147,109,71,168,13,208,237,153,66,119,14,244,21,130,44,212,
+57,152,67,180,19,24,116,7,206,106,124,246,31,116,46,90,22,53,117,1,71,119,67,63,139,84,214,157,208,34,72,215,
+182,191,226,187,240,144,206,143,169,120,207,86,62,129,47,145,196,233,72,99,149,162,166,243,150,239,198,41,74,177,188,248,
+26,75,157,85,158,251,74,60,107,94,248,2,180,28,253,196,193,73,138,123,114,156,45,121,157,229,240,46,129,126,159,37,
+160,195,152,64,191,19,152,164,32,0,157,236,167,13,244,177,104,96,188,190,139,166,193,100,98,186,184,153,37,253,39,240,
+168,21,110,45,230,216,226,19,152,39,130,203,233,35,248,176,139,134,18,104,235,11,84,194,37,209,214,168,232,93,96,242,
+53,216,254,200,27,49,38,209,7,251,245,255,213,16,208,34,139,206,23,154,16,143,105,218,101,165,29,130,187,163,49,186,
+160,143,105,131,252,253,158,246,174,9,181,159,162,34,119,42,206,71,252,197,209,109,200,246,33,129,34,143,151,250,208,75,
+57,175,214,40,199,237,120,94,117,193,185,237,120,239,250,141,60,4,78,38,240,170,40,235,196,166,238,52,208,238,238,174,
+24,125,202,204,36,60,67,129,196,181,217,230,133,2,241,29,181,51,1,245,217,83,118,14,22,37,196,243,120,57,3,105,
+210,233,78,121,28,116,30,210,91,149,90,146,254,40,218,170,206,91,58,223,174,89,48,3,106,239,58,143,126,171,160,159,
+126,140,190,28,133,254,9,90,15,77,209,48,0,239,81,158,199,144,30,41,250,0,186,28,93,137,110,69,93,255,30,40,
+15,182,214,117,216,38,112,208,29,58,243,23,228,241,18,125,139,234,218,86,95,2,71,145,181,213,80,158,133,143,58,148,
+70,19,149,119,32,253,118,214,41,105,134,56,135,205,203,235,13,210,255,51,30,47,35,156,198,230,54,19,48,129,14,4,
+38,233,240,121,167,143,239,33,64,232,137,69,241,38,68,3,171,20,157,18,243,231,19,104,87,213,68,5,57,180,46,84,
+10,250,112,244,161,9,196,88,132,169,98,23,242,208,185,247,187,189,70,96,127,50,60,99,9,153,190,27,159,127,44,193,
+175,93,86,75,96,71,146,211,238,241,111,162,143,22,72,90,59,172,116,17,249,87,164,1,250,35,168,42,251,57,9,45,
+137,214,41,144,224,212,196,93,25,53,117,33,39,116,145,171,170,137,210,142,85,199,197,94,123,152,165,249,167,138,141,62,
+154,176,250,118,123,194,126,29,68,224,88,98,173,128,178,76,18,171,162,15,65,151,162,110,153,250,147,34,227,232,87,187,
+149,241,62,74,87,147,231,101,219,211,36,112,52,250,61,19,79,99,203,78,172,128,255,47,16,87,147,90,58,22,49,197,
+215,53,202,139,69,156,52,57,238,160,243,208,12,148,245,55,104,35,164,215,189,102,26,183,105,209,249,13,244,20,122,25,
+169,205,107,28,116,63,210,221,94,47,208,246,31,229,104,171,55,129,213,200,94,145,49,124,90,186,165,104,227,187,81,231,
+251,165,111,248,88,59,2,163,200,209,159,145,54,203,101,221,28,211,237,66,140,38,3,186,179,253,23,105,70,218,250,82,
+189,167,13,121,89,237,93,2,30,150,53,176,195,153,64,191,19,40,186,144,51,186,0,64,221,89,178,32,210,128,194,54,
+12,129,182,206,80,33,244,188,212,162,54,176,82,94,212,145,227,143,71,32,198,66,206,56,51,90,227,165,224,55,76,224,
+3,2,155,113,88,181,4,24,239,225,243,80,20,227,54,254,18,178,103,151,35,17,96,32,221,254,241,251,186,104,227,141,
+43,208,54,72,19,57,211,162,44,166,9,128,199,208,153,232,28,116,9,234,214,14,77,181,117,229,101,58,229,33,208,62,
+17,24,175,23,162,77,22,152,201,185,2,227,149,29,77,143,21,10,93,156,202,154,183,7,8,184,57,223,151,39,178,70,
+112,184,17,9,236,193,167,147,163,45,71,8,245,38,159,105,130,98,224,98,127,132,176,101,126,244,105,156,143,211,81,230,
+76,236,174,156,225,29,60,63,129,185,243,71,201,28,227,37,66,254,29,233,249,253,122,93,91,75,206,231,156,198,255,167,
+205,24,90,204,249,100,129,204,138,169,206,165,71,20,240,209,47,81,213,143,253,28,45,210,67,5,214,166,157,179,145,230,
+84,174,70,119,209,126,188,72,3,136,30,55,141,133,180,160,248,145,8,229,152,4,31,63,163,63,121,146,182,161,13,24,
+182,122,18,216,155,108,45,137,54,172,103,246,6,114,245,36,175,78,68,135,163,135,244,46,109,75,135,212,22,226,69,222,
+50,104,161,249,244,212,129,143,38,96,2,37,17,208,151,21,109,142,138,152,110,87,182,141,64,0,184,173,142,49,57,62,
+91,4,54,113,31,67,89,39,242,70,200,149,63,26,76,32,169,159,39,11,214,143,162,95,40,95,54,19,24,138,128,218,
+6,154,22,221,141,202,176,243,113,58,208,231,12,149,7,191,215,59,4,218,235,146,215,83,160,61,209,229,232,69,148,218,
+27,188,120,14,61,130,254,142,118,68,243,162,174,23,84,121,72,116,42,199,34,166,199,212,116,189,60,101,100,128,114,125,
+43,16,140,22,232,106,97,170,155,54,221,23,88,158,172,209,30,37,224,10,74,207,86,140,128,24,182,105,98,94,255,20,
+93,135,218,237,93,254,209,247,239,59,197,82,139,19,155,124,92,214,158,185,128,215,71,17,39,78,102,236,101,72,2,240,
+45,99,124,243,14,126,53,190,158,111,200,68,107,252,166,218,27,90,8,189,134,138,216,9,68,174,113,73,187,155,53,216,
+124,28,157,131,222,66,189,102,7,116,151,158,83,143,77,128,6,168,239,253,97,37,52,68,141,129,86,141,157,95,251,43,
+70,32,169,239,116,76,53,39,255,159,93,66,221,23,117,169,13,130,119,162,29,58,149,150,48,58,223,228,49,157,163,191,
+130,90,12,58,249,247,231,38,96,2,19,76,160,213,249,34,166,157,105,186,13,46,212,207,82,69,18,239,179,184,122,116,
+197,140,5,203,124,45,187,48,94,46,232,195,209,135,39,16,227,46,134,169,134,119,239,79,76,160,69,224,16,254,150,241,
+232,33,61,50,70,59,191,108,13,33,144,236,232,77,75,163,29,241,123,74,12,148,23,228,56,63,210,172,206,3,132,123,
+152,99,157,77,59,249,181,155,56,212,138,220,205,19,154,102,85,241,222,11,76,72,119,69,215,205,214,36,67,218,197,87,
+150,233,209,50,63,164,189,95,85,86,2,253,228,119,80,255,242,30,253,202,129,148,255,15,104,85,164,122,212,157,125,119,
+163,75,80,93,108,225,130,25,185,165,96,124,71,239,76,32,246,134,179,209,36,169,59,44,78,234,156,116,109,67,232,78,
+139,127,34,221,45,18,106,159,11,141,216,244,120,244,93,251,82,198,109,209,71,123,180,172,163,122,52,223,206,246,240,4,
+86,229,163,175,14,255,113,240,39,115,19,243,32,180,108,176,7,71,140,78,96,208,120,234,113,250,36,61,81,225,13,84,
+228,218,39,86,62,223,194,209,245,232,120,116,164,156,146,63,29,134,51,181,173,141,134,251,112,152,247,245,184,199,83,135,
+249,204,111,155,128,9,148,65,128,47,178,86,246,67,237,241,50,242,212,36,159,128,77,87,231,245,195,207,69,173,140,1,
+65,147,112,7,151,133,138,81,61,141,45,90,65,196,191,65,190,108,38,48,20,1,218,198,26,232,37,84,134,253,99,168,
+52,253,158,9,116,139,0,141,60,61,255,233,88,100,151,236,3,242,213,68,163,92,218,193,22,98,122,110,126,45,140,204,
+167,245,124,99,72,65,50,198,209,29,205,91,41,45,91,127,18,160,238,151,69,186,67,168,136,125,150,200,253,9,176,228,
+82,139,43,90,24,189,141,98,152,206,25,199,162,201,81,218,199,148,92,138,248,238,219,242,190,8,175,95,70,161,246,10,
+17,227,103,176,135,61,194,67,237,237,223,72,59,205,187,109,90,12,15,177,23,136,52,69,15,87,131,179,62,4,1,234,
+244,138,144,198,144,49,142,218,251,225,104,160,95,212,107,91,125,8,36,117,51,41,199,131,145,190,227,221,48,45,40,157,
+136,86,236,68,134,48,237,109,73,119,191,230,49,221,141,179,33,106,249,232,148,150,63,55,1,19,248,128,192,68,17,64,
+60,86,192,199,204,124,105,117,187,184,191,184,157,33,110,208,57,200,136,33,198,240,233,41,35,134,240,135,69,9,76,83,
+212,1,241,103,138,224,195,46,26,66,32,237,27,147,163,158,235,191,63,138,189,91,85,180,30,69,126,212,165,72,216,106,
+67,96,208,14,181,34,191,155,18,227,249,226,181,225,50,40,35,175,12,250,63,235,191,122,68,227,172,234,91,106,98,167,
+145,15,61,23,188,12,211,111,97,236,132,180,155,208,214,191,4,214,167,232,69,250,17,93,239,104,87,170,173,60,2,122,
+242,192,164,17,220,107,161,90,99,154,109,56,143,188,165,115,73,170,8,190,187,229,226,94,18,190,172,64,226,83,19,119,
+141,2,241,27,21,149,115,159,30,15,164,187,51,191,128,138,252,110,86,17,46,186,75,244,58,164,59,198,46,14,116,116,
+27,241,116,199,181,173,135,9,36,215,121,233,100,248,239,40,138,158,196,82,150,169,189,127,29,125,177,172,4,236,55,10,
+129,119,240,178,35,90,11,93,136,202,30,176,43,61,157,59,79,71,91,163,249,145,218,201,149,40,171,233,119,46,87,207,
+26,56,9,119,29,231,231,51,27,112,142,206,89,108,7,55,129,98,4,38,42,22,189,21,251,188,2,62,38,35,174,6,
+80,182,145,9,136,209,92,35,7,233,248,233,191,58,134,112,128,162,4,222,46,234,128,248,147,200,71,141,38,215,34,20,
+201,46,34,17,56,12,63,203,68,242,213,238,70,143,4,252,45,3,168,209,237,111,250,181,9,116,155,64,91,63,56,51,
+121,41,242,232,74,93,152,52,213,66,39,113,166,4,136,30,101,214,53,75,38,46,86,38,3,55,161,47,163,50,38,211,
+94,198,239,30,200,139,56,64,232,115,43,58,137,173,133,156,247,250,156,97,217,197,159,130,4,138,244,245,202,159,250,196,
+207,51,166,249,131,38,134,26,102,122,124,97,145,201,188,79,52,140,71,238,226,112,222,153,31,93,70,196,223,162,170,55,
+207,105,227,197,13,72,227,121,157,127,103,167,141,46,135,246,227,245,60,40,196,212,222,109,205,33,160,49,209,55,80,217,
+157,151,54,56,29,132,6,172,109,204,61,240,158,95,116,135,128,206,93,109,210,98,175,22,115,182,65,23,32,141,107,99,
+152,206,37,186,62,186,22,253,12,173,138,102,71,155,144,246,241,104,96,19,4,239,101,49,109,52,213,66,78,158,13,51,
+122,108,219,1,89,156,59,140,9,152,192,184,4,90,147,198,227,190,149,251,191,171,137,161,65,119,232,162,208,198,196,253,
+83,238,84,251,43,194,119,41,110,158,78,113,48,29,253,142,209,9,131,223,244,255,209,9,20,185,184,74,51,19,99,39,
+98,234,203,199,230,16,88,131,162,124,173,164,226,92,194,96,237,208,146,124,219,173,9,196,32,160,246,95,164,111,124,38,
+70,38,234,232,131,239,238,99,92,124,235,28,31,98,91,16,233,164,144,136,145,226,28,140,31,93,152,150,245,27,70,175,
+226,251,167,48,58,60,82,126,237,166,7,9,36,147,83,106,99,139,21,204,254,168,130,241,29,189,51,1,109,90,11,189,
+158,148,247,243,145,174,43,27,115,135,2,253,87,251,230,174,155,41,155,174,185,67,175,9,235,248,219,104,20,167,28,107,
+155,152,214,248,97,9,244,35,244,37,52,3,170,194,116,93,56,6,233,78,62,109,168,60,23,181,198,35,105,189,38,121,
+212,102,149,208,223,231,249,39,113,109,205,33,160,197,218,170,218,167,22,118,247,71,154,196,183,213,152,128,250,11,236,175,
+137,116,78,216,156,215,90,220,89,17,205,129,116,78,152,28,13,101,175,243,166,174,19,212,247,140,70,79,32,221,101,115,
+55,126,255,203,49,150,169,45,45,148,211,217,57,132,151,108,38,96,2,57,9,196,88,200,209,173,192,234,32,116,203,118,
+136,245,253,238,160,14,208,180,186,189,90,135,48,157,62,126,128,0,87,117,10,228,207,11,17,80,61,105,135,115,81,155,
+30,7,218,145,216,152,139,208,162,64,28,191,69,224,215,252,85,27,139,109,143,227,112,203,216,78,237,207,4,34,19,248,
+106,65,127,143,22,140,95,247,232,79,147,193,144,49,216,210,196,211,197,95,165,119,25,112,1,186,10,105,170,79,43,227,
+14,67,220,182,236,69,254,238,132,142,253,224,95,255,237,55,2,109,147,184,42,250,183,81,145,115,168,38,207,47,146,35,
+91,169,4,66,39,179,85,63,231,33,237,36,142,113,119,124,169,133,204,235,60,153,196,83,180,215,104,215,47,112,212,196,
+127,136,205,24,18,169,23,227,180,125,255,167,33,255,122,140,218,182,104,30,212,154,17,229,88,150,233,250,237,110,116,41,
+58,25,93,143,58,217,146,4,208,245,95,94,123,150,8,190,190,207,75,173,190,225,247,36,107,203,86,152,61,125,23,126,
+136,180,0,30,115,66,191,194,34,244,103,82,156,19,212,183,72,45,163,191,251,24,47,150,66,179,33,221,101,163,199,164,
+105,124,255,18,186,141,240,207,115,44,211,52,158,207,187,225,244,53,226,104,225,210,102,2,38,16,64,32,198,66,142,146,
+189,31,105,16,18,98,179,18,73,183,145,94,30,18,185,15,226,104,247,80,209,157,25,90,193,183,149,75,64,223,165,24,
+223,167,1,63,186,8,105,187,120,43,55,247,246,94,103,2,26,168,133,246,175,35,149,75,187,115,246,160,141,61,57,82,
+32,127,102,2,53,32,176,106,193,60,52,125,162,227,38,248,204,31,192,72,147,166,186,240,58,33,32,110,230,40,109,19,
+106,243,18,105,79,180,9,10,89,120,34,90,38,211,133,235,110,244,109,94,196,201,132,171,47,2,109,88,176,148,99,104,
+79,151,22,244,225,232,157,9,232,177,46,121,77,139,56,135,162,29,243,70,236,209,240,154,144,11,93,200,153,180,71,203,
+28,154,237,249,136,120,48,90,27,77,30,234,36,67,188,151,9,163,199,19,233,142,155,35,209,27,57,175,223,214,34,78,
+136,141,37,82,227,22,46,67,64,52,32,142,54,214,104,206,71,147,239,161,166,235,186,188,115,17,90,232,84,255,169,244,
+223,75,199,107,57,219,47,81,109,221,36,64,125,61,66,250,82,183,236,87,36,156,119,49,90,119,41,222,208,173,12,59,
+221,250,16,72,251,29,114,164,49,160,174,77,181,16,57,6,189,236,190,8,10,195,216,68,195,188,159,247,109,221,149,19,
+106,202,195,166,138,220,86,137,161,190,154,24,239,7,5,11,245,12,241,255,86,208,135,163,119,38,160,11,171,23,59,7,
+203,20,98,238,76,161,28,168,31,8,108,77,33,55,46,169,160,167,114,114,60,166,36,223,118,107,2,177,8,28,133,163,
+188,23,7,237,105,191,193,63,183,181,191,209,192,215,183,23,40,211,207,11,196,205,26,117,38,2,106,162,224,26,164,62,
+173,204,69,28,221,93,244,29,244,103,100,51,1,17,248,20,250,76,65,20,183,20,140,239,232,217,8,132,76,182,95,138,
+235,126,89,196,17,69,61,5,35,212,116,199,127,163,77,115,9,72,115,11,171,163,51,209,151,80,72,187,34,218,176,246,
+63,62,121,14,157,131,182,64,211,49,158,254,2,58,20,229,93,196,33,250,4,139,234,79,128,141,10,136,227,40,245,36,
+160,49,146,198,74,161,166,5,61,93,211,133,204,69,232,177,131,187,134,38,236,120,253,71,32,233,103,91,115,183,188,254,
+5,4,214,200,73,225,89,194,107,241,199,214,231,4,104,63,186,11,113,95,116,57,186,7,221,140,238,64,119,163,179,249,
+124,7,52,7,242,90,1,64,162,90,2,117,99,142,69,236,86,34,187,114,168,153,148,67,114,220,167,8,212,36,238,169,
+237,62,163,86,190,157,13,16,72,24,235,183,10,98,216,166,56,241,247,97,128,110,255,188,72,235,61,57,206,199,113,12,
+42,195,138,76,252,246,79,133,184,164,93,37,64,195,223,16,189,94,240,11,112,41,241,27,221,159,82,190,79,20,96,244,
+62,113,255,156,50,210,49,150,37,62,247,226,248,40,170,202,254,30,43,255,246,211,219,4,104,112,233,152,250,111,17,26,
+223,38,189,77,163,254,185,79,234,235,228,128,186,90,37,137,219,232,126,62,173,65,202,122,113,0,163,52,202,31,82,63,
+77,60,182,181,131,13,120,253,112,90,232,72,199,183,240,163,49,249,241,104,163,24,252,240,147,246,81,163,121,29,98,27,
+17,41,70,86,236,163,98,2,170,183,54,109,199,107,221,13,83,196,78,36,178,124,238,141,222,9,112,244,52,113,62,130,
+90,249,170,24,135,147,235,49,2,105,59,225,168,235,143,39,81,94,59,154,8,3,223,129,30,43,190,179,91,144,64,82,
+247,179,112,220,23,61,132,58,217,35,4,56,24,21,76,217,209,199,33,32,160,104,90,164,231,246,134,218,171,68,92,8,
+141,227,187,31,255,17,131,68,179,115,124,14,21,49,113,93,26,249,164,92,114,99,74,24,199,154,172,218,221,117,86,114,
+133,213,212,125,90,239,28,39,65,87,161,50,108,44,78,87,171,41,2,103,171,143,9,208,46,211,243,159,142,11,163,144,
+139,3,162,141,99,218,201,211,232,115,96,82,190,44,3,225,113,192,180,253,163,139,254,195,18,63,133,91,32,126,166,71,
+251,35,77,122,105,161,168,42,83,57,170,124,190,124,97,86,118,80,30,1,218,130,190,247,179,162,103,81,17,123,144,200,
+211,149,151,83,123,22,1,24,75,103,230,172,40,125,231,231,85,220,126,49,202,122,97,78,70,237,193,245,219,100,141,53,
+181,3,180,22,122,188,189,208,5,94,63,79,220,27,144,38,199,151,69,105,59,141,194,176,205,159,22,137,242,154,218,254,
+164,40,74,94,236,164,90,2,170,183,68,159,225,88,244,28,165,249,7,109,254,75,125,106,115,78,200,216,235,148,212,71,
+181,52,156,90,175,17,72,219,9,199,255,160,188,166,49,213,108,168,213,94,123,173,236,206,111,113,2,212,253,167,208,105,
+40,175,61,76,4,253,230,165,45,6,1,96,166,39,141,203,243,214,196,160,240,219,203,87,191,91,27,207,243,6,241,9,
+249,247,172,126,231,89,85,249,147,122,187,46,164,146,134,136,115,76,226,175,170,236,59,157,154,16,72,235,157,163,118,170,
+148,97,175,227,244,123,53,41,110,99,179,1,227,25,144,31,145,152,179,134,97,150,142,39,116,97,123,63,42,106,90,8,
+74,125,230,204,77,239,4,79,202,120,82,65,88,239,17,255,223,104,142,188,37,79,210,159,136,227,15,209,197,72,155,72,
+186,97,247,146,104,222,236,59,124,67,9,168,45,160,67,35,52,196,99,229,203,86,46,1,49,70,121,23,114,52,89,185,
+120,63,213,15,101,189,18,133,218,206,229,214,98,247,188,3,68,237,103,37,164,73,194,80,211,226,200,3,232,120,180,9,
+210,166,132,214,24,162,140,146,37,190,215,231,24,98,154,188,47,45,111,101,148,215,62,63,36,144,212,221,52,28,111,10,
+169,252,182,56,90,4,220,14,181,218,66,219,49,196,239,43,196,95,81,62,108,38,48,18,129,164,157,125,139,163,250,204,
+60,166,240,219,141,228,219,159,53,155,0,245,255,49,164,13,18,161,166,235,213,163,145,54,124,54,27,86,217,165,19,192,
+68,191,229,88,196,180,162,91,118,118,107,239,95,12,208,22,40,111,199,72,148,113,236,13,254,91,190,246,5,110,72,6,
+97,173,122,27,53,78,13,132,255,115,126,226,175,114,58,73,186,19,119,43,253,202,11,92,179,4,19,238,123,115,12,217,
+157,71,180,17,237,93,62,61,162,102,69,110,92,118,96,60,5,210,142,208,198,149,173,236,2,137,25,90,15,233,78,142,
+24,118,32,78,90,99,148,178,243,222,77,255,73,25,55,139,1,12,31,234,123,110,65,127,64,235,160,57,7,151,141,247,
+38,67,31,67,27,34,13,166,175,71,154,0,232,182,105,210,126,112,118,253,127,159,18,160,45,232,153,218,207,20,108,148,
+26,75,251,98,177,130,54,4,103,245,213,103,5,212,215,10,21,100,175,54,73,192,71,253,115,168,109,85,155,130,68,206,
+8,64,180,160,119,23,202,123,39,130,158,40,114,31,218,19,45,138,42,27,51,36,105,41,221,16,107,205,155,16,49,50,
+73,187,171,130,128,234,13,29,23,82,241,131,226,252,41,241,213,106,183,109,175,151,226,117,200,35,223,91,115,16,85,48,
+112,26,189,75,128,182,165,199,98,133,220,249,120,133,218,168,173,191,8,168,206,19,205,207,241,118,20,195,206,198,201,98,
+253,69,114,220,210,78,50,238,191,133,254,59,153,216,250,177,201,9,3,189,124,130,120,250,49,194,183,2,227,55,37,218,
+76,20,68,63,248,84,180,110,254,131,143,171,155,2,165,71,202,241,74,164,124,46,18,201,79,171,211,108,243,53,13,175,
+231,71,250,209,223,121,208,194,72,143,11,209,15,79,107,178,78,63,14,170,31,66,213,123,111,34,45,38,78,156,188,190,
+139,227,85,232,12,116,43,106,25,63,234,153,190,244,49,14,129,205,112,163,126,116,178,56,238,198,241,114,6,245,165,31,
+1,183,69,34,192,247,35,245,164,47,130,190,55,170,183,175,161,67,144,45,63,129,109,136,242,27,52,99,254,168,227,197,
+120,140,119,78,28,239,221,230,190,241,15,138,166,50,207,85,176,136,106,195,75,36,250,17,199,183,105,231,111,112,84,99,
+215,81,231,139,169,146,255,139,142,83,112,19,205,222,197,211,169,209,188,217,81,19,8,252,137,66,204,92,176,32,23,19,
+255,190,130,62,28,61,59,129,41,179,7,109,133,124,135,191,163,115,198,233,245,224,161,109,90,215,215,183,245,122,225,135,
+202,63,231,168,217,121,255,104,180,40,26,238,194,68,231,176,183,209,243,232,94,52,6,233,7,149,47,98,108,124,51,199,
+110,217,242,129,9,187,95,10,4,87,147,104,59,144,143,175,22,204,203,237,196,223,123,24,31,55,241,254,110,232,48,244,
+145,97,194,12,245,246,138,188,185,52,186,113,168,15,253,158,9,36,4,116,205,49,71,78,26,47,18,254,231,57,227,56,
+120,115,8,124,156,162,28,139,62,25,169,72,235,227,71,79,128,216,150,115,184,174,79,109,121,9,104,34,171,77,186,205,
+183,136,125,46,111,250,77,11,15,188,51,139,0,76,226,234,241,73,222,17,94,97,227,128,183,190,7,135,36,252,139,30,
+94,198,65,235,174,152,188,69,32,158,158,151,172,93,56,223,67,71,160,203,208,29,232,5,164,93,106,186,29,177,136,105,
+231,154,30,33,247,117,148,55,123,14,63,136,128,24,182,105,57,94,135,236,110,33,90,71,187,148,16,161,23,255,131,114,
+237,127,83,2,48,85,253,45,136,254,129,158,64,250,126,232,7,249,86,66,105,48,31,135,33,32,70,109,58,129,215,177,
+238,68,83,95,119,192,48,201,54,238,237,54,134,177,206,65,184,236,57,123,128,28,183,218,83,227,42,216,5,202,68,32,
+173,255,228,248,29,142,69,239,108,215,34,230,151,83,191,153,50,225,64,193,4,18,206,186,203,32,143,169,175,239,183,71,
+171,133,158,39,159,130,85,112,253,212,57,34,229,210,157,188,67,221,21,250,46,239,107,162,231,86,116,20,218,16,205,141,
+106,177,9,129,124,232,156,21,242,8,44,162,181,30,253,230,115,94,157,27,102,91,222,146,186,78,199,188,43,242,127,209,
+187,69,117,205,177,100,187,223,52,185,246,247,120,253,27,148,247,46,181,83,82,95,62,154,128,8,12,106,83,7,4,180,
+41,162,252,239,240,212,143,169,246,23,1,234,125,42,244,55,84,134,253,180,191,104,70,46,45,53,146,126,193,53,153,85,
+196,142,138,156,181,218,187,3,86,202,78,199,223,33,13,58,139,154,46,132,90,126,107,15,160,33,25,76,120,255,184,104,
+197,181,197,95,67,62,7,91,146,142,234,118,70,164,11,151,93,209,25,232,106,164,223,131,80,251,41,186,88,131,139,76,
+166,91,26,87,71,3,109,120,112,126,253,255,200,4,218,216,233,209,45,122,180,67,25,166,71,77,204,140,70,206,140,63,
+205,77,0,166,122,62,176,46,166,6,219,155,188,161,199,19,104,145,199,223,143,97,200,38,108,150,229,24,58,145,65,212,
+33,77,147,54,195,164,218,188,183,85,214,68,75,115,212,121,160,31,237,88,10,221,226,208,188,26,118,137,178,16,72,235,
+159,227,150,232,37,84,212,212,47,165,223,173,44,89,112,152,2,4,18,214,167,5,84,218,10,138,219,116,75,248,172,196,
+49,116,140,127,85,83,57,81,174,133,208,181,72,139,92,90,184,121,8,93,128,126,130,212,62,166,175,91,251,32,79,105,
+223,50,212,24,146,143,71,52,141,49,231,68,117,43,150,243,51,12,1,213,85,162,201,57,222,137,138,152,54,236,126,3,
+165,62,91,199,52,233,193,239,243,255,229,40,143,105,243,167,30,129,52,142,223,212,191,143,253,71,32,109,11,28,53,239,
+19,50,190,82,255,60,97,234,167,255,8,246,119,137,169,247,159,161,178,76,99,245,185,80,127,67,14,45,189,192,37,210,
+164,86,17,235,230,173,205,161,197,47,20,15,88,41,187,205,120,173,193,103,81,211,221,28,159,69,62,249,22,170,153,124,
+145,19,222,107,114,204,187,235,133,40,67,154,110,135,86,29,206,139,214,70,123,33,173,100,95,131,158,71,26,196,213,193,
+116,119,78,107,209,137,99,62,104,14,157,126,247,181,40,167,137,231,50,236,1,156,46,131,220,31,68,104,111,41,199,228,
+248,93,142,157,118,212,61,71,152,61,144,118,162,68,200,65,111,187,16,131,54,233,71,94,127,135,94,68,49,77,187,114,
+55,65,189,13,43,71,238,85,214,54,233,247,10,99,157,135,112,213,19,166,242,234,252,235,126,46,71,187,105,90,208,164,
+254,213,47,135,76,50,16,109,28,211,166,152,47,163,129,239,86,211,120,213,173,60,9,235,188,59,54,181,168,209,218,80,
+84,183,242,196,202,79,123,27,228,181,206,153,161,246,11,34,198,202,86,237,252,80,182,143,163,175,162,229,209,71,107,151,
+193,65,25,34,143,234,91,38,67,33,119,14,190,62,200,157,255,173,57,129,164,190,85,231,39,163,34,166,62,239,136,44,
+197,37,92,122,254,154,157,215,122,90,64,30,219,159,192,173,248,89,210,114,152,102,19,72,218,194,44,28,67,54,157,106,
+110,242,243,105,123,210,209,214,63,4,168,239,249,208,163,168,76,251,62,206,251,7,106,204,146,10,92,162,57,56,22,89,
+140,208,14,147,185,83,127,49,243,88,87,95,73,89,117,139,237,147,40,134,233,209,42,105,125,212,181,216,141,203,87,194,
+92,237,63,150,105,34,226,49,164,31,218,173,187,157,75,6,91,187,44,26,87,177,37,23,8,110,159,68,218,73,80,134,
+141,193,233,58,168,107,253,65,146,182,6,126,107,161,239,162,131,208,113,72,119,145,93,134,110,67,119,33,45,56,233,177,
+31,15,33,13,18,37,45,18,158,128,182,67,173,157,97,37,87,71,71,247,228,35,101,169,59,31,148,231,172,118,5,1,
+245,59,112,125,109,48,72,249,125,139,215,247,100,133,151,35,156,46,112,127,143,90,233,244,43,108,202,127,115,14,102,77,
+8,170,29,205,105,219,234,215,106,239,251,114,211,6,118,67,154,48,136,97,167,247,61,208,138,1,80,105,250,14,31,25,
+80,121,91,42,110,83,45,225,146,246,111,161,59,249,181,249,171,181,201,175,169,156,122,173,92,73,189,126,130,99,200,66,
+206,3,189,86,222,126,207,111,82,223,26,159,106,156,90,196,244,244,155,220,56,137,163,141,9,121,54,129,106,225,167,175,
+199,210,185,33,55,56,66,210,22,116,221,30,98,153,22,30,27,140,175,175,139,70,131,57,54,164,209,228,140,163,249,162,
+190,230,28,165,240,64,188,62,39,248,193,193,181,123,185,111,78,28,148,85,19,185,121,38,4,7,243,106,255,95,19,183,
+179,161,116,192,31,165,78,237,164,51,129,132,185,118,152,231,25,36,17,188,49,182,21,37,233,12,170,207,67,136,81,155,
+102,226,117,89,19,174,90,24,214,143,192,149,106,109,101,209,99,45,244,168,63,245,223,39,162,139,209,104,164,133,72,61,
+234,162,168,201,207,221,104,47,180,4,234,202,57,34,77,151,99,200,100,147,22,170,190,211,230,163,212,186,169,163,115,202,
+190,50,186,8,189,139,202,176,171,112,58,240,29,171,35,131,42,242,4,131,13,208,179,101,0,174,169,207,243,201,87,223,
+215,123,21,109,171,78,105,180,215,57,175,53,185,21,171,95,209,70,154,149,234,84,214,126,200,75,82,159,251,112,204,107,
+63,37,66,99,17,169,108,137,62,205,241,109,20,98,183,19,169,43,227,166,198,86,76,193,130,37,245,177,77,72,101,18,
+231,242,130,201,59,122,197,4,168,179,175,160,87,2,235,59,141,118,43,47,230,68,65,185,39,94,158,59,30,117,62,109,
+221,69,17,148,152,35,53,138,0,109,225,215,232,125,148,215,174,36,194,84,141,130,225,194,116,36,64,157,167,227,150,133,
+121,221,233,233,37,121,219,212,80,225,213,55,118,204,87,211,2,148,241,99,127,55,0,233,51,5,64,173,156,198,85,133,
+76,56,225,132,233,191,141,56,14,106,100,179,82,40,253,160,220,2,17,10,247,62,62,14,134,215,83,17,124,217,69,78,
+2,73,59,213,0,237,17,162,46,154,51,122,19,130,175,66,33,142,111,66,65,42,42,195,167,72,231,100,180,88,9,233,
+61,141,207,111,163,115,139,250,30,212,95,125,18,127,115,162,165,208,60,137,148,255,105,209,52,168,140,243,9,110,91,54,
+5,127,245,189,218,3,109,137,142,67,123,163,110,217,122,1,9,235,81,31,127,68,154,32,220,42,32,126,207,69,105,107,
+63,43,144,249,93,208,90,104,202,146,10,114,27,126,191,95,146,239,94,115,123,22,25,158,15,29,128,38,239,181,204,7,
+228,247,164,128,56,142,210,12,2,234,91,14,67,75,68,44,206,63,241,117,69,68,127,118,149,157,192,83,217,131,14,132,
+156,109,224,85,179,95,236,79,241,38,13,44,226,169,129,241,28,173,92,2,161,215,255,79,150,155,45,123,47,74,160,109,
+252,43,87,186,126,218,23,77,173,127,2,77,243,11,155,162,199,3,227,43,154,198,200,186,110,203,114,190,156,152,112,27,
+161,139,144,173,207,8,12,106,191,250,49,249,31,161,188,147,178,207,18,231,59,200,143,130,4,66,159,218,55,41,247,204,
+21,148,93,215,188,182,162,4,248,226,175,129,138,152,30,139,48,35,106,228,206,161,180,92,28,181,179,74,59,164,98,153,
+118,89,20,173,62,199,47,72,128,58,184,36,86,133,246,152,31,221,110,91,144,94,243,163,139,17,90,28,221,139,202,176,
+177,56,253,34,202,221,127,18,103,65,164,221,87,63,64,191,65,127,69,122,188,217,227,232,121,84,39,211,174,32,45,138,
+84,106,164,41,174,159,65,69,31,141,160,157,35,3,155,22,42,45,68,133,137,81,70,61,82,111,20,42,251,78,197,71,
+72,99,189,10,139,214,19,73,193,228,24,20,235,46,5,92,213,210,52,102,156,11,229,238,243,122,162,18,187,144,73,88,
+206,210,133,100,59,38,153,214,113,114,156,140,227,239,209,11,40,166,233,174,62,61,14,180,99,126,28,32,46,1,49,71,
+95,69,121,77,253,92,99,191,255,73,217,244,56,210,144,71,112,137,229,99,104,1,212,88,70,113,91,98,53,222,146,250,
+208,56,59,196,118,170,38,151,78,37,148,0,149,218,250,190,37,71,141,131,139,152,174,193,54,70,3,62,11,228,107,21,
+252,100,253,109,74,245,29,238,55,66,97,247,112,188,180,222,57,174,139,66,198,89,58,95,105,62,193,237,167,135,219,65,
+104,214,147,122,215,221,131,161,143,131,37,106,46,211,102,250,208,236,246,108,188,50,118,80,95,6,141,135,81,232,202,152,
+118,118,127,3,253,14,53,213,150,164,96,167,160,133,35,21,240,49,252,236,21,201,151,221,228,32,48,168,211,88,154,168,
+211,229,136,222,164,160,186,11,196,214,153,128,238,72,208,179,98,117,71,75,108,211,14,189,31,163,243,18,199,154,232,210,
+239,178,104,183,234,92,104,118,164,187,103,116,103,203,76,72,183,58,207,136,102,64,19,162,41,144,118,96,245,130,41,191,
+250,97,59,181,187,214,157,57,21,222,189,169,58,156,168,32,164,197,137,175,223,150,82,91,208,157,42,45,171,176,12,105,
+146,81,143,109,253,225,215,113,172,221,91,234,19,203,24,103,180,231,123,12,255,124,3,93,210,254,166,95,183,8,104,39,
+212,187,232,219,13,230,241,32,223,27,141,129,108,17,8,240,29,94,27,55,23,71,112,85,166,139,109,112,254,19,164,243,
+91,76,123,30,103,251,161,103,98,58,181,175,92,4,94,205,21,250,131,192,89,118,151,7,184,173,77,148,133,200,201,158,
+40,244,92,122,58,113,31,68,182,250,17,208,152,60,175,105,182,106,108,222,72,14,223,53,2,186,11,166,200,198,173,55,
+136,255,107,198,57,250,30,23,54,252,104,227,229,65,56,250,21,210,181,212,72,166,107,197,197,145,238,120,183,245,31,1,
+205,23,28,142,166,15,40,250,191,136,163,187,165,109,253,75,96,53,138,30,123,156,62,28,77,141,143,52,167,245,252,112,
+1,154,248,126,232,160,112,36,22,154,52,184,29,205,55,82,160,14,159,233,66,242,119,29,194,244,234,199,235,144,241,35,
+145,30,81,20,195,222,196,201,62,232,190,24,206,236,35,55,1,77,200,127,13,109,134,116,194,155,18,245,163,221,208,143,
+133,238,84,230,182,137,109,5,213,228,246,193,168,140,91,76,95,193,239,3,104,91,164,137,40,45,206,76,142,166,70,77,
+53,45,166,124,15,253,3,221,85,97,33,151,138,148,214,180,248,217,9,233,2,239,103,168,231,22,34,6,181,239,185,40,
+131,22,18,191,132,52,241,212,233,2,145,32,133,237,110,60,232,182,253,43,10,123,106,174,131,31,80,180,151,208,118,72,
+125,66,211,236,130,166,21,168,202,242,240,29,214,247,116,65,164,126,109,57,164,49,204,5,250,110,215,112,97,249,179,228,
+109,47,180,58,138,125,253,242,14,62,53,97,113,46,178,117,143,128,22,28,222,66,121,250,170,129,73,166,154,182,219,162,
+52,255,134,131,208,107,198,177,196,213,56,195,86,79,2,33,155,186,212,103,63,94,207,226,56,87,131,8,204,207,255,63,
+71,161,231,171,247,137,123,32,218,31,69,51,206,237,251,209,87,126,5,135,139,119,112,58,5,159,175,143,110,235,16,206,
+31,55,143,192,199,40,210,233,72,215,118,121,237,22,218,216,134,121,35,57,124,227,8,124,186,194,18,169,175,154,23,61,
+95,97,154,205,75,74,131,104,164,219,63,139,152,110,143,154,14,245,60,32,149,161,77,191,224,117,200,237,137,68,27,214,
+14,224,147,129,52,122,30,88,205,11,208,198,90,143,87,58,25,61,141,250,221,244,152,168,133,81,205,107,175,250,236,137,
+73,162,93,56,102,189,149,157,160,182,28,4,244,3,140,149,84,174,210,65,122,220,92,108,211,163,199,78,71,11,161,180,
+205,84,82,166,34,137,36,121,221,136,227,25,168,234,246,125,11,105,46,157,228,161,197,172,72,89,154,28,55,97,244,127,
+28,155,118,190,210,99,227,86,108,114,221,149,93,54,248,237,134,244,248,20,177,124,31,93,143,166,68,101,39,221,209,191,
+242,144,104,69,142,255,66,175,161,178,236,200,142,25,114,128,74,8,80,193,207,230,172,228,55,9,223,184,71,114,83,38,
+181,255,243,114,178,24,28,124,207,74,42,205,137,228,38,144,212,239,61,131,43,44,227,255,77,191,11,45,55,207,186,69,
+72,234,183,200,247,87,231,227,127,38,126,162,23,15,191,122,148,118,150,115,106,43,15,209,51,96,135,181,34,144,182,179,
+228,168,71,98,221,134,66,76,143,120,215,102,27,91,31,19,160,13,104,252,114,90,72,3,42,16,103,165,62,70,183,136,
+48,88,0,0,32,0,73,68,65,84,30,167,232,73,197,105,17,230,201,2,21,161,168,123,161,56,153,234,162,23,149,33,
+209,95,56,190,141,98,218,229,56,155,8,181,210,232,98,49,251,38,105,88,107,145,242,223,72,23,142,182,255,253,239,37,
+32,252,24,185,13,14,241,45,72,184,232,247,102,222,66,182,114,8,232,55,13,134,160,31,255,45,165,131,52,161,88,150,
+233,251,116,2,106,253,230,71,252,18,20,243,72,190,210,243,217,178,188,62,28,61,132,138,254,94,16,46,114,219,249,196,
+40,86,152,62,138,45,86,137,86,224,120,33,106,138,61,65,65,250,168,38,227,21,21,110,154,248,190,2,13,254,254,106,
+65,231,16,20,47,177,140,158,148,102,155,166,229,245,247,144,54,138,196,30,59,227,114,28,211,152,110,186,140,217,116,176,
+146,9,80,23,15,140,83,59,157,255,209,132,231,231,80,171,253,148,156,189,210,221,39,229,152,134,227,40,164,178,133,218,
+181,68,212,221,217,182,26,18,160,110,212,94,245,251,126,121,173,47,127,11,160,134,85,56,98,150,168,212,175,160,215,243,
+86,110,91,248,11,120,61,112,78,28,49,177,128,15,19,223,127,111,75,111,184,151,122,20,91,232,29,69,1,57,115,148,
+110,16,72,218,131,218,219,244,232,26,20,98,106,239,59,161,110,20,193,105,214,136,128,218,0,202,210,191,16,44,138,105,
+172,164,39,35,245,149,233,209,52,101,152,30,227,113,99,65,199,27,21,140,95,151,232,171,146,17,61,106,78,143,127,153,
+20,197,50,61,74,104,67,110,93,124,95,143,191,144,108,241,9,208,41,164,131,168,77,121,125,51,41,156,130,190,128,242,
+60,246,33,126,198,234,225,241,5,178,113,0,250,125,61,178,211,253,92,180,181,23,181,27,253,222,215,25,232,199,104,178,
+238,231,174,177,57,152,181,226,146,169,63,47,203,166,197,241,215,209,61,72,59,249,212,239,164,125,80,89,105,14,235,183,
+45,237,69,121,173,71,116,233,153,199,250,77,154,171,209,119,209,124,168,172,113,4,174,199,179,55,121,231,16,180,238,120,
+159,248,141,44,4,174,34,144,198,86,59,35,181,49,61,182,163,42,211,111,95,168,221,156,19,49,193,155,34,250,234,27,
+87,124,151,55,166,176,183,32,221,205,52,248,251,59,49,239,125,31,237,143,186,97,155,147,232,133,232,17,244,103,180,56,
+138,57,118,198,221,56,118,61,255,125,145,49,180,174,91,108,245,32,144,247,81,189,186,0,90,166,30,89,143,146,11,61,
+126,247,34,180,26,82,217,66,76,237,249,255,144,198,233,182,122,18,80,221,206,20,144,53,245,209,182,250,19,248,17,89,
+212,163,74,67,76,99,27,61,42,187,108,211,245,105,167,62,98,122,194,76,168,235,1,91,227,9,44,64,9,47,67,122,
+204,110,94,211,245,196,111,209,239,242,70,116,248,198,18,120,164,194,146,105,110,70,215,181,182,34,4,218,38,126,190,202,
+235,34,166,93,129,235,20,201,75,55,226,146,231,129,73,55,94,31,132,180,195,58,182,105,23,170,110,137,237,70,17,251,
+42,77,24,127,9,233,206,167,193,187,86,121,171,111,77,44,180,75,118,173,190,106,12,25,10,11,147,244,251,255,81,94,
+107,55,165,173,124,2,23,145,68,134,218,41,30,68,233,160,47,160,170,238,176,210,14,147,135,145,118,200,151,62,81,69,
+26,237,237,87,231,112,237,166,185,31,189,137,186,109,58,239,237,136,210,60,22,175,208,62,247,0,203,45,144,238,70,208,
+14,223,50,76,237,230,118,244,51,180,8,82,221,233,255,88,246,77,28,245,121,45,230,43,62,188,190,142,198,100,168,0,
+245,113,219,161,210,190,111,248,158,7,109,133,142,70,106,23,111,160,42,77,109,255,99,249,8,58,116,217,4,168,147,253,
+2,26,193,141,196,105,181,213,178,243,23,219,127,154,239,228,184,1,199,135,81,17,123,159,200,251,197,206,167,253,197,37,
+64,29,169,189,190,16,80,209,122,244,96,220,204,216,91,20,2,73,157,170,94,55,65,239,160,16,187,143,72,149,109,80,
+35,173,195,209,72,115,28,15,243,121,200,130,99,20,166,118,82,13,1,234,120,73,116,55,10,53,61,173,162,180,241,98,
+53,20,156,74,44,2,73,91,208,53,102,85,118,24,9,197,202,126,127,251,17,72,52,53,122,20,21,177,158,251,209,81,
+10,171,178,47,143,174,68,35,157,24,249,56,200,180,48,180,45,106,117,150,253,221,210,226,151,62,229,202,113,57,116,38,
+170,195,4,38,217,168,141,233,153,169,126,148,218,48,77,15,54,250,94,106,145,245,65,100,171,134,192,79,73,102,152,26,
+137,251,182,210,73,116,83,53,69,27,39,21,109,110,208,98,198,5,232,64,180,30,154,29,165,121,202,93,88,226,78,134,
+62,139,52,97,123,12,210,35,20,158,65,154,196,173,147,141,34,51,171,228,46,160,35,100,34,0,219,37,208,30,232,106,
+164,231,91,135,154,38,46,158,71,231,35,125,47,231,71,3,237,147,215,122,156,215,43,40,134,189,134,147,121,80,166,50,
+58,208,4,170,135,79,163,27,80,86,211,248,167,245,27,100,28,115,35,84,156,68,122,84,199,199,144,206,141,26,63,92,
+132,52,89,37,255,221,176,247,73,244,191,72,187,79,109,53,35,64,189,172,25,208,40,94,38,206,108,168,102,165,233,156,
+29,229,57,209,95,56,190,138,138,218,25,56,232,156,176,67,116,149,128,234,8,233,124,153,215,52,14,236,106,222,157,248,
+208,4,84,47,137,46,206,91,169,73,248,251,57,174,33,31,85,25,105,105,156,246,16,26,206,158,227,131,121,171,202,143,
+211,169,158,0,245,251,53,244,248,112,13,32,195,251,122,90,131,205,4,6,8,208,102,212,23,106,142,162,236,71,35,171,
+121,106,206,98,29,52,144,126,191,188,8,189,101,123,68,62,109,32,143,35,224,214,35,6,30,249,195,215,249,88,187,144,
+239,74,131,213,237,17,98,109,101,85,22,231,66,122,28,197,6,72,143,85,138,109,111,225,240,103,232,224,212,113,221,120,
+164,249,234,213,35,245,169,91,136,117,107,168,30,63,51,67,175,150,35,114,190,95,193,223,157,232,84,116,58,122,20,181,
+204,237,47,37,241,193,145,246,163,71,89,236,138,220,118,198,69,83,214,127,186,141,118,61,244,96,21,109,177,173,191,223,
+137,52,213,79,116,219,222,36,3,58,79,62,149,72,143,175,122,8,233,81,9,250,222,62,137,102,65,211,161,105,209,252,
+72,231,166,89,209,236,104,10,164,207,234,106,207,146,177,191,161,29,148,193,42,234,88,233,244,155,181,181,107,21,93,109,
+227,179,232,115,232,147,104,206,68,106,43,175,33,61,62,65,246,52,82,27,83,91,187,13,221,142,244,56,160,103,208,112,
+246,53,62,80,125,198,176,251,104,15,139,196,112,212,47,62,168,231,67,40,235,143,115,150,87,87,70,234,95,46,70,119,
+160,49,72,109,96,106,164,71,134,106,204,52,19,154,28,233,61,61,22,74,143,147,81,127,51,99,242,90,71,125,46,95,
+165,92,119,224,55,171,41,15,231,208,118,54,200,26,193,225,170,37,64,59,157,155,20,213,159,228,61,55,237,67,156,61,
+122,237,60,65,121,117,157,123,40,82,191,91,212,52,86,255,12,122,179,215,56,20,45,120,175,197,167,222,213,95,62,135,
+242,62,122,89,231,220,25,93,191,245,171,113,234,84,153,210,247,239,63,40,111,255,165,115,235,151,209,117,168,210,241,46,
+249,214,181,235,175,208,80,143,49,125,153,247,87,167,189,221,200,209,214,48,2,212,189,30,133,246,109,164,254,40,196,174,
+36,210,102,180,143,39,66,34,59,78,51,9,36,125,161,10,167,254,67,243,14,101,218,13,180,63,141,163,108,49,8,168,
+242,18,125,150,163,118,104,22,49,221,21,145,250,139,145,189,168,62,218,242,246,127,188,46,122,7,210,72,156,180,115,113,
+247,168,153,183,179,113,8,192,119,99,116,231,72,149,208,39,159,233,199,234,70,163,163,209,214,104,42,212,250,14,142,3,
+204,255,12,244,75,9,163,227,56,118,107,135,49,73,247,157,105,151,135,250,221,202,218,102,154,22,199,201,209,189,200,86,
+14,1,141,27,206,65,26,67,12,124,207,220,229,116,135,0,117,48,37,250,72,104,234,109,117,120,42,175,99,153,38,62,
+109,25,8,0,92,223,161,143,160,188,63,34,31,171,174,234,226,71,119,113,237,149,1,153,131,116,145,0,117,164,246,26,
+242,99,203,119,43,110,175,24,121,157,20,253,10,189,136,98,152,238,4,247,100,70,143,52,0,234,106,18,164,167,108,228,
+181,167,137,208,35,165,236,175,108,170,94,208,119,243,86,40,225,31,65,43,160,174,140,119,73,119,38,116,61,26,202,116,
+93,251,249,254,170,201,254,40,45,245,170,57,214,247,134,170,244,140,239,233,206,179,86,155,237,15,98,46,101,86,2,105,
+187,224,168,199,222,150,105,186,195,254,59,89,243,213,180,112,131,127,228,52,74,249,180,75,36,209,53,56,188,165,160,211,
+181,137,95,231,31,54,214,174,62,237,82,216,31,105,23,89,25,166,59,113,254,130,180,91,194,22,153,0,29,128,110,253,
+59,13,183,39,162,79,68,118,95,119,119,207,147,193,187,209,37,232,151,72,237,121,70,52,47,218,150,239,241,95,209,235,
+201,247,153,183,108,67,16,88,131,247,212,215,109,141,180,235,216,86,62,129,247,72,226,79,180,203,131,186,212,54,213,39,
+31,93,126,49,251,50,133,251,41,245,206,104,125,234,246,154,180,126,117,180,117,135,0,236,223,64,175,69,72,61,228,7,
+84,135,74,86,179,88,23,12,245,129,223,27,150,192,167,249,100,129,97,63,109,254,7,218,45,250,19,218,177,198,57,182,
+250,19,184,34,32,139,139,16,71,59,139,107,109,92,111,104,226,235,75,100,242,86,244,115,148,119,231,254,80,229,27,203,
+155,63,64,215,15,245,161,223,171,37,129,119,201,149,198,146,182,102,17,208,53,97,30,123,156,192,155,112,110,186,10,165,
+243,103,121,226,23,14,75,186,186,51,236,96,244,198,16,206,52,222,202,123,215,216,16,110,252,86,93,8,112,254,217,12,
+61,64,126,52,231,19,50,23,172,187,178,207,69,122,122,141,205,4,70,34,160,167,249,148,105,186,27,231,136,50,19,232,
+107,223,116,20,63,64,69,77,187,140,52,217,222,117,150,202,67,162,173,56,222,138,244,187,5,101,218,27,56,215,179,230,
+189,226,93,66,237,195,85,207,226,190,29,53,217,180,11,85,119,139,233,247,109,142,70,187,160,13,208,199,145,30,129,98,
+11,36,0,191,95,34,241,181,85,71,64,207,20,223,21,5,214,90,120,52,165,217,166,105,121,125,22,178,197,33,160,223,
+230,217,23,125,20,249,124,23,222,76,107,23,51,169,207,197,57,198,186,99,81,59,216,107,87,206,186,102,40,225,255,35,
+142,253,106,231,82,112,61,238,198,214,3,4,168,43,245,255,203,160,144,254,226,174,58,23,145,50,45,132,254,133,244,76,
+247,88,246,20,142,54,69,62,111,214,185,242,7,229,45,169,175,103,3,26,129,190,23,83,13,114,231,127,107,64,32,169,
+83,253,214,96,86,211,245,76,165,191,137,51,28,38,242,161,187,118,71,13,145,113,61,253,96,253,225,226,249,253,222,33,
+64,61,234,105,18,39,162,34,243,22,186,131,231,164,222,41,181,115,218,13,2,180,145,116,190,100,98,94,191,128,202,48,
+181,227,173,187,81,190,186,164,57,73,5,25,209,157,36,191,64,179,21,72,75,207,245,63,3,233,153,237,111,23,240,147,
+59,42,13,164,61,142,158,21,191,29,210,51,76,149,167,178,183,8,191,66,26,191,65,7,34,91,100,2,212,237,30,184,
+220,9,197,216,13,23,57,119,185,221,233,14,5,237,168,81,155,209,133,236,109,232,161,228,168,231,238,106,183,94,165,207,
+220,85,122,77,179,182,254,96,81,202,166,103,32,171,79,176,85,67,64,157,241,181,232,199,168,245,12,233,106,146,253,48,
+21,237,150,107,51,253,184,242,1,252,191,36,154,187,237,125,191,204,71,224,101,130,235,252,254,67,248,198,184,235,35,95,
+234,14,93,21,129,149,72,40,214,29,139,119,86,149,233,6,165,51,111,131,202,146,181,40,47,16,240,175,104,199,172,17,
+28,174,251,4,146,243,172,30,243,163,243,189,174,251,242,152,54,40,237,67,132,95,12,58,95,231,241,17,61,44,121,210,
+53,240,238,104,75,164,223,143,138,101,218,205,191,11,210,83,5,108,189,71,96,168,59,32,58,149,66,99,225,119,59,5,
+242,231,93,35,48,123,198,148,85,135,123,163,139,51,134,47,59,152,198,223,250,29,189,101,80,251,239,165,104,126,193,214,
+227,4,56,7,253,136,34,232,250,121,193,2,69,121,147,184,127,64,250,77,37,155,9,12,75,160,109,252,165,133,191,227,
+8,184,195,176,129,195,63,56,154,168,26,227,247,173,85,177,144,163,19,128,38,105,190,95,144,178,30,201,113,29,141,97,
+77,142,207,166,190,218,26,74,250,86,25,71,237,228,251,25,90,21,233,177,83,85,152,38,229,119,165,124,71,85,145,88,
+191,165,65,59,58,129,50,111,142,38,238,161,178,107,192,255,12,122,21,221,151,232,49,142,154,212,210,99,67,238,169,232,
+251,64,82,125,107,90,192,61,12,233,121,193,19,245,45,133,234,11,174,133,201,163,104,223,26,64,214,201,174,38,51,122,
+52,138,242,53,93,157,50,214,3,121,209,2,206,101,72,23,178,55,244,64,126,157,197,98,4,54,40,22,125,156,216,103,
+142,243,159,255,201,66,160,170,177,107,150,188,148,29,230,125,18,248,23,210,66,251,85,101,39,102,255,165,17,248,59,158,
+87,70,227,236,160,200,144,218,247,8,163,133,13,141,27,186,106,92,107,204,69,6,52,233,181,5,138,253,29,124,16,159,
+91,50,46,210,56,196,214,155,4,116,61,151,215,244,125,80,91,122,42,111,68,135,175,132,128,230,189,178,216,40,2,105,
+225,164,78,246,111,50,163,241,248,170,109,153,82,123,171,116,19,117,91,218,126,25,72,128,115,79,26,115,29,94,252,20,
+233,92,90,100,222,226,5,226,239,143,126,141,108,38,144,153,0,99,148,29,105,143,154,55,91,44,115,164,206,1,143,37,
+200,94,157,131,57,68,33,2,234,72,144,30,169,17,114,251,48,209,198,179,199,121,167,180,91,200,241,157,222,10,182,12,
+175,15,67,119,33,253,240,114,149,246,48,137,109,136,10,177,119,228,241,9,192,84,143,67,186,8,105,133,184,87,236,175,
+100,84,143,99,152,126,252,18,249,157,50,9,192,60,237,15,150,231,245,127,80,213,125,1,73,246,173,233,118,254,91,208,
+14,72,223,219,50,171,58,200,183,242,148,104,103,142,122,12,166,173,51,1,221,201,164,62,77,187,254,108,125,64,128,186,
+214,247,100,12,138,97,122,156,237,167,80,31,144,139,83,68,177,66,255,70,253,96,15,81,72,93,52,198,129,103,47,93,
+35,160,58,68,170,207,16,187,165,107,25,39,97,50,172,235,222,227,81,172,107,223,193,12,206,231,141,69,81,55,139,233,
+180,11,16,80,221,33,141,113,67,44,239,157,106,5,114,234,168,89,9,80,145,170,211,59,51,86,232,175,147,240,138,147,
+53,137,82,195,37,249,209,239,167,180,95,207,104,204,190,108,169,9,219,121,116,2,212,153,198,201,167,13,170,75,254,13,
+178,209,196,218,8,181,218,170,142,54,19,200,67,128,54,179,48,210,28,126,81,211,227,212,246,71,211,160,218,244,157,121,
+88,244,84,216,20,50,71,77,220,196,50,93,200,223,132,182,69,19,161,40,29,11,126,180,120,115,56,186,3,105,18,177,
+27,118,45,137,206,133,220,56,35,181,244,148,37,199,5,209,53,168,215,108,155,72,40,236,38,39,1,26,138,126,75,232,
+86,212,75,11,127,189,214,190,7,231,87,19,31,39,160,47,228,172,174,202,131,147,199,129,115,15,175,247,68,26,96,216,
+134,38,160,103,228,158,132,230,71,62,191,85,222,90,187,151,32,245,189,4,138,53,166,210,221,167,182,28,4,146,239,155,
+38,149,155,108,250,157,144,221,145,47,238,114,180,141,58,7,165,46,117,158,248,25,10,53,45,94,106,55,121,169,70,26,
+237,227,128,165,248,255,44,244,34,42,195,52,193,122,50,170,226,137,26,165,114,235,119,231,212,161,218,205,217,40,196,214,
+237,119,126,117,44,63,21,169,58,205,250,27,57,175,16,86,191,35,221,234,63,234,80,158,36,47,31,229,248,0,74,237,
+25,94,44,80,135,252,57,15,195,19,160,142,210,243,208,202,188,214,57,232,117,20,195,116,30,245,70,226,225,209,251,147,
+12,4,104,67,106,159,106,155,15,163,80,83,191,180,101,134,228,28,36,22,1,128,167,29,203,244,188,214,201,32,182,105,
+114,232,98,116,32,90,9,77,136,166,66,105,186,227,28,211,114,241,249,60,104,115,180,47,186,1,61,141,186,57,89,251,
+22,233,235,14,160,25,208,64,158,211,252,250,24,78,32,225,169,182,161,5,186,110,216,251,5,18,213,137,120,169,240,210,
+59,102,30,2,176,78,191,123,107,241,250,102,84,164,238,136,110,203,72,64,237,92,119,202,109,135,210,58,200,83,117,181,
+8,75,222,183,71,154,80,180,125,72,224,49,94,30,137,62,89,139,74,114,38,42,39,64,221,107,211,77,44,59,181,242,
+2,244,120,130,128,87,159,250,127,177,42,160,102,126,158,35,63,90,164,242,163,45,123,188,157,14,206,62,117,170,118,171,
+235,185,135,80,168,93,66,196,201,80,105,227,138,196,247,215,56,254,23,105,44,83,150,233,92,186,237,96,78,254,191,55,
+9,80,151,106,147,167,4,54,150,239,244,102,169,155,157,235,164,78,127,159,163,78,117,141,169,187,149,143,70,203,162,201,
+81,171,175,234,22,169,36,253,19,57,166,215,191,163,121,61,115,183,242,227,116,179,17,160,142,52,111,49,10,197,58,7,
+189,138,175,35,80,87,219,99,182,210,59,84,221,9,164,237,136,163,158,176,114,1,202,179,241,85,27,99,116,163,197,172,
+168,238,69,109,86,254,4,188,77,191,226,117,217,246,38,9,232,241,71,90,152,209,201,71,39,200,187,209,189,232,73,52,
+22,189,132,210,19,20,47,187,110,79,144,131,93,80,179,42,191,6,165,17,83,180,24,210,29,92,85,152,218,223,131,72,
+119,86,105,113,113,51,52,23,250,59,10,105,115,247,17,175,6,36,251,35,11,98,141,126,130,180,64,108,43,151,128,78,
+226,55,162,253,209,39,80,207,55,50,149,1,45,141,84,174,126,54,221,125,113,59,250,30,154,18,137,75,207,215,175,11,
+16,70,128,186,215,238,192,88,182,125,88,46,250,55,22,224,245,253,211,36,145,198,191,77,49,109,12,59,6,169,191,117,
+255,210,224,230,77,253,234,250,40,100,252,76,180,150,105,252,63,15,138,218,78,240,183,8,250,51,186,31,21,201,31,209,
+71,52,249,190,10,45,140,26,92,211,253,85,52,213,37,250,19,10,177,125,251,139,86,111,148,150,138,84,157,126,30,233,
+113,100,121,76,223,113,221,161,163,141,197,187,161,101,208,71,80,171,207,210,177,42,75,210,252,46,71,141,227,211,190,199,
+119,0,86,85,1,25,211,73,234,73,237,67,155,210,175,71,154,127,138,101,58,103,106,254,170,242,246,151,177,248,14,214,
+227,4,104,91,31,71,26,63,105,211,180,158,196,162,133,195,119,81,187,61,192,63,90,228,246,29,168,195,212,119,37,183,
+156,183,165,173,31,125,60,3,125,166,237,189,126,126,169,51,179,126,236,110,55,116,157,64,248,199,234,69,33,158,241,229,
+215,15,66,158,136,214,70,177,219,187,126,208,240,37,116,51,186,22,93,174,215,212,225,88,142,227,25,121,81,152,188,207,
+153,61,134,56,219,186,93,140,135,179,148,55,168,163,47,225,248,120,228,221,189,165,16,158,224,89,220,222,141,180,171,254,
+114,218,245,109,229,36,211,29,175,180,159,246,132,247,227,159,31,160,126,106,75,175,80,222,115,208,177,232,63,238,183,160,
+96,211,133,224,157,96,248,68,4,20,239,227,99,62,218,213,163,17,124,245,157,11,234,225,40,10,221,235,59,250,31,164,
+12,71,162,195,104,7,234,111,108,13,39,144,156,87,255,69,49,191,88,160,168,207,16,119,111,244,71,218,77,176,27,242,
+178,16,145,55,71,235,33,221,101,58,37,42,211,52,102,250,45,58,32,77,164,72,254,83,31,62,118,159,64,210,174,119,
+38,39,191,9,200,205,191,105,7,186,174,181,213,136,64,82,167,202,81,145,254,74,227,28,157,219,116,174,187,41,209,29,
+28,31,65,234,199,222,64,165,206,23,81,14,181,173,211,209,20,232,100,180,133,251,29,40,116,209,146,182,165,5,181,153,
+208,180,104,67,164,59,243,230,67,19,163,24,246,28,78,206,66,63,163,190,159,142,225,208,62,76,32,11,129,164,125,47,
+70,216,5,144,198,85,79,161,219,209,243,238,123,160,48,140,133,143,102,135,113,216,233,109,42,106,53,194,232,228,208,239,
+207,91,124,1,6,39,210,56,183,239,196,204,159,135,17,160,173,233,196,246,43,244,19,20,107,55,137,78,114,26,76,105,
+144,166,129,244,149,28,135,181,164,99,74,63,215,35,210,14,67,203,165,111,116,56,170,141,124,14,221,225,78,172,3,169,
+8,31,83,87,106,35,215,160,165,35,184,179,139,15,8,188,200,97,52,186,16,93,138,46,64,3,171,29,77,111,215,180,
+169,207,83,222,189,208,50,40,86,31,132,171,218,217,195,228,232,60,164,137,178,129,193,127,211,235,183,118,181,80,179,12,
+37,231,191,185,201,214,189,40,198,132,231,19,248,153,211,237,42,172,162,169,15,109,36,209,230,16,93,44,245,146,189,75,
+102,175,71,167,160,67,211,140,187,29,164,36,154,125,76,250,17,141,133,53,193,84,228,218,81,19,164,58,87,253,3,253,
+149,246,163,77,37,29,45,57,143,127,137,128,95,64,218,144,56,85,199,72,197,3,40,175,151,163,111,145,207,7,138,187,
+179,135,186,17,72,218,181,218,149,218,117,94,187,145,118,225,77,177,121,169,149,28,62,169,83,165,50,47,186,22,205,138,
+138,152,174,151,212,23,188,142,94,69,218,196,242,56,186,43,121,61,134,163,38,60,181,224,171,5,30,133,43,188,208,67,
+57,214,197,143,250,73,93,183,236,138,126,75,123,227,96,171,138,64,91,91,82,146,58,231,124,22,109,140,86,69,243,162,
+143,160,88,166,54,163,235,116,93,175,222,44,167,174,111,81,176,153,64,189,9,84,222,43,39,29,211,190,96,249,41,210,
+68,123,191,153,78,200,23,163,95,163,139,220,81,150,83,253,73,59,91,25,239,26,32,207,80,32,21,77,32,232,194,239,
+70,116,60,186,10,189,132,90,150,183,254,200,215,138,68,252,63,164,193,123,39,59,0,255,63,235,20,200,159,199,33,64,
+221,108,129,167,19,227,120,235,75,47,186,200,208,66,231,67,232,34,116,19,26,133,222,65,45,203,251,125,73,227,245,234,
+49,233,135,148,253,237,209,247,208,199,245,79,67,76,23,140,170,227,163,144,38,88,223,234,183,250,165,204,182,17,8,36,
+237,127,61,130,156,51,66,176,60,31,157,79,224,47,186,157,229,65,54,110,88,234,228,107,188,115,24,234,133,59,5,181,
+40,124,53,58,4,93,234,122,135,66,31,90,219,121,244,96,138,191,67,36,4,26,151,60,137,52,49,122,63,122,30,189,
+141,116,189,160,239,198,252,104,22,52,59,154,12,85,121,189,250,24,233,237,77,123,63,146,163,173,161,4,146,118,61,53,
+197,211,36,252,228,57,139,169,93,202,218,153,111,171,41,1,234,119,55,178,38,197,156,112,79,75,171,185,36,45,242,168,
+207,82,95,166,235,175,55,209,43,201,255,175,37,71,77,208,43,156,230,251,166,64,234,199,212,214,116,156,20,77,132,228,
+75,115,29,234,3,21,255,101,180,60,90,4,233,189,53,209,237,62,255,66,161,66,163,253,168,206,62,138,214,70,91,32,
+45,228,104,65,71,117,22,203,84,239,186,78,223,159,250,189,52,150,83,251,49,1,19,168,134,128,86,218,187,97,63,39,
+81,237,170,250,65,55,18,239,98,154,15,145,246,95,208,65,93,204,67,191,36,173,147,221,254,40,100,17,71,3,163,251,
+208,5,72,245,245,0,106,89,132,129,204,149,56,250,58,250,46,218,30,205,133,6,47,168,190,197,123,199,34,13,0,109,
+213,17,208,32,201,54,50,129,247,248,88,122,10,105,129,83,19,14,183,36,210,64,127,44,175,109,227,19,208,46,242,211,
+208,150,72,231,189,121,208,224,239,61,111,213,222,116,193,55,6,105,98,254,40,234,251,214,218,231,216,25,236,54,1,93,
+132,198,178,219,98,57,234,87,63,124,103,79,98,130,96,33,202,175,205,84,49,238,146,138,141,82,11,196,119,163,163,209,
+25,72,231,26,155,9,136,192,142,72,19,91,155,235,159,130,166,73,76,157,135,165,149,10,250,138,21,93,147,168,127,67,
+250,110,106,50,213,214,124,2,154,128,215,53,231,228,57,139,58,53,253,248,20,196,121,51,194,117,105,206,164,29,60,35,
+129,253,8,167,121,182,157,209,180,25,227,100,13,150,78,230,235,28,46,13,231,63,93,196,25,124,28,42,29,133,145,233,
+26,79,254,213,46,47,68,119,32,91,201,4,248,62,167,41,168,62,63,137,54,65,27,160,249,145,54,19,196,54,93,187,
+235,81,163,26,107,217,76,192,4,122,144,64,229,19,73,109,29,213,52,240,250,7,250,60,170,60,31,21,215,149,118,219,
+252,25,29,76,135,249,66,197,105,247,101,114,180,179,47,82,240,127,34,13,116,179,152,118,180,60,140,116,17,117,60,26,
+141,74,191,181,148,124,238,66,50,235,163,5,145,38,73,111,66,103,163,163,80,233,233,43,13,219,7,4,168,139,211,121,
+181,81,31,243,208,40,82,223,3,93,120,168,159,210,4,154,142,79,160,27,209,61,232,26,244,28,210,64,223,237,83,16,
+114,88,219,249,79,19,53,95,69,159,206,17,189,91,65,213,47,233,28,118,17,58,11,105,65,170,101,158,64,72,73,248,
+56,20,129,164,189,107,34,64,227,188,24,182,34,78,174,114,187,43,142,146,186,217,23,47,63,65,101,76,16,228,205,160,
+54,175,220,135,78,66,58,15,235,181,207,47,130,96,107,253,216,114,27,134,5,120,125,50,210,227,74,155,98,111,80,144,
+171,208,30,58,186,127,107,74,181,142,92,142,182,241,224,13,132,92,122,228,208,67,126,170,235,149,51,221,94,134,100,211,
+245,55,219,234,119,61,50,243,27,180,72,215,51,149,45,3,58,31,63,131,142,68,127,68,254,141,10,32,148,101,73,59,
+209,194,217,124,104,29,164,246,178,44,154,14,233,253,216,246,8,14,143,166,223,216,39,182,99,251,51,1,19,168,150,64,
+215,23,80,232,192,70,81,228,213,170,45,118,101,169,105,119,213,57,232,135,232,69,165,234,1,151,40,148,111,180,43,93,
+16,237,137,6,183,113,77,74,234,162,233,37,164,129,138,116,45,58,131,186,209,100,181,173,79,9,208,102,126,75,209,119,
+170,97,241,181,192,146,182,227,116,167,84,250,191,6,220,186,69,94,139,47,218,201,252,54,210,192,79,113,212,198,213,214,
+181,56,243,44,210,173,246,105,219,127,44,121,173,221,128,234,155,212,87,105,33,243,118,164,221,64,10,231,254,74,16,34,
+90,50,96,79,61,170,222,116,33,254,45,164,65,251,12,168,46,166,118,165,246,112,38,58,23,93,137,220,30,4,193,150,
+153,64,210,222,199,18,97,214,204,145,134,15,168,62,108,126,244,138,199,81,195,67,202,243,9,245,243,75,194,111,135,102,
+202,19,47,82,88,157,175,116,135,213,63,209,105,232,17,215,43,20,108,29,9,208,110,53,222,185,14,45,217,49,112,189,
+3,188,73,246,116,110,61,0,253,39,205,170,191,7,41,137,230,31,147,115,164,198,89,27,4,148,246,64,226,236,170,120,
+110,51,1,244,74,142,146,212,109,154,202,236,188,216,25,109,134,134,122,18,71,26,174,170,163,174,17,117,29,169,163,244,
+46,210,53,227,195,72,155,41,254,65,155,122,144,163,173,36,2,73,251,208,98,205,170,104,43,244,25,52,7,210,249,45,
+182,169,126,31,69,90,156,251,11,117,171,77,154,54,19,48,129,30,39,144,78,6,118,173,24,116,100,186,128,212,78,133,
+111,116,45,19,241,19,214,45,241,151,34,253,56,220,127,227,187,183,199,78,4,104,87,186,35,231,239,104,42,164,201,109,
+13,80,52,105,112,1,210,93,5,247,34,237,50,209,194,142,205,4,180,235,115,35,48,156,130,202,218,161,172,5,21,73,
+147,228,154,148,212,69,252,43,137,212,70,181,168,242,56,210,34,202,243,72,139,140,154,4,85,152,137,144,6,98,99,208,
+20,104,122,164,240,15,161,105,145,222,123,129,246,44,223,182,30,33,144,12,228,149,219,25,209,87,18,105,48,255,17,84,
+165,169,93,170,205,169,111,60,15,233,66,238,89,218,19,7,155,9,132,17,160,125,235,162,84,139,198,49,26,210,213,248,
+89,65,57,113,187,20,133,56,70,29,125,19,79,219,160,149,226,120,28,214,139,54,33,60,141,70,161,115,208,169,174,71,
+40,216,114,19,72,206,155,218,221,254,7,244,249,220,14,186,31,65,99,191,115,145,242,255,95,127,15,186,95,33,221,202,
+65,210,150,247,34,253,61,2,242,112,25,113,86,85,60,183,33,81,168,183,37,117,173,76,174,137,54,65,234,187,102,64,
+218,60,167,107,60,109,238,146,100,131,199,76,237,11,47,250,44,253,95,115,24,250,63,61,182,158,150,192,255,26,211,43,
+140,250,26,125,166,141,19,186,134,212,117,163,174,49,95,65,218,220,167,249,170,167,208,93,232,78,164,121,18,93,143,186,
+77,9,66,9,150,180,131,169,113,189,14,250,33,90,10,77,131,202,48,213,177,174,235,254,76,31,161,77,51,54,19,48,
+129,6,17,24,124,162,168,188,104,73,135,166,137,83,13,104,183,68,58,161,245,170,233,34,245,56,116,52,186,15,249,68,
+40,8,93,176,164,93,173,74,210,159,68,154,252,190,25,61,193,137,76,3,25,155,9,12,73,128,118,163,129,206,198,67,
+126,152,253,77,13,130,213,206,30,69,247,160,7,208,197,232,110,218,223,35,28,109,38,48,36,129,182,243,225,143,8,176,
+26,90,26,105,39,95,76,211,197,221,115,72,139,219,234,23,47,71,163,104,155,119,112,180,153,64,52,2,180,103,141,233,
+142,143,228,240,80,252,252,88,190,104,171,145,92,218,141,8,80,79,179,114,216,12,125,25,169,207,209,36,67,81,211,166,
+2,77,22,105,98,232,66,116,62,245,166,215,54,19,136,66,128,118,171,77,44,26,179,173,142,52,17,90,119,211,164,218,
+165,104,31,116,173,251,49,40,244,185,37,99,190,181,193,112,126,0,138,123,137,179,168,226,185,45,5,208,235,114,148,164,
+238,103,33,27,115,163,143,34,157,135,63,134,102,67,122,95,139,58,26,236,188,135,52,110,151,105,129,70,246,58,210,117,
+166,142,122,79,125,139,164,113,189,206,187,218,152,165,207,116,231,133,22,115,244,158,76,159,79,68,123,209,123,182,10,9,
+36,245,173,77,122,107,161,239,163,21,144,54,27,199,54,141,189,158,64,39,163,163,209,67,200,125,132,32,216,76,160,97,
+4,186,126,53,156,116,108,41,86,117,108,187,162,121,210,55,122,228,120,15,249,212,173,209,123,114,114,84,7,106,51,1,
+19,232,65,2,244,71,43,147,237,95,163,229,50,100,95,3,107,13,164,181,227,92,147,224,163,209,117,232,70,116,55,242,
+192,73,16,108,193,4,104,143,218,173,183,16,90,12,105,7,242,236,104,73,52,19,210,5,193,116,40,53,157,123,210,11,
+191,151,121,173,182,169,255,31,70,79,34,45,44,94,139,238,228,60,165,54,106,51,129,82,9,208,126,181,248,178,93,164,
+68,214,192,207,40,249,242,164,85,36,162,131,220,180,141,199,191,201,71,171,162,165,144,250,29,61,234,67,147,69,147,162,
+212,210,9,37,125,166,29,189,207,33,77,30,105,113,88,11,54,87,80,79,173,13,77,188,182,153,64,105,4,104,183,251,
+226,124,71,84,215,141,128,207,146,183,75,209,126,124,39,244,253,176,153,64,139,64,210,231,170,221,62,130,52,121,159,199,
+52,81,175,69,0,255,134,73,30,106,14,107,2,93,32,192,119,93,215,107,187,163,111,33,61,85,35,166,169,47,120,6,
+157,129,244,68,133,203,61,78,134,130,205,4,26,78,160,235,11,57,131,249,210,209,45,207,123,218,141,172,157,129,186,83,
+167,174,246,42,25,211,197,234,97,232,84,164,73,51,79,48,8,130,205,4,122,148,64,114,81,181,42,217,223,9,173,63,
+68,49,116,139,250,203,232,60,116,24,3,165,43,135,8,227,183,76,160,20,2,73,251,76,125,79,206,11,77,178,106,177,
+231,69,116,47,154,2,105,103,178,38,84,125,62,18,4,91,215,8,208,94,181,112,184,108,132,12,140,197,199,124,232,13,
+95,156,70,160,153,209,69,210,223,104,241,88,139,53,234,83,212,223,204,138,52,254,189,31,189,129,180,184,163,69,28,247,
+55,130,96,171,156,64,210,78,55,35,225,3,209,188,149,103,96,232,4,181,139,126,12,58,1,29,79,191,245,192,208,193,
+252,110,63,19,104,27,211,221,2,135,37,114,178,208,102,178,185,144,158,54,145,51,170,131,155,128,9,84,69,128,239,185,
+230,51,15,64,223,69,69,238,194,209,119,94,227,46,141,185,110,71,143,33,141,197,180,113,230,26,142,54,19,48,1,19,
+232,30,1,13,106,18,173,207,241,26,244,54,170,139,189,73,70,238,69,123,163,165,81,247,64,57,101,19,48,129,232,4,
+244,157,110,211,86,188,62,10,93,134,206,67,123,162,5,208,64,152,232,25,176,67,19,48,1,19,104,8,1,250,202,199,
+80,12,187,10,39,173,126,183,33,104,92,12,19,48,129,72,4,210,190,129,227,180,232,112,244,10,234,150,189,76,194,231,
+163,77,35,21,207,110,26,76,128,118,146,94,79,236,19,216,96,53,87,210,96,66,46,154,9,244,54,1,190,159,147,160,
+157,81,200,121,233,125,226,189,133,158,64,154,139,80,63,177,6,154,13,77,138,210,254,163,183,33,57,247,38,96,2,205,
+36,64,39,181,41,58,13,189,132,186,97,90,188,185,27,237,142,62,221,76,202,46,149,9,152,128,9,152,128,9,152,128,
+9,20,39,192,88,73,23,151,19,161,231,81,12,219,11,39,94,200,41,94,53,246,96,2,141,39,64,95,161,137,174,139,
+209,171,168,10,211,117,226,77,232,39,40,246,35,115,26,95,95,253,94,64,218,140,206,109,171,163,144,141,171,191,80,124,
+155,9,152,64,61,9,240,253,92,5,105,14,83,139,50,157,76,97,212,15,60,133,110,64,191,69,155,161,5,208,100,200,
+11,55,245,172,102,231,202,4,186,66,64,143,75,168,187,157,70,6,165,105,145,158,43,185,26,210,227,215,244,27,1,101,
+152,126,0,78,63,24,167,91,22,255,131,206,78,94,115,176,153,128,9,152,128,9,152,128,9,152,128,9,116,32,240,73,
+62,215,99,255,138,154,30,103,249,239,162,78,28,223,4,76,160,63,8,240,136,153,139,41,169,22,114,244,155,135,155,163,
+141,208,71,81,172,231,79,169,79,210,227,5,117,157,120,38,58,30,61,141,108,38,144,155,64,242,88,180,81,180,215,199,
+137,60,111,78,7,94,56,204,9,204,193,77,160,42,2,90,120,193,166,70,122,180,166,30,83,171,49,177,30,71,171,223,
+47,213,121,36,61,151,232,124,162,48,183,162,171,208,13,72,143,77,123,27,181,204,143,79,76,73,248,104,2,38,144,18,
+136,53,168,77,253,149,126,76,58,69,45,234,172,128,214,66,139,34,221,41,163,247,244,219,0,250,141,128,78,166,142,83,
+101,215,81,207,48,126,10,233,71,89,71,161,171,147,215,28,252,204,239,22,4,255,49,1,19,48,1,19,48,1,19,48,
+129,12,4,146,113,218,154,4,189,40,67,240,78,65,198,114,1,59,91,167,64,254,220,4,76,192,4,134,34,144,244,71,
+171,243,153,126,247,112,109,164,31,136,10,23,201,4,0,0,32,0,73,68,65,84,159,18,233,154,49,171,61,65,64,45,
+214,232,58,241,82,250,164,115,178,70,116,56,19,200,66,128,118,122,4,225,190,157,37,108,91,152,163,121,253,45,79,242,
+182,17,241,75,19,168,17,129,228,252,163,197,156,233,208,103,144,54,57,45,128,158,68,119,163,187,144,206,47,175,32,109,
+36,111,153,191,211,41,9,31,77,192,4,134,35,208,115,11,57,131,11,146,116,144,233,219,218,113,245,41,164,69,157,25,
+145,6,234,154,0,208,143,147,191,139,94,68,175,35,117,156,207,32,253,56,171,118,192,216,76,192,4,76,192,4,76,192,
+4,76,192,4,10,18,72,198,101,27,226,230,140,130,174,20,93,63,226,170,157,245,54,19,48,1,19,40,76,32,233,159,
+180,160,163,77,128,243,34,237,146,214,38,64,61,165,66,215,138,154,80,123,52,145,126,72,250,69,250,160,27,57,218,76,
+160,52,2,180,203,213,112,126,22,154,38,71,34,199,18,246,155,158,244,205,65,204,65,77,192,4,76,192,4,76,160,1,
+4,52,104,237,105,27,52,120,25,75,97,36,155,9,152,128,9,152,128,9,152,128,9,152,64,119,8,204,20,41,89,61,
+222,214,102,2,38,96,2,81,8,36,215,141,23,224,76,178,153,64,93,8,92,66,70,206,67,95,201,145,161,55,114,132,
+117,80,19,48,1,19,48,1,19,48,129,134,16,200,115,91,121,67,138,236,98,152,128,9,152,128,9,152,128,9,152,128,
+9,148,72,64,207,3,47,106,218,29,127,121,81,39,142,111,2,38,96,2,38,96,2,61,64,224,151,228,81,79,17,201,
+106,122,44,147,205,4,76,192,4,76,192,4,76,160,207,8,120,33,167,207,42,220,197,53,1,19,48,1,19,48,1,19,
+48,129,146,9,196,184,227,251,5,242,120,77,201,249,180,123,19,48,1,19,48,1,19,168,3,129,123,201,196,169,57,50,
+50,58,71,88,7,53,1,19,48,1,19,48,1,19,104,8,1,47,228,52,164,34,93,12,19,48,1,19,48,1,19,48,
+1,19,168,9,129,135,35,228,227,150,8,62,236,194,4,76,192,4,76,192,4,122,133,192,222,100,244,202,12,153,125,135,
+48,49,206,179,25,146,114,16,19,48,1,19,48,1,19,48,129,58,17,240,66,78,157,106,195,121,49,1,19,48,1,19,
+48,1,19,48,129,222,39,240,98,132,34,156,19,193,135,93,152,128,9,152,128,9,152,64,175,16,120,140,140,254,31,122,
+166,67,134,111,227,115,63,90,173,3,36,127,108,2,38,96,2,38,96,2,77,36,224,133,156,38,214,170,203,100,2,38,
+96,2,38,96,2,38,96,2,221,35,80,116,33,231,53,178,174,31,126,182,153,128,9,152,128,9,152,64,163,9,76,56,
+225,132,19,180,233,42,10,171,197,156,87,135,41,244,123,188,127,193,48,159,249,109,19,48,1,19,48,1,19,48,1,19,
+48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,232,76,224,127,255,251,223,4,232,19,232,61,20,106,126,172,90,
+103,212,14,97,2,38,96,2,38,208,64,2,156,56,117,30,253,41,122,105,136,147,232,88,222,155,25,41,76,3,75,239,
+34,153,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,84,70,128,9,166,251,80,
+168,105,55,178,205,4,76,192,4,76,192,4,250,142,0,39,206,214,34,13,199,77,208,189,40,221,24,161,227,241,125,7,
+196,5,54,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,40,135,0,147,77,23,
+161,16,123,154,72,139,149,147,43,123,53,1,19,48,1,19,48,129,122,19,224,28,152,46,228,232,56,7,58,8,221,130,
+94,70,235,212,59,247,206,157,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,64,
+207,16,96,178,105,119,20,98,167,16,169,103,202,233,140,154,128,9,152,128,9,152,64,153,4,116,78,68,211,162,101,208,
+154,101,166,101,223,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,125,68,128,
+201,166,165,209,107,40,143,189,74,224,197,80,31,145,114,81,77,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,
+192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,160,98,2,90,140,65,255,64,121,236,239,21,103,211,
+201,153,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,64,255,17,96,245,70,11,57,235,161,135,50,174,228,220,70,184,229,251,143,148,75,108,2,38,96,2,38,96,
+2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,93,34,192,226,
+204,246,232,169,14,139,57,119,243,249,214,168,75,185,116,178,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,
+96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,96,2,38,208,135,4,180,56,131,54,71,55,163,193,246,46,111,
+156,139,214,69,10,215,135,132,92,100,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,232,76,96,
+194,206,65,28,194,4,76,192,4,76,192,4,76,192,4,76,192,4,242,19,104,91,156,153,136,216,219,162,53,209,44,232,
+94,116,254,132,19,78,120,54,71,155,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,64,67,9,76,216,208,114,185,88,38,208,8,2,255,251,223,255,218,203,49,3,255,124,
+5,45,143,230,69,99,208,181,232,31,232,73,52,193,132,19,250,43,45,14,54,19,48,1,19,48,1,19,48,1,19,48,
+1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,48,1,19,40,157,128,22,114,18,109,206,241,
+50,52,148,93,205,155,223,68,165,231,199,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,36,4,180,56,131,182,65,143,162,145,108,44,31,254,200,224,
+76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,76,192,4,250,147,0,215,132,186,126,156,36,57,246,39,4,151,
+218,4,76,192,4,76,192,4,26,74,192,207,97,106,104,197,186,88,205,32,192,0,252,83,148,228,28,244,177,12,37,122,
+130,48,155,161,43,21,214,143,89,19,5,155,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,244,38,1,45,
+200,96,115,33,93,23,206,141,230,71,122,228,246,66,201,113,42,142,211,163,73,209,187,201,113,114,142,175,160,119,208,68,
+232,113,244,34,122,22,221,134,238,65,151,113,189,248,60,71,155,9,152,128,9,152,128,9,152,64,143,16,240,66,78,143,
+84,148,179,217,159,4,24,184,95,65,201,87,204,81,250,75,8,187,122,26,222,139,57,41,9,31,77,192,4,76,192,4,
+76,192,4,76,192,4,76,192,4,76,160,94,4,146,133,154,52,83,154,159,209,6,190,181,209,39,208,202,104,78,244,17,
+164,5,155,152,166,69,157,71,208,217,232,194,255,103,239,44,192,239,40,174,54,142,6,9,5,130,187,187,187,75,112,119,
+47,94,164,197,189,184,67,241,2,165,72,139,187,182,56,69,130,23,43,174,33,72,18,146,96,1,18,2,132,144,132,240,
+125,191,247,178,251,231,230,230,202,238,206,236,222,221,187,231,60,207,123,215,102,206,156,121,103,238,248,206,130,23,129,45,
+6,20,9,38,198,128,49,96,12,24,3,198,64,78,25,176,137,156,156,38,140,153,85,78,6,106,26,242,155,194,194,61,
+96,194,24,108,252,132,219,53,192,203,242,99,19,57,98,193,196,24,48,6,140,1,99,192,24,48,6,140,129,236,24,168,
+105,207,45,69,200,90,73,63,125,128,201,56,10,211,128,110,64,171,229,71,129,65,224,43,208,27,232,45,235,183,193,15,
+96,44,177,182,221,88,116,216,133,49,80,56,6,106,202,135,185,136,192,10,64,19,55,11,2,189,101,163,178,34,107,209,
+219,58,207,0,77,236,12,0,154,212,121,137,242,70,111,244,152,24,3,198,128,49,96,12,24,3,198,64,78,24,176,137,
+156,156,36,132,153,97,12,136,129,154,134,253,155,220,90,34,1,51,55,226,103,55,249,179,206,126,2,246,204,139,49,96,
+12,24,3,198,128,49,0,3,212,201,251,113,216,26,204,7,180,77,205,151,224,9,240,48,245,235,99,28,77,74,202,64,
+77,123,77,44,76,11,150,7,75,3,181,221,102,6,11,128,169,128,38,107,38,2,113,69,91,30,13,3,31,131,167,3,
+60,107,109,59,152,48,49,6,10,204,0,229,199,220,152,191,19,216,4,44,4,52,169,155,23,209,62,110,194,143,224,239,
+224,68,202,28,109,215,102,98,12,24,3,198,128,49,96,12,24,3,198,128,49,96,12,24,3,213,12,104,96,32,192,114,
+28,199,128,36,210,15,79,179,130,106,213,118,110,12,24,3,198,128,49,96,12,24,3,17,24,160,254,220,25,124,0,26,
+201,112,30,92,13,244,150,133,73,9,25,32,237,213,94,235,9,206,7,175,128,193,32,109,249,145,0,222,4,167,129,121,
+74,72,187,69,217,24,40,36,3,252,95,85,94,204,3,78,4,207,129,31,64,17,100,32,70,206,81,72,210,75,100,52,
+105,164,252,213,61,56,150,40,230,22,85,99,192,24,48,6,202,201,128,189,145,83,206,116,183,88,231,148,1,53,192,2,
+121,129,227,74,225,69,130,227,86,248,185,199,86,109,38,96,206,188,24,3,198,128,49,96,12,148,150,1,234,225,99,137,
+252,9,32,202,183,8,158,196,221,73,64,223,179,179,183,96,69,66,135,72,85,123,172,58,70,90,57,223,19,108,7,22,
+6,51,129,118,245,165,244,118,216,173,224,50,218,122,31,114,52,49,6,140,129,156,48,80,83,126,236,138,89,219,131,53,
+192,148,57,49,49,170,25,67,113,56,47,101,140,142,38,109,98,32,200,79,107,18,188,190,153,164,73,252,25,192,20,64,
+219,240,77,26,156,235,173,174,239,3,104,171,245,126,64,219,229,233,59,72,125,64,95,160,55,58,135,115,52,49,6,140,
+1,99,192,24,40,48,3,237,234,124,20,152,50,51,221,24,72,143,129,160,161,166,9,156,103,192,196,14,33,29,132,223,
+191,219,68,142,3,131,5,242,74,190,209,150,45,97,99,126,118,206,181,165,203,116,64,219,178,104,107,4,53,236,213,9,
+235,77,158,248,130,163,137,49,96,12,24,3,198,0,12,212,12,184,237,205,173,139,128,62,42,29,85,30,194,225,30,224,
+43,171,115,163,82,150,127,119,53,249,98,11,44,222,23,172,0,84,183,230,73,62,192,152,179,201,123,215,230,201,40,179,
+197,24,40,51,3,148,31,243,18,127,77,224,236,1,244,70,75,81,199,92,126,193,246,227,40,95,206,225,104,146,17,3,
+228,31,245,233,54,7,203,128,213,65,15,160,118,137,107,62,210,2,0,77,232,220,11,30,33,93,223,224,104,98,12,24,
+3,198,128,49,80,48,6,92,43,131,130,69,215,204,53,6,242,205,64,48,112,240,47,172,212,158,252,46,114,1,158,143,
+180,65,37,23,10,243,235,151,124,162,253,246,23,3,90,29,172,73,27,173,10,158,21,104,66,71,43,180,180,146,92,43,
+180,70,2,237,107,173,143,40,11,154,196,249,52,56,106,240,231,29,242,136,86,106,153,24,3,198,128,49,80,74,6,130,
+122,87,113,215,199,165,245,134,205,162,186,136,41,39,225,254,116,171,115,99,178,150,99,231,65,190,56,18,19,119,1,170,
+111,39,204,177,185,90,125,173,183,115,142,32,15,218,202,249,28,39,148,153,214,153,12,84,213,35,42,43,142,3,235,129,
+188,77,250,38,37,95,131,253,27,130,47,173,142,75,74,97,115,127,228,159,165,113,177,25,8,191,179,166,190,221,4,205,
+125,57,63,253,14,13,255,3,215,145,174,55,59,107,51,5,198,64,192,64,80,30,78,197,165,218,211,122,123,236,255,192,
+239,128,222,72,212,247,38,53,22,241,54,248,6,140,32,255,105,193,169,137,49,96,12,196,96,192,38,114,98,144,101,78,
+141,129,180,25,160,226,211,135,113,213,168,82,229,231,34,87,225,121,31,107,112,187,80,152,31,191,228,11,149,213,179,1,
+117,16,245,198,205,252,96,137,224,56,35,71,77,220,68,21,173,174,211,228,141,86,100,189,14,180,141,223,139,228,21,219,
+154,5,34,76,198,101,32,104,144,171,67,25,66,142,148,39,171,219,16,213,231,26,240,28,3,212,112,175,134,242,94,229,
+154,252,166,163,73,7,49,16,228,147,89,136,146,202,169,207,73,99,117,210,114,47,129,221,178,243,104,112,118,66,131,95,
+198,223,42,196,89,19,231,38,5,96,160,42,221,107,173,237,201,141,189,192,70,96,90,80,36,185,29,99,15,39,31,126,
+86,36,163,205,86,99,160,232,12,80,158,168,255,118,26,80,185,161,193,202,78,147,221,136,208,141,148,45,157,22,175,182,
+196,39,168,127,84,191,28,5,122,130,229,64,187,22,11,168,109,222,27,104,236,224,50,48,202,210,25,22,76,34,51,16,
+228,231,5,241,160,93,101,52,233,171,9,28,45,50,213,2,169,70,162,126,162,242,252,112,240,22,208,120,196,253,224,41,
+203,127,176,96,98,12,180,96,192,106,227,22,4,217,99,99,32,75,6,168,8,79,39,188,19,60,132,121,23,58,182,179,
+138,208,3,147,109,84,65,126,208,171,244,139,7,88,138,163,26,72,154,196,209,106,22,95,162,1,159,167,192,221,64,3,
+175,125,44,223,192,66,201,133,188,167,183,187,148,207,38,5,221,192,218,64,141,244,185,128,242,165,38,15,213,72,151,59,
+61,215,228,179,222,250,210,100,143,158,105,165,223,247,64,13,244,143,193,0,160,188,214,47,56,239,207,81,131,222,63,1,
+117,26,213,145,52,41,40,3,65,126,217,2,243,207,0,115,129,254,164,233,194,28,115,47,216,30,218,216,135,147,5,194,
+139,4,199,53,137,243,51,9,252,153,151,54,48,80,149,238,97,232,155,114,162,201,188,101,193,100,225,205,2,30,47,39,
+31,238,95,64,187,205,100,99,160,48,12,84,149,31,43,98,244,1,96,43,48,69,97,34,16,223,208,179,240,162,45,214,
+226,251,52,31,181,91,184,110,15,37,123,130,213,65,247,156,209,243,20,246,104,49,128,22,250,153,24,3,117,25,168,41,
+255,118,192,209,90,96,94,160,183,110,92,68,253,194,65,224,94,112,7,120,30,216,247,39,69,130,137,49,80,195,128,213,
+198,53,132,216,165,49,208,78,6,168,24,53,224,57,143,7,27,94,67,199,178,214,224,246,192,100,27,84,144,15,102,39,
+88,229,131,117,193,102,96,17,48,49,72,83,126,64,249,3,224,6,160,55,116,134,166,25,152,233,206,39,3,228,61,53,
+194,181,29,136,86,83,169,97,174,149,85,115,0,159,3,20,163,209,167,215,234,251,130,135,193,171,96,0,208,196,207,119,
+228,189,17,28,77,10,194,0,121,70,109,201,253,192,41,64,121,71,51,35,55,147,142,187,113,204,189,96,191,108,220,14,
+220,6,38,208,69,66,217,157,56,171,252,52,41,0,3,65,186,203,210,63,130,61,128,190,127,227,146,254,120,207,133,104,
+66,125,127,242,226,213,185,176,198,140,48,6,58,144,1,202,15,45,114,185,4,104,2,103,218,14,140,98,109,148,108,34,
+167,150,145,24,215,228,151,57,113,190,123,128,185,56,230,185,174,249,6,251,148,183,79,5,21,161,62,9,79,237,88,66,
+6,170,218,75,138,189,22,60,105,177,72,79,160,190,226,68,32,13,81,62,188,29,92,70,254,123,55,141,0,76,167,49,
+96,12,24,3,198,128,49,144,152,1,85,142,1,86,225,248,51,240,33,239,161,36,177,77,230,49,123,6,72,175,137,193,
+92,96,117,112,5,24,8,218,33,111,19,232,49,96,182,236,89,176,16,219,197,0,233,61,9,152,23,28,5,84,126,140,
+6,89,137,202,189,79,192,173,224,15,96,62,160,65,18,147,2,48,16,164,217,55,28,67,209,185,6,197,11,33,216,170,
+58,248,233,208,120,135,163,86,37,154,20,128,1,210,184,27,56,8,244,6,99,64,167,201,71,68,72,91,150,152,24,3,
+198,128,7,6,248,63,133,125,53,29,119,1,42,59,202,36,219,18,89,15,76,150,67,133,184,10,176,12,199,59,192,96,
+80,36,81,187,252,114,48,13,40,71,162,89,44,27,50,160,60,0,118,3,15,130,17,32,75,121,142,192,54,2,225,127,
+170,161,157,246,192,24,48,6,140,1,99,192,24,200,140,129,170,138,233,2,143,181,162,6,69,51,139,131,5,148,156,129,
+32,253,103,229,184,21,184,11,100,57,128,78,112,117,101,36,119,175,2,122,19,195,164,195,25,32,157,231,7,199,131,183,
+64,30,228,93,140,56,3,172,6,166,233,112,250,11,27,61,210,102,124,176,35,168,158,196,81,231,255,26,80,152,65,100,
+108,93,18,184,118,76,53,25,160,173,47,77,114,206,0,233,180,13,120,5,116,186,28,150,243,164,48,243,140,129,194,48,
+64,97,161,65,196,229,192,83,96,20,40,147,188,87,152,132,202,137,161,100,142,133,193,117,224,251,130,103,148,94,216,159,
+19,86,205,140,172,24,80,154,7,232,193,81,139,59,63,0,237,92,244,242,41,225,239,2,42,118,101,197,131,133,99,12,
+24,3,198,128,49,96,12,52,100,32,172,148,56,246,5,190,228,91,20,53,12,211,30,228,131,1,210,232,119,96,5,112,
+27,200,99,99,95,171,200,230,4,249,32,204,172,240,206,0,105,171,55,192,124,188,141,128,26,239,242,53,26,175,6,235,
+120,143,184,41,116,98,128,52,153,8,236,7,134,130,106,249,140,139,37,128,147,254,44,61,99,235,63,170,35,224,112,190,
+100,150,118,91,88,241,24,32,93,23,1,170,107,127,116,72,227,34,121,125,48,30,67,230,218,24,48,6,26,49,192,31,
+255,28,80,189,104,161,72,101,129,139,173,170,227,119,111,196,139,221,255,149,1,56,10,7,190,53,129,115,35,24,6,58,
+69,158,37,34,51,131,48,142,150,236,29,206,0,105,61,33,56,27,248,28,155,66,157,147,168,252,181,178,168,195,243,158,
+69,207,24,48,6,140,129,194,48,64,165,164,134,209,220,64,43,153,125,201,0,20,21,134,131,178,25,74,218,104,16,116,
+30,112,18,208,192,103,158,229,78,140,155,19,216,6,201,29,148,81,73,207,201,193,62,224,99,144,119,209,74,44,189,161,
+83,152,237,186,58,40,171,140,19,21,210,65,229,215,254,96,8,168,22,173,214,211,86,28,133,40,43,176,83,117,175,182,
+13,209,194,7,31,178,204,56,100,217,141,182,49,64,130,118,13,58,113,174,242,67,229,72,153,68,223,92,52,49,6,140,
+129,4,12,80,80,132,229,199,102,156,191,9,126,41,83,225,17,196,181,31,199,67,18,208,87,58,47,240,52,21,208,162,
+144,193,160,19,69,91,31,235,237,140,202,255,162,116,9,220,225,17,14,211,149,227,244,64,59,52,12,4,121,148,175,48,
+234,15,29,158,28,22,61,99,32,18,3,105,125,156,42,82,224,230,200,24,40,59,3,84,70,33,5,91,114,226,115,43,
+26,125,52,220,36,103,12,144,222,26,224,84,58,111,1,78,4,75,128,188,15,122,110,139,141,19,3,109,211,210,15,152,
+20,156,1,242,225,36,68,225,168,0,221,11,16,157,89,176,241,120,176,57,182,95,196,241,86,62,124,57,162,0,118,119,
+170,137,59,18,177,211,64,143,154,8,126,198,245,223,72,155,174,138,173,230,121,30,47,207,193,168,169,60,24,246,3,58,
+250,123,208,99,42,252,50,176,22,234,78,2,107,130,188,215,181,126,99,62,222,120,131,125,43,52,125,237,97,128,122,175,
+27,33,143,178,15,142,103,206,255,85,132,168,250,174,8,237,164,176,77,52,6,123,127,4,26,227,209,183,6,71,2,181,
+249,38,7,81,229,43,28,62,12,110,34,207,61,26,213,83,153,220,241,159,172,142,238,129,92,28,10,230,173,190,217,97,
+231,250,31,12,0,71,119,88,188,44,58,191,49,176,27,167,234,27,46,246,219,173,220,157,77,135,69,135,241,255,235,71,
+217,244,100,238,172,51,131,140,129,12,25,176,137,156,26,178,171,42,102,237,203,63,5,24,22,160,226,210,26,209,21,26,
+236,199,63,3,190,183,14,82,35,222,36,127,12,44,140,73,106,236,107,114,100,234,252,153,215,208,162,205,121,242,30,229,
+227,69,148,129,54,56,212,144,166,194,60,56,24,75,53,49,87,132,193,137,106,82,23,231,226,124,160,237,224,78,36,47,
+14,170,126,104,231,233,51,0,239,27,16,202,121,96,218,154,208,126,230,250,58,208,187,230,126,158,47,103,197,56,77,170,
+251,144,159,80,50,196,135,34,211,225,141,1,45,150,56,0,204,232,77,99,177,20,245,42,150,185,102,109,45,3,148,183,
+243,113,111,74,240,154,245,63,107,217,241,123,13,215,213,10,215,231,226,44,176,52,200,211,4,176,198,36,180,96,66,19,
+45,207,4,199,143,56,126,3,122,147,71,190,227,56,142,16,183,61,184,121,41,104,54,153,243,11,207,239,7,138,247,199,
+232,250,154,163,73,107,6,196,217,70,192,231,98,204,214,161,182,199,133,234,211,255,2,197,217,164,67,24,160,124,208,216,
+196,233,96,83,160,73,223,188,203,98,24,184,63,176,137,156,188,167,148,217,151,42,3,121,106,156,164,26,209,86,202,41,
+196,180,226,124,37,160,66,76,71,205,248,106,37,203,64,240,34,184,3,188,69,195,70,131,21,38,198,128,23,6,170,58,
+14,95,162,112,6,47,74,127,85,114,23,135,237,172,227,231,145,81,71,85,164,181,86,51,29,9,150,0,42,111,138,38,
+234,32,158,2,174,110,212,89,44,90,132,202,104,47,249,80,3,20,215,131,153,10,28,127,13,56,168,1,127,42,121,241,
+217,2,199,163,80,166,147,119,230,199,224,59,129,202,176,218,246,99,127,238,173,6,62,45,74,189,67,124,52,176,165,206,
+160,15,249,20,37,179,21,37,238,62,34,156,55,29,164,103,104,146,218,82,23,130,237,64,17,235,218,48,30,46,199,183,
+240,188,17,249,81,131,190,38,5,98,128,124,172,252,187,34,152,3,60,71,26,190,81,32,243,11,107,106,85,249,113,25,
+145,216,25,104,2,173,157,242,45,129,127,1,122,129,119,129,222,140,209,152,196,104,48,94,171,186,166,42,62,122,163,249,
+97,160,133,48,205,228,3,30,174,7,6,180,210,221,76,73,89,158,193,239,38,196,245,2,176,96,89,226,28,196,83,117,
+203,242,228,145,81,37,139,119,71,70,151,124,124,2,17,251,35,152,173,96,17,252,25,123,119,38,31,106,124,214,196,24,
+48,6,202,200,0,5,152,246,251,252,3,120,9,232,99,227,245,246,192,213,190,239,250,230,200,193,160,27,40,35,85,22,
+231,20,24,80,94,2,211,129,31,128,79,57,5,101,41,88,108,42,227,50,64,58,76,2,142,5,250,22,137,207,239,32,
+161,46,115,209,71,15,87,139,203,129,185,207,7,3,164,221,172,224,229,204,115,77,122,1,190,128,234,158,249,96,183,179,
+173,128,231,238,64,31,138,87,123,168,86,70,115,67,223,251,42,196,222,233,129,157,170,119,125,238,1,254,136,244,154,180,
+143,129,32,93,151,224,248,42,200,187,140,192,64,253,111,126,4,218,243,93,31,241,29,6,190,6,186,39,209,243,184,162,
+239,61,93,11,122,180,47,37,44,228,56,12,144,86,83,128,101,192,161,224,63,224,77,112,112,28,29,230,214,157,1,56,
+95,1,60,6,234,141,3,112,59,117,209,255,253,125,112,61,88,203,53,70,232,80,125,60,62,56,18,140,2,205,68,125,
+19,125,71,108,2,224,26,116,71,250,23,47,85,56,149,243,161,160,172,114,108,71,38,114,137,34,69,198,93,25,168,221,
+90,228,113,137,87,75,148,100,22,85,99,96,28,6,38,26,231,78,73,110,80,112,77,72,84,181,226,233,20,176,42,152,
+28,52,146,9,120,48,59,56,27,104,101,203,201,248,31,105,43,86,96,194,196,7,3,26,24,239,238,67,81,160,67,171,
+213,245,22,153,73,155,25,160,156,88,0,19,78,5,122,11,66,3,43,181,171,216,185,85,40,153,19,107,143,32,94,195,
+40,255,222,46,148,229,37,55,150,52,211,202,244,83,192,178,53,84,168,215,94,212,124,169,58,252,76,226,182,41,249,113,
+104,77,188,236,210,47,3,191,71,157,222,88,86,123,168,86,62,231,198,77,181,55,115,126,189,31,246,249,92,129,168,149,
+211,38,237,101,96,87,130,63,7,204,220,94,51,186,66,215,202,249,175,193,87,224,121,160,60,242,14,232,15,180,170,121,
+82,160,85,205,250,134,69,181,76,193,197,52,224,39,176,8,152,27,168,220,214,91,148,211,3,197,79,125,24,249,151,155,
+193,64,225,40,140,199,40,11,95,225,104,146,51,6,168,167,212,231,86,250,253,14,40,45,181,157,141,182,238,90,1,204,
+10,180,221,110,63,112,56,120,8,152,100,196,0,105,115,16,65,105,112,58,235,178,67,255,253,62,64,219,164,221,8,254,
+7,124,138,250,29,123,130,86,111,38,14,194,205,117,64,253,71,147,198,12,232,63,250,119,176,61,104,197,105,99,45,197,
+127,114,0,255,153,171,137,134,234,158,150,111,135,21,63,186,157,21,3,210,238,40,98,116,8,80,189,83,100,209,194,157,
+237,105,243,220,81,228,72,152,237,198,64,82,6,212,168,44,157,240,167,215,235,210,251,131,3,129,38,102,162,14,98,77,
+22,248,251,152,227,149,129,30,53,250,212,17,235,15,52,32,214,13,232,186,34,20,46,225,169,29,141,129,70,12,172,209,
+232,65,194,251,31,225,239,225,132,126,205,155,39,6,40,31,214,67,213,209,96,101,48,185,39,181,237,86,163,65,92,77,
+74,189,66,252,62,161,124,251,174,221,6,89,248,173,25,32,173,228,72,219,64,108,7,84,41,85,110,112,28,3,126,6,
+26,20,20,244,172,72,149,150,108,213,255,235,18,226,184,7,249,81,113,49,241,204,0,220,206,139,202,63,131,122,11,14,
+148,135,52,0,213,23,20,169,67,191,183,236,245,40,26,140,51,201,144,129,160,92,11,67,212,4,142,218,244,237,172,107,
+245,95,24,0,180,74,244,113,160,118,88,127,80,87,40,175,52,209,83,79,126,224,166,32,25,12,158,2,215,2,147,2,
+50,64,62,213,130,131,173,192,106,64,3,103,154,200,81,62,85,31,60,236,135,171,78,86,25,186,39,249,226,5,142,38,
+25,49,64,250,156,65,80,71,0,77,140,102,33,250,223,247,6,42,35,174,1,154,220,77,171,238,220,0,213,243,75,127,
+19,249,133,103,55,131,74,29,222,196,93,217,31,105,82,236,10,160,73,156,118,137,234,24,109,185,39,40,189,212,7,251,
+28,124,8,134,4,231,115,112,156,1,44,1,230,4,115,1,77,32,107,124,202,151,168,28,83,157,187,167,20,170,46,166,
+220,210,169,73,142,25,32,157,52,230,121,1,216,26,248,204,15,237,138,181,234,79,253,31,239,104,151,1,22,174,49,208,
+78,6,194,6,100,59,109,200,52,108,10,177,197,9,80,141,54,53,110,38,73,16,184,26,224,151,128,99,128,86,102,76,
+3,36,195,127,61,84,26,229,3,57,255,12,104,59,54,173,178,121,27,188,8,172,162,19,9,38,181,12,244,172,189,225,
+120,173,206,129,73,27,25,224,127,191,51,193,31,6,150,4,157,86,206,106,0,66,131,18,47,128,39,128,73,254,25,152,
+14,19,79,0,90,196,160,1,163,17,96,16,120,9,188,10,212,209,95,26,204,14,180,96,65,13,252,137,129,122,102,130,
+38,240,194,115,29,165,67,18,158,135,207,116,63,60,175,56,200,224,71,225,109,9,148,39,239,204,32,188,82,5,65,89,
+166,242,235,36,48,79,131,136,235,109,131,155,244,172,64,29,249,131,48,87,121,221,167,188,236,83,153,233,138,204,128,202,
+166,235,192,142,64,101,86,214,162,182,255,235,224,63,64,255,131,1,160,34,5,250,63,132,38,219,209,19,3,148,155,234,
+43,106,225,132,38,23,23,0,245,38,193,185,93,17,213,155,170,143,119,1,170,147,77,50,96,128,52,154,155,96,244,159,
+213,98,16,181,35,210,22,13,188,63,3,254,14,94,205,168,124,56,154,176,90,149,139,95,224,230,6,236,249,133,163,73,
+99,6,238,230,209,154,141,31,123,127,162,114,97,36,248,24,104,178,239,57,240,20,208,152,82,203,246,22,249,91,206,66,
+209,68,206,31,192,62,96,30,224,35,191,111,140,158,69,193,187,192,36,231,12,144,31,214,198,196,139,192,226,57,55,53,
+174,121,27,16,183,101,40,191,94,139,235,209,220,27,3,69,103,96,162,162,71,160,149,253,85,21,217,84,184,221,11,28,
+14,226,188,133,83,47,8,77,0,169,34,172,150,234,70,250,124,60,16,36,106,152,171,54,213,106,205,215,177,231,22,142,
+143,0,173,200,105,89,17,203,141,73,71,51,160,124,180,152,199,24,106,80,225,82,143,250,76,85,76,6,248,143,111,139,
+151,99,129,26,184,89,139,26,253,131,193,15,64,131,245,26,144,239,1,180,58,171,85,103,14,39,145,69,121,118,99,226,
+250,58,141,167,161,145,125,153,195,204,25,8,234,192,221,9,88,105,166,206,219,151,224,30,112,49,105,215,155,99,151,224,
+86,139,19,86,4,11,6,208,164,142,86,169,170,254,156,16,168,238,19,244,214,169,116,233,217,79,64,109,9,77,18,41,
+207,105,162,79,80,126,83,254,11,117,248,204,127,168,29,75,84,255,238,135,253,15,16,39,217,96,226,143,129,13,81,165,
+213,123,19,212,81,169,182,205,67,224,131,58,207,242,124,75,131,171,62,6,50,194,56,170,222,125,61,188,176,99,166,12,
+104,80,116,215,76,67,252,245,45,70,13,94,221,6,254,9,134,100,28,190,5,151,35,6,130,58,54,180,104,125,78,246,
+3,171,0,181,187,162,200,215,56,250,35,120,41,138,99,115,227,206,0,105,182,30,90,46,7,243,186,107,107,170,97,24,
+79,149,174,151,208,54,121,160,169,75,255,15,15,65,165,218,125,173,68,11,178,244,70,135,73,21,3,85,255,107,181,111,
+239,0,107,86,61,78,235,116,12,138,63,5,143,2,181,211,123,1,245,235,98,143,23,145,223,228,45,148,175,56,57,71,
+32,94,39,115,60,12,168,93,239,34,42,223,118,2,90,36,102,146,51,6,170,242,175,44,211,216,167,210,73,227,1,157,
+38,83,16,33,213,183,54,145,83,224,148,37,191,170,60,210,216,185,198,21,190,160,95,198,19,69,0,0,32,0,73,68,
+65,84,252,210,4,182,73,11,6,198,42,229,91,184,45,228,227,160,32,211,224,148,222,160,217,31,104,149,84,84,209,32,
+133,196,55,79,253,208,249,47,112,11,25,213,58,255,98,184,164,66,254,124,156,168,107,149,132,47,185,21,69,191,15,149,
+213,52,228,194,219,118,76,137,1,210,83,220,31,15,22,73,41,136,90,181,26,0,232,3,94,13,142,67,57,126,7,52,
+184,62,10,168,3,162,65,110,13,178,207,9,182,3,75,3,31,162,129,172,99,200,99,89,119,78,125,216,94,26,29,228,
+201,217,137,236,211,96,46,240,30,56,135,52,187,145,99,42,66,120,106,132,77,7,212,201,155,30,44,8,230,0,51,6,
+215,58,159,25,168,94,246,45,7,18,183,75,125,43,45,171,190,32,239,232,255,189,68,3,14,190,231,254,22,112,254,100,
+131,231,185,184,77,60,170,237,56,146,139,115,129,207,118,157,202,221,105,20,8,92,232,96,146,18,3,164,229,228,168,94,
+8,168,126,83,187,94,117,110,86,164,127,67,88,15,130,171,192,179,150,214,176,96,162,109,133,150,129,134,221,192,166,96,
+46,160,69,15,81,69,109,181,227,192,69,224,255,44,79,69,165,45,185,59,210,235,52,124,31,12,52,112,148,150,244,69,
+241,29,224,111,224,115,5,146,69,218,86,213,117,138,219,251,96,38,133,221,66,118,195,182,212,218,132,45,194,206,237,227,
+42,46,175,195,200,221,83,52,244,23,116,43,143,104,210,70,233,160,113,129,84,243,11,113,91,133,32,110,7,179,41,44,
+7,81,159,162,178,104,49,139,252,237,96,103,233,188,86,229,95,245,137,246,5,26,15,232,84,209,183,1,181,136,194,36,
+167,12,84,229,71,89,184,25,88,7,168,237,164,242,67,11,61,149,63,39,3,146,31,129,38,230,84,38,222,12,62,178,
+242,5,22,202,40,202,56,224,159,224,39,16,85,126,137,234,208,209,221,80,252,255,27,44,14,42,123,140,150,49,141,202,
+20,231,48,157,131,227,45,28,125,202,112,148,109,10,42,121,73,71,147,108,24,128,235,9,193,118,160,55,72,91,190,32,
+128,187,193,49,96,55,176,58,168,12,34,54,139,45,110,198,7,235,131,219,193,247,192,85,70,161,224,114,144,198,128,124,
+179,168,216,179,24,12,144,62,7,131,209,224,53,176,102,12,175,169,56,197,134,69,193,159,128,242,206,211,96,24,240,37,
+239,162,40,108,8,166,98,127,89,148,194,227,196,224,34,240,51,104,36,74,63,77,20,231,90,176,177,171,78,228,252,173,
+70,145,113,184,47,157,214,134,75,57,23,192,113,15,240,119,240,37,80,155,62,171,182,250,7,132,117,22,152,28,116,229,
+165,148,163,107,234,115,206,0,121,97,65,112,39,80,95,46,137,40,255,222,5,38,3,86,126,100,144,222,240,172,182,115,
+179,58,141,199,137,69,237,44,213,5,123,130,12,98,51,118,16,10,179,10,15,112,30,69,250,227,72,11,111,76,106,24,
+128,23,241,121,30,80,95,39,13,81,219,247,63,96,43,80,19,122,250,151,132,185,20,248,14,184,136,242,252,28,32,125,
+131,45,132,88,12,144,38,147,128,135,65,86,237,36,130,106,155,104,226,220,36,71,12,144,19,170,235,163,153,185,214,88,
+196,147,32,110,153,243,13,126,212,78,90,6,116,233,204,81,84,205,148,52,25,32,209,53,88,174,138,38,207,162,78,192,
+95,193,252,105,114,97,186,219,207,0,105,28,22,66,42,208,124,55,14,31,106,127,12,203,103,1,233,56,17,216,16,104,
+16,57,45,249,1,197,175,0,125,212,125,31,144,184,172,192,175,6,31,110,4,35,128,171,188,141,130,141,202,151,234,197,
+137,49,233,243,60,208,247,218,114,183,90,9,155,212,184,219,23,168,158,78,58,24,134,215,46,81,153,186,73,113,82,39,
+191,150,194,227,90,224,171,46,102,199,61,209,96,216,65,32,191,145,8,44,147,141,1,254,200,49,13,209,96,110,37,140,
+220,147,81,96,3,225,120,123,240,109,26,9,88,71,167,250,13,111,0,77,58,119,3,97,30,234,58,22,152,74,51,221,
+129,1,242,194,178,224,122,224,186,32,70,237,186,5,28,76,49,175,77,24,128,219,174,255,42,231,235,128,119,64,26,50,
+18,165,79,130,205,65,87,152,77,76,75,229,81,85,216,187,114,30,181,127,121,93,42,198,116,128,82,56,20,143,62,23,
+26,161,174,34,90,140,119,33,152,30,180,45,191,40,137,8,255,12,224,42,199,161,160,3,82,188,216,81,80,26,84,65,
+125,171,251,65,222,36,173,73,116,45,236,89,2,20,59,17,59,200,122,165,5,216,12,104,178,90,147,49,174,162,49,2,
+45,46,156,23,116,16,83,22,149,177,24,80,226,6,152,143,227,35,160,72,51,209,3,177,247,100,16,198,97,172,184,217,
+69,241,25,8,210,118,47,142,234,192,249,148,175,81,166,189,37,77,50,100,0,206,181,106,189,39,120,22,164,33,159,163,
+244,33,112,42,88,23,120,217,66,6,61,75,2,85,174,174,50,28,5,103,103,72,185,5,21,131,1,210,102,37,160,213,
+47,7,197,240,150,185,83,236,235,14,52,72,251,47,224,42,218,246,200,196,129,1,18,96,10,160,114,167,89,251,73,147,
+131,115,3,135,144,178,241,42,27,3,104,96,62,13,209,170,221,108,34,83,226,80,224,120,63,144,246,194,44,213,105,143,
+1,109,253,96,98,12,140,197,0,249,226,88,240,9,240,33,106,131,141,165,223,46,252,49,32,110,3,28,195,177,217,162,
+4,30,39,18,149,69,207,0,13,86,249,51,60,161,38,217,0,166,4,125,65,20,209,36,133,182,191,53,9,24,128,143,
+48,207,104,146,229,131,40,36,198,112,51,4,183,103,129,89,64,110,56,199,22,215,9,78,181,219,115,19,159,178,26,162,
+52,168,194,83,156,183,75,212,134,234,3,212,142,58,26,236,13,214,2,203,131,5,128,250,165,122,11,77,237,102,159,237,
+57,245,33,203,154,252,109,143,183,184,175,194,46,156,63,13,198,0,223,242,40,10,215,104,123,132,205,128,116,24,32,113,
+149,145,180,226,252,125,80,68,81,166,239,5,122,130,116,72,50,173,109,99,128,52,93,7,104,91,16,223,114,10,10,219,
+22,175,50,6,12,223,19,0,189,234,233,99,66,4,53,93,50,146,179,15,193,109,224,80,160,239,137,120,23,244,170,243,
+249,49,112,149,7,80,208,114,107,55,239,17,48,133,45,25,32,93,150,3,39,131,66,108,55,134,157,51,129,211,129,139,
+104,95,120,19,7,6,32,127,103,160,206,88,35,209,4,143,246,45,46,132,96,171,218,133,219,130,180,86,3,230,98,32,
+175,16,137,225,96,36,233,183,56,24,1,210,16,13,178,93,1,22,2,202,47,14,150,154,215,78,99,128,252,160,213,190,
+26,64,240,53,240,244,13,186,182,6,157,70,85,110,226,35,110,193,95,193,79,192,183,104,240,251,15,160,82,86,232,216,
+110,9,108,185,148,99,84,185,169,221,54,231,45,124,136,11,211,243,238,168,36,70,112,167,62,157,244,205,14,66,253,185,
+137,58,54,233,77,229,102,139,118,120,220,84,244,134,81,110,226,83,86,67,148,6,160,7,120,2,100,41,106,147,169,60,
+188,24,108,8,166,7,45,147,65,110,192,61,192,151,40,31,183,12,215,28,164,195,128,184,7,59,1,45,152,243,213,78,
+66,85,93,121,156,187,139,129,74,121,154,78,140,76,107,91,24,32,81,55,2,253,65,209,101,48,17,176,149,238,109,201,
+69,254,2,37,13,43,133,76,112,212,160,127,63,224,91,180,229,214,84,192,159,225,166,169,37,3,240,61,43,208,192,143,
+47,81,103,179,55,184,30,108,209,210,0,71,7,132,161,6,223,41,192,181,147,171,201,32,125,112,218,36,103,12,144,46,
+42,127,10,49,137,19,82,135,189,147,128,59,64,82,209,135,231,77,98,50,0,217,97,93,53,29,231,175,181,32,255,71,
+158,111,16,51,136,182,57,15,226,246,98,139,56,37,125,172,65,26,45,30,106,91,252,202,18,48,28,239,0,198,0,159,
+242,41,202,46,7,51,128,240,63,80,57,150,133,87,139,103,115,6,200,23,135,129,129,192,151,104,144,227,148,230,161,218,
+83,87,6,224,88,139,34,125,203,103,40,60,14,76,236,106,159,111,255,216,180,42,136,186,221,159,234,240,133,124,219,80,
+100,125,240,17,150,255,90,244,209,108,33,11,143,35,203,123,184,220,18,228,154,26,236,211,155,251,73,69,117,114,183,92,
+71,176,4,198,145,6,202,191,119,37,77,196,152,254,52,241,247,17,56,19,204,11,98,51,44,63,96,11,224,75,78,67,
+81,108,59,204,67,50,6,196,117,21,22,229,252,90,48,10,100,37,87,18,80,197,134,100,49,48,95,185,96,32,76,196,
+224,184,13,199,52,222,118,64,109,91,68,171,71,181,2,108,41,96,153,53,23,57,46,158,17,97,186,113,156,22,188,11,
+124,139,86,145,174,14,44,127,196,75,26,39,215,240,61,25,216,31,232,63,234,42,170,248,6,128,155,193,138,78,134,197,
+244,76,120,42,91,244,250,171,139,252,128,231,139,99,6,109,206,141,129,134,12,144,159,102,2,90,177,156,68,52,64,145,
+202,91,108,13,13,238,128,7,112,22,54,202,247,228,92,28,54,19,77,56,79,93,148,104,99,171,222,132,117,157,176,110,
+196,199,167,69,225,161,136,118,66,122,152,47,245,6,172,6,14,124,73,63,20,105,16,66,109,179,48,140,174,99,17,185,
+50,155,253,50,64,190,152,31,104,96,76,147,181,190,68,3,96,183,3,191,198,154,182,174,255,46,220,234,173,186,231,129,
+79,209,64,183,86,156,79,9,42,97,229,141,114,236,138,19,231,123,242,102,127,187,237,9,211,149,227,189,192,85,212,47,
+186,0,116,7,185,204,47,213,124,99,163,235,66,23,251,54,101,53,161,109,56,39,13,245,214,151,234,151,52,69,125,131,
+71,192,142,174,81,68,135,254,23,147,3,95,131,255,23,74,167,73,54,12,4,233,167,52,212,34,245,135,65,214,50,148,
+0,55,6,217,68,216,66,73,135,1,37,96,0,189,206,245,53,232,68,209,27,23,150,89,211,201,66,169,106,37,221,148,
+63,245,154,233,51,192,183,168,194,62,30,132,255,129,84,227,98,202,127,101,0,190,39,2,42,111,92,87,104,106,21,147,
+42,162,135,64,219,86,183,19,246,30,192,117,66,234,113,116,76,100,121,196,24,240,197,0,249,233,30,144,68,84,46,174,
+237,203,142,178,232,129,179,176,30,209,226,145,102,34,126,207,42,18,47,216,123,95,179,8,57,62,123,165,72,92,20,205,
+86,210,70,249,178,27,184,209,49,157,228,93,117,238,7,96,63,48,97,209,184,48,123,179,97,128,188,161,60,183,17,120,
+7,248,150,127,103,19,139,242,133,66,66,41,221,22,1,125,60,38,154,222,158,122,10,44,145,71,70,177,75,113,22,206,
+5,81,7,113,21,167,245,242,24,159,118,218,20,240,168,65,201,145,192,69,62,198,243,86,237,140,75,220,176,177,247,31,
+46,17,198,239,73,113,195,52,247,110,12,192,121,248,223,215,241,116,224,218,143,71,69,67,25,198,147,59,193,194,160,18,
+174,155,245,227,133,182,143,143,62,95,139,172,42,111,104,184,218,101,254,163,49,16,228,131,201,56,42,95,180,75,254,70,
+192,209,12,54,87,249,100,64,9,8,246,0,122,51,161,147,229,83,34,183,83,62,83,193,172,106,196,0,105,166,252,217,
+43,165,140,217,171,81,184,118,63,29,6,130,244,236,201,241,5,199,52,213,10,20,173,106,223,63,29,75,163,107,197,134,
+229,128,235,128,197,123,232,88,37,122,168,230,210,24,104,206,0,249,105,95,16,117,96,2,167,99,137,13,82,52,167,119,
+172,167,48,167,122,74,152,24,180,90,16,163,173,91,86,27,75,65,78,47,130,56,173,192,81,171,8,211,146,115,114,26,
+253,142,48,139,68,83,190,220,26,40,223,37,21,149,35,122,35,122,159,142,32,197,34,145,42,3,228,147,19,128,22,217,
+248,150,23,82,53,188,228,202,73,172,77,64,127,79,137,166,50,67,109,244,29,64,165,126,204,27,189,161,93,28,151,0,
+95,128,168,242,82,222,226,146,7,123,32,79,233,252,207,168,36,214,113,167,60,243,4,208,226,205,60,68,41,178,13,216,
+123,20,112,145,59,34,7,102,14,189,48,64,98,85,202,37,142,174,237,163,102,233,174,157,17,110,2,222,39,178,209,41,
+251,53,145,51,2,248,16,189,61,235,133,91,83,210,154,1,113,13,142,244,145,112,14,58,244,38,97,107,99,59,216,69,
+39,172,160,222,129,244,185,0,244,232,224,116,82,212,102,1,154,121,252,133,227,237,186,33,25,127,252,241,127,61,177,223,
+92,48,80,83,160,76,128,81,119,131,52,86,135,43,31,108,147,139,72,151,203,8,149,51,122,165,120,165,4,209,14,107,
+27,125,195,227,6,112,33,255,223,1,9,244,248,246,210,31,133,247,129,69,64,210,2,101,42,252,46,5,158,7,38,198,
+128,15,6,244,166,131,254,51,113,243,228,104,252,124,224,195,128,18,234,56,129,56,79,219,34,222,125,120,254,102,11,55,
+121,122,124,12,198,164,249,157,168,126,121,138,108,7,218,50,57,113,218,15,76,145,48,110,239,224,239,6,234,218,243,18,
+250,55,111,29,206,64,77,187,253,111,68,87,11,108,124,191,177,245,22,58,119,238,112,42,51,141,94,77,186,237,70,224,
+231,131,233,61,24,241,165,116,81,102,72,95,17,68,245,246,140,17,13,85,223,241,242,136,110,203,232,44,233,246,214,63,
+67,214,197,224,200,130,146,246,186,163,221,81,243,159,99,48,230,189,134,129,73,184,62,23,36,109,31,213,168,235,186,28,
+198,217,157,224,12,240,73,215,93,255,39,234,227,253,0,38,245,160,122,98,15,58,76,69,116,6,52,135,176,101,116,231,
+169,184,12,199,173,194,241,181,84,2,49,165,30,25,80,195,173,10,122,245,125,48,40,147,104,118,124,103,80,225,193,35,
+181,166,202,3,3,97,186,4,199,107,57,166,37,90,193,224,193,98,83,17,135,1,56,63,30,36,125,251,79,111,225,220,
+6,150,6,19,130,56,65,167,234,22,91,86,6,90,77,150,84,180,90,250,210,84,141,52,229,165,98,128,252,52,13,208,
+22,32,113,69,126,124,12,230,148,134,111,248,82,123,66,123,255,71,217,46,82,147,208,133,16,226,163,178,118,56,72,83,
+150,44,4,25,5,52,146,68,83,190,92,5,196,125,27,71,91,168,105,53,253,129,96,130,2,70,221,76,206,144,1,242,
+136,242,153,222,70,76,235,237,121,149,171,26,112,48,241,200,64,144,110,74,187,61,64,210,118,57,94,187,68,91,252,220,
+13,166,5,30,45,77,71,149,108,4,42,31,227,188,113,218,63,29,107,138,175,21,30,181,109,84,28,46,113,94,17,109,
+197,118,81,145,25,192,254,89,128,203,150,114,175,22,57,254,69,180,157,244,210,255,255,98,224,83,212,127,210,182,214,11,
+167,205,9,97,200,126,225,43,224,67,238,71,73,218,102,155,254,128,1,184,94,207,71,162,57,234,80,121,93,234,52,41,
+242,27,57,107,146,114,255,0,101,27,176,153,134,56,95,8,70,1,205,150,155,228,147,1,13,118,253,62,69,211,180,98,
+204,36,67,6,168,44,180,181,161,210,116,234,4,193,190,135,31,173,212,122,6,140,96,165,159,86,197,229,73,134,99,204,
+0,48,103,66,163,186,227,111,129,132,126,205,155,49,208,136,129,36,45,52,173,140,76,226,175,145,13,101,185,127,40,17,
+157,45,66,100,139,212,97,63,141,248,76,30,33,78,73,157,252,136,199,207,147,122,54,127,145,24,216,5,87,170,95,162,
+136,254,251,239,130,115,169,99,111,137,226,193,220,24,3,48,48,63,248,39,232,9,124,203,215,40,60,128,252,168,54,160,
+137,127,6,14,64,229,153,64,111,133,187,72,111,60,171,141,254,144,139,146,54,248,61,153,48,39,139,17,174,198,77,76,
+234,51,48,51,183,227,112,41,45,26,139,81,26,156,173,139,2,203,16,108,159,192,193,254,41,29,252,154,215,100,12,168,
+109,180,111,50,175,117,125,189,207,93,229,227,235,235,62,245,124,147,58,177,50,145,131,90,95,111,19,169,253,103,146,29,
+3,139,101,23,84,195,144,242,54,150,214,208,208,180,30,20,117,34,71,149,237,53,96,246,180,136,201,185,94,77,94,105,
+50,231,27,240,68,206,109,45,163,121,39,16,105,13,248,251,222,154,161,154,203,161,213,23,118,158,46,3,76,226,204,77,
+8,219,3,77,86,196,217,234,73,141,124,13,40,105,251,199,247,105,184,228,181,161,241,45,246,253,15,204,9,146,136,56,
+41,106,125,146,36,190,230,39,125,6,190,35,8,253,127,226,190,46,223,143,255,153,6,207,76,226,49,240,167,8,206,85,
+78,60,30,193,93,91,157,4,43,180,150,195,136,53,83,54,100,32,250,7,167,28,70,153,213,207,71,228,55,3,81,234,
+92,181,135,247,4,247,131,202,0,129,6,10,76,140,129,70,12,4,229,196,60,60,191,11,120,255,6,0,58,181,61,205,
+17,228,195,251,56,154,120,96,32,72,51,105,82,255,74,139,15,52,136,254,59,144,84,52,128,125,17,105,116,122,82,5,
+109,244,183,15,97,175,29,35,124,149,145,218,254,203,164,62,3,83,115,251,255,64,212,138,67,110,53,22,85,244,73,28,
+162,48,158,6,68,21,159,164,18,149,179,164,250,205,31,12,84,149,127,90,124,240,23,48,169,7,98,190,64,135,202,133,
+11,128,182,166,206,68,170,226,50,130,0,125,196,99,76,38,134,91,32,33,3,211,133,39,109,60,106,226,125,54,48,168,
+141,54,180,53,232,34,14,188,169,209,173,55,81,116,44,179,204,74,228,47,160,32,220,131,227,155,33,17,214,113,13,153,
+104,219,241,124,66,62,24,164,57,137,163,200,125,175,31,147,204,24,216,140,144,150,7,81,202,204,176,35,48,0,247,167,
+130,135,193,103,57,255,111,234,141,28,173,198,113,145,169,40,143,166,36,158,26,128,55,49,6,92,25,80,35,49,73,227,
+254,19,215,128,75,232,255,104,226,172,5,50,173,228,35,254,223,239,180,114,148,147,231,71,96,135,203,0,95,148,104,168,
+3,108,146,30,3,26,168,156,37,130,122,213,185,87,145,55,43,147,56,17,220,155,19,99,64,12,172,3,244,134,194,188,
+186,240,44,63,160,239,68,242,228,13,158,245,154,186,95,223,208,211,155,56,39,130,41,18,18,162,129,235,231,192,254,5,
+170,211,170,7,114,213,199,60,4,68,233,147,224,172,34,255,38,174,122,139,212,164,62,3,90,36,27,103,66,226,81,220,
+239,87,95,85,225,238,234,173,87,253,39,146,138,6,227,77,178,97,64,245,213,109,192,117,49,187,234,168,7,192,126,148,
+11,90,164,213,46,81,89,230,67,50,155,132,242,97,108,7,232,112,153,248,245,21,253,9,80,228,43,255,248,178,41,83,
+61,34,160,104,114,45,6,47,83,52,163,83,178,119,41,244,254,53,37,221,166,54,2,3,90,81,80,133,35,241,178,63,
+152,56,130,87,87,39,111,187,42,48,255,209,24,32,125,213,192,93,29,204,20,205,71,165,35,160,198,209,118,224,54,26,
+72,121,159,196,81,180,212,8,255,84,39,14,162,14,117,148,65,55,135,32,204,107,137,24,208,196,66,146,6,218,75,37,
+226,200,87,84,15,140,168,232,178,136,238,218,237,108,14,12,216,32,3,35,122,101,16,70,41,131,160,222,213,234,232,181,
+64,117,63,69,29,199,122,157,71,173,196,236,7,76,140,129,150,12,4,109,118,229,173,107,128,6,197,124,139,22,179,252,
+153,182,223,37,190,21,155,190,74,121,176,51,60,28,3,146,78,226,124,134,223,195,72,159,53,192,59,5,229,244,80,236,
+94,52,134,237,26,168,189,52,134,251,50,58,141,179,173,154,22,113,108,222,65,36,45,68,92,38,113,136,143,77,228,56,
+144,23,197,171,234,45,68,237,162,227,192,82,186,72,40,63,225,79,109,215,141,41,255,118,2,42,27,218,37,154,60,77,
+90,142,215,218,108,121,176,150,145,116,175,243,176,144,173,47,81,116,29,187,74,151,165,148,181,87,119,144,82,14,42,153,
+250,160,193,29,14,150,223,140,22,13,168,230,73,52,3,60,28,168,225,174,206,100,214,210,147,0,173,113,150,53,235,227,
+134,167,213,97,167,129,56,13,193,113,181,68,191,243,67,116,167,230,210,145,1,109,167,54,15,136,50,168,172,116,185,28,
+28,77,227,232,127,160,40,171,223,84,118,169,28,115,17,213,39,185,175,83,92,34,104,126,51,101,160,103,130,208,212,65,
+121,48,129,191,82,122,9,218,87,90,213,171,55,124,91,137,190,5,115,107,43,71,57,121,254,71,236,232,145,129,45,175,
+101,16,70,89,131,80,219,186,122,219,58,93,235,237,243,122,171,134,71,114,191,55,48,49,6,162,48,176,62,142,212,159,
+212,132,175,111,209,182,199,39,209,246,83,59,208,196,35,3,193,64,166,234,170,63,129,36,229,187,218,227,127,3,75,145,
+62,58,22,74,130,248,135,54,31,20,158,68,60,62,69,156,187,118,239,136,232,167,108,206,180,64,178,94,253,82,203,131,
+70,212,47,128,207,81,96,188,16,181,142,10,118,189,184,163,189,67,28,253,155,247,104,12,108,133,179,237,65,146,190,182,
+250,249,79,130,45,201,179,235,129,103,57,111,183,248,28,55,248,170,221,145,41,89,248,255,34,190,106,123,183,83,244,73,
+128,159,219,105,64,187,195,78,82,16,180,203,230,179,9,120,7,16,231,181,215,180,108,85,99,80,133,225,46,64,51,201,
+194,84,64,43,136,55,6,39,3,53,152,178,200,224,74,67,217,177,13,48,105,15,3,26,52,58,19,100,53,137,163,88,
+126,169,31,147,76,24,152,135,80,244,255,110,37,239,226,224,52,112,54,13,164,247,90,57,206,217,115,117,94,52,8,238,
+34,42,239,190,113,81,96,126,141,129,42,6,214,169,58,143,122,58,16,135,54,88,17,149,173,95,221,29,200,33,74,187,
+234,9,202,53,215,50,34,158,101,17,93,215,44,248,153,24,111,123,71,244,234,226,76,139,119,254,227,162,192,252,54,102,
+128,188,166,133,5,231,1,173,158,87,221,114,11,208,100,98,189,5,21,195,184,255,33,48,49,6,198,97,160,166,124,216,
+4,7,215,0,245,215,124,139,218,63,218,166,230,98,223,138,77,95,23,3,74,191,197,186,174,162,159,104,210,125,7,210,
+230,16,80,244,1,191,163,136,203,156,209,163,94,217,138,251,140,24,238,203,234,244,253,136,17,87,254,57,63,162,219,162,
+56,211,130,69,23,177,133,20,46,236,69,243,59,3,206,180,240,74,99,142,113,165,15,30,14,160,236,91,27,60,18,215,
+115,26,238,177,67,106,23,244,168,123,128,71,93,166,170,53,3,106,143,183,179,191,253,127,132,255,112,107,51,59,219,69,
+156,189,85,219,201,196,158,4,174,193,134,122,29,184,44,237,210,74,43,109,153,164,6,209,7,117,2,86,229,174,142,189,
+160,1,221,185,129,94,129,220,10,76,11,210,146,41,81,124,44,120,10,216,64,42,36,100,40,219,17,150,38,25,163,12,
+244,251,52,235,83,159,202,76,87,83,6,148,182,221,154,184,80,185,112,31,184,3,60,67,227,164,136,111,75,77,128,237,
+147,3,23,81,171,76,122,76,140,1,31,12,44,154,64,201,131,252,255,70,37,240,87,86,47,135,19,241,121,35,68,94,
+139,87,46,141,224,46,15,78,206,197,8,117,120,211,150,1,228,53,117,36,76,82,98,0,126,159,102,16,126,89,212,207,
+4,250,131,87,64,61,249,132,155,154,204,49,49,6,154,49,176,22,15,47,7,122,171,195,183,104,155,145,253,193,221,190,
+21,155,190,46,6,52,73,191,33,208,49,170,168,95,174,137,187,99,40,79,162,250,201,187,187,253,98,26,248,36,238,95,
+141,233,167,140,206,181,197,148,22,171,180,234,11,253,183,3,201,89,217,49,78,81,39,193,28,131,41,181,247,61,136,253,
+34,49,25,24,137,251,179,192,105,57,109,175,38,233,231,213,163,64,109,113,181,3,77,178,101,224,72,130,187,23,244,200,
+54,216,74,104,207,240,123,125,27,194,181,32,227,48,64,39,110,77,240,37,104,167,252,64,224,119,128,185,227,216,46,183,
+248,17,102,7,55,128,239,64,154,114,85,92,251,204,125,60,6,72,188,48,77,117,220,14,180,43,111,174,36,91,76,210,
+103,0,158,119,0,253,65,61,233,203,205,147,193,92,233,91,146,94,8,216,223,29,28,4,92,228,67,60,187,174,234,74,
+47,146,166,185,48,12,144,143,230,2,163,98,102,70,213,211,43,20,38,146,57,48,20,190,222,140,200,113,163,1,244,28,
+196,162,171,157,165,58,121,58,48,40,98,156,92,157,157,147,139,200,151,196,8,18,107,85,240,125,157,68,251,133,123,255,
+4,37,97,194,162,25,151,1,229,13,176,26,104,212,142,227,145,147,12,192,247,90,64,225,196,53,207,220,71,100,0,110,
+85,190,191,14,162,200,72,28,221,3,22,2,29,145,46,65,60,142,226,168,50,47,170,168,93,180,24,136,200,114,121,157,
+137,35,240,5,104,38,99,120,248,123,208,81,68,17,159,161,205,34,29,225,153,203,55,91,58,138,203,52,34,3,255,243,
+131,143,35,164,67,181,147,79,185,88,18,228,182,252,195,182,43,171,13,118,60,183,114,46,141,204,215,64,103,152,175,56,
+106,236,232,27,199,180,139,235,125,56,30,214,5,185,205,219,13,104,243,126,59,119,171,167,195,68,9,142,90,117,163,213,
+83,89,172,174,108,68,238,75,60,216,2,108,15,250,53,114,212,226,190,182,123,217,13,104,37,209,235,45,220,186,60,222,
+6,222,42,3,252,33,143,46,202,204,111,83,6,54,226,233,197,160,29,121,83,43,44,94,108,106,157,61,244,201,64,111,
+148,245,5,191,212,40,253,152,107,173,254,62,159,149,46,253,107,158,21,237,82,111,103,38,121,93,187,58,158,202,151,218,
+110,200,196,24,112,101,224,247,40,136,179,234,86,225,233,127,106,171,78,197,68,11,9,218,7,127,194,217,98,45,156,134,
+143,47,9,79,114,126,60,12,251,210,88,109,95,27,109,141,226,60,89,123,211,174,211,97,64,249,21,89,21,76,86,39,
+4,213,203,185,158,104,172,99,179,221,202,150,1,173,250,189,6,204,153,66,176,106,27,106,123,107,43,15,82,32,183,70,
+165,222,150,248,180,230,94,189,75,181,3,246,164,93,174,111,65,188,15,42,223,49,169,231,176,128,247,118,195,230,56,175,
+22,61,141,251,119,10,24,207,118,153,60,160,69,192,29,183,165,42,245,235,166,196,121,170,22,241,110,246,88,219,160,14,
+106,230,192,158,37,103,32,104,255,168,142,137,83,127,169,94,218,9,188,153,60,228,76,124,250,106,175,255,130,181,54,254,
+144,73,146,141,19,136,250,135,42,67,6,143,243,36,189,27,15,80,175,247,234,176,186,61,61,182,178,212,28,12,48,84,
+102,216,56,191,13,180,75,6,19,176,6,105,189,10,58,21,183,43,192,79,32,13,209,10,164,144,63,175,182,155,178,174,
+149,191,61,225,88,43,29,218,37,63,19,240,100,192,146,36,3,6,224,185,27,216,7,60,15,134,0,173,10,238,3,14,
+3,185,155,12,79,66,9,241,152,30,156,7,92,228,5,60,199,233,96,38,49,213,252,116,56,3,228,33,213,95,47,197,
+204,136,90,161,186,111,135,83,227,45,122,1,199,250,191,70,145,220,119,208,137,68,216,230,249,40,74,132,60,184,249,222,
+91,98,152,162,150,12,4,233,123,95,131,116,211,74,226,101,229,198,196,24,168,102,32,200,55,243,113,124,31,164,33,111,
+161,116,190,234,48,237,60,61,6,224,90,229,252,33,160,222,219,186,218,241,226,9,176,47,80,155,61,61,67,218,164,153,
+56,29,0,226,188,141,35,158,86,23,23,130,73,115,6,2,158,206,231,216,140,227,222,60,159,164,147,248,36,46,143,3,
+23,121,17,207,205,201,181,167,137,25,128,219,153,128,198,28,162,138,198,47,183,76,28,96,134,30,177,243,237,168,145,106,
+225,238,139,12,205,182,160,234,48,64,250,156,220,34,141,124,61,126,3,69,62,191,173,84,39,54,118,43,49,3,36,78,
+216,33,63,139,115,189,194,154,181,104,144,252,81,176,4,72,28,143,70,30,165,51,192,158,28,53,40,236,91,196,217,222,
+192,26,110,141,18,193,225,62,188,170,81,60,16,180,83,180,157,155,165,175,67,58,198,245,10,223,147,131,245,193,233,224,
+34,176,57,208,91,44,29,33,196,101,86,112,61,112,17,237,87,106,98,12,56,49,64,6,156,23,140,136,153,17,213,201,
+209,183,226,76,34,48,0,87,91,0,181,117,162,136,222,138,206,181,16,9,213,135,106,83,101,37,207,231,154,144,14,50,
+142,4,85,218,78,3,26,109,153,167,255,190,158,119,80,172,45,42,62,24,32,79,104,18,231,57,144,134,104,177,193,226,
+62,236,52,29,209,24,128,111,149,5,61,128,22,85,133,227,3,163,57,127,10,172,6,38,2,114,83,65,52,173,197,113,
+69,188,94,1,113,68,121,191,35,185,72,35,213,2,174,182,228,56,178,9,201,31,243,76,91,81,167,97,66,230,58,137,
+199,210,64,219,20,185,200,213,120,206,220,246,178,4,8,183,155,2,109,145,24,69,52,161,189,23,40,4,61,216,249,109,
+148,72,69,112,83,239,187,229,133,224,160,83,140,36,141,148,79,155,77,130,71,72,198,150,78,180,133,91,199,109,109,217,
+41,121,160,18,15,18,72,141,142,13,128,175,63,55,170,34,139,86,246,157,3,82,107,8,86,235,230,124,71,160,66,215,
+183,104,245,153,53,222,60,252,51,66,30,131,163,58,10,125,65,187,197,210,215,67,218,154,138,223,24,32,67,107,31,241,
+184,157,196,234,255,129,42,239,199,127,211,104,103,198,64,50,6,200,71,170,131,227,136,38,36,254,146,44,180,114,250,130,
+175,255,70,36,120,24,238,114,63,88,137,141,106,239,184,148,95,17,233,232,114,118,108,57,115,78,246,177,14,210,118,51,
+142,245,38,119,85,239,92,7,38,144,59,19,99,160,154,1,242,196,131,32,13,81,249,57,105,117,88,118,158,62,3,112,
+30,246,205,231,224,252,175,224,126,176,31,232,26,88,231,92,110,102,78,223,154,108,66,8,226,163,56,105,144,44,234,226,
+11,156,86,68,111,47,85,56,203,198,218,226,135,2,95,51,131,254,21,246,234,255,232,123,88,122,67,162,248,145,37,6,
+196,227,246,250,209,140,117,87,245,115,71,240,145,199,72,192,237,9,64,19,214,173,228,71,28,156,6,42,19,218,121,140,
+75,181,77,216,185,0,136,18,47,156,181,148,255,86,235,182,243,236,25,32,133,84,158,68,221,233,161,101,130,214,113,160,
+9,231,163,128,213,105,217,39,111,244,16,73,160,233,193,123,32,75,81,103,240,117,176,110,116,75,253,184,36,204,67,129,
+10,95,223,114,56,10,253,24,89,98,45,226,48,128,86,137,127,8,242,32,175,98,68,137,83,197,162,238,155,1,242,147,
+222,64,212,74,179,164,162,65,182,235,124,219,101,250,242,203,0,233,61,25,152,50,56,106,171,9,109,103,18,247,187,54,
+99,69,48,208,21,119,219,202,129,248,155,118,44,69,118,49,14,3,112,20,214,101,107,112,94,111,80,156,219,227,136,246,
+215,207,189,96,245,202,224,167,113,172,79,231,134,58,158,246,90,127,70,185,2,174,149,111,47,7,106,167,215,138,210,98,
+111,96,29,187,140,210,163,8,193,4,249,65,171,196,199,0,159,162,60,120,11,176,183,63,139,144,17,10,110,35,249,44,
+172,179,117,236,5,226,200,32,28,171,77,86,112,22,178,53,31,190,198,7,143,128,70,162,197,183,75,130,108,13,75,33,
+52,226,48,31,208,10,119,23,249,28,207,83,131,20,44,52,149,98,0,110,239,3,106,235,104,171,68,161,158,232,185,234,
+188,202,164,54,199,220,147,135,141,218,178,222,151,92,144,251,8,119,184,129,36,164,242,234,31,128,239,118,151,242,136,250,
+119,103,131,174,58,177,195,233,140,28,189,60,110,13,116,3,214,47,28,57,6,238,14,245,129,238,59,248,96,146,62,32,
+216,14,185,136,64,103,0,199,0,159,223,151,216,3,125,55,131,47,129,137,27,3,250,80,234,173,96,62,55,53,222,124,
+191,239,77,147,41,50,6,126,101,96,18,14,46,171,24,85,142,126,101,100,118,30,3,52,156,244,29,168,89,128,38,75,
+166,1,106,55,204,1,84,30,246,0,223,130,31,129,62,54,169,21,163,3,56,14,2,250,48,177,242,196,80,234,87,185,
+137,34,123,225,40,110,62,188,28,253,223,68,81,94,86,55,106,252,86,137,218,26,81,86,147,143,193,157,218,39,69,144,
+61,49,82,101,88,22,50,144,252,214,39,139,128,44,140,10,3,42,99,86,2,245,218,199,250,223,255,87,174,72,19,29,
+76,140,1,49,160,242,224,247,64,117,151,47,81,253,118,15,249,76,122,77,140,129,44,25,88,128,192,150,141,25,224,35,
+228,213,81,49,253,152,115,198,205,33,161,23,88,23,212,43,63,38,226,254,244,160,19,228,48,34,161,54,189,139,60,128,
+231,168,237,123,151,112,74,233,151,182,251,172,68,124,73,240,9,208,2,130,122,121,79,121,86,59,98,252,25,12,7,69,
+105,15,109,40,91,61,201,107,158,244,152,26,55,6,174,193,251,1,96,25,55,53,99,249,30,193,213,217,212,103,167,141,
+117,215,46,42,12,168,66,106,171,212,12,48,28,132,49,170,60,179,18,13,56,29,75,230,184,37,171,0,27,132,115,28,
+247,87,5,107,52,120,158,228,246,226,120,218,2,252,51,137,103,243,211,197,192,20,156,93,6,196,103,94,100,88,94,12,
+49,59,58,134,129,110,196,100,50,135,216,104,32,127,160,131,127,243,154,35,6,168,151,85,238,205,3,230,5,139,1,13,
+164,234,45,4,93,71,145,209,56,82,57,245,54,248,24,125,47,115,212,164,142,58,35,131,168,115,7,115,28,75,112,163,
+14,202,225,32,206,136,236,32,220,95,57,150,34,187,104,198,128,22,201,172,220,204,65,213,179,126,164,211,221,85,215,185,
+59,13,218,143,154,148,218,54,67,227,254,157,97,88,22,212,120,227,45,10,9,243,55,32,66,229,201,71,13,158,217,237,
+146,48,16,148,3,97,108,87,224,228,44,16,101,178,58,244,211,234,168,73,237,11,40,15,143,110,229,208,158,27,3,41,
+48,176,51,58,167,142,161,87,139,104,206,140,225,222,156,142,205,192,139,92,106,240,176,251,216,183,43,87,234,43,205,82,
+231,126,161,110,81,102,206,128,193,59,57,26,173,137,194,219,28,117,152,247,6,12,4,245,218,1,60,214,36,133,250,95,
+211,53,112,250,46,247,15,165,126,210,194,150,34,201,82,158,140,85,253,252,168,39,93,166,198,157,129,35,81,113,23,112,
+157,36,150,37,202,211,39,128,43,116,97,50,46,3,109,159,200,169,50,73,157,53,37,86,22,54,105,246,250,49,176,61,
+5,95,94,6,197,247,198,158,87,128,102,220,125,201,31,81,100,19,57,110,108,222,131,119,159,19,108,110,214,252,234,251,
+43,31,74,76,135,49,32,6,104,44,170,179,178,156,35,27,67,241,175,242,203,164,192,12,144,23,244,214,205,90,96,109,
+160,1,177,165,193,4,32,174,104,139,53,117,58,164,75,80,253,166,198,182,58,28,31,16,206,243,28,85,142,233,250,61,
+234,225,145,28,15,6,115,129,168,162,21,210,87,225,215,202,195,168,140,209,217,195,105,212,1,161,118,47,112,137,26,171,
+83,113,216,35,170,99,71,119,202,195,15,56,234,48,239,17,25,8,6,50,54,194,121,189,69,6,250,255,171,243,254,115,
+68,117,230,172,243,25,152,133,40,94,3,102,244,24,85,45,74,184,158,122,198,38,113,60,146,106,170,98,49,176,99,44,
+215,227,141,247,50,238,251,198,244,99,206,127,99,224,125,78,63,7,243,253,118,171,235,108,124,206,230,238,186,42,238,201,
+223,49,221,181,221,244,30,58,30,47,46,5,185,183,124,69,44,84,251,70,147,110,11,1,229,189,90,249,146,27,71,0,
+229,217,37,179,15,201,0,0,32,0,73,68,65,84,194,8,109,59,213,213,51,123,50,88,187,62,88,63,208,19,153,30,
+212,60,137,142,11,192,73,96,18,7,125,42,95,14,1,189,28,116,116,188,215,44,38,77,234,146,24,116,208,194,103,42,
+156,212,248,86,97,149,182,124,75,0,23,242,167,63,45,237,128,98,234,255,16,247,55,130,3,98,250,107,230,124,97,120,
+94,10,7,111,200,17,113,110,230,214,158,193,64,77,190,252,27,183,52,160,153,55,177,6,122,222,82,164,216,246,204,132,
+249,171,58,70,225,107,252,171,210,53,41,32,3,148,123,106,80,175,9,182,7,42,243,166,2,190,101,66,20,46,17,96,
+91,142,63,129,222,224,109,194,87,153,166,133,7,113,42,169,15,112,127,41,48,137,198,64,119,156,109,26,205,105,101,21,
+212,149,17,221,182,211,153,38,25,183,200,208,128,79,105,71,61,149,97,120,101,15,74,19,56,155,1,165,115,173,140,224,
+134,13,34,213,178,82,238,235,19,137,254,162,30,41,208,196,173,250,139,54,137,227,145,84,83,21,139,129,117,113,61,119,
+44,31,227,141,247,96,76,247,230,60,96,64,227,36,180,71,181,10,252,85,160,55,208,107,219,164,170,139,230,2,133,21,
+226,183,43,198,111,238,33,2,26,35,169,136,141,47,133,76,120,61,42,255,105,2,71,19,58,181,249,80,1,13,7,167,
+0,45,104,41,154,168,221,94,111,129,78,146,120,188,150,196,147,249,241,203,64,77,25,240,23,202,25,189,189,168,5,154,
+113,39,140,191,199,143,22,18,158,11,108,188,19,18,114,41,36,112,215,7,139,56,63,19,100,33,250,72,124,207,60,17,
+130,61,213,60,76,202,117,220,15,61,183,226,237,180,234,48,242,20,247,60,218,82,197,213,69,156,235,123,15,121,148,117,
+49,42,143,244,153,77,5,100,128,188,164,15,133,15,112,204,232,119,88,158,44,96,226,99,50,233,182,20,184,17,12,6,
+69,145,31,49,116,231,98,50,158,189,213,112,165,116,222,63,70,226,62,146,189,149,241,67,36,62,219,196,136,147,15,167,
+90,197,106,146,17,3,36,216,154,64,31,151,174,39,111,112,115,90,144,145,53,22,76,94,25,80,30,0,135,3,125,240,
+217,151,84,62,30,157,215,56,155,93,157,207,0,25,89,249,250,214,152,25,122,8,238,123,200,175,73,50,6,196,29,248,
+35,104,52,6,240,68,81,249,197,238,217,128,222,138,119,149,151,80,48,49,16,87,201,136,54,95,13,25,128,211,213,192,
+5,96,36,168,39,170,159,46,7,221,64,67,61,121,125,128,205,143,1,95,162,183,63,76,114,198,0,137,171,178,97,59,
+240,95,16,165,109,54,20,119,119,130,45,64,206,98,99,230,116,49,160,196,169,193,154,92,127,11,210,148,159,80,174,198,
+80,22,111,252,116,197,53,201,9,54,30,239,153,8,125,159,160,139,243,36,54,149,201,79,192,213,1,28,135,123,78,7,
+95,234,70,161,200,6,47,202,148,41,83,142,43,249,105,107,208,168,195,18,37,223,254,128,35,107,72,165,156,78,105,168,
+39,221,54,7,47,131,40,141,44,156,229,70,174,198,18,109,223,102,18,129,1,184,82,27,224,245,136,169,167,188,144,229,
+91,46,17,98,80,223,9,118,62,22,49,78,62,156,169,67,221,179,190,37,118,55,13,6,224,251,239,224,151,58,137,55,
+134,123,23,167,17,166,233,44,30,3,228,133,185,129,239,69,112,218,37,194,196,24,104,27,3,228,233,9,192,231,32,142,
+60,132,227,74,159,191,109,134,23,60,224,128,63,237,104,242,101,3,226,223,225,126,220,85,230,185,96,5,187,239,110,16,
+167,56,183,53,14,177,75,46,34,212,129,70,192,173,254,247,199,128,239,65,61,81,155,232,81,48,61,40,220,127,29,155,
+53,134,165,65,123,95,226,227,237,178,14,204,73,237,141,18,137,219,53,246,204,185,38,38,111,1,125,64,117,190,30,200,
+245,3,224,160,246,90,107,161,71,102,128,196,170,78,216,201,185,254,31,72,83,250,161,92,43,43,10,81,216,97,231,100,
+160,81,227,129,71,177,69,29,222,141,65,33,226,31,57,35,165,228,16,158,52,176,57,12,248,150,122,131,17,73,194,144,
+158,169,65,74,12,152,218,50,49,64,62,154,6,156,1,92,228,35,60,219,219,17,5,203,56,164,153,86,189,244,117,73,
+248,54,249,125,159,112,125,124,68,177,96,41,150,220,92,248,90,26,84,55,158,155,37,93,238,95,101,199,120,181,103,230,
+1,90,125,156,149,188,157,60,5,204,103,28,6,72,80,165,175,6,41,222,110,144,184,122,75,167,103,28,157,230,182,115,
+25,32,47,220,212,32,159,36,185,173,62,147,6,28,58,151,48,139,89,33,24,32,15,238,150,32,3,239,165,188,107,249,
+55,121,18,7,252,105,48,93,43,201,235,137,198,104,230,72,30,66,123,124,98,243,97,160,209,27,30,245,226,217,232,222,
+147,60,104,79,36,58,56,84,113,26,96,67,142,131,64,35,209,27,85,75,23,149,10,108,63,164,81,196,18,220,215,66,
+82,109,15,111,146,115,6,72,167,48,127,207,198,249,202,96,121,160,73,61,171,175,28,210,174,109,223,200,9,108,254,51,
+199,229,29,236,111,230,117,20,15,245,129,164,227,192,155,205,28,230,236,153,246,253,214,126,151,190,86,59,104,63,215,223,
+131,135,128,73,19,6,84,168,240,248,10,48,101,19,103,73,30,169,197,51,20,248,24,124,212,158,168,130,137,49,224,131,
+1,237,193,187,150,163,162,65,248,127,193,81,135,121,207,144,1,202,186,141,8,238,175,96,238,12,131,245,17,212,72,148,
+156,198,94,188,67,124,40,43,145,14,77,180,78,17,49,190,183,69,116,215,110,103,90,133,151,229,170,216,162,240,210,238,
+116,241,21,254,42,40,154,175,129,178,143,185,255,74,131,103,118,187,36,12,104,0,0,217,11,236,224,49,202,15,83,191,
+168,207,100,98,12,180,155,129,173,98,26,160,15,159,223,33,63,53,223,43,136,164,38,248,63,133,110,245,77,189,169,192,
+252,64,223,157,90,16,168,60,158,26,168,143,172,29,78,126,6,250,118,199,36,96,12,208,248,197,104,240,11,232,3,222,
+1,175,129,199,192,183,73,108,194,95,230,18,216,169,69,147,247,16,248,74,96,194,26,35,244,109,15,13,30,15,168,185,
+159,171,203,154,244,92,29,227,78,2,250,110,133,139,104,44,227,12,23,5,230,183,41,3,179,240,244,28,48,107,3,87,
+195,184,175,116,124,189,193,243,34,220,246,89,95,255,143,255,235,23,69,136,116,217,109,172,42,255,53,102,36,152,20,145,
+1,85,44,1,180,218,110,48,72,67,62,70,233,30,32,12,171,235,152,119,206,2,155,87,231,168,70,132,47,233,135,162,
+41,65,222,163,223,54,251,224,102,113,240,33,240,45,218,178,234,46,160,21,164,62,164,63,74,42,249,185,109,100,89,192,
+29,195,0,121,73,111,160,105,69,139,139,232,251,42,19,117,12,41,29,30,17,210,106,18,208,104,165,187,75,62,200,194,
+175,234,197,190,224,120,48,21,168,247,17,244,14,79,193,248,209,131,39,181,137,162,136,222,218,89,32,126,8,217,250,192,
+70,213,129,175,68,137,144,39,55,95,161,103,206,108,99,89,222,208,224,90,171,161,175,1,245,218,193,122,99,66,111,145,
+150,151,32,139,121,133,1,242,192,20,64,111,4,251,146,167,81,52,169,209,107,12,228,129,1,242,98,220,237,2,31,196,
+79,236,254,33,126,102,6,122,67,251,92,240,8,120,11,168,45,32,169,87,6,255,250,36,250,175,182,107,213,255,244,10,
+160,62,71,108,27,219,145,30,216,169,239,71,14,5,181,162,173,197,180,56,38,215,130,141,21,158,57,206,15,124,148,147,
+170,123,207,11,245,230,58,242,5,52,14,94,39,7,215,2,241,92,79,244,63,58,27,168,125,84,192,24,86,190,201,186,
+36,182,235,115,23,190,228,47,133,36,194,140,54,6,138,202,0,255,220,176,98,209,224,159,111,25,142,194,59,128,38,137,
+194,112,10,209,96,8,211,179,202,238,184,13,56,188,54,149,117,120,26,6,99,199,42,6,224,69,157,193,55,155,178,151,
+236,161,26,192,87,3,53,6,125,201,187,40,42,84,158,174,162,218,78,115,196,0,249,72,3,225,167,56,102,76,125,223,
+236,248,28,69,203,76,105,194,0,105,165,73,156,127,57,166,121,30,188,171,108,213,96,195,54,160,59,104,18,235,242,62,
+18,47,64,117,127,212,237,52,52,57,146,123,194,176,113,1,16,14,52,113,154,186,220,153,123,82,58,200,64,82,83,219,
+230,53,106,3,107,235,91,109,203,80,105,7,213,57,46,194,189,35,193,109,224,53,208,7,168,221,244,14,232,5,254,14,
+182,237,32,186,74,27,21,210,241,52,224,75,180,93,141,182,182,46,45,159,22,241,124,48,160,60,8,86,2,154,48,136,
+35,106,15,85,202,197,102,49,193,205,154,224,84,160,137,75,109,19,166,177,147,172,68,97,221,5,150,106,102,99,30,158,
+97,163,218,150,79,129,90,209,64,251,9,121,176,177,153,13,216,168,188,208,13,60,11,124,72,165,125,136,162,150,121,172,
+153,93,246,108,92,6,224,116,66,112,4,24,1,234,137,250,60,218,234,111,26,80,88,254,177,253,102,224,75,52,177,181,
+208,184,108,218,29,99,192,24,72,141,1,254,116,42,128,214,2,141,10,43,30,197,22,21,112,234,164,197,125,13,57,181,
+120,38,85,76,28,42,5,52,199,155,128,79,249,27,202,146,154,213,177,254,224,100,70,240,140,79,162,3,93,170,96,254,
+9,148,158,127,10,238,249,56,60,137,146,142,77,15,139,88,118,12,144,143,86,4,106,24,186,200,27,120,222,32,59,171,
+45,36,23,6,72,171,61,192,143,46,9,158,51,191,26,20,184,20,204,9,236,237,156,154,204,1,39,170,127,180,10,54,
+170,28,136,195,26,45,249,187,196,70,13,212,103,37,154,4,91,49,127,44,116,166,69,112,173,60,123,48,104,52,136,249,
+2,207,180,114,85,238,66,104,178,82,249,124,32,80,127,32,138,168,15,242,58,56,25,44,220,153,108,118,102,172,72,47,
+165,187,38,236,190,1,62,228,107,148,172,7,42,249,169,51,89,179,88,21,129,129,48,15,114,140,59,73,169,183,70,181,
+197,217,56,194,253,217,128,234,246,199,128,254,51,141,86,252,243,40,51,209,34,176,171,192,204,32,151,255,187,192,174,139,
+57,254,12,106,229,214,113,136,206,217,13,12,22,175,143,212,26,158,240,250,11,252,173,9,42,105,165,163,137,31,6,2,
+78,53,113,59,0,52,146,193,60,88,25,228,242,191,18,133,9,108,159,21,168,156,242,37,239,69,9,215,220,24,3,198,
+128,71,6,248,247,170,16,122,217,215,191,24,61,106,128,135,3,230,30,45,109,143,42,226,18,86,146,251,122,228,72,170,
+158,147,110,147,177,25,128,147,7,68,142,103,81,163,239,58,16,166,229,5,30,245,255,67,122,77,140,1,87,6,200,71,
+123,131,239,28,243,166,86,61,107,175,108,147,156,51,64,58,141,15,84,15,116,162,60,79,164,108,176,189,38,15,194,137,
+234,160,247,34,38,184,222,112,153,84,126,242,46,216,168,9,228,172,68,223,90,52,201,136,1,18,85,43,136,27,245,17,
+180,64,70,171,86,195,182,213,250,156,107,181,177,235,228,116,95,116,104,223,121,147,2,48,16,164,255,195,28,125,136,242,
+142,38,14,195,60,85,0,6,204,196,78,101,160,42,31,198,109,171,189,82,229,87,121,121,107,112,33,248,24,52,154,20,
+231,81,219,229,69,44,216,2,180,61,73,101,67,128,165,56,62,8,134,2,45,22,170,55,145,163,122,71,111,184,135,126,
+218,110,127,173,1,216,118,62,136,186,176,1,167,13,69,139,30,246,169,213,111,215,126,24,128,219,30,160,23,104,148,86,
+250,255,158,1,212,135,243,19,104,27,180,96,251,121,192,167,156,218,134,104,88,144,198,64,185,25,224,31,172,193,67,215,
+213,32,42,212,180,242,238,74,176,54,200,109,69,26,55,181,171,226,50,5,231,63,1,95,162,217,124,125,160,207,36,96,
+0,62,52,8,237,154,23,107,211,71,3,13,167,130,174,60,201,249,253,181,142,28,174,207,150,110,19,99,192,133,1,242,
+208,244,64,19,224,46,162,242,41,247,219,11,184,240,212,73,126,73,171,53,64,189,14,169,75,30,200,147,223,207,49,102,
+27,96,245,92,144,113,225,98,81,160,129,136,40,242,56,142,42,245,86,30,243,125,104,27,71,173,196,143,26,39,156,58,
+137,218,7,219,231,145,143,78,180,9,174,149,255,212,166,215,164,98,61,249,140,155,243,7,184,131,163,207,54,178,210,90,
+19,132,155,130,220,254,15,58,49,221,227,198,137,244,217,4,184,78,222,161,162,34,151,196,13,223,220,27,3,105,49,64,
+142,84,217,51,57,80,159,61,142,252,5,199,7,1,13,8,187,46,208,138,19,174,15,183,111,163,100,155,180,56,141,170,
+23,27,196,189,218,144,170,103,90,137,198,161,244,182,206,122,32,23,245,69,104,71,112,212,162,79,31,237,125,77,46,92,
+47,157,38,126,25,8,210,73,121,231,48,160,201,178,70,242,60,15,166,247,27,122,250,218,176,185,242,191,8,142,221,57,
+170,143,230,75,196,215,146,233,199,194,66,48,6,140,129,177,24,224,143,247,150,195,191,88,29,173,167,129,58,90,106,232,
+84,23,18,185,168,72,199,138,108,130,139,154,56,125,192,181,79,89,62,129,73,29,233,5,82,143,6,62,26,57,213,233,
+51,146,11,13,142,215,230,203,79,170,29,57,158,255,73,250,77,140,1,23,6,200,67,91,130,62,142,121,81,43,253,219,
+222,249,114,225,161,76,126,73,171,123,29,211,187,8,222,181,109,136,86,87,219,54,107,100,110,120,56,52,70,162,157,128,
+219,92,182,163,66,187,130,99,150,219,170,125,88,166,50,162,221,113,37,125,199,7,90,96,83,79,52,160,116,43,184,8,
+12,169,231,192,211,189,175,209,115,34,104,55,29,22,126,3,6,72,155,199,60,165,245,51,150,206,13,72,182,219,153,51,
+160,188,24,96,181,152,249,91,101,163,175,137,205,152,65,123,115,174,109,158,23,0,153,243,30,6,72,216,203,128,184,99,
+84,226,126,24,120,2,156,12,150,6,109,105,71,133,225,114,60,2,104,60,194,135,168,206,109,75,124,194,116,233,212,99,
+192,235,60,28,155,141,17,169,173,179,177,220,22,77,130,248,133,101,218,89,92,251,148,215,138,198,135,217,107,12,164,193,
+64,234,131,29,252,107,195,63,177,142,7,19,137,197,18,70,68,165,216,165,96,19,240,0,248,17,116,201,248,227,143,63,
+158,208,97,210,219,115,124,54,246,172,175,144,234,200,135,135,96,184,182,209,152,208,99,4,70,163,235,124,176,111,29,157,
+147,215,185,151,244,214,192,164,30,205,159,49,32,6,200,255,19,115,88,2,204,163,235,132,162,242,248,21,240,82,66,255,
+230,45,67,6,72,243,25,9,110,165,12,131,108,87,80,211,16,240,113,224,143,237,50,32,103,225,174,25,209,158,95,112,
+247,175,136,110,219,237,108,151,12,13,248,71,134,97,89,80,227,141,55,63,36,172,214,128,136,145,220,95,16,168,253,214,
+163,129,27,31,183,167,69,137,222,52,61,215,135,50,211,225,206,0,245,87,117,63,114,67,52,174,225,174,117,188,79,209,
+241,123,15,122,76,133,49,224,155,129,173,99,42,212,224,71,209,223,68,94,149,56,236,21,51,222,190,157,171,255,190,120,
+76,165,226,126,74,176,22,56,5,188,10,190,0,143,80,110,157,11,214,0,218,97,133,91,153,136,234,173,51,65,55,15,
+161,189,137,142,195,60,232,49,21,245,25,208,24,212,161,96,182,250,143,199,83,187,252,46,208,171,193,243,162,220,158,29,
+67,125,247,201,174,42,74,228,205,78,99,32,77,6,38,74,83,121,29,221,123,114,79,149,94,18,121,3,79,7,119,224,
+100,205,88,92,40,126,85,21,190,6,73,55,31,203,129,219,197,82,110,222,139,239,27,110,215,35,22,26,232,243,57,185,
+50,2,125,23,130,227,65,173,204,193,141,223,213,222,76,120,61,6,127,31,37,244,107,222,140,129,144,129,69,57,209,64,
+136,75,249,255,3,254,159,161,188,26,20,42,181,99,174,25,88,8,235,92,191,101,52,20,29,223,131,111,65,184,8,100,
+98,206,213,25,153,20,232,213,127,117,30,147,214,241,120,245,34,154,180,58,141,178,126,0,249,243,65,47,26,139,171,100,
+145,136,166,107,129,64,101,225,72,206,219,88,115,98,231,124,17,227,228,234,76,156,220,232,170,196,252,199,98,96,103,92,
+207,212,192,135,202,156,165,27,60,243,125,91,229,152,222,236,83,89,118,84,168,60,231,255,141,208,204,78,63,30,78,4,
+93,7,41,127,70,199,9,214,126,233,244,172,82,172,248,133,229,11,229,78,89,251,234,27,145,98,154,132,248,46,235,148,
+131,115,77,132,109,234,33,92,213,25,106,131,174,31,64,245,135,218,204,95,17,198,91,28,159,0,79,129,247,194,244,230,
+220,151,28,129,162,131,192,36,30,20,126,136,142,45,129,38,165,76,210,97,96,121,212,106,49,65,216,159,170,13,165,31,
+55,52,49,55,170,246,65,193,174,175,192,94,159,139,111,62,67,223,125,5,227,192,204,53,6,82,97,192,101,32,175,165,
+65,84,90,213,110,246,230,98,201,234,27,49,206,71,227,246,244,24,238,59,197,233,243,158,35,226,178,2,223,179,41,217,
+169,171,202,135,83,17,170,222,154,113,29,208,172,54,94,111,134,169,162,61,181,250,102,213,185,56,247,209,168,146,202,209,
+52,252,250,84,233,182,83,99,32,22,3,252,23,212,96,220,12,172,24,203,227,184,142,245,54,206,59,227,222,182,59,57,
+101,224,107,236,82,61,170,137,151,168,162,206,231,83,64,29,207,190,96,56,24,1,134,1,13,132,253,2,52,41,184,19,
+208,219,62,19,130,188,200,116,24,114,30,249,253,51,202,204,215,243,98,84,86,118,4,117,158,210,122,238,136,97,22,165,
+179,174,178,171,123,196,56,185,58,187,159,188,243,165,171,18,243,223,154,129,32,191,206,130,203,109,65,163,114,164,91,107,
+77,94,93,168,221,182,31,208,226,25,123,51,203,43,181,137,149,173,137,207,53,18,251,254,205,227,163,156,94,247,219,165,
+157,25,3,185,98,96,217,92,89,147,157,49,139,19,148,218,146,250,127,102,45,234,171,207,154,82,160,83,163,87,152,31,
+108,3,180,40,83,223,119,251,128,227,187,224,53,240,36,237,141,55,56,70,150,160,222,12,221,159,195,201,33,192,199,120,
+195,64,233,194,158,254,28,77,60,51,80,213,62,215,184,232,52,13,212,171,191,118,53,40,250,226,93,181,161,214,111,16,
+199,164,183,31,37,111,14,74,234,217,252,25,3,157,196,64,170,19,57,53,68,29,204,181,86,42,36,17,85,114,119,39,
+241,88,112,63,255,195,126,13,154,105,2,194,135,104,255,217,169,40,0,165,179,140,114,51,145,94,194,99,196,53,208,169,
+213,54,87,53,209,57,71,147,103,113,31,141,53,51,26,215,179,185,55,6,96,64,3,187,171,130,41,28,216,208,0,254,
+127,192,139,14,58,204,107,182,12,244,37,56,77,190,104,112,63,138,40,141,207,6,151,82,95,232,237,171,46,161,14,89,
+129,139,245,128,58,190,11,7,71,117,70,178,108,79,16,92,75,145,109,199,3,13,14,151,81,86,33,210,154,184,141,34,
+149,1,4,210,58,138,219,118,186,217,49,163,192,191,36,156,211,50,10,203,130,249,149,1,165,173,6,186,242,36,154,52,
+60,5,124,8,158,0,38,237,101,224,207,4,239,58,80,169,65,202,125,218,27,13,11,221,24,168,207,0,237,171,77,120,
+226,210,62,175,175,184,56,119,231,106,147,169,67,8,87,109,228,44,218,177,90,172,160,186,101,233,0,187,112,212,110,44,
+159,113,24,0,212,183,122,28,60,9,180,128,170,149,28,137,3,141,177,185,150,141,10,103,48,56,0,168,143,103,146,30,
+3,11,161,122,115,208,168,209,173,9,62,77,228,84,164,0,109,243,208,212,234,227,162,92,156,0,124,254,167,180,43,132,
+116,154,24,3,198,0,12,248,252,115,53,35,84,29,180,69,154,57,104,242,76,43,23,78,110,242,188,227,30,85,21,216,
+250,120,161,38,11,124,77,228,76,138,174,201,64,25,39,114,118,35,222,235,2,95,242,21,138,78,36,173,174,106,166,144,
+244,211,192,185,47,81,152,38,198,128,11,3,91,226,121,25,23,5,248,125,7,188,230,168,195,188,103,203,128,38,102,132,
+168,162,206,197,126,96,51,202,48,77,32,235,77,28,13,46,76,14,244,70,99,15,160,250,36,239,34,251,247,165,156,254,
+103,222,13,77,193,62,173,108,109,244,118,67,109,112,99,77,214,213,62,204,201,181,242,222,98,25,217,114,29,121,70,147,
+57,38,41,51,240,107,241,82,41,83,118,38,168,168,19,205,41,91,53,150,250,153,184,186,16,44,57,214,93,187,200,154,
+129,133,9,80,139,80,92,100,52,158,79,225,191,173,1,83,19,99,160,173,12,4,101,95,104,131,198,73,132,13,65,212,
+5,24,161,223,78,58,142,106,83,100,244,13,182,118,243,62,11,54,8,106,187,29,10,190,3,95,0,77,232,60,5,238,
+5,106,139,87,203,141,92,40,223,248,24,207,251,26,61,154,228,190,31,152,164,203,128,222,204,106,244,54,206,207,60,187,
+150,122,74,147,106,133,145,154,242,76,109,185,43,128,242,179,79,185,23,94,62,245,169,208,116,25,3,69,102,192,71,193,
+63,78,252,107,254,204,122,190,63,136,58,160,80,171,175,55,55,30,169,189,89,162,235,247,137,235,156,158,226,171,129,188,
+25,129,26,6,101,147,93,136,176,143,213,42,226,77,43,102,180,250,69,141,170,86,50,109,43,7,49,158,151,113,2,46,
+6,61,230,180,25,3,148,203,154,196,93,25,76,215,204,93,132,103,119,226,230,121,26,83,17,156,154,147,156,48,160,78,
+234,235,96,181,136,246,40,113,85,239,248,170,123,234,5,251,127,220,124,14,188,2,214,2,11,0,229,81,159,210,13,101,
+135,147,247,239,34,191,14,241,169,184,0,186,150,142,97,163,6,12,242,46,91,97,160,175,69,45,205,226,250,13,15,207,
+111,230,192,158,121,103,96,59,52,102,53,73,151,196,120,109,249,115,25,80,95,198,164,61,12,236,68,176,174,255,255,103,
+208,113,77,123,204,183,80,141,129,113,24,80,29,173,178,111,87,48,43,40,123,163,90,99,20,31,130,118,136,38,121,53,
+73,210,189,29,129,55,8,115,74,238,11,106,27,255,17,200,190,126,224,62,240,52,208,184,134,202,69,31,19,80,90,40,
+186,23,176,73,28,72,72,89,52,46,180,45,104,52,46,218,151,103,183,167,108,131,119,245,213,99,2,244,185,174,37,128,
+168,253,205,168,182,104,162,241,170,112,140,185,58,188,168,10,204,157,49,208,105,12,248,40,252,91,113,178,40,14,150,111,
+229,168,201,243,91,155,60,43,195,35,21,232,190,68,233,173,244,40,155,172,66,132,215,240,20,233,62,232,209,91,13,247,
+70,212,167,85,132,190,100,184,47,69,166,167,148,12,104,32,116,41,224,210,89,252,8,255,207,3,117,40,76,10,194,64,
+208,224,85,153,165,142,114,59,69,147,55,122,203,246,75,112,33,88,7,28,9,86,4,234,172,30,15,222,3,63,1,95,
+182,134,157,96,84,150,74,166,143,17,219,30,114,27,118,144,98,248,203,210,169,86,157,102,33,119,243,127,81,135,209,36,
+101,6,130,252,166,65,141,221,64,183,148,131,115,81,175,58,115,23,236,213,27,126,149,255,73,206,255,43,46,113,205,171,
+223,29,28,13,27,134,255,99,28,117,152,119,99,32,49,3,85,101,199,170,156,255,7,69,79,130,99,193,108,192,165,93,
+142,247,142,16,245,45,180,184,39,115,161,206,255,158,64,95,203,60,224,120,1,106,161,211,34,64,229,216,67,96,103,224,
+99,28,79,139,123,245,230,186,190,11,56,94,8,238,153,120,102,32,104,55,104,76,116,174,6,170,213,71,122,28,168,143,
+84,72,33,142,123,99,184,38,170,124,203,109,40,124,218,183,82,211,103,12,20,153,1,31,21,64,171,248,31,132,131,73,
+91,57,106,240,92,43,4,174,14,159,169,114,41,161,248,126,123,102,206,18,114,56,15,113,246,241,54,206,35,232,89,15,
+104,101,123,84,113,125,251,161,58,156,15,170,47,236,220,24,136,201,128,38,114,92,255,255,15,163,163,119,73,203,226,152,
+116,231,206,249,229,74,187,54,90,165,9,28,117,150,213,1,221,129,60,116,4,24,5,198,128,145,96,16,248,11,208,98,
+131,131,193,59,96,36,80,199,198,69,212,112,216,145,206,197,196,46,74,10,232,247,119,49,108,158,41,134,219,118,57,117,
+89,16,20,213,230,112,130,49,170,123,115,231,206,192,214,168,88,210,93,77,234,26,244,127,250,115,234,161,88,0,245,24,
+80,254,152,183,222,131,24,247,254,133,219,87,98,184,55,167,198,128,111,6,54,66,225,131,64,3,181,27,130,169,128,201,
+111,12,104,177,81,59,165,72,131,196,190,6,196,6,65,184,38,113,238,105,39,241,37,11,123,77,226,59,121,131,56,255,
+200,253,59,27,60,203,253,109,250,89,43,99,228,57,192,199,152,91,117,124,63,33,143,30,4,108,162,177,154,21,59,47,
+61,3,222,183,86,11,102,155,67,98,167,230,68,157,180,164,162,74,181,176,179,210,73,35,93,227,207,247,107,198,11,215,
+232,47,195,229,16,199,72,106,48,241,118,112,32,149,136,6,34,227,200,100,113,28,183,112,251,67,139,231,246,216,24,168,
+203,0,229,242,158,60,88,17,184,148,249,202,251,90,69,88,246,50,25,10,138,39,148,93,195,201,7,23,96,249,69,64,
+219,53,100,37,122,179,70,101,151,38,145,110,199,142,11,91,5,140,155,43,177,245,14,220,253,13,108,6,212,150,112,233,
+184,46,142,127,117,158,122,129,178,72,163,142,98,189,248,231,253,77,221,141,49,122,134,122,134,123,190,167,14,244,123,158,
+117,154,186,198,12,232,127,253,7,224,187,211,223,56,68,183,39,170,67,119,1,55,185,169,49,223,49,25,216,9,247,141,
+182,161,137,162,106,0,142,14,143,226,48,77,55,212,105,154,48,23,150,3,154,152,82,127,76,223,16,208,98,199,238,64,
+111,70,142,2,170,235,212,119,24,14,190,5,223,129,193,224,77,240,6,80,61,246,45,245,36,7,147,188,50,64,122,135,
+166,109,195,201,97,64,139,17,242,252,230,97,104,111,59,142,154,104,189,172,29,1,87,133,169,29,96,54,1,75,87,221,
+235,228,211,143,136,220,174,148,35,47,118,114,36,115,24,55,181,35,26,21,222,223,240,76,139,216,10,39,148,119,51,99,
+244,117,96,26,207,198,171,32,109,123,253,237,57,78,166,206,24,240,194,128,203,160,94,20,3,142,198,209,244,81,28,214,
+113,243,51,247,206,170,115,191,108,183,6,122,142,240,180,158,245,21,65,221,11,24,249,46,72,50,88,53,8,127,23,128,
+139,64,18,209,64,133,47,81,103,206,196,24,136,197,0,141,171,223,225,65,3,33,106,100,185,200,253,120,126,135,70,191,
+175,45,175,92,108,49,191,9,24,32,237,174,37,63,172,128,215,61,128,6,143,210,22,13,68,245,1,143,128,203,8,95,
+229,105,36,193,237,48,28,238,142,189,39,112,84,91,98,138,72,30,235,59,82,167,105,23,208,171,254,227,142,188,251,83,
+140,88,205,135,91,77,238,125,7,223,149,21,111,49,252,102,225,116,43,2,105,212,241,245,21,126,127,20,29,228,75,153,
+233,137,196,128,234,37,223,131,102,234,59,140,0,95,128,112,208,84,147,128,62,22,213,232,173,190,3,192,77,192,36,59,
+6,54,115,8,74,237,149,191,2,213,39,153,10,101,233,82,4,184,54,88,29,104,226,102,126,16,167,222,85,219,173,250,
+109,201,77,185,150,168,94,253,20,253,143,113,124,2,220,3,186,218,101,212,157,92,154,228,128,129,93,177,65,3,144,139,
+129,137,114,96,79,94,77,80,251,240,44,242,237,143,109,54,240,61,194,255,39,248,11,232,209,102,91,210,14,94,219,216,
+29,2,231,246,150,98,218,76,143,173,95,101,122,179,137,14,229,193,111,198,246,82,152,43,181,139,22,72,193,218,151,201,
+167,255,78,65,175,169,52,6,10,207,64,218,13,139,176,209,153,132,40,21,102,175,133,30,75,220,48,21,7,35,129,175,
+21,139,101,124,149,123,40,252,169,18,136,51,145,51,26,247,15,3,77,38,106,34,40,169,248,156,200,249,52,169,17,230,
+175,212,12,104,0,123,73,224,82,222,107,80,88,141,180,207,129,73,177,25,56,15,243,53,232,163,149,240,113,6,149,226,
+196,122,8,142,223,0,42,67,239,161,254,78,252,102,41,126,207,96,192,74,171,148,213,185,158,16,36,149,229,209,211,13,
+125,210,85,6,209,96,118,84,209,32,247,49,224,184,168,30,50,118,183,78,6,225,253,53,131,48,44,8,24,224,127,40,
+30,102,2,251,1,31,109,91,13,0,190,15,110,6,15,130,62,160,90,84,247,237,14,78,3,179,84,63,72,112,190,34,
+126,118,0,183,39,240,107,94,98,48,16,228,147,249,240,162,9,144,164,242,1,101,254,197,73,61,71,241,23,216,41,167,
+139,0,77,218,108,9,100,243,92,192,165,206,194,123,93,233,206,93,13,152,9,154,88,84,126,127,8,168,110,183,54,26,
+36,180,67,170,242,193,182,132,127,48,88,13,216,172,90,227,196,208,228,234,157,224,2,160,242,59,15,114,5,70,168,93,
+172,186,66,131,238,157,38,170,124,53,249,187,13,229,98,230,147,219,157,70,102,130,248,104,76,168,217,68,142,222,188,236,
+154,148,79,160,63,51,47,85,229,157,194,212,24,155,22,45,248,22,45,204,217,194,183,82,211,103,12,116,10,3,46,3,
+123,173,56,208,36,142,86,161,36,21,173,52,50,25,111,60,117,80,125,118,4,124,78,44,20,41,125,206,194,216,121,193,
+239,35,24,253,38,110,46,2,215,209,208,137,224,188,169,19,85,66,62,6,42,20,200,87,77,67,178,135,198,64,13,3,
+52,180,212,96,220,25,184,190,137,247,60,58,222,230,255,160,9,78,147,2,51,64,26,246,37,95,156,68,20,52,185,178,
+63,112,25,36,171,102,66,121,227,19,240,20,120,22,60,72,88,94,86,150,161,231,92,108,94,11,157,27,130,164,162,242,
+127,110,80,59,200,155,84,95,222,253,125,128,129,26,72,138,42,59,225,48,87,19,57,65,71,113,89,236,114,29,124,111,
+197,129,182,178,184,164,149,35,123,238,198,64,144,158,161,146,67,57,89,52,188,72,120,236,143,191,251,128,38,225,62,161,
+156,224,80,87,212,14,187,90,192,134,215,57,46,85,215,85,180,155,10,68,237,72,155,200,137,198,151,171,171,93,80,48,
+113,66,37,26,16,59,35,161,223,56,222,54,194,177,22,70,172,11,218,209,199,90,144,112,133,61,192,109,228,241,155,57,
+62,215,228,255,192,99,147,20,24,216,0,157,199,131,149,64,210,60,155,130,89,137,84,142,193,151,6,253,181,16,242,11,
+240,61,248,56,184,254,142,227,103,64,227,19,19,0,73,55,160,188,63,33,80,249,58,35,80,191,99,122,160,103,106,31,
+234,153,160,182,137,222,4,209,228,227,3,32,111,114,17,6,201,222,147,129,236,239,36,249,137,200,124,13,230,5,175,117,
+82,196,10,18,23,181,69,194,255,76,173,201,250,191,253,160,155,5,43,187,79,195,228,205,101,119,10,242,56,92,168,252,
+49,49,6,140,129,44,24,80,71,45,192,195,28,147,202,8,60,46,12,66,93,89,152,158,203,48,2,14,126,72,74,100,
+29,127,154,164,40,149,84,229,163,169,57,63,31,244,3,213,50,154,139,111,192,191,193,222,192,75,190,67,207,44,96,36,
+240,33,191,160,100,205,82,37,156,69,214,153,1,242,204,159,192,16,199,12,248,35,254,245,177,248,201,156,13,50,5,185,
+98,128,52,237,9,174,1,125,64,18,81,221,244,1,184,22,168,236,148,190,70,157,20,167,184,163,119,113,48,10,184,136,
+86,210,119,188,64,144,234,176,67,99,18,165,58,230,104,249,205,139,200,22,112,60,72,83,148,167,118,5,10,43,47,81,
+239,72,59,66,142,57,46,3,180,141,95,82,121,31,143,71,38,33,9,127,75,2,181,247,92,228,107,60,39,9,222,252,
+196,96,64,28,131,167,29,18,170,119,90,233,132,222,73,193,62,224,109,160,62,68,158,68,117,242,17,49,168,54,167,9,
+24,128,227,74,157,193,113,17,160,49,15,141,93,20,81,126,194,232,190,224,89,160,201,110,229,235,165,19,80,210,81,94,
+224,96,67,240,10,232,68,81,29,118,1,152,179,163,18,45,231,145,129,239,89,192,32,208,72,110,229,65,206,99,241,171,
+121,178,19,104,76,205,181,95,134,138,186,162,122,181,244,229,80,33,50,131,25,217,57,12,240,167,211,31,123,86,160,74,
+34,169,188,132,199,74,3,169,115,152,73,22,147,128,7,151,14,111,109,26,252,47,153,37,157,227,11,66,22,5,251,129,
+179,130,163,182,67,240,46,232,94,1,248,20,171,208,188,167,82,231,42,36,227,77,7,254,7,126,118,204,132,143,72,87,
+231,50,85,238,152,145,182,211,130,149,129,6,179,47,6,207,129,193,64,157,251,106,81,163,122,24,120,21,220,5,52,232,
+191,5,88,5,76,145,5,139,132,163,65,51,23,57,51,11,59,219,29,6,4,169,253,180,92,2,162,52,152,147,230,155,
+218,177,168,9,226,161,252,150,166,104,245,186,73,6,12,144,136,202,151,83,129,55,18,38,104,127,252,29,14,156,250,7,
+248,63,29,104,226,50,169,200,239,142,25,80,86,234,32,224,88,233,252,125,210,68,194,223,97,210,225,83,208,55,27,184,
+16,168,172,204,179,168,190,190,29,248,140,190,233,170,98,0,110,103,2,231,128,161,160,40,50,6,67,101,239,139,224,20,
+176,9,232,94,21,45,59,13,24,128,23,149,63,75,128,127,128,111,65,39,74,127,34,101,147,190,25,229,122,184,86,153,
+241,81,147,140,244,12,207,38,4,25,89,148,60,24,108,212,66,81,45,244,76,75,158,73,110,157,249,52,6,202,193,64,
+90,29,246,45,161,79,175,212,38,149,71,146,122,236,64,127,179,17,39,159,131,100,35,59,144,163,88,81,226,53,205,119,
+241,32,164,45,13,247,249,72,24,176,111,125,9,205,48,111,5,97,64,91,146,104,146,82,91,25,36,21,149,23,151,131,
+239,147,42,48,127,249,102,128,242,80,219,159,189,32,208,26,255,23,71,213,57,154,184,155,4,168,141,160,186,124,8,208,
+86,27,218,110,66,219,50,12,105,211,235,238,207,17,246,98,32,169,204,149,212,99,1,253,125,136,205,74,183,102,251,113,
+215,70,107,110,110,92,0,14,169,125,208,166,235,153,9,87,91,128,164,37,95,162,248,194,180,148,155,222,113,24,208,183,
+7,46,5,75,140,243,164,249,141,17,60,86,217,180,55,112,110,195,82,118,157,72,89,183,53,186,146,46,226,81,91,108,
+29,112,27,48,73,143,129,21,80,61,121,66,245,31,225,79,109,23,47,66,126,233,129,162,99,193,174,96,38,47,74,211,
+85,162,186,123,59,160,21,224,251,112,124,63,12,142,252,31,158,218,49,6,3,240,88,237,250,120,46,246,3,179,86,223,
+204,225,185,182,23,212,214,68,253,128,182,161,124,129,244,127,150,163,73,52,6,222,194,217,31,193,245,96,79,160,237,243,
+148,230,169,188,121,142,222,172,101,78,2,60,155,188,189,18,71,45,116,122,35,52,192,202,137,144,9,175,71,245,159,190,
+109,162,113,30,158,169,126,249,180,137,155,182,60,170,41,255,84,23,158,8,210,218,169,67,229,214,149,109,137,168,5,106,
+12,148,153,1,253,209,193,107,32,169,104,118,119,94,80,102,26,187,226,30,112,145,148,203,122,254,238,238,82,110,39,169,
+50,0,249,171,2,151,85,159,213,233,55,146,139,25,83,53,216,148,119,4,3,228,19,149,193,115,128,62,64,171,239,146,
+72,152,111,123,225,57,233,64,74,71,240,105,145,200,231,171,211,14,0,0,32,0,73,68,65,84,15,3,228,197,221,146,
+100,230,42,63,47,230,39,54,233,91,66,188,31,170,138,123,212,211,175,112,152,116,128,219,107,164,176,195,53,189,155,197,
+89,101,163,222,204,240,106,179,41,27,155,1,241,27,96,34,142,71,1,189,41,16,71,250,225,120,71,48,182,98,199,43,
+244,233,173,108,23,249,196,209,4,243,222,130,1,18,231,88,135,4,250,75,11,245,145,30,19,254,124,224,82,160,183,84,
+139,42,90,229,189,34,168,252,23,35,69,220,28,141,195,64,192,159,222,64,126,10,228,89,244,246,136,222,184,57,23,104,
+103,8,75,247,113,82,51,254,141,144,71,142,91,131,27,192,231,32,105,31,11,175,185,147,79,176,72,245,162,229,151,248,
+217,35,146,143,128,219,251,154,164,188,198,122,182,151,187,188,73,96,187,242,198,94,192,231,39,31,80,55,142,116,45,60,
+200,27,15,102,143,49,208,209,12,240,87,92,10,104,50,38,169,188,133,71,171,68,130,92,2,23,83,131,184,29,223,102,
+220,223,220,209,25,48,71,145,35,17,54,107,150,16,49,159,233,63,149,163,216,153,41,121,101,128,124,50,41,184,12,132,
+147,49,156,198,22,117,78,212,80,219,16,76,156,215,184,154,93,229,98,128,188,184,12,112,201,215,90,93,89,26,129,171,
+195,65,18,185,63,15,36,97,248,195,73,140,143,232,71,171,147,77,82,102,128,180,168,180,231,57,106,50,70,91,51,70,
+21,109,9,250,24,232,6,82,233,19,160,247,51,144,84,244,61,140,41,65,202,12,150,87,61,220,106,2,34,137,104,235,
+40,189,253,229,36,232,248,11,24,152,196,128,28,250,209,127,73,219,194,57,113,82,38,207,226,170,10,218,18,233,74,240,
+29,200,155,168,189,254,33,184,19,168,156,157,17,148,41,169,218,18,87,113,12,86,7,122,163,229,29,160,58,161,232,162,
+56,92,1,166,106,11,169,29,30,40,188,42,207,156,4,154,77,0,62,197,243,180,222,116,73,204,112,96,187,190,171,148,
+69,62,63,52,177,161,230,209,24,48,6,146,51,192,31,252,100,224,34,151,227,185,210,120,74,110,69,231,248,132,11,77,
+140,249,148,171,59,135,157,124,199,132,68,211,170,5,95,162,74,223,231,22,123,249,38,207,172,75,196,0,121,100,124,176,
+44,208,170,122,151,1,111,13,162,221,15,92,182,101,75,20,7,243,100,12,52,98,128,252,56,1,112,25,72,233,221,72,
+119,39,222,135,171,238,96,8,136,43,90,21,184,121,187,57,193,134,79,227,26,30,209,189,244,46,213,238,248,117,122,248,
+112,92,105,203,115,212,4,236,71,32,170,40,125,254,156,54,63,132,161,15,11,187,72,46,87,206,166,205,91,86,250,73,
+152,102,31,133,110,150,110,154,180,72,108,38,126,119,5,239,1,151,54,20,222,115,39,247,96,81,98,94,202,230,81,92,
+5,88,131,227,179,32,111,210,27,131,52,217,184,104,217,210,38,143,241,37,29,38,4,170,19,46,1,239,131,56,11,23,
+112,158,43,185,23,107,102,7,225,127,32,143,148,23,206,166,128,207,141,56,54,155,12,25,197,243,163,129,250,243,185,25,
+15,197,150,243,192,104,144,182,124,64,0,185,155,200,42,92,102,51,131,75,193,64,26,123,124,238,232,192,156,90,152,119,
+57,248,239,68,175,179,120,142,212,48,207,250,76,93,99,6,126,108,252,40,246,19,237,17,239,83,95,108,3,204,67,33,
+24,152,26,43,143,1,250,198,73,210,141,208,85,14,15,5,231,1,235,245,67,130,73,62,24,96,207,110,237,155,172,111,
+245,36,149,110,73,61,22,212,223,112,236,254,119,2,219,197,147,190,149,211,22,161,19,167,206,235,250,4,174,111,228,248,
+150,209,40,188,8,188,225,91,177,233,171,203,192,12,220,85,94,138,242,173,35,213,55,218,254,112,117,112,46,72,91,174,
+37,0,151,58,110,233,180,13,44,163,254,224,255,175,111,161,169,29,147,68,110,136,227,41,8,79,101,206,154,64,223,139,
+187,14,44,12,146,182,161,240,154,75,217,24,171,78,202,165,101,249,53,234,40,76,211,247,185,86,203,161,137,123,211,38,
+58,14,188,155,67,219,74,103,18,233,48,6,220,1,14,2,11,65,128,222,106,89,23,156,0,158,2,31,130,81,160,8,
+162,133,60,122,51,219,247,24,84,17,226,158,154,141,228,11,233,214,206,0,31,55,9,68,187,96,168,31,191,107,232,70,
+117,84,214,162,48,3,104,103,160,94,132,127,4,208,183,215,210,150,59,8,64,99,94,38,198,128,49,208,130,1,47,19,
+57,85,127,246,37,9,111,238,22,97,54,123,252,13,133,220,227,42,232,130,194,174,153,219,178,60,83,99,192,167,12,246,
+169,204,116,53,101,192,231,138,130,159,8,73,131,152,38,198,64,93,6,40,135,213,192,90,9,184,174,164,215,64,231,221,
+148,193,207,0,203,115,117,217,182,155,109,100,96,136,67,216,223,57,248,45,170,215,27,49,60,201,34,0,125,27,162,157,
+91,172,109,141,221,105,12,164,222,68,185,118,158,181,49,51,201,206,218,222,234,56,160,137,153,86,162,145,138,87,193,222,
+160,111,43,199,62,158,147,7,30,69,143,203,128,129,77,228,248,72,136,250,58,52,145,50,73,253,71,77,239,126,203,211,
+199,155,186,24,247,161,250,173,154,220,125,16,168,13,229,165,111,140,158,188,137,6,8,15,160,92,95,87,253,118,147,150,
+12,156,134,139,211,65,210,9,197,150,1,56,56,248,25,191,31,57,248,55,175,41,51,160,54,6,208,152,214,153,96,45,
+130,91,0,44,8,246,2,95,128,188,139,198,244,84,71,174,146,119,67,11,102,159,210,94,109,235,49,77,236,158,154,103,
+170,147,52,121,162,118,84,187,228,120,2,238,3,214,1,105,180,199,107,227,213,143,27,42,115,77,140,1,99,32,2,3,
+190,27,171,155,17,102,146,134,119,104,234,7,225,137,29,187,24,152,181,235,204,207,73,127,63,106,76,75,4,6,124,14,
+130,103,81,129,70,136,146,57,201,35,3,65,167,124,22,108,251,11,232,230,96,163,242,236,32,240,119,7,29,230,213,24,
+72,147,129,239,29,148,39,153,208,112,8,174,189,94,131,129,132,167,177,226,165,132,150,108,66,217,242,215,132,126,93,189,
+173,230,170,160,142,127,173,92,62,177,206,125,187,149,14,3,59,163,86,131,86,19,70,80,175,193,130,253,64,101,117,185,
+242,110,70,226,50,160,214,35,35,27,203,24,204,242,9,35,221,143,188,243,89,148,252,163,118,19,216,134,112,52,129,115,
+8,232,158,48,204,34,121,211,27,114,127,42,146,193,89,217,26,228,135,112,21,250,189,132,171,65,76,151,49,141,52,77,
+215,194,173,30,178,217,164,80,12,204,143,181,71,129,153,10,98,181,182,237,59,11,216,246,125,254,18,76,19,56,87,131,
+1,45,84,170,125,161,62,253,221,96,57,254,235,218,90,186,82,62,181,240,151,232,113,168,59,56,30,136,18,141,201,158,
+1,84,103,100,37,87,16,208,200,172,2,179,112,242,195,64,77,254,155,138,235,13,192,129,224,88,176,39,88,30,132,245,
+115,126,12,111,179,37,190,39,114,180,130,210,69,30,117,241,220,161,126,231,246,24,47,173,224,209,138,71,147,108,24,152,
+220,99,48,81,6,66,60,6,103,170,10,198,192,140,216,123,2,88,194,209,238,159,240,255,111,240,182,163,30,243,110,12,
+164,197,192,48,7,197,67,29,252,22,217,171,58,131,195,19,68,64,163,233,251,210,120,222,33,129,95,23,47,243,225,121,
+1,23,5,117,252,126,205,61,117,78,63,173,243,204,110,121,98,160,170,163,181,52,42,53,16,58,69,4,213,159,227,102,
+31,6,223,95,209,0,124,148,65,248,8,58,163,58,233,31,213,97,29,119,83,214,185,103,183,252,48,48,71,66,53,106,
+191,52,149,32,143,170,255,123,46,184,14,232,237,159,50,201,150,68,118,251,50,69,56,70,92,85,94,41,15,105,97,170,
+239,49,146,24,102,180,116,250,3,46,62,107,233,202,28,228,137,1,77,160,222,8,22,202,147,81,17,108,89,3,55,151,
+71,112,103,78,34,48,16,180,113,244,54,221,133,64,125,238,102,210,141,135,27,130,71,192,53,96,73,160,111,49,113,240,
+46,170,7,245,22,144,222,138,249,27,208,164,99,150,162,182,185,56,49,41,47,3,91,16,117,109,173,247,6,120,24,92,
+2,212,127,85,222,127,6,60,6,212,143,203,235,2,11,76,203,86,124,54,82,84,216,44,224,104,126,111,71,255,157,232,
+125,49,159,145,162,2,249,208,167,62,211,213,148,1,53,180,125,137,203,224,165,47,27,76,79,14,25,160,65,167,10,109,
+45,176,35,112,41,211,53,209,171,149,251,39,83,78,164,210,74,68,183,137,49,224,202,128,203,246,160,101,109,99,244,130,
+244,251,19,18,175,85,234,127,167,156,89,59,161,255,36,222,52,192,58,113,18,143,13,252,104,133,223,41,224,41,96,146,
+62,3,211,18,196,121,96,174,8,65,141,192,141,86,40,255,55,130,219,52,156,124,229,160,84,43,102,77,210,97,32,201,
+34,54,181,97,30,138,96,142,210,77,229,161,242,93,148,137,198,8,42,11,229,68,11,195,254,80,40,139,179,51,246,86,
+130,218,10,104,17,67,22,162,60,59,32,65,64,163,105,167,127,167,65,97,147,124,50,16,76,24,135,43,200,143,196,74,
+181,107,102,204,167,181,45,173,90,141,248,220,88,29,167,150,62,204,65,43,6,110,194,129,38,104,126,105,229,144,231,211,
+128,221,192,179,64,109,165,19,72,11,165,73,229,173,60,165,75,18,193,223,248,96,31,240,63,252,171,255,127,8,152,11,
+180,163,96,185,158,112,71,3,147,18,48,160,60,27,96,1,142,39,17,101,141,79,107,17,197,118,96,46,80,43,147,114,
+99,93,160,201,157,91,240,163,252,31,234,168,117,91,154,235,137,60,198,116,27,116,169,195,239,34,111,185,120,238,80,191,
+62,59,25,46,3,96,29,74,111,170,209,74,86,179,214,55,201,94,53,173,207,139,221,253,181,194,59,2,34,126,231,72,
+134,86,69,95,72,199,240,71,71,61,230,221,24,72,147,129,81,9,149,171,179,244,98,66,191,157,224,109,15,34,177,22,
+72,50,144,48,29,254,174,161,209,188,45,229,195,43,156,123,21,53,198,171,228,120,206,55,175,186,118,61,213,64,217,229,
+224,82,87,69,230,191,57,3,65,58,106,2,238,48,176,6,104,53,24,160,255,228,249,224,14,208,46,249,198,33,96,229,
+45,147,116,24,152,45,129,218,225,248,121,45,44,79,194,65,238,240,58,208,167,9,233,43,64,214,171,141,131,224,115,115,
+88,25,94,212,103,31,30,242,148,27,203,218,103,200,45,4,189,113,70,193,15,33,156,199,129,182,88,210,196,218,131,32,
+142,248,92,232,16,39,92,115,27,159,129,43,241,178,59,240,145,102,170,51,7,129,239,193,124,32,171,149,233,170,203,53,
+192,250,28,80,249,105,226,206,192,80,84,28,13,102,2,43,128,86,237,37,61,87,63,127,165,192,253,8,142,159,0,109,
+129,246,18,229,185,242,133,38,133,191,5,234,199,171,92,81,25,175,133,11,130,22,220,107,91,55,181,231,215,1,122,3,
+103,30,160,251,237,22,217,125,113,104,132,213,73,33,19,29,127,220,159,24,254,1,44,27,51,166,218,1,76,255,155,83,
+192,99,192,36,41,3,106,32,7,184,130,163,139,124,141,103,21,58,165,23,120,8,57,157,131,243,81,46,164,214,248,125,
+166,244,228,102,72,0,220,239,82,195,191,203,101,111,60,103,104,189,5,85,4,6,200,19,115,130,171,128,107,57,241,35,
+58,52,80,171,21,15,38,198,64,110,25,32,143,94,6,146,200,79,120,82,103,166,116,66,188,195,54,197,145,156,255,146,
+132,188,192,79,31,142,179,251,38,16,157,161,125,167,114,174,116,242,41,119,250,182,215,244,213,103,128,68,83,58,174,15,
+6,71,76,192,94,184,155,12,84,210,191,190,214,116,239,18,246,63,35,218,90,207,217,71,178,221,196,47,3,112,170,85,
+194,223,212,35,188,197,189,151,121,30,150,37,93,70,85,221,59,128,243,36,122,91,4,91,216,199,71,136,27,147,241,148,
+103,14,1,163,83,78,73,233,127,19,236,7,38,10,121,231,124,75,16,183,94,214,160,173,73,142,25,32,77,149,175,212,
+175,242,149,175,212,54,186,52,208,43,221,11,3,189,45,221,23,196,205,63,120,73,36,31,227,75,43,232,115,204,124,49,
+76,19,135,1,86,229,168,49,30,151,52,28,131,255,159,193,8,48,12,124,7,134,128,225,64,247,70,2,185,241,149,23,
+81,229,85,180,160,199,164,68,12,144,123,206,6,174,99,87,143,163,163,212,229,209,4,30,243,204,218,142,186,180,42,78,
+51,197,38,191,49,48,47,167,62,86,112,132,26,63,11,79,236,152,9,3,163,61,134,242,181,71,93,166,170,3,24,160,
+242,210,164,203,70,64,171,164,92,203,137,215,208,113,14,171,96,126,226,104,146,49,3,164,229,20,25,7,89,228,224,90,
+173,90,107,20,183,190,228,111,173,128,43,179,168,179,244,178,3,1,11,224,247,49,242,107,220,213,83,81,130,212,91,51,
+90,157,232,115,133,233,181,232,83,249,104,146,13,3,218,254,227,4,48,125,132,224,190,196,141,86,226,105,85,105,59,101,
+42,135,192,173,207,226,64,94,19,175,139,240,76,121,41,174,124,28,122,168,89,209,171,69,130,215,1,149,127,73,244,226,
+205,187,104,235,101,189,5,221,7,60,15,158,14,240,95,142,239,130,175,64,218,111,226,175,79,24,165,23,234,179,69,33,
+225,36,208,53,185,226,153,20,173,142,191,23,108,77,190,92,18,92,14,170,223,230,211,42,251,184,237,26,43,123,60,39,
+82,10,234,238,66,231,158,192,71,190,82,121,112,32,56,0,132,210,155,19,221,155,7,236,6,180,53,150,207,113,7,212,
+141,35,10,75,229,168,137,35,3,85,117,148,222,114,218,27,168,31,158,116,134,108,2,252,170,158,211,184,192,148,64,101,
+138,22,174,77,14,116,175,27,144,27,31,121,17,53,94,165,31,218,84,254,154,116,48,3,212,179,225,196,165,142,255,33,
+170,127,6,174,99,87,107,163,163,186,76,236,96,6,235,71,77,127,106,31,162,2,98,6,71,69,3,29,253,119,132,119,
+101,244,42,89,179,234,220,199,233,91,62,148,152,142,200,12,168,114,242,37,54,192,238,139,201,206,209,179,12,81,81,5,
+166,70,155,139,12,192,243,213,52,42,53,160,96,146,33,3,148,247,19,129,85,9,50,233,118,97,25,90,155,155,160,212,
+222,72,34,207,38,241,212,9,126,170,58,140,138,206,31,129,22,206,36,149,5,241,248,47,242,173,38,145,125,137,6,185,
+246,5,190,38,113,212,144,122,20,148,186,129,79,252,179,150,237,9,112,133,8,129,106,16,243,96,242,229,0,229,205,16,
+17,252,165,225,100,110,7,165,159,57,248,53,175,141,25,72,218,185,127,165,54,47,81,78,105,251,141,107,192,238,160,93,
+111,28,107,112,181,63,184,19,156,2,150,3,51,96,235,44,96,33,176,42,232,25,96,117,142,139,1,245,169,231,7,42,
+195,52,201,163,137,31,223,34,59,230,242,173,180,72,250,212,6,195,222,27,64,26,19,124,131,209,123,19,80,91,125,75,
+210,244,126,142,99,9,225,235,58,202,196,247,88,254,184,72,250,31,169,213,99,215,158,24,80,90,6,152,132,227,125,168,
+221,202,147,234,183,208,179,49,249,231,42,208,85,95,214,156,43,159,173,4,54,7,106,251,164,185,64,98,93,244,111,10,
+76,28,25,168,74,195,231,80,245,7,240,16,40,83,127,80,5,224,37,224,71,96,210,249,12,76,71,20,213,158,217,16,
+140,239,41,186,187,162,39,74,191,195,83,112,249,82,227,107,34,103,45,162,229,178,170,77,172,252,55,95,212,228,194,154,
+121,61,91,241,170,103,125,166,174,57,3,154,156,252,165,185,147,200,79,211,108,148,69,54,194,28,230,131,1,58,9,234,
+224,107,111,209,197,28,45,82,190,122,24,104,32,213,36,67,6,72,195,5,8,238,72,240,3,141,249,50,53,220,93,89,
+78,50,232,161,48,181,2,168,180,82,213,97,124,3,18,206,3,46,117,211,156,248,191,141,60,124,52,72,204,41,126,151,
+3,106,151,104,240,193,87,123,84,246,168,51,188,1,113,30,161,120,155,164,203,128,242,0,152,129,80,14,2,81,38,227,
+238,192,157,6,181,243,32,51,58,24,209,223,193,175,121,109,204,192,204,60,74,82,176,212,235,227,92,133,174,221,26,7,
+149,218,19,77,188,60,15,118,6,83,83,14,205,13,182,7,167,130,87,65,203,54,61,110,6,130,203,240,223,19,204,3,
+110,5,213,111,114,112,233,36,154,188,240,221,207,116,50,40,75,207,148,89,19,17,222,95,193,210,158,195,237,135,190,179,
+192,146,64,131,76,173,22,73,41,29,226,202,247,113,61,152,251,204,24,248,27,33,109,6,92,219,52,106,163,61,1,180,
+104,230,21,16,69,212,159,219,0,104,146,86,237,160,52,250,22,147,161,247,96,96,226,151,1,77,216,169,190,56,13,124,
+2,146,212,129,120,43,148,244,199,218,11,11,101,177,25,155,148,129,238,120,188,11,172,145,84,65,3,127,61,184,191,95,
+131,103,29,127,219,181,146,9,9,90,36,60,113,56,218,202,182,113,201,91,97,220,91,137,239,232,227,103,111,38,246,109,
+30,147,48,48,5,158,124,253,199,134,36,49,192,252,116,30,3,193,128,217,94,196,76,131,159,174,242,63,20,232,109,28,
+203,95,174,76,70,244,79,250,45,14,52,144,126,59,152,21,188,19,209,171,57,251,149,129,36,131,30,202,223,189,140,192,
+46,6,206,225,236,201,174,171,100,39,83,226,237,12,240,104,144,167,195,213,168,45,181,225,94,110,79,194,161,38,215,150,
+105,233,33,158,131,251,112,190,99,60,47,230,218,3,3,219,160,67,11,12,90,201,23,56,208,132,79,219,7,41,200,131,
+202,195,51,181,50,184,201,243,254,77,158,217,163,228,12,204,131,215,184,51,176,154,180,29,171,76,35,125,85,22,108,156,
+220,140,216,62,53,240,218,31,156,14,86,194,30,189,105,115,11,248,145,107,87,249,10,5,191,7,167,0,133,227,75,52,
+184,82,86,209,4,206,14,32,110,94,171,199,151,182,58,235,13,246,1,202,191,199,145,238,95,128,174,55,40,184,215,72,
+38,110,244,160,201,125,159,121,160,73,48,246,40,38,3,87,227,126,239,152,126,234,57,255,137,155,154,12,92,7,68,26,
+31,171,206,107,156,191,135,191,77,192,31,64,127,224,91,214,165,124,221,29,84,218,125,190,149,151,88,223,48,226,174,246,
+185,218,83,183,0,149,251,109,111,43,97,67,173,104,76,241,187,218,155,9,174,47,74,224,199,188,20,147,129,155,48,123,
+205,148,76,95,63,37,189,157,175,54,40,196,111,224,232,42,43,162,160,243,9,107,17,67,113,80,5,125,128,220,151,188,
+135,162,22,161,219,99,159,12,192,247,244,64,31,152,243,33,231,160,196,167,121,166,171,128,12,144,7,38,0,251,128,129,
+192,85,62,65,129,143,14,71,1,153,204,206,100,56,86,153,174,45,212,22,1,231,1,241,174,143,150,234,35,148,219,101,
+103,73,103,132,4,103,250,216,106,92,185,191,51,98,239,39,22,144,167,60,57,13,80,187,192,135,232,3,226,151,131,233,
+64,117,27,166,222,249,230,184,121,21,184,124,216,21,239,117,229,91,238,250,33,201,180,68,102,0,206,127,7,30,168,155,
+34,99,223,212,199,120,183,7,149,124,17,57,128,148,28,98,199,6,192,37,31,174,173,184,152,248,101,0,78,15,7,113,
+101,172,55,20,240,124,38,112,73,219,56,225,171,46,127,4,108,12,252,146,81,71,27,97,188,1,124,137,38,85,75,41,
+16,120,20,112,205,35,250,88,179,62,184,156,104,241,0,254,84,22,234,131,245,113,165,111,41,19,45,199,145,38,1,15,
+4,250,176,188,171,12,70,193,193,174,81,69,71,216,254,210,88,196,253,64,245,175,79,81,57,20,134,225,106,174,249,175,
+97,0,110,39,6,43,129,171,128,250,252,163,65,187,100,12,1,127,9,244,38,254,94,224,32,224,106,207,91,232,80,28,
+115,209,30,172,161,223,46,29,25,8,211,53,56,94,192,49,77,81,61,190,37,112,180,186,120,222,39,242,100,242,140,142,
+122,180,146,229,75,71,29,157,230,93,251,7,78,230,49,82,246,54,142,71,50,163,168,98,69,204,87,20,42,234,92,78,
+27,197,125,11,55,62,183,83,104,17,148,61,206,49,3,43,99,219,30,96,54,71,27,181,237,199,191,193,3,142,122,204,
+123,19,6,248,255,119,227,241,2,96,119,160,87,230,103,0,19,2,201,16,240,86,229,204,126,34,49,0,159,106,179,76,
+23,201,241,111,142,212,178,123,248,183,75,59,211,202,77,100,8,124,254,153,163,86,144,42,95,186,200,52,120,254,19,216,
+13,188,13,158,7,143,1,173,46,212,91,15,203,130,197,193,170,96,22,224,235,77,85,84,141,37,122,195,199,36,123,6,
+126,71,144,11,70,8,86,111,197,169,222,201,139,44,143,33,73,87,227,143,192,111,255,188,68,164,195,236,80,153,17,87,
+84,159,86,132,114,237,98,78,246,7,73,211,246,87,69,173,127,127,196,137,222,250,57,27,100,217,199,210,27,63,218,162,
+196,135,36,225,218,71,184,121,208,225,178,155,200,96,34,240,28,56,23,188,232,24,153,36,99,49,105,108,153,229,24,141,
+114,121,167,156,169,142,240,26,92,156,0,38,173,190,153,224,92,111,117,29,8,158,72,224,119,44,47,65,59,79,247,244,
+86,199,102,216,171,54,218,121,64,187,133,248,144,69,81,178,45,240,85,22,249,176,169,147,116,140,38,50,42,91,132,57,
+193,70,96,7,176,16,80,63,72,125,201,52,235,184,225,232,87,222,185,31,220,11,30,7,18,141,105,189,12,146,148,91,
+242,47,209,184,239,229,64,113,52,233,108,6,182,39,122,135,166,28,69,253,15,214,3,247,164,28,78,238,212,187,252,9,
+171,35,51,117,245,69,130,115,235,16,141,75,154,50,164,79,177,1,91,159,108,70,215,245,75,116,167,77,93,14,109,250,
+212,30,118,60,3,52,194,231,34,146,135,128,21,61,68,246,191,232,184,142,134,254,23,30,116,153,138,58,12,144,94,26,
+220,214,4,206,97,96,246,58,78,190,231,158,6,3,76,162,51,176,54,78,227,118,66,149,199,111,139,30,68,169,92,170,
+93,112,6,208,22,30,221,61,196,124,114,116,168,124,18,148,239,85,255,165,53,105,131,234,113,228,166,113,238,216,141,44,
+24,208,54,48,42,207,154,137,158,31,0,242,180,40,101,203,102,6,183,120,214,155,250,179,111,11,55,246,56,25,3,73,
+242,72,197,15,245,238,254,4,185,55,152,40,89,208,145,124,105,240,233,25,112,20,121,224,245,72,62,252,58,250,23,234,
+52,138,236,99,16,207,117,18,223,111,204,178,213,22,119,50,228,59,204,235,13,84,207,220,229,177,253,156,164,159,152,102,
+254,206,54,21,58,35,180,139,137,198,140,142,81,209,2,152,173,64,42,253,2,242,235,21,148,143,35,208,175,111,146,244,
+0,174,162,60,104,19,57,174,44,54,240,79,122,85,63,209,78,14,87,112,227,42,48,63,88,9,244,4,139,1,77,242,
+76,2,38,5,106,111,203,163,16,167,142,80,89,168,201,149,126,224,19,112,47,120,18,124,0,106,229,175,220,152,187,246,
+102,204,235,255,18,191,203,99,250,49,231,197,99,96,62,76,190,17,100,209,15,92,182,120,244,184,91,236,171,33,80,111,
+144,42,142,117,190,236,136,19,102,222,221,174,227,209,64,53,62,95,240,168,207,84,69,103,192,215,106,131,31,162,7,105,
+46,59,141,1,26,112,90,241,124,36,216,4,104,21,142,139,12,196,243,245,52,162,222,116,81,98,126,27,51,64,122,205,
+194,211,83,193,46,64,141,235,122,162,193,79,193,36,58,3,59,226,52,110,131,240,94,242,250,55,209,131,40,143,75,120,
+81,100,47,33,191,42,143,158,9,38,214,13,143,18,55,173,92,130,254,10,207,207,184,40,48,191,137,25,208,66,147,199,
+192,18,160,94,253,164,129,202,11,201,111,31,115,204,133,144,231,245,182,164,58,153,73,197,234,207,164,204,181,246,151,164,
+79,168,45,174,214,70,245,105,64,19,202,105,136,38,139,222,0,103,144,151,53,208,213,46,209,160,157,254,83,245,254,107,
+113,109,210,91,69,101,149,187,137,184,86,11,215,91,140,42,126,53,16,218,63,192,29,28,31,7,105,148,97,113,39,148,
+48,99,188,169,244,99,146,11,6,78,198,138,37,29,44,81,185,114,35,216,11,40,207,165,38,148,91,215,83,78,14,36,
+128,219,193,116,30,2,234,137,142,57,129,6,255,77,82,100,32,104,175,43,175,104,50,185,55,233,120,29,71,45,24,212,
+91,149,51,131,89,129,198,99,53,57,63,19,80,123,94,117,225,24,160,177,40,45,166,209,88,130,220,235,158,174,149,110,
+239,130,167,128,234,2,181,229,198,146,32,220,112,251,179,213,121,232,178,0,70,186,71,130,115,117,98,210,241,12,188,76,
+12,213,214,206,66,230,205,34,144,188,133,145,164,177,92,47,14,174,122,180,66,192,228,55,6,212,64,155,231,183,75,231,
+179,143,209,208,215,89,139,41,72,194,128,38,209,52,168,235,42,131,92,21,152,255,98,50,64,99,77,141,177,29,192,22,
+192,117,128,66,13,181,107,65,47,96,146,2,3,164,215,236,168,189,14,104,80,169,153,104,240,60,213,78,91,179,192,139,
+246,12,94,197,87,207,152,118,127,139,251,171,99,250,41,163,243,243,136,180,58,127,7,131,172,26,221,190,121,254,8,133,
+234,152,154,100,207,128,202,177,75,193,58,96,25,80,153,33,228,40,209,128,232,227,32,111,29,119,213,169,106,107,39,149,
+235,146,122,52,127,45,25,136,251,214,165,20,106,160,234,74,48,173,46,82,16,13,158,93,196,160,214,63,83,208,29,87,
+229,42,120,152,48,174,167,6,238,85,110,150,85,84,46,29,4,142,2,131,129,38,233,52,200,168,173,222,53,184,217,7,
+124,10,42,18,14,104,134,215,30,143,10,51,174,40,191,155,180,159,129,101,49,97,47,80,93,231,197,177,106,20,142,213,
+70,221,63,197,252,53,150,61,132,243,4,237,105,229,249,127,0,215,246,222,140,232,88,20,216,68,14,36,100,41,164,163,
+218,93,90,164,38,244,203,40,108,45,148,208,68,144,139,104,97,249,67,46,10,204,111,33,24,120,20,43,235,45,146,72,
+203,120,245,53,74,39,174,19,48,33,97,26,104,116,145,17,46,158,59,208,239,166,196,73,179,230,190,228,9,95,138,76,
+79,108,6,198,196,246,81,223,131,38,132,76,74,198,0,141,109,197,120,13,160,70,247,108,186,112,16,85,114,90,69,122,
+61,13,192,175,29,244,152,215,6,12,144,94,75,241,232,12,208,106,18,71,26,52,88,213,29,216,91,57,98,163,181,236,
+132,147,57,91,59,27,203,197,45,228,245,87,198,186,99,23,141,24,80,25,163,149,222,127,2,174,109,186,70,97,164,121,
+255,238,52,149,155,238,198,12,240,31,211,195,1,148,127,187,112,212,132,141,234,44,45,58,80,187,69,29,246,163,193,112,
+144,39,81,62,79,42,26,224,125,49,169,103,243,215,146,129,159,91,186,24,215,193,172,220,154,102,220,219,206,119,52,144,
+127,35,56,157,124,174,133,48,121,144,173,60,25,161,254,73,105,243,49,233,169,201,144,155,2,120,162,52,145,154,36,249,
+221,117,0,62,145,161,230,105,28,6,246,228,206,236,227,220,141,118,67,59,109,156,0,46,142,230,220,159,43,242,254,117,
+212,215,235,163,81,237,106,87,89,28,5,54,48,239,202,98,254,253,31,142,137,171,57,154,169,118,224,41,142,58,204,123,
+78,25,8,198,172,100,157,218,215,107,101,108,230,135,25,135,151,139,224,124,76,228,204,65,76,92,86,181,137,136,202,202,
+162,160,51,152,11,98,218,108,196,238,30,195,87,3,241,78,143,250,76,85,60,6,124,173,154,155,32,94,176,230,186,67,
+24,152,139,120,156,9,230,119,140,143,102,132,250,129,191,83,206,246,117,212,229,236,157,202,94,35,127,130,242,117,8,93,
+135,34,123,171,161,73,168,255,195,118,29,115,41,196,73,43,243,46,7,203,71,52,80,43,85,22,1,255,223,222,121,192,
+219,81,148,239,223,208,67,232,189,73,2,132,222,123,135,96,193,130,138,52,17,233,40,42,93,138,2,130,16,80,16,12,
+77,20,16,41,10,130,252,164,27,58,72,9,136,210,9,134,222,67,77,104,33,33,4,8,144,255,255,251,28,118,195,201,
+205,205,189,103,119,102,247,236,57,231,121,63,159,39,187,247,156,157,119,102,190,51,103,102,118,102,118,115,87,131,215,119,
+236,101,176,213,141,242,225,40,75,59,248,34,215,31,143,108,141,19,208,19,57,175,163,35,144,22,25,91,197,180,24,122,
+139,18,235,113,100,83,139,236,73,98,223,26,45,131,22,70,35,145,250,157,88,27,90,112,21,110,73,91,189,70,128,39,
+237,52,212,78,106,91,49,4,242,212,151,185,35,39,101,12,254,206,65,167,211,166,104,49,167,74,182,110,164,196,136,243,
+99,145,124,217,77,126,2,121,54,179,206,69,59,214,143,186,89,181,5,242,252,20,90,51,228,150,57,147,173,114,59,26,
+149,190,136,83,151,222,189,56,255,18,90,176,238,179,60,167,3,243,4,114,152,106,19,160,125,169,79,96,127,254,56,0,
+133,206,27,107,62,114,88,189,99,159,183,37,129,125,201,85,104,93,201,10,166,35,55,109,198,128,172,137,149,250,9,184,
+172,224,117,125,150,201,153,60,254,91,41,140,58,84,77,8,198,50,237,28,188,55,150,51,251,201,76,32,214,205,190,110,
+42,109,29,68,128,65,148,218,197,19,144,158,242,8,109,99,117,211,160,221,52,122,164,185,48,235,50,240,75,211,220,245,
+56,39,9,88,0,45,134,150,64,154,164,215,185,62,87,158,53,122,252,24,141,67,175,32,213,253,145,58,226,255,5,142,
+122,237,133,22,168,39,85,101,210,150,116,173,69,122,78,71,107,163,44,54,197,72,57,75,192,14,187,118,48,249,205,178,
+152,169,9,170,35,42,56,1,87,201,98,235,242,59,250,45,245,89,191,175,195,208,60,149,76,240,212,137,82,59,49,124,
+234,143,253,73,153,4,146,122,164,186,243,120,162,50,163,207,18,215,145,92,60,75,150,0,117,215,106,210,181,153,147,111,
+117,73,105,219,211,119,115,228,44,29,103,228,8,58,69,144,143,248,75,139,194,7,82,159,159,157,226,155,38,253,209,101,
+92,149,110,0,137,145,26,181,155,182,230,19,208,107,221,178,218,71,212,79,47,226,100,165,22,247,250,29,113,183,72,14,
+151,122,18,231,32,202,79,11,197,77,51,226,31,75,219,114,62,9,208,38,169,16,155,63,36,176,195,182,4,1,61,105,
+189,120,96,74,181,33,98,207,64,31,14,94,125,2,235,146,68,109,230,42,211,180,153,239,166,50,35,172,74,92,49,22,
+114,52,16,212,141,77,223,128,76,213,38,187,53,88,165,99,9,112,211,22,65,191,77,46,98,78,158,220,221,22,84,90,
+55,19,49,22,41,245,58,135,39,90,23,129,83,158,147,192,89,132,251,14,154,41,103,248,250,96,167,242,199,221,180,175,
+133,46,28,168,253,166,29,87,95,48,0,45,140,212,153,107,209,102,117,212,31,233,221,186,106,223,244,90,177,250,223,198,
+180,26,254,250,244,234,252,77,164,73,66,45,72,93,140,180,3,188,169,70,126,149,63,77,12,174,159,49,33,186,153,123,
+36,99,152,142,187,28,190,218,217,243,131,140,25,191,142,235,255,158,49,140,47,79,8,240,59,30,2,247,167,248,243,120,
+180,98,11,128,25,214,2,105,116,18,43,64,128,122,189,18,201,216,44,32,41,218,24,245,92,64,120,7,237,157,128,54,
+111,148,109,90,128,212,98,240,209,180,127,215,151,29,121,134,248,246,224,90,141,159,98,152,159,6,142,65,49,220,199,71,
+57,92,204,66,91,166,87,90,141,208,184,219,214,20,2,95,38,214,250,251,152,70,18,161,249,46,141,171,154,186,136,83,
+151,208,99,56,63,24,205,84,247,89,214,83,221,219,217,218,151,192,230,100,109,139,192,236,233,254,253,183,72,253,172,173,
+189,9,108,66,246,102,44,57,139,195,232,7,111,40,57,206,74,68,23,99,33,103,102,114,18,58,138,208,187,180,109,159,
+17,216,61,34,8,237,74,254,83,68,127,118,149,157,64,191,236,65,166,10,161,14,112,162,7,235,83,113,105,219,15,184,
+65,211,174,149,237,145,118,13,135,182,175,183,225,67,187,174,222,70,65,70,186,52,129,176,52,210,192,189,254,73,154,5,
+147,207,180,136,163,197,154,217,145,110,112,82,233,21,131,58,87,94,66,242,179,16,225,181,112,178,17,218,155,244,60,202,
+241,42,137,223,199,72,142,205,176,173,137,244,107,57,34,126,131,52,191,151,35,92,199,4,161,124,183,33,179,131,81,150,
+221,243,154,4,60,220,237,37,20,2,12,126,67,225,175,69,83,45,40,15,66,49,198,139,184,137,110,234,31,175,136,238,
+213,14,219,149,192,17,100,108,206,156,153,211,152,250,220,156,97,29,172,113,2,101,63,105,160,113,196,137,232,162,198,147,
+216,180,43,179,110,106,232,41,161,26,27,218,154,79,160,182,153,53,99,50,52,158,214,102,169,17,25,195,249,242,120,4,
+86,201,232,74,147,216,26,79,105,66,187,18,198,56,239,35,198,121,122,34,108,177,128,4,101,25,159,7,68,227,160,77,
+32,160,251,245,227,80,232,92,214,67,212,181,51,154,144,126,71,89,62,129,21,74,142,242,3,226,211,248,173,35,45,198,
+141,185,30,243,14,109,196,99,237,46,106,201,66,164,19,77,211,189,20,39,171,166,127,68,56,62,64,195,249,112,4,63,
+118,145,159,64,200,46,151,52,214,143,211,147,222,142,117,117,73,151,234,247,173,129,227,242,104,9,164,142,120,17,164,223,
+219,220,72,79,70,104,17,85,215,77,66,106,12,21,151,158,20,24,133,52,184,211,68,222,61,168,102,212,167,244,212,199,
+2,8,36,229,183,35,174,143,70,90,12,9,5,254,16,62,126,68,185,189,200,177,91,35,78,213,209,37,145,30,143,215,
+96,126,94,164,186,177,18,82,93,145,244,157,218,121,45,200,232,122,73,231,170,59,186,161,148,116,174,244,134,166,25,23,
+211,52,249,86,188,146,54,17,108,136,148,206,175,144,15,253,255,63,55,114,94,182,237,65,132,121,250,192,103,202,78,104,
+43,197,71,121,110,79,122,135,32,213,199,44,118,6,245,64,237,150,45,144,0,28,159,197,197,87,41,139,125,56,30,132,
+212,78,84,205,180,32,122,67,213,18,229,244,84,143,0,245,88,227,235,45,2,82,166,39,40,47,14,8,239,160,141,17,
+208,19,79,26,147,106,92,81,164,189,132,115,149,231,81,72,99,229,170,155,158,250,93,57,82,34,71,226,231,31,145,124,
+217,77,24,129,209,57,131,231,93,144,206,25,157,131,117,33,160,123,163,44,118,21,23,255,44,75,128,146,174,213,56,79,
+247,126,121,173,232,118,58,111,186,28,46,156,192,233,184,88,43,208,141,230,150,212,199,218,58,131,192,124,37,103,115,24,
+241,221,94,114,156,149,137,78,19,111,161,54,6,7,227,144,118,97,231,53,173,100,104,119,247,203,121,29,180,106,56,110,
+44,235,147,190,27,127,104,178,61,150,121,144,30,139,100,126,63,51,230,15,58,57,164,22,84,106,214,165,190,164,31,175,
+200,137,118,6,173,129,150,67,11,34,45,216,232,201,5,221,12,43,13,121,7,90,10,255,14,210,141,198,157,196,127,39,
+199,235,208,123,200,175,66,20,132,72,6,91,149,209,166,232,104,180,104,160,91,53,44,111,161,139,208,178,248,94,143,227,
+50,72,11,50,186,249,208,66,158,164,197,16,45,66,168,253,86,127,80,191,64,147,46,220,40,93,121,235,15,65,11,53,
+45,232,204,131,190,138,22,36,159,125,153,212,213,205,82,41,70,124,139,19,145,126,123,121,236,133,188,55,152,161,0,0,
+32,0,73,68,65,84,60,129,58,33,12,92,143,37,159,123,161,172,3,194,171,9,115,124,39,48,42,51,143,252,166,206,
+160,76,110,35,206,195,208,183,144,126,115,85,177,135,171,146,16,167,163,242,4,126,69,10,181,65,34,143,125,76,160,33,
+105,64,126,19,233,169,143,241,9,188,136,75,141,61,139,26,119,104,108,116,1,58,9,141,106,161,178,60,146,244,106,140,
+22,195,110,36,223,121,94,233,21,35,110,251,72,8,168,238,209,183,190,200,159,90,72,204,58,39,163,49,188,173,121,4,
+178,252,22,31,37,153,187,53,47,169,61,198,60,182,199,111,123,255,50,198,60,71,239,177,248,138,178,9,104,227,64,140,
+39,64,207,195,207,245,101,39,222,241,53,141,192,107,37,198,252,58,113,117,244,61,127,214,65,67,119,101,51,129,15,67,
+23,114,212,25,106,197,183,227,22,114,186,0,253,126,151,191,67,254,212,228,251,185,33,14,28,54,63,1,6,230,10,60,
+103,162,252,142,62,11,169,69,147,153,240,185,44,199,117,144,38,142,53,129,188,38,210,132,154,38,227,99,252,150,113,51,
+149,233,70,90,147,169,146,22,140,52,185,250,24,186,6,29,142,108,241,8,12,196,213,111,145,142,49,76,139,51,42,47,
+149,161,218,88,45,18,235,168,197,15,13,188,139,170,51,184,46,221,148,175,213,208,190,252,78,94,226,230,248,193,146,82,
+160,65,174,126,127,89,77,13,196,61,89,3,181,243,245,148,155,102,70,85,39,53,89,250,19,164,133,196,70,77,60,245,
+132,211,126,148,189,118,127,217,34,19,128,235,19,184,220,149,114,82,251,164,242,217,14,245,71,121,77,19,181,239,34,29,
+213,191,228,181,127,228,13,232,112,83,19,160,124,213,111,76,160,188,53,177,216,210,70,94,234,211,191,3,127,104,17,50,
+175,93,3,147,255,203,27,216,225,50,17,232,203,213,26,167,196,54,181,55,23,163,95,163,209,148,103,108,255,69,250,219,
+2,231,95,137,20,129,238,15,79,141,228,203,110,194,9,204,134,139,60,227,241,178,95,97,19,158,211,246,242,208,232,216,
+95,155,0,126,72,123,163,249,178,42,218,171,129,137,242,152,59,16,96,69,131,31,71,186,66,55,109,189,142,15,221,211,
+217,58,135,192,136,146,178,170,1,254,153,232,174,146,226,171,100,52,121,6,14,221,101,36,198,174,30,173,252,150,182,147,
+186,187,76,52,249,179,45,137,127,201,136,105,184,13,95,90,0,176,53,143,128,22,114,26,29,232,245,148,202,101,249,82,
+157,97,104,135,218,83,28,89,190,91,145,139,165,61,152,40,249,27,199,211,209,75,200,79,232,8,66,14,131,163,202,248,
+68,164,133,186,24,179,11,242,161,186,183,52,234,20,83,127,182,6,82,91,90,214,66,206,214,57,225,78,36,220,35,57,
+195,182,93,48,234,191,38,238,214,70,167,160,213,145,22,31,27,53,13,230,94,70,63,230,70,249,149,70,3,249,186,124,
+4,96,252,44,33,127,78,153,29,197,241,155,104,27,164,215,253,44,143,166,71,211,50,77,102,188,143,70,163,219,209,245,
+232,58,164,221,241,121,109,60,1,181,169,192,22,143,128,158,222,188,57,158,187,74,120,210,66,255,145,72,125,98,30,211,
+88,250,180,60,1,29,38,23,129,145,132,210,152,119,145,92,161,167,14,164,133,11,181,57,218,124,244,76,139,45,224,164,
+185,25,204,137,234,113,12,251,59,78,158,138,225,200,62,162,16,80,253,212,60,74,214,246,105,177,40,177,219,73,94,2,
+143,17,176,145,54,74,237,217,125,121,35,41,33,92,214,122,215,53,73,227,186,126,224,191,91,143,0,99,250,250,68,15,
+230,143,77,234,63,200,121,254,103,194,213,230,135,114,134,119,176,214,35,160,249,103,45,14,47,90,112,210,181,136,243,155,
+130,227,168,188,251,88,11,57,250,145,46,21,152,219,78,223,89,178,23,252,178,76,94,245,132,91,19,38,127,234,233,2,
+127,87,10,1,13,240,38,161,208,114,213,110,173,42,218,2,36,234,96,164,201,243,147,145,38,229,108,25,9,48,120,154,
+159,32,154,20,213,142,203,24,139,56,25,83,208,86,151,207,65,110,190,14,211,179,153,172,9,221,101,214,35,24,226,232,
+199,5,43,245,120,209,180,191,124,135,244,141,152,246,215,157,243,13,28,245,42,200,125,209,79,81,214,39,51,116,231,161,
+133,129,159,195,115,24,71,91,73,4,224,173,93,152,87,72,148,161,98,29,136,52,166,212,88,80,227,57,45,234,104,44,
+162,93,240,159,34,77,122,220,143,234,77,139,174,33,175,135,121,134,240,111,215,59,244,121,126,2,148,227,198,132,94,60,
+191,135,202,134,212,120,56,228,30,227,90,194,223,85,217,220,181,103,194,52,185,221,200,36,105,79,185,215,83,101,90,180,
+56,21,13,239,233,194,138,127,119,44,233,91,51,82,26,213,94,158,27,201,151,221,196,33,240,10,110,52,25,174,123,129,
+44,54,87,150,139,125,109,116,2,183,226,241,171,13,120,13,125,117,89,3,81,4,93,50,123,80,104,111,26,14,196,87,
+185,224,218,76,167,57,73,141,225,67,236,63,4,30,28,226,192,97,91,146,192,227,164,250,74,180,95,65,169,215,188,234,
+80,238,65,53,111,208,241,166,155,238,24,166,1,242,102,129,142,150,8,12,223,202,193,191,72,226,55,138,152,129,135,241,
+165,1,134,173,185,4,52,113,16,186,136,211,220,28,52,22,187,126,251,154,64,159,128,180,235,209,214,32,129,100,18,251,
+23,92,190,13,138,213,30,55,24,123,91,94,166,223,155,250,146,213,80,161,11,57,248,255,26,202,187,147,237,101,194,118,
+180,81,247,251,2,96,32,26,140,242,62,217,52,134,176,39,49,160,187,148,163,173,73,4,224,175,152,159,77,162,127,146,
+99,67,139,250,212,129,173,146,48,121,15,46,247,188,228,234,194,81,14,122,141,225,247,209,254,232,143,117,95,181,195,233,
+119,201,196,246,1,25,209,98,161,158,228,176,149,75,96,36,209,229,221,40,161,148,106,17,249,0,218,166,179,244,71,43,
+26,191,75,37,91,147,106,123,163,90,35,171,15,2,237,159,48,121,36,208,135,131,199,39,160,250,154,213,52,214,181,53,
+143,192,153,68,173,77,120,179,246,146,132,69,249,94,139,110,239,246,114,93,179,190,214,56,60,196,70,133,4,118,216,202,
+17,56,153,20,45,16,152,42,205,7,105,3,130,173,51,9,232,73,172,239,33,109,212,140,109,151,225,80,247,43,54,8,
+196,154,100,142,241,136,118,255,14,46,145,67,201,187,118,119,199,178,243,98,57,178,159,124,4,146,137,173,117,242,133,110,
+201,80,218,45,248,219,150,76,121,147,18,205,77,250,210,68,125,4,210,206,151,188,11,2,77,74,125,165,163,213,130,152,
+22,199,139,182,65,68,144,183,15,125,180,232,196,85,213,63,245,126,122,164,246,66,117,255,110,148,119,17,71,59,139,245,
+36,142,110,58,108,173,73,96,195,128,100,79,36,236,141,1,225,29,20,2,252,22,181,160,122,10,58,13,173,140,86,65,
+250,92,135,86,183,185,201,128,242,214,219,68,219,180,242,169,215,29,253,6,105,81,193,86,46,129,59,3,163,211,110,224,
+139,3,125,84,33,184,38,68,230,141,148,144,167,241,243,203,72,190,236,38,46,129,60,109,140,218,110,91,243,8,188,71,
+212,106,103,122,51,61,105,245,19,250,212,233,212,175,86,176,111,93,184,183,12,244,242,125,199,222,207,244,194,165,21,191,
+62,144,68,111,18,33,225,87,113,111,118,147,230,194,82,69,240,105,23,21,39,144,150,53,71,181,9,231,163,79,35,38,
+89,227,241,223,33,47,226,212,65,205,59,9,85,231,162,118,122,71,215,15,114,252,173,1,73,39,77,124,167,136,230,228,
+100,135,244,143,8,199,255,225,195,143,205,71,0,25,193,197,50,17,124,180,146,139,117,25,160,14,169,224,32,181,82,12,
+225,179,28,218,142,68,29,139,246,65,190,25,139,95,66,31,198,119,57,149,199,144,93,108,79,77,229,173,3,62,160,222,
+175,65,54,127,142,46,71,90,200,153,29,229,177,199,9,244,11,6,139,26,40,218,90,140,128,250,8,180,34,201,94,44,
+32,233,175,81,254,195,117,227,96,203,71,128,50,152,145,144,135,160,61,144,198,162,90,4,223,20,181,100,159,148,212,171,
+218,68,25,231,202,131,158,12,11,217,181,126,51,225,47,68,182,242,9,60,64,148,147,114,70,251,62,225,78,165,109,24,
+151,51,124,85,130,105,33,106,173,72,137,153,136,31,109,122,24,29,201,159,221,196,37,144,231,105,13,141,159,230,81,187,
+103,107,26,129,115,136,249,131,94,98,215,43,170,126,134,98,76,144,247,18,85,182,175,169,59,75,19,34,100,215,188,218,
+232,135,178,197,234,171,43,74,96,61,210,117,20,10,125,165,154,22,165,7,35,91,103,19,208,166,145,91,34,33,120,13,
+63,122,149,154,30,124,176,213,17,136,181,144,243,42,62,243,12,66,234,146,82,219,217,172,27,200,78,51,237,22,156,39,
+98,166,53,168,200,123,243,19,49,25,157,237,138,193,145,118,53,172,219,129,20,244,40,165,173,11,1,234,195,236,104,53,
+180,11,95,105,135,239,249,72,187,10,98,181,193,184,178,65,64,119,180,122,221,214,136,18,104,132,60,69,217,81,175,86,
+163,222,107,241,242,199,148,201,95,144,158,220,27,128,242,154,54,43,252,196,139,56,121,241,85,38,220,230,164,68,175,244,
+202,107,215,231,13,232,112,147,9,108,192,217,254,168,254,137,80,45,80,235,201,156,86,183,161,100,96,253,128,76,168,15,
+57,40,32,188,131,134,17,208,98,125,222,123,153,187,8,171,69,184,150,52,250,74,45,70,238,74,226,183,141,152,129,43,
+241,245,231,136,254,236,42,46,129,55,114,184,155,141,48,139,230,8,231,32,241,8,92,138,43,77,86,234,222,163,39,211,
+98,201,9,104,113,93,164,223,120,69,76,155,10,67,238,67,223,38,252,191,42,146,23,39,35,39,1,234,163,218,17,189,
+205,103,174,156,46,210,96,159,112,114,22,122,54,253,192,199,142,38,160,5,236,97,1,4,52,6,188,13,173,199,61,255,
+185,218,184,151,42,192,167,131,214,19,72,6,156,234,148,238,68,161,118,103,189,239,118,60,7,80,186,91,80,199,101,209,
+187,161,208,234,194,63,221,142,204,170,156,39,216,215,151,231,198,252,253,23,244,38,234,84,251,148,140,107,114,200,6,1,
+88,204,139,86,71,7,161,187,144,248,216,138,35,48,17,215,255,64,218,105,94,168,17,199,176,128,108,236,92,104,226,42,
+226,28,62,171,160,195,208,221,104,18,10,49,133,191,28,173,93,145,236,57,25,57,9,80,134,106,27,239,64,121,77,237,
+232,215,115,70,239,96,16,128,159,54,23,252,175,155,2,208,239,236,70,212,114,156,148,230,68,23,115,12,105,111,222,33,
+188,235,87,147,107,0,101,240,2,202,106,227,9,240,157,38,39,61,40,122,210,191,17,138,121,31,49,28,127,233,111,35,
+40,109,14,28,159,64,82,54,7,115,204,106,234,7,55,70,241,19,101,143,189,18,16,247,68,253,57,234,55,214,155,169,
+188,46,65,253,80,175,254,203,184,128,116,168,175,15,49,205,253,213,56,148,145,94,199,81,12,1,202,240,178,144,74,80,
+23,246,6,215,135,98,202,168,213,188,166,245,128,227,122,232,58,148,213,238,35,192,1,200,237,75,15,133,175,215,40,196,
+50,189,15,111,227,64,103,203,7,134,111,181,224,218,157,161,215,89,196,50,173,130,219,202,39,160,27,254,95,32,61,129,
+147,247,93,236,229,167,186,152,24,181,179,167,140,215,90,21,147,250,72,94,233,120,244,148,221,23,145,118,59,105,210,190,
+182,11,139,163,173,56,2,186,51,210,227,183,67,217,177,241,113,113,209,76,246,172,247,181,230,181,85,9,248,183,188,129,
+171,30,142,250,191,41,105,220,10,105,76,160,188,134,62,170,63,30,31,67,208,249,148,237,43,28,109,173,77,64,79,128,
+44,19,144,133,183,8,123,99,64,120,7,253,194,23,126,13,132,238,158,188,233,195,231,250,253,254,0,253,29,181,154,221,
+64,130,67,22,97,212,119,156,134,92,191,154,95,242,106,235,7,100,76,198,112,174,215,14,249,150,49,77,84,212,217,146,
+156,159,143,230,171,251,44,228,84,12,247,11,113,224,176,165,16,120,142,88,84,17,212,254,54,106,186,223,82,125,209,19,
+104,182,230,17,24,73,212,7,32,141,233,117,223,55,45,83,121,105,92,252,8,210,255,245,160,221,230,205,182,208,141,81,
+87,52,59,3,142,63,140,0,253,143,230,14,183,14,243,82,11,173,215,118,30,19,193,143,93,180,23,129,123,200,206,94,
+72,109,164,230,196,122,106,35,199,242,253,195,232,50,116,53,210,156,142,173,72,2,26,128,38,218,140,99,168,125,130,131,
+218,238,18,142,69,38,187,105,190,149,175,68,226,53,1,197,178,123,113,212,180,124,117,74,196,98,92,167,45,56,191,22,
+233,41,0,219,103,4,198,114,136,185,64,220,82,85,139,188,207,130,22,65,67,208,171,200,86,14,1,237,190,126,29,157,
+128,74,89,76,37,158,243,80,94,251,111,75,85,236,6,18,11,136,153,209,110,232,82,244,34,138,101,247,227,232,219,104,
+150,6,146,225,75,90,128,0,101,57,40,176,114,232,201,172,22,200,105,53,147,8,187,37,208,184,94,202,224,137,106,166,
+254,243,84,169,14,212,73,125,239,85,40,228,73,28,133,61,51,245,249,121,76,62,107,6,1,202,225,15,40,171,29,214,
+140,180,134,196,73,6,211,122,172,62,244,193,172,25,238,225,122,189,241,65,19,39,182,10,19,160,140,84,254,122,114,63,
+143,13,38,80,133,115,215,57,73,163,28,118,68,111,55,80,136,122,226,115,123,212,7,53,13,16,113,111,135,66,108,52,
+129,87,64,181,246,171,105,25,113,196,185,9,80,118,59,161,24,115,145,154,191,61,38,173,11,58,218,76,160,158,64,82,
+55,214,73,234,137,158,4,124,30,141,66,247,160,179,208,182,40,29,11,213,7,245,121,15,4,98,78,184,234,63,166,28,
+133,22,234,33,190,222,190,210,174,93,237,14,232,132,221,37,39,146,207,190,189,1,105,240,251,137,92,167,221,29,182,114,
+8,172,64,52,39,163,77,81,172,50,44,39,229,197,199,114,31,81,232,29,169,29,101,116,62,218,69,167,167,112,180,171,
+69,187,14,244,31,121,219,202,33,160,93,109,234,123,46,65,103,243,196,198,132,114,162,253,66,200,171,44,151,47,41,141,
+133,71,67,221,95,141,72,118,65,235,161,229,208,220,40,134,125,128,19,149,233,209,126,10,39,6,206,74,249,216,41,48,
+53,151,7,134,239,244,224,39,0,96,246,94,32,44,195,111,123,55,174,249,107,122,29,191,195,244,180,106,199,133,73,144,
+118,239,173,19,152,176,123,9,191,119,160,15,7,143,71,224,14,92,237,155,209,221,243,25,175,175,202,229,115,144,16,61,
+77,182,70,164,4,169,255,60,5,105,103,171,173,250,4,222,35,137,159,34,205,131,100,177,88,227,173,44,113,250,218,238,
+9,92,202,199,139,163,35,80,191,238,47,169,125,170,50,59,14,189,136,38,111,194,109,66,255,170,116,134,216,157,4,214,
+255,101,102,107,65,2,140,239,6,145,108,205,101,197,152,199,186,150,250,123,116,11,98,112,146,75,34,144,180,111,154,35,
+148,108,85,34,64,99,144,174,160,13,229,60,212,110,197,65,219,174,238,39,121,59,149,99,200,174,193,174,140,253,142,210,
+130,126,16,105,93,76,142,211,113,60,2,189,137,108,83,19,120,131,143,180,211,183,160,210,168,158,91,229,21,169,94,40,
+223,218,97,224,167,179,128,80,146,169,13,253,24,61,134,14,68,154,8,41,205,136,111,19,148,215,148,118,77,178,180,164,
+145,246,129,72,239,116,255,55,210,142,154,152,245,94,108,84,166,219,160,158,110,134,91,146,157,19,93,251,255,89,30,160,
+108,243,154,38,188,108,57,9,0,125,37,164,167,23,27,177,74,255,223,26,100,64,253,175,158,226,127,166,145,204,244,114,
+205,211,124,175,197,171,244,126,38,39,97,7,139,69,128,178,208,83,86,122,170,36,139,237,26,43,254,178,252,144,185,197,
+81,204,39,113,52,46,250,101,89,233,119,60,113,8,80,102,175,161,172,246,103,2,196,73,128,189,4,17,80,57,160,153,
+208,9,232,35,212,147,105,156,171,69,156,197,80,173,207,9,138,60,99,96,226,220,1,125,138,242,154,158,226,88,19,185,
+191,204,200,190,10,151,83,110,43,34,141,121,98,216,203,56,89,161,10,249,114,26,76,192,4,114,16,224,7,156,54,228,
+123,71,104,17,70,166,254,114,36,165,242,65,200,219,214,232,253,8,156,82,23,122,149,213,151,80,233,3,129,202,195,142,
+144,192,148,107,194,248,17,142,182,238,9,188,199,199,123,71,64,222,82,46,200,243,236,104,119,244,20,210,192,92,178,149,
+67,64,55,189,39,35,45,42,148,222,254,17,231,66,72,245,62,175,41,236,86,168,178,117,158,180,245,65,51,34,77,168,
+45,128,246,65,119,163,183,144,38,139,98,153,126,55,122,52,95,139,66,199,35,197,87,89,46,78,88,118,2,42,207,68,
+3,56,126,128,242,90,39,60,177,157,29,112,131,33,128,190,95,6,240,154,232,249,49,42,189,125,109,36,59,164,235,103,
+232,109,20,106,242,177,113,35,113,250,154,242,8,80,38,170,119,35,50,22,174,158,136,110,9,75,242,183,38,199,88,19,
+106,66,53,17,157,137,90,130,129,19,249,57,1,202,44,79,61,56,215,101,253,57,195,102,158,169,28,18,205,201,241,34,
+212,219,24,89,253,235,149,104,110,84,90,210,147,248,52,215,22,98,218,184,157,230,183,180,180,59,162,56,4,40,59,109,
+0,143,97,90,176,172,253,135,244,113,82,102,47,38,96,2,165,19,224,71,156,54,230,115,112,62,38,176,101,208,100,206,
+210,169,207,210,51,19,57,194,52,31,201,81,43,224,161,157,39,46,166,176,19,249,43,229,31,57,245,118,151,176,61,130,
+99,104,189,158,162,208,218,236,15,61,161,36,70,29,85,97,200,239,50,72,131,117,253,95,3,94,192,1,66,73,166,155,
+221,33,104,21,164,69,134,166,213,59,226,190,9,133,152,118,198,107,135,252,108,168,105,249,72,35,38,13,122,186,172,47,
+154,7,45,136,214,64,191,65,255,69,90,120,42,162,158,235,102,87,109,136,110,12,87,71,105,114,124,108,35,2,42,215,
+68,251,115,12,49,239,52,15,168,23,128,215,147,163,89,236,30,46,174,149,93,64,180,81,130,166,233,224,56,0,221,134,
+66,118,20,19,188,102,90,84,220,47,74,2,237,36,42,1,202,69,245,238,184,90,41,53,254,79,203,252,103,203,100,105,
+23,164,190,47,150,169,47,61,35,106,33,216,89,105,4,40,187,171,115,84,132,243,8,83,90,26,29,81,207,4,84,22,
+137,230,231,120,61,234,109,204,172,223,172,22,227,102,235,217,115,188,111,147,116,113,200,109,99,9,185,57,74,243,26,47,
+113,246,84,56,1,202,77,245,50,150,157,129,163,90,61,40,60,225,142,192,4,76,160,24,2,233,143,56,57,254,45,66,
+235,160,93,214,109,209,48,164,249,224,56,43,210,107,42,98,218,163,56,171,77,100,114,108,11,94,197,212,208,252,94,225,
+122,57,234,109,32,198,37,29,105,226,114,63,250,1,234,168,250,71,126,181,136,112,13,250,16,217,138,39,240,26,81,252,
+19,109,129,244,100,72,63,212,244,255,176,129,52,28,132,66,39,19,85,135,126,143,150,67,115,230,111,173,178,133,36,46,
+61,109,51,147,226,68,139,34,109,160,208,211,157,71,160,219,145,152,23,105,186,129,29,141,116,83,241,237,108,169,247,213,
+173,70,128,50,174,245,17,28,175,64,121,77,27,125,150,109,181,188,87,41,189,240,203,250,132,131,218,183,157,81,211,179,
+161,52,160,67,145,218,141,24,166,167,23,142,108,122,198,156,128,110,9,80,54,42,239,117,144,202,169,81,59,173,91,103,
+21,250,144,140,172,141,110,71,106,207,98,217,120,28,29,137,42,148,83,39,37,11,129,164,252,178,214,135,243,93,230,89,
+40,151,119,45,229,178,12,122,184,129,2,213,83,13,90,204,153,27,21,122,47,141,255,51,145,250,244,16,187,152,192,233,
+120,174,208,244,150,87,90,157,17,19,229,166,242,143,53,167,245,16,190,180,96,233,58,208,25,213,199,185,108,103,2,233,
+15,153,227,214,40,116,112,170,27,205,182,104,24,146,124,104,183,245,191,81,76,211,142,136,47,183,115,157,106,70,222,96,
+154,14,78,52,177,121,23,138,213,225,225,170,109,76,19,176,26,156,238,223,140,50,106,118,156,228,251,27,72,3,24,47,
+226,0,161,64,75,23,111,246,36,14,45,50,44,128,102,104,118,249,215,199,79,122,116,227,165,182,56,134,189,138,147,95,
+163,53,209,18,40,234,255,15,35,127,72,79,217,44,143,86,69,155,162,237,208,177,232,6,164,255,227,170,44,123,159,136,
+110,67,187,215,243,244,121,123,18,160,156,211,126,85,71,189,79,59,175,61,79,192,246,132,84,66,174,96,55,31,122,43,
+7,124,109,66,42,33,133,83,70,161,56,235,180,57,231,122,58,40,244,254,2,23,53,147,159,243,167,140,209,127,85,145,
+0,229,164,223,125,163,118,113,21,243,160,52,145,129,190,232,108,52,166,209,204,52,120,157,250,238,142,28,143,87,181,172,
+243,164,139,50,252,110,131,229,93,127,217,233,252,145,39,58,135,41,152,128,202,5,109,140,70,161,222,76,247,213,122,34,
+171,176,137,113,124,239,131,66,239,91,159,195,135,54,38,215,247,205,5,147,180,251,24,4,40,179,63,35,213,179,24,246,
+10,78,86,64,147,235,65,140,52,218,135,9,152,64,54,2,69,76,138,93,73,18,94,64,3,179,37,101,138,171,151,227,
+175,117,209,189,83,124,218,154,127,104,50,238,22,180,94,196,228,107,212,118,34,186,53,162,79,187,250,156,192,66,156,254,
+31,218,232,243,143,58,254,236,83,8,188,134,110,72,116,117,167,17,97,192,162,167,37,246,68,63,68,218,21,222,244,39,
+66,72,67,59,217,219,100,230,113,244,111,52,28,61,134,244,31,155,191,213,167,79,159,9,28,43,103,164,75,19,50,255,
+34,97,91,71,72,220,34,248,208,238,112,189,58,234,97,164,133,228,219,56,42,239,227,209,56,244,17,250,24,125,130,62,
+72,206,167,227,216,23,205,132,84,71,103,73,206,213,247,76,143,244,202,134,5,145,250,228,37,209,106,104,110,52,7,42,
+219,148,151,251,208,245,232,140,170,150,107,217,80,58,40,62,213,189,69,3,242,171,182,193,150,159,128,218,152,121,115,4,
+95,133,48,199,162,163,114,132,13,13,178,57,14,212,46,234,158,64,109,92,12,155,132,147,147,104,127,14,139,225,204,62,
+10,39,160,241,248,225,13,198,18,171,142,52,24,93,99,151,209,151,235,149,111,187,161,197,27,11,209,240,85,15,114,229,
+193,104,88,195,33,124,97,85,9,140,32,97,26,219,205,144,33,129,111,101,184,214,151,150,79,224,46,162,60,62,81,79,
+155,179,84,230,91,162,149,209,201,232,76,20,100,180,57,245,225,247,227,143,227,208,204,245,31,102,60,215,253,135,242,162,
+113,124,205,232,67,211,83,31,43,70,160,75,249,15,38,121,187,163,44,109,203,180,114,164,123,207,67,209,227,211,186,192,
+159,155,128,9,148,67,32,90,11,220,165,193,208,205,222,49,129,89,248,59,225,119,108,181,78,162,11,135,141,200,195,95,
+209,82,40,166,13,195,217,32,57,108,53,62,74,115,149,141,242,211,132,231,77,104,213,42,167,179,224,180,165,19,197,47,
+19,207,221,232,126,116,45,122,185,83,235,27,245,98,29,242,255,67,244,29,164,133,62,91,24,129,49,4,127,13,61,138,
+180,104,243,20,26,141,198,38,199,119,169,107,186,161,173,188,81,55,6,145,200,75,209,252,5,37,246,67,252,234,102,93,
+188,180,160,163,191,117,67,37,134,58,159,30,205,137,116,147,184,24,210,2,141,22,118,148,30,13,218,163,245,243,248,202,
+107,90,132,186,11,221,140,174,164,108,95,201,235,200,225,90,143,64,221,184,72,227,194,144,197,128,221,8,127,65,167,246,
+67,161,37,79,57,244,199,135,218,220,60,239,227,215,111,248,43,72,227,129,154,197,46,135,186,122,178,58,17,108,135,118,
+68,106,211,180,88,29,203,212,175,92,66,218,119,137,229,208,126,138,37,64,189,88,145,24,84,239,212,175,245,102,151,81,
+182,223,235,237,162,178,190,39,237,106,243,118,70,75,68,142,83,99,128,235,208,190,228,247,245,200,190,237,174,9,4,146,
+246,79,247,92,27,52,24,253,36,174,251,46,186,38,118,91,220,96,252,190,172,7,2,117,253,153,218,45,45,206,236,137,
+26,153,72,87,31,117,47,210,166,174,59,81,205,178,150,113,18,191,22,110,254,130,182,69,51,214,28,229,251,71,171,66,
+154,151,219,169,62,120,214,52,213,135,245,121,177,4,234,234,223,233,196,244,19,52,83,132,24,181,169,247,108,180,79,234,
+203,117,32,37,225,163,9,148,79,32,234,4,79,93,163,161,155,197,135,145,118,253,230,53,77,232,45,69,3,241,118,94,
+7,205,8,87,199,96,8,241,171,211,214,4,91,76,123,26,103,27,163,55,228,212,13,168,40,196,49,202,110,62,60,93,
+134,6,197,241,88,89,47,154,252,85,103,172,27,65,77,168,190,139,52,81,172,9,245,231,144,118,204,63,139,92,191,96,
+64,189,88,147,195,47,208,22,168,31,178,53,70,64,117,76,245,107,20,82,253,82,157,122,19,189,128,222,65,154,24,84,
+59,54,138,118,76,11,20,45,107,212,145,35,73,252,96,164,69,21,219,231,4,84,190,90,188,185,17,221,74,57,171,46,
+216,58,140,64,221,184,104,40,89,255,118,206,236,191,71,184,1,232,29,143,123,114,18,36,24,101,49,140,195,38,57,61,
+104,194,88,155,25,30,80,248,208,114,168,171,23,186,23,249,58,250,26,82,253,88,28,53,50,225,197,101,153,236,19,174,
+254,3,233,62,40,83,40,95,220,116,2,212,149,255,144,136,245,27,72,200,245,148,175,198,106,77,51,210,186,50,145,239,
+143,190,133,22,42,32,33,47,226,243,40,242,249,183,2,124,219,101,147,8,36,237,225,17,68,255,155,6,147,240,18,215,
+105,190,37,184,45,110,48,62,95,150,131,64,82,174,243,18,244,2,244,77,164,254,174,17,155,200,69,154,75,187,8,253,
+137,223,187,250,175,134,141,120,119,229,98,213,167,165,27,14,52,237,11,239,39,126,109,104,180,181,8,129,186,246,228,104,
+146,28,178,136,87,159,227,171,249,99,171,250,15,168,23,245,127,250,220,4,76,160,68,2,81,127,125,73,163,145,38,255,
+6,78,116,99,22,98,23,210,64,168,35,106,25,131,129,242,172,65,152,38,127,99,155,38,67,181,56,164,134,180,102,110,
+64,83,18,225,71,202,238,118,188,12,10,247,212,52,15,255,143,152,53,121,174,201,83,45,128,106,178,92,131,64,157,107,
+2,93,147,168,58,62,73,189,209,119,182,94,8,80,39,180,184,55,4,105,55,211,108,189,92,94,165,175,53,224,159,14,
+169,62,104,215,158,218,250,116,55,142,254,214,119,89,77,245,75,143,84,107,1,80,79,109,105,177,93,245,72,139,48,154,
+100,77,207,85,207,70,35,165,65,117,79,11,133,250,94,159,143,163,238,105,33,177,173,140,122,50,15,25,186,16,53,117,
+2,169,66,80,85,254,215,160,43,208,189,148,249,152,10,165,205,73,41,153,0,191,143,52,70,181,7,250,173,228,49,61,
+209,85,91,128,240,184,39,15,190,207,194,80,22,131,57,59,58,191,135,218,107,85,46,39,252,97,148,131,22,118,26,182,
+186,122,48,43,129,54,69,154,212,90,21,173,136,242,214,11,130,54,100,234,187,78,39,205,135,53,116,181,47,170,20,1,
+234,206,142,36,72,125,108,111,99,151,39,40,227,21,202,76,124,82,175,151,39,206,31,163,205,144,226,143,53,113,134,171,
+201,166,177,211,45,104,95,244,146,219,193,201,92,218,226,36,169,71,115,145,153,145,104,142,6,50,165,118,88,79,46,122,
+33,167,1,88,205,190,132,242,93,142,52,92,137,212,86,100,53,221,71,61,131,238,70,255,66,79,162,55,144,238,173,82,
+91,154,147,13,208,134,232,235,104,81,212,91,123,201,37,189,218,19,92,177,59,237,205,189,189,94,233,11,42,67,128,250,
+246,23,18,179,35,138,213,23,105,83,222,15,209,43,104,178,185,31,154,140,194,39,38,80,58,129,34,23,114,212,137,92,
+139,66,118,40,171,131,82,135,52,2,213,172,106,13,70,50,240,82,218,22,70,191,67,154,240,157,5,197,182,247,113,248,
+75,242,127,122,108,199,157,238,143,50,156,1,6,23,35,13,136,163,254,38,10,100,251,22,190,213,153,190,140,110,69,143,
+33,253,78,52,89,49,14,213,172,106,191,151,52,93,173,112,164,94,168,237,58,36,209,124,77,72,179,22,66,180,35,75,
+229,169,182,80,55,241,58,151,52,168,215,81,215,76,64,90,68,145,105,208,174,58,160,207,85,151,181,104,83,191,144,163,
+25,85,73,215,169,222,203,244,183,206,53,216,251,24,165,11,61,253,56,87,188,242,149,134,83,26,210,133,156,241,156,43,
+29,138,127,242,57,117,78,159,117,156,81,95,150,34,211,231,160,205,58,46,243,159,103,120,36,167,23,162,27,209,227,157,
+90,23,62,199,225,51,17,72,198,73,139,115,250,28,74,219,29,125,149,197,78,225,226,131,21,192,253,90,22,108,83,94,
+75,89,204,197,39,26,59,168,125,15,49,245,51,79,163,123,208,181,232,1,164,126,66,139,182,234,183,22,64,234,63,214,
+68,203,160,53,208,162,201,223,115,114,108,100,162,146,203,162,152,250,199,227,169,55,39,71,241,102,39,77,33,64,221,125,
+149,136,23,233,37,114,141,95,134,162,159,82,222,218,80,80,136,145,22,141,161,182,69,91,35,45,70,46,137,210,205,50,
+156,70,53,253,174,30,65,199,161,203,221,254,69,101,91,25,103,73,63,169,244,92,135,190,217,75,194,52,22,223,18,221,
+172,235,92,39,68,161,218,150,148,239,55,72,229,31,145,218,139,188,166,246,64,247,119,186,239,210,220,208,204,72,155,246,
+230,70,250,92,138,101,106,115,119,69,122,162,62,150,79,251,41,128,64,93,251,33,239,103,162,159,32,245,83,49,236,65,
+156,124,7,189,150,58,115,125,72,73,248,104,2,205,35,16,189,85,238,210,144,104,130,249,75,129,217,27,70,248,65,245,
+62,170,212,120,144,223,129,164,237,32,180,3,210,13,114,17,166,201,213,83,209,161,85,202,123,17,25,45,219,39,229,167,
+129,143,6,85,223,71,177,58,188,152,217,208,68,200,24,164,78,244,81,52,2,61,140,158,71,147,92,31,160,80,144,81,
+55,116,35,117,58,210,4,125,25,166,197,184,255,34,77,144,105,177,68,101,175,163,202,127,28,210,130,137,22,73,36,237,
+108,215,113,34,117,64,237,131,173,2,4,168,51,218,89,254,79,84,86,157,169,64,174,107,55,144,106,147,206,71,119,160,
+231,169,147,170,183,54,19,168,17,224,119,161,227,143,144,22,58,243,152,38,103,215,70,15,41,176,251,61,81,200,111,148,
+199,77,132,222,60,191,135,110,67,170,31,210,102,0,245,95,154,84,210,66,145,62,43,106,114,27,215,13,153,22,15,15,
+71,250,191,83,26,10,224,139,170,73,128,122,59,152,148,29,221,96,234,180,120,119,21,58,135,114,15,222,73,78,220,235,
+227,107,3,180,10,90,29,45,129,102,67,69,155,118,221,255,13,29,226,250,91,52,234,230,250,79,250,73,37,98,123,116,
+33,234,169,237,188,130,250,176,173,46,182,181,6,129,164,124,167,39,181,154,16,63,15,105,254,161,202,246,18,137,219,29,
+221,166,68,186,253,17,133,234,90,82,191,84,167,174,68,155,162,88,3,158,97,248,218,138,242,215,92,132,205,4,76,160,
+66,4,98,253,200,39,103,169,110,32,162,207,52,24,185,8,205,160,63,114,154,118,131,239,137,254,154,134,111,102,103,82,
+151,191,205,72,207,129,104,16,154,29,21,101,186,17,62,17,253,74,17,52,51,239,138,191,93,44,41,71,237,98,57,22,
+169,28,53,1,209,108,27,75,2,94,68,26,60,105,224,244,8,186,11,233,55,80,51,151,127,74,162,216,35,245,99,49,
+98,184,0,105,48,164,129,119,145,166,157,117,42,231,51,41,223,171,139,140,200,190,139,39,64,221,89,150,88,244,68,202,
+128,226,99,107,106,12,90,92,28,138,46,70,106,171,222,160,254,106,2,215,102,2,83,16,72,250,219,11,249,112,231,41,
+190,104,252,143,231,185,116,41,93,238,62,176,113,104,211,186,146,242,208,216,92,253,155,198,64,237,106,90,252,187,21,109,
+133,180,107,217,117,71,16,90,216,168,183,179,146,252,55,145,142,141,154,234,129,22,117,52,174,214,102,40,181,37,210,40,
+36,155,15,165,139,144,122,138,76,79,252,244,69,75,35,221,219,105,44,168,227,92,104,58,84,150,141,39,34,61,109,113,
+4,109,222,147,101,69,234,120,154,71,32,233,39,149,0,213,183,59,208,26,168,59,123,149,15,191,65,189,208,198,62,91,
+11,17,72,202,184,15,73,214,156,206,47,81,85,251,224,199,73,219,129,72,109,80,205,60,246,74,73,84,243,72,221,210,
+198,242,191,162,13,35,166,80,79,92,107,188,232,87,121,70,132,106,87,38,208,50,4,104,88,30,66,161,246,56,14,250,
+162,244,21,29,77,203,63,105,216,1,221,143,62,66,69,219,251,68,112,34,170,229,91,71,91,28,2,176,156,14,253,12,
+141,71,101,219,167,68,248,30,26,129,206,70,7,160,101,81,17,175,228,139,3,172,67,188,80,6,125,144,234,198,225,72,
+191,191,162,109,28,17,252,3,105,183,185,173,77,8,80,158,91,160,7,208,36,212,14,166,124,72,234,247,134,163,67,209,
+188,40,203,132,90,155,148,174,179,145,149,0,245,68,99,152,71,81,94,27,74,192,166,143,255,178,230,187,202,215,195,243,
+159,121,11,163,5,194,189,77,26,15,169,50,127,167,45,31,1,202,85,99,230,88,150,246,207,233,49,150,223,16,63,234,
+99,175,71,218,68,100,235,48,2,148,123,122,191,191,3,231,31,162,174,54,145,15,118,65,29,70,166,253,178,75,25,158,
+128,84,158,85,51,205,113,245,71,105,93,244,216,171,130,213,175,75,249,172,195,223,207,160,152,118,39,206,38,215,129,10,
+34,112,146,76,192,4,138,38,64,35,240,125,244,73,132,150,69,131,247,201,13,138,206,203,176,36,206,213,56,42,254,23,
+81,89,246,14,17,249,70,52,114,33,195,52,173,67,95,226,124,84,73,133,169,129,218,72,116,43,210,226,209,250,168,150,
+142,200,217,179,187,64,2,148,139,22,212,86,64,207,33,45,184,77,203,98,220,248,191,139,243,243,81,109,167,121,96,210,
+29,188,66,4,40,83,253,190,55,66,90,164,251,0,245,84,151,248,186,146,166,58,174,182,107,2,122,26,157,137,54,68,
+51,34,237,40,180,153,64,67,4,84,95,208,235,40,175,237,68,64,247,153,13,209,110,236,34,120,46,132,70,231,45,144,
+10,135,251,47,105,91,11,53,6,194,87,181,20,1,202,117,1,212,142,245,86,99,132,255,160,239,181,84,129,56,177,81,
+9,80,254,233,61,234,108,156,223,129,234,77,99,178,155,81,95,20,53,94,59,43,159,128,202,16,157,134,154,177,161,148,
+104,167,50,45,28,254,30,205,140,210,122,56,249,88,62,33,199,216,19,129,186,50,250,46,231,175,161,152,118,61,206,22,
+65,46,255,158,10,193,223,153,64,187,19,72,26,129,219,34,180,46,218,185,94,187,57,75,27,150,34,216,165,190,57,206,
+135,246,65,247,161,50,118,230,19,205,100,123,150,179,109,80,17,89,236,104,159,98,138,6,162,71,81,81,166,193,144,252,
+95,141,246,66,90,24,168,117,134,29,13,191,5,50,79,57,157,136,134,160,143,81,87,251,136,15,222,64,154,68,80,25,
+135,152,22,106,255,128,35,204,196,196,0,0,16,184,73,68,65,84,250,183,0,22,39,49,128,0,101,188,47,82,63,162,
+133,187,170,47,232,104,162,64,117,91,105,125,18,157,143,126,16,144,125,7,53,1,245,125,171,163,188,166,186,184,24,114,
+31,26,185,46,193,244,32,84,245,54,137,36,54,100,99,184,234,20,52,43,114,93,137,92,87,170,228,142,242,221,3,105,
+147,65,59,152,126,127,143,161,31,86,137,177,211,210,124,2,212,137,45,81,253,252,131,158,52,92,7,185,125,107,126,241,
+4,167,32,45,71,142,63,69,47,161,102,154,54,107,109,135,106,117,43,61,6,103,210,14,10,35,144,148,209,225,28,53,
+70,142,101,186,7,188,14,185,30,20,86,114,118,108,2,45,68,32,105,12,244,4,130,22,98,66,77,175,170,41,172,113,
+193,183,118,141,126,7,221,136,52,97,219,12,187,155,72,39,175,130,183,80,81,87,62,169,112,85,221,209,77,254,21,72,
+157,85,12,211,228,254,91,232,118,164,157,44,219,35,79,58,85,190,54,116,159,64,202,78,3,24,237,68,249,4,233,6,
+91,79,83,104,209,69,131,220,107,208,143,209,31,209,88,148,199,84,239,244,36,216,177,104,254,238,83,225,79,219,141,0,
+101,173,221,149,90,208,25,142,212,102,84,205,148,38,213,243,199,209,69,104,127,84,228,255,253,214,110,69,236,252,244,64,
+128,186,244,101,148,215,30,238,193,181,191,10,36,64,161,156,157,183,96,42,18,78,253,180,250,236,213,2,81,56,120,139,
+16,160,172,167,71,167,161,88,227,120,92,149,110,234,115,31,70,123,180,8,118,39,179,100,2,212,141,126,232,102,164,54,
+78,245,69,117,190,54,7,82,114,82,28,93,1,4,210,178,76,142,3,56,222,130,84,206,101,218,43,68,118,68,1,217,
+179,203,130,9,80,110,191,70,161,155,74,235,235,154,54,176,234,117,127,83,204,179,234,111,155,9,152,64,135,18,168,107,
+16,254,196,121,168,105,208,62,121,32,195,121,48,85,124,104,130,109,103,116,19,10,121,245,7,193,131,76,19,195,199,6,
+103,200,14,166,73,0,190,234,156,14,70,33,29,223,4,194,63,134,46,71,59,161,254,104,114,167,55,205,200,253,69,75,
+16,160,44,47,64,23,34,77,104,107,210,253,124,180,35,90,82,25,224,168,246,66,159,229,49,221,140,105,17,199,55,238,
+45,81,27,226,39,146,178,95,20,233,137,175,17,40,239,98,32,65,163,152,22,110,158,65,55,160,223,33,245,131,243,196,
+207,181,61,118,58,1,234,213,74,72,237,95,30,59,169,211,249,21,153,127,10,100,14,116,11,106,181,73,113,165,247,41,
+244,35,84,27,131,21,201,201,190,171,71,128,114,215,230,169,137,168,149,236,61,18,123,25,250,74,245,136,58,69,85,34,
+64,29,81,187,166,205,129,239,163,39,145,222,20,226,182,174,74,133,20,49,45,73,217,106,28,254,16,250,24,21,105,122,
+221,251,153,200,27,10,35,150,97,145,174,40,171,218,111,63,57,106,14,42,102,29,209,220,150,54,169,214,199,81,100,118,
+236,219,4,76,160,21,8,212,53,10,75,114,254,34,10,53,237,86,56,6,53,52,152,73,175,171,59,234,169,155,245,208,
+97,232,1,20,227,73,33,220,228,54,221,140,170,211,222,20,181,66,145,182,108,26,225,187,12,210,224,37,139,141,231,98,
+77,234,159,133,126,128,38,15,164,57,111,89,22,78,120,207,4,40,219,57,19,77,113,33,159,173,140,52,241,157,197,244,
+27,151,238,68,95,67,211,79,225,212,127,116,28,1,234,192,42,72,175,93,212,162,161,158,194,124,1,105,130,167,72,83,
+95,167,133,27,77,218,170,61,219,29,173,213,113,240,157,225,210,9,80,207,52,94,211,141,98,86,251,128,0,155,148,158,
+224,14,140,16,206,218,249,221,10,166,190,244,89,244,179,14,44,38,103,185,142,0,117,64,237,202,1,72,175,156,170,178,
+169,206,170,239,213,110,231,57,234,178,224,83,19,152,38,1,234,138,234,247,44,232,62,180,237,52,47,244,23,109,65,32,
+41,239,218,220,22,231,223,68,151,34,45,226,197,178,15,113,164,141,168,7,162,249,218,2,90,7,101,130,50,75,235,198,
+37,156,199,180,183,112,182,119,7,161,116,86,77,160,109,8,20,254,31,22,211,56,212,195,58,148,63,142,67,161,19,153,
+31,227,227,50,180,127,159,62,125,222,230,56,77,35,254,133,249,114,35,180,5,90,26,45,143,230,70,85,176,23,72,196,
+233,232,180,52,49,228,39,61,245,49,50,1,234,194,137,184,60,24,117,87,255,84,81,199,162,103,208,163,232,13,52,28,
+221,128,244,121,205,92,62,41,137,206,60,82,135,6,146,243,223,161,173,50,16,80,123,117,21,58,10,169,126,77,114,61,
+130,130,173,70,128,58,245,69,78,86,66,3,80,255,228,168,39,192,180,83,78,79,200,204,132,102,65,189,217,39,92,240,
+17,122,21,141,71,111,162,113,232,57,164,58,168,207,159,70,195,169,127,99,56,218,76,160,20,2,212,241,57,137,72,99,
+181,238,250,222,158,210,112,61,95,110,225,246,178,39,68,113,190,75,202,72,125,155,158,24,157,33,142,215,232,94,30,193,
+227,165,232,120,121,118,189,16,5,27,117,119,16,20,254,132,150,173,24,13,221,71,252,11,93,78,93,213,24,208,102,2,
+153,8,80,183,117,253,126,232,207,212,33,141,239,108,29,66,32,41,123,45,184,236,139,214,71,27,160,153,209,140,168,17,
+83,229,25,141,116,47,160,185,140,91,169,67,55,115,180,181,32,1,234,195,2,36,251,106,164,186,16,203,158,194,209,33,
+212,139,107,99,57,180,31,19,48,129,242,8,20,190,106,144,116,68,245,57,186,134,63,190,85,255,65,192,185,38,174,222,
+66,239,162,215,145,38,171,212,201,205,134,230,70,11,161,233,80,35,147,96,92,86,154,41,173,67,209,209,52,158,234,100,
+109,37,16,160,46,106,82,232,27,93,162,250,148,191,71,34,117,142,23,160,199,145,234,149,39,9,4,193,54,5,1,234,
+144,38,184,246,71,135,161,70,30,73,127,136,235,78,69,26,68,191,195,239,189,118,87,198,185,205,4,186,37,64,29,235,
+203,23,75,161,5,145,110,226,212,127,73,90,208,81,253,209,100,184,234,161,218,41,157,171,191,211,36,249,7,72,55,250,
+47,33,45,224,140,66,99,169,115,31,114,180,153,64,211,8,36,227,192,23,73,64,255,12,137,80,253,222,6,13,165,14,
+103,8,230,75,243,18,72,202,105,111,194,171,127,211,2,115,21,76,139,206,255,67,103,32,77,134,215,198,103,28,61,70,
+19,4,91,109,151,50,24,52,201,245,75,180,19,154,23,53,195,84,55,117,79,122,19,186,133,118,235,226,102,36,194,113,
+182,23,1,218,101,205,107,124,228,126,176,189,202,53,107,110,168,7,186,7,88,12,109,142,86,72,206,53,254,215,61,131,
+218,30,221,3,188,156,232,201,228,120,47,199,154,185,254,164,36,90,227,152,140,199,210,196,206,201,201,117,104,195,244,131,
+192,163,230,75,175,160,78,236,16,232,199,193,77,192,4,218,153,128,26,162,46,90,155,191,159,71,157,102,122,180,94,255,
+169,220,177,104,0,74,111,62,218,185,248,43,149,55,152,235,53,70,42,7,153,254,51,251,231,208,81,168,42,19,22,149,
+226,229,196,116,79,128,250,178,48,58,8,61,138,186,51,189,183,246,126,116,56,210,111,189,106,11,201,221,103,204,159,154,
+128,9,152,64,1,4,104,3,53,222,185,11,101,177,7,11,72,138,93,246,64,128,194,169,141,75,147,227,57,28,155,245,
+202,42,189,6,82,175,28,222,31,45,133,60,94,238,161,220,252,213,103,4,146,122,162,241,153,254,47,213,71,80,58,222,
+231,180,16,147,255,55,144,94,211,253,43,164,87,239,186,56,76,192,4,76,192,4,76,32,136,128,250,146,68,107,113,124,
+2,197,50,253,23,3,59,7,37,206,129,77,192,4,42,65,160,180,109,142,52,26,245,25,222,149,63,180,187,174,95,253,
+135,109,122,174,39,62,244,138,174,139,208,105,222,17,209,188,82,166,14,126,137,216,181,67,78,19,235,42,143,33,148,135,
+118,175,219,76,160,97,2,73,91,54,59,1,180,51,106,73,180,10,90,2,169,61,125,2,221,130,222,67,122,2,71,79,
+70,216,76,192,4,76,160,99,9,36,109,166,250,220,29,27,132,48,145,235,118,161,253,252,71,131,215,251,178,2,8,80,
+110,122,149,203,143,144,94,77,172,39,30,138,52,61,201,240,52,186,4,221,128,158,243,120,25,10,182,220,4,168,191,155,
+18,88,175,193,213,238,245,85,145,118,53,235,233,134,60,246,62,129,180,139,89,175,162,121,5,233,190,238,62,234,232,205,
+28,109,38,96,2,38,96,2,38,16,141,0,253,215,66,56,251,41,218,7,233,237,12,161,166,183,51,104,76,189,55,253,
+214,132,80,103,14,111,2,38,208,124,2,205,90,200,81,206,135,160,131,81,105,105,80,164,37,154,94,247,118,23,58,11,
+233,166,180,102,190,49,77,73,148,127,76,38,147,250,19,179,86,21,107,11,56,46,143,242,203,161,93,98,164,62,77,71,
+94,180,152,179,46,210,68,129,218,178,7,168,83,126,215,44,32,108,38,96,2,38,32,2,73,223,171,87,56,252,189,65,
+34,255,228,186,239,186,127,110,144,86,65,151,37,229,150,122,223,147,19,45,232,12,66,154,16,15,177,73,4,214,43,96,
+244,250,199,251,209,48,116,35,229,61,158,163,205,4,10,33,64,125,214,107,136,190,141,150,67,11,34,189,146,168,31,210,
+231,26,207,105,162,75,117,83,245,80,245,115,44,210,162,141,54,228,220,75,253,28,205,209,102,2,38,96,2,38,96,2,
+209,9,212,141,185,6,224,252,100,244,45,164,87,234,133,152,230,188,30,67,191,160,15,155,60,31,25,226,208,97,77,192,
+4,170,65,160,180,69,148,186,198,169,62,231,87,242,135,118,75,181,139,169,177,212,110,45,77,228,254,30,189,226,137,8,
+40,216,76,192,4,76,192,4,76,192,4,58,146,64,50,254,155,159,204,143,64,154,64,237,201,244,127,8,14,68,19,60,
+126,234,9,83,249,223,37,229,168,39,154,215,68,27,162,213,19,233,41,7,77,134,207,139,244,228,130,38,195,103,69,99,
+144,54,53,189,135,244,4,195,19,72,19,10,207,160,103,93,190,80,176,153,128,9,152,128,9,152,128,9,116,60,129,100,
+140,165,141,6,231,161,245,144,54,24,132,216,75,4,214,124,228,41,30,111,133,96,116,88,19,48,129,110,9,208,104,13,
+71,173,110,99,200,192,173,104,203,110,51,233,15,77,192,4,76,192,4,76,192,4,76,160,3,9,48,54,74,223,245,125,
+67,47,131,189,241,124,191,87,7,34,106,139,44,83,118,243,161,233,145,202,123,14,52,93,114,158,62,149,213,22,249,116,
+38,76,192,4,76,192,4,76,192,4,76,32,22,129,100,172,180,42,199,123,81,232,255,239,246,38,62,206,69,125,145,199,
+95,177,10,201,126,76,192,4,166,36,64,3,163,255,196,235,127,168,213,236,3,18,252,24,58,20,45,141,220,80,78,89,
+180,254,203,4,76,192,4,76,192,4,76,160,195,9,164,227,35,142,27,162,183,80,119,166,255,224,254,40,212,225,180,156,
+125,19,48,1,19,48,1,19,48,1,19,48,129,78,33,192,216,119,73,116,55,10,89,196,121,155,240,23,161,85,59,133,
+155,243,105,2,38,208,68,2,52,54,90,0,249,26,122,24,85,221,180,120,243,20,58,30,173,141,154,72,206,81,155,128,
+9,152,128,9,152,128,9,152,64,245,9,104,188,132,102,66,7,160,9,40,53,221,180,62,143,246,64,222,16,83,253,162,
+116,10,77,192,4,76,192,4,76,192,4,76,192,4,34,16,96,236,59,27,186,22,125,130,178,154,194,60,139,142,67,75,
+32,143,163,35,148,137,93,152,128,9,52,64,32,109,112,56,14,68,255,70,33,43,209,4,143,110,218,37,58,2,29,141,
+244,94,112,155,9,152,128,9,152,128,9,152,128,9,152,64,131,4,24,63,213,110,46,57,206,140,14,65,239,33,189,150,
+246,100,244,69,148,126,223,160,71,95,102,2,38,96,2,38,96,2,38,96,2,38,96,2,173,73,128,177,239,172,232,60,
+164,205,226,141,218,68,46,124,25,157,132,244,102,163,214,204,188,83,109,2,38,16,68,160,79,80,232,8,129,187,105,124,
+78,194,237,30,104,238,8,238,243,186,120,141,128,207,161,139,209,109,72,255,49,107,205,252,159,133,165,36,124,52,1,19,
+48,1,19,48,1,19,48,129,108,4,146,113,223,49,132,122,0,93,227,113,85,54,126,190,218,4,76,192,4,76,192,4,
+76,192,4,76,160,117,9,48,22,158,139,212,159,131,190,129,102,72,148,206,205,126,202,223,31,161,49,104,84,114,252,132,
+163,230,36,111,100,220,124,35,71,155,9,152,64,7,19,72,27,139,166,34,232,102,49,103,27,18,244,83,180,9,154,169,
+132,196,125,64,28,79,162,17,232,18,52,12,233,179,47,120,130,65,20,108,38,96,2,38,96,2,38,96,2,38,16,135,
+0,227,190,245,241,52,28,125,224,113,86,28,166,246,98,2,38,96,2,38,96,2,38,96,2,38,80,109,2,140,129,245,
+150,159,227,209,116,232,9,244,6,210,163,53,233,188,231,179,156,107,209,230,121,52,142,113,242,135,28,109,38,96,2,38,
+48,153,64,85,23,114,210,4,110,198,201,129,104,3,52,111,250,97,224,81,171,217,106,12,159,66,247,161,255,162,97,52,
+144,47,113,180,153,128,9,152,128,9,152,128,9,152,128,9,20,72,128,155,216,5,24,119,233,198,213,102,2,38,96,2,
+38,96,2,38,96,2,38,96,2,109,77,32,217,188,190,10,153,156,30,105,3,185,230,37,189,113,92,16,108,38,96,2,
+153,8,84,98,33,167,167,20,39,13,222,202,92,179,49,218,18,13,64,139,162,126,168,171,105,37,59,205,211,251,201,151,
+175,115,28,141,116,188,7,221,139,254,141,106,198,68,66,122,234,163,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,84,138,64,229,87,49,146,133,156,174,208,6,
+242,193,98,72,239,142,156,3,245,71,122,135,164,94,135,166,119,76,234,252,65,52,222,11,53,80,176,153,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,
+9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,
+128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,152,128,9,
+152,64,71,17,248,255,188,82,120,75,172,5,106,157,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+#endif // PNG_digits_H_
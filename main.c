@@ -1,30 +1,88 @@
 #define _CRT_SECURE_NO_WARNINGS
+// localtime_r() and clock_gettime()
+#define _POSIX_C_SOURCE 200809L
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <errno.h>
+#include <signal.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
 
 #include <SDL2/SDL.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOWON_SSE2
+#endif
+
+// The AVX2 blend can't be assumed from the build flags, so it is compiled
+// for AVX2 on its own and only taken after a run-time check of the CPU and
+// the OS, like the AVX2 JPEG kernels of stb_image.h
+#ifdef SOWON_SSE2
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define SOWON_AVX2
+#define SOWON_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && _MSC_VER >= 1700
+#define SOWON_AVX2
+#define SOWON_AVX2_TARGET
+#endif
+#endif
+
+#ifdef SOWON_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// cl.exe has no C99 `restrict`, only its own spelling
+#ifdef _MSC_VER
+#define SOWON_RESTRICT __restrict
+#else
+#define SOWON_RESTRICT restrict
+#endif
+
 #include "./digits.h"
+#include "./shm.h"
+#include "./server.h"
 
 #ifdef PENGER
 #include "./penger_walk_sheet.h"
 #endif
 
-#define FPS 60
+#define STBI_ONLY_PNG
+#define STBI_NO_STDIO
+// big sprite sheets written with full flushes inflate on all cores
+#define STBI_PNG_THREADS
+#define STB_IMAGE_IMPLEMENTATION
+#include "./stb_image.h"
+
+#define HEADLESS_FPS 30
 //#define DELTA_TIME (1.0f / FPS)
 #define SPRITE_CHAR_WIDTH (300 / 2)
 #define SPRITE_CHAR_HEIGHT (380 / 2)
 #define CHAR_WIDTH (300 / 2)
 #define CHAR_HEIGHT (380 / 2)
-#define CHARS_COUNT 8
-#define TEXT_WIDTH (CHAR_WIDTH * CHARS_COUNT)
+// HH:MM:SS, the hours take as many digits as they need
+#define CHARS_MIN 8
+// The hours of SIZE_MAX seconds are 16 digits
+#define CHARS_CAP (16 + 6)
+#define TEXT_WIDTH(chars_count) (CHAR_WIDTH * (int) (chars_count))
 #define TEXT_HEIGHT (CHAR_HEIGHT)
+#define TIMERS_CAP 16
+#define CELLS_CAP (TIMERS_CAP * CHARS_CAP)
 #define WIGGLE_COUNT 3
 #define WIGGLE_DURATION (0.40f / WIGGLE_COUNT)
 #define COLON_INDEX 10
+#define DIGITS_COUNT 11
 #define MAIN_COLOR_R 220
 #define MAIN_COLOR_G 220
 #define MAIN_COLOR_B 220
@@ -38,263 +96,2343 @@
 #define PENGER_SCALE 4
 #define PENGER_STEPS_PER_SECOND 3
 
-void secc(int code)
+void secc(int code)
+{
+    if (code < 0) {
+        fprintf(stderr, "SDL pooped itself: %s\n", SDL_GetError());
+        abort();
+    }
+}
+
+void *secp(void *ptr)
+{
+    if (ptr == NULL) {
+        fprintf(stderr, "SDL pooped itself: %s\n", SDL_GetError());
+        abort();
+    }
+
+    return ptr;
+}
+
+SDL_Surface *load_png_file_as_surface(uint32_t *data, size_t width, size_t height)
+{
+    SDL_Surface* image_surface =
+        secp(SDL_CreateRGBSurfaceFrom(
+                 data,
+                 (int) width,
+                 (int) height,
+                 32,
+                 (int) width * 4,
+                 0x000000FF,
+                 0x0000FF00,
+                 0x00FF0000,
+                 0xFF000000));
+    return image_surface;
+}
+
+// Headers generated with `png2c -e` carry the PNG file instead of the
+// pixels, so decode them once at startup
+uint32_t *decode_embedded_png(const unsigned char *png, size_t png_size, size_t width, size_t height)
+{
+    int x, y, n;
+    uint32_t *data = (uint32_t *) stbi_load_from_memory(png, (int) png_size, &x, &y, &n, 4);
+    if (data == NULL) {
+        fprintf(stderr, "Could not decode embedded PNG: %s\n", stbi_failure_reason());
+        abort();
+    }
+    assert((size_t) x == width && (size_t) y == height);
+    return data;
+}
+
+void decode_embedded_images(void)
+{
+#ifdef PNG_digits_EMBEDDED
+    digits_data = decode_embedded_png(digits_png, digits_png_size, digits_width, digits_height);
+#endif
+#if defined(PENGER) && defined(PNG_penger_EMBEDDED)
+    penger_data = decode_embedded_png(penger_png, penger_png_size, penger_width, penger_height);
+#endif
+}
+
+SDL_Texture *load_digits_png_file_as_texture(SDL_Renderer *renderer)
+{
+    SDL_Surface *image_surface = load_png_file_as_surface(digits_data, digits_width, digits_height);
+    return secp(SDL_CreateTextureFromSurface(renderer, image_surface));
+}
+
+#ifdef PENGER
+SDL_Texture *load_penger_png_file_as_texture(SDL_Renderer *renderer)
+{
+    SDL_Surface *image_surface = load_png_file_as_surface(penger_data, penger_width, penger_height);
+    return secp(SDL_CreateTextureFromSurface(renderer, image_surface));
+}
+#endif
+
+typedef struct {
+    size_t digit_index;
+    size_t wiggle_index;
+    SDL_Rect dst_rect;
+} Cell;
+
+Cell make_cell_at(size_t digit_index, size_t wiggle_index, int *pen_x, int *pen_y, float user_scale, float fit_scale)
+{
+    const int effective_digit_width = (int) floorf((float) CHAR_WIDTH * user_scale * fit_scale);
+    const int effective_digit_height = (int) floorf((float) CHAR_HEIGHT * user_scale * fit_scale);
+
+    const Cell cell = {
+        .digit_index = digit_index,
+        .wiggle_index = wiggle_index,
+        .dst_rect = {
+            *pen_x,
+            *pen_y,
+            effective_digit_width,
+            effective_digit_height
+        },
+    };
+    *pen_x += effective_digit_width;
+    return cell;
+}
+
+// A texture with the digits sprite sheet layout: DIGITS_COUNT columns and
+// WIGGLE_COUNT rows of char_width x char_height glyphs.
+typedef struct {
+    SDL_Texture *texture;
+    int char_width;
+    int char_height;
+} Glyphs;
+
+void render_digit_at(SDL_Renderer *renderer, const Glyphs *glyphs, const Cell *cell)
+{
+    const SDL_Rect src_rect = {
+        (int) cell->digit_index * glyphs->char_width,
+        (int) cell->wiggle_index * glyphs->char_height,
+        glyphs->char_width,
+        glyphs->char_height
+    };
+    SDL_RenderCopy(renderer, glyphs->texture, &src_rect, &cell->dst_rect);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+#define SOWON_RENDER_GEOMETRY
+#endif
+
+#define GLYPH_BATCH_CAP 256
+
+// Quads of all the glyphs drawn from one texture in a frame, submitted
+// with a single SDL_RenderGeometry() instead of a SDL_RenderCopy() per
+// glyph. The indices never change and the vertices get overwritten every
+// frame, so nothing is allocated. Older SDL draws the cells one by one, and
+// so does SDL's software renderer: it is faster with SDL_RenderCopy() and
+// its triangle rasterizer reads past the edge of 1:1 textures like the
+// atlas (SDL 2.28). A renderer that refuses the geometry gets the same.
+typedef struct {
+#ifdef SOWON_RENDER_GEOMETRY
+    SDL_Vertex vertices[GLYPH_BATCH_CAP * 4];
+    int indices[GLYPH_BATCH_CAP * 6];
+#endif
+    int ready;
+    int per_glyph;
+} GlyphBatch;
+
+void render_digits(SDL_Renderer *renderer, GlyphBatch *batch, const Glyphs *glyphs, const Cell *cells, size_t count)
+{
+#ifdef SOWON_RENDER_GEOMETRY
+    // Only the widest clocks need more than one batch
+    for (; count > GLYPH_BATCH_CAP; cells += GLYPH_BATCH_CAP, count -= GLYPH_BATCH_CAP) {
+        render_digits(renderer, batch, glyphs, cells, GLYPH_BATCH_CAP);
+    }
+    if (!batch->ready) {
+        for (int i = 0; i < GLYPH_BATCH_CAP; ++i) {
+            static const int quad[6] = {0, 1, 2, 2, 1, 3};
+            for (int j = 0; j < 6; ++j) batch->indices[i * 6 + j] = i * 4 + quad[j];
+        }
+        SDL_RendererInfo info;
+        batch->per_glyph = SDL_GetRendererInfo(renderer, &info) < 0 || (info.flags & SDL_RENDERER_SOFTWARE) != 0;
+        batch->ready = 1;
+    }
+
+    if (!batch->per_glyph) {
+        // Color modulation is per vertex with SDL_RenderGeometry()
+        SDL_Color color = {255, 255, 255, 255};
+        secc(SDL_GetTextureColorMod(glyphs->texture, &color.r, &color.g, &color.b));
+
+        const float u_step = 1.0f / DIGITS_COUNT;
+        const float v_step = 1.0f / WIGGLE_COUNT;
+        for (size_t i = 0; i < count; ++i) {
+            const SDL_Rect *dst = &cells[i].dst_rect;
+            const float u0 = (float) cells[i].digit_index * u_step;
+            const float v0 = (float) cells[i].wiggle_index * v_step;
+            const float x0 = (float) dst->x, x1 = (float) (dst->x + dst->w);
+            const float y0 = (float) dst->y, y1 = (float) (dst->y + dst->h);
+            SDL_Vertex *v = &batch->vertices[i * 4];
+            v[0] = (SDL_Vertex) {{x0, y0}, color, {u0, v0}};
+            v[1] = (SDL_Vertex) {{x1, y0}, color, {u0 + u_step, v0}};
+            v[2] = (SDL_Vertex) {{x0, y1}, color, {u0, v0 + v_step}};
+            v[3] = (SDL_Vertex) {{x1, y1}, color, {u0 + u_step, v0 + v_step}};
+        }
+        if (SDL_RenderGeometry(renderer, glyphs->texture, batch->vertices, (int) count * 4, batch->indices, (int) count * 6) == 0) {
+            return;
+        }
+        fprintf(stderr, "SDL_RenderGeometry() failed, drawing the glyphs one by one: %s\n", SDL_GetError());
+        batch->per_glyph = 1;
+    }
+#else
+    (void) batch;
+#endif
+    for (size_t i = 0; i < count; ++i) {
+        render_digit_at(renderer, glyphs, &cells[i]);
+    }
+}
+
+// Resamples a single w x h cell of RGBA pixels with a separable tent
+// filter. The filter widens with the downscale factor, so every source
+// pixel contributes when the glyph gets smaller. Works in premultiplied
+// alpha to avoid dark fringes around the glyphs.
+void resample_cell(const uint32_t *src, size_t src_stride, int src_w, int src_h,
+                   uint32_t *dst, size_t dst_stride, int dst_w, int dst_h,
+                   float *scratch)
+{
+    // Horizontal pass: src_w x src_h -> dst_w x src_h
+    const float x_ratio = (float) src_w / (float) dst_w;
+    const float x_radius = fmaxf(x_ratio, 1.0f);
+    for (int x = 0; x < dst_w; ++x) {
+        const float center = ((float) x + 0.5f) * x_ratio - 0.5f;
+        const int lo = (int) ceilf(center - x_radius);
+        const int hi = (int) floorf(center + x_radius);
+        for (int y = 0; y < src_h; ++y) {
+            float acc[4] = {0}, total = 0.0f;
+            for (int i = lo; i <= hi; ++i) {
+                const float w = 1.0f - fabsf((float) i - center) / x_radius;
+                if (w <= 0.0f) continue;
+                const int sx = i < 0 ? 0 : (i >= src_w ? src_w - 1 : i);
+                const uint32_t p = src[y * src_stride + sx];
+                const float a = (float) (p >> 24) / 255.0f;
+                acc[0] += w * (float) ((p >> 0)  & 0xFF) * a;
+                acc[1] += w * (float) ((p >> 8)  & 0xFF) * a;
+                acc[2] += w * (float) ((p >> 16) & 0xFF) * a;
+                acc[3] += w * (float) (p >> 24);
+                total += w;
+            }
+            float *out = &scratch[(y * dst_w + x) * 4];
+            for (int c = 0; c < 4; ++c) out[c] = acc[c] / total;
+        }
+    }
+
+    // Vertical pass: dst_w x src_h -> dst_w x dst_h
+    const float y_ratio = (float) src_h / (float) dst_h;
+    const float y_radius = fmaxf(y_ratio, 1.0f);
+    for (int y = 0; y < dst_h; ++y) {
+        const float center = ((float) y + 0.5f) * y_ratio - 0.5f;
+        const int lo = (int) ceilf(center - y_radius);
+        const int hi = (int) floorf(center + y_radius);
+        for (int x = 0; x < dst_w; ++x) {
+            float acc[4] = {0}, total = 0.0f;
+            for (int i = lo; i <= hi; ++i) {
+                const float w = 1.0f - fabsf((float) i - center) / y_radius;
+                if (w <= 0.0f) continue;
+                const int sy = i < 0 ? 0 : (i >= src_h ? src_h - 1 : i);
+                const float *in = &scratch[(sy * dst_w + x) * 4];
+                for (int c = 0; c < 4; ++c) acc[c] += w * in[c];
+                total += w;
+            }
+            const float a = acc[3] / total;
+            uint32_t p = (uint32_t) (a + 0.5f) << 24;
+            if (a > 0.0f) {
+                for (int c = 0; c < 3; ++c) {
+                    const float v = fminf(acc[c] / total * 255.0f / a, 255.0f);
+                    p |= (uint32_t) (v + 0.5f) << (c * 8);
+                }
+            }
+            dst[y * dst_stride + x] = p;
+        }
+    }
+}
+
+// Digits sprite sheet prescaled to the current effective digit size, so
+// every blit is a 1:1 copy instead of a linear-filtered scale. The pixels
+// stay around for the software compositor.
+typedef struct {
+    Glyphs glyphs;
+    uint32_t *pixels;
+    int max_texture_width;
+    int max_texture_height;
+} Atlas;
+
+// Returns 1 if the atlas pixels had to be rebuilt for the new size.
+int atlas_resample(Atlas *atlas, int char_width, int char_height)
+{
+    if (atlas->pixels != NULL &&
+        atlas->glyphs.char_width == char_width &&
+        atlas->glyphs.char_height == char_height) {
+        return 0;
+    }
+
+    const int atlas_width = char_width * DIGITS_COUNT;
+    const int atlas_height = char_height * WIGGLE_COUNT;
+
+    free(atlas->pixels);
+    atlas->pixels = malloc(sizeof(*atlas->pixels) * atlas_width * atlas_height);
+    float *scratch = malloc(sizeof(*scratch) * 4 * char_width * SPRITE_CHAR_HEIGHT);
+    assert(atlas->pixels != NULL && scratch != NULL);
+    for (int row = 0; row < WIGGLE_COUNT; ++row) {
+        for (int col = 0; col < DIGITS_COUNT; ++col) {
+            resample_cell(
+                &digits_data[row * SPRITE_CHAR_HEIGHT * digits_width + col * SPRITE_CHAR_WIDTH],
+                digits_width, SPRITE_CHAR_WIDTH, SPRITE_CHAR_HEIGHT,
+                &atlas->pixels[row * char_height * atlas_width + col * char_width],
+                atlas_width, char_width, char_height,
+                scratch);
+        }
+    }
+    free(scratch);
+
+    atlas->glyphs.char_width = char_width;
+    atlas->glyphs.char_height = char_height;
+    return 1;
+}
+
+// Returns the glyphs to render cells of char_width x char_height with.
+// The atlas is rebuilt only when that size changes (resize or zoom) and
+// falls back to the full size sheet when the atlas would not fit into a
+// texture.
+const Glyphs *atlas_glyphs(Atlas *atlas, SDL_Renderer *renderer, const Glyphs *sheet, int char_width, int char_height)
+{
+    const int atlas_width = char_width * DIGITS_COUNT;
+    const int atlas_height = char_height * WIGGLE_COUNT;
+
+    if (char_width <= 0 || char_height <= 0 ||
+        (atlas->max_texture_width > 0 && atlas_width > atlas->max_texture_width) ||
+        (atlas->max_texture_height > 0 && atlas_height > atlas->max_texture_height)) {
+        return sheet;
+    }
+
+    if (atlas_resample(atlas, char_width, char_height) || atlas->glyphs.texture == NULL) {
+        if (atlas->glyphs.texture) SDL_DestroyTexture(atlas->glyphs.texture);
+        SDL_Surface *surface = load_png_file_as_surface(atlas->pixels, atlas_width, atlas_height);
+        atlas->glyphs.texture = secp(SDL_CreateTextureFromSurface(renderer, surface));
+        SDL_FreeSurface(surface);
+    }
+
+    Uint8 r, g, b;
+    secc(SDL_GetTextureColorMod(sheet->texture, &r, &g, &b));
+    secc(SDL_SetTextureColorMod(atlas->glyphs.texture, r, g, b));
+
+    return &atlas->glyphs;
+}
+
+typedef struct {
+    SDL_Rect src_rect;
+    SDL_Rect dst_rect;
+    int flipped;
+} Sprite;
+
+int cell_eq(const Cell *a, const Cell *b)
+{
+    return a->digit_index == b->digit_index
+        && a->wiggle_index == b->wiggle_index
+        && SDL_RectEquals(&a->dst_rect, &b->dst_rect);
+}
+
+int sprite_eq(const Sprite *a, const Sprite *b)
+{
+    return SDL_RectEquals(&a->src_rect, &b->src_rect)
+        && SDL_RectEquals(&a->dst_rect, &b->dst_rect)
+        && a->flipped == b->flipped;
+}
+
+void render_sprite(SDL_Renderer *renderer, SDL_Texture *texture, const Sprite *sprite)
+{
+    secc(SDL_RenderCopyEx(renderer, texture, &sprite->src_rect, &sprite->dst_rect, 0, NULL,
+                          sprite->flipped ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE));
+}
+
+// Persistent render target that keeps the digits from the previous frame,
+// so only the cells whose digit or wiggle frame changed get blitted again.
+// The penger walks under the digits, so the areas it leaves and enters are
+// repainted with everything that overlaps them.
+typedef struct {
+    SDL_Texture *texture;
+    int width, height;
+    int valid;
+    Uint8 color_r, color_g, color_b;
+    Cell cells[CELLS_CAP];
+    size_t cells_count;
+    SDL_Rect cells_bounds;
+    Sprite penger;
+} Canvas;
+
+// Repaints the background, the penger and the cells under rect, clipped to it.
+void canvas_repaint_rect(SDL_Renderer *renderer, GlyphBatch *batch, const Glyphs *glyphs,
+                         const Cell *cells, size_t count,
+                         SDL_Texture *penger_texture, const Sprite *penger,
+                         const SDL_Rect *rect)
+{
+    secc(SDL_RenderSetClipRect(renderer, rect));
+    secc(SDL_RenderFillRect(renderer, rect));
+    if (penger != NULL && SDL_HasIntersection(&penger->dst_rect, rect)) {
+        render_sprite(renderer, penger_texture, penger);
+    }
+    Cell under[CELLS_CAP];
+    size_t under_count = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (SDL_HasIntersection(&cells[i].dst_rect, rect)) under[under_count++] = cells[i];
+    }
+    render_digits(renderer, batch, glyphs, under, under_count);
+    secc(SDL_RenderSetClipRect(renderer, NULL));
+}
+
+// w x h is the output size of the renderer, penger may be NULL. Returns
+// the amount of cells and sprites that were redrawn.
+size_t canvas_update(Canvas *canvas, SDL_Renderer *renderer, int w, int h, GlyphBatch *batch, const Glyphs *glyphs,
+                     const Cell *cells, size_t count, SDL_Texture *penger_texture, const Sprite *penger)
+{
+    if (canvas->texture == NULL || canvas->width != w || canvas->height != h) {
+        if (canvas->texture) SDL_DestroyTexture(canvas->texture);
+        canvas->texture = secp(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, w, h));
+        canvas->width = w;
+        canvas->height = h;
+        canvas->valid = 0;
+    }
+
+    Uint8 r, g, b;
+    secc(SDL_GetTextureColorMod(glyphs->texture, &r, &g, &b));
+    if (r != canvas->color_r || g != canvas->color_g || b != canvas->color_b) {
+        canvas->color_r = r;
+        canvas->color_g = g;
+        canvas->color_b = b;
+        canvas->valid = 0;
+    }
+
+    // Moving cells means the whole layout changed (resize or zoom)
+    assert(count <= CELLS_CAP);
+    if (canvas->cells_count != count) canvas->valid = 0;
+    for (size_t i = 0; canvas->valid && i < count; ++i) {
+        if (!SDL_RectEquals(&canvas->cells[i].dst_rect, &cells[i].dst_rect)) {
+            canvas->valid = 0;
+        }
+    }
+    canvas->cells_count = count;
+
+    if (!canvas->valid) {
+        canvas->cells_bounds = (SDL_Rect) {0};
+        for (size_t i = 0; i < count; ++i) {
+            if (i == 0) {
+                canvas->cells_bounds = cells[i].dst_rect;
+            } else {
+                SDL_UnionRect(&canvas->cells_bounds, &cells[i].dst_rect, &canvas->cells_bounds);
+            }
+        }
+    }
+
+    // Changed cells clear of the penger are filled and blitted in one
+    // batch. The rest is repainted region by region afterwards, which also
+    // fixes up any batched cell that overlaps a region.
+    const int penger_moved = penger != NULL && (!canvas->valid || !sprite_eq(&canvas->penger, penger));
+    SDL_Rect regions[CELLS_CAP + 2];
+    size_t regions_count = 0;
+    if (canvas->valid && penger_moved) {
+        regions[regions_count++] = canvas->penger.dst_rect;
+        regions[regions_count++] = penger->dst_rect;
+    }
+    Cell redraw[CELLS_CAP];
+    SDL_Rect clear[CELLS_CAP];
+    size_t redrawn = 0;
+    size_t changed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (canvas->valid && cell_eq(&canvas->cells[i], &cells[i])) continue;
+        canvas->cells[i] = cells[i];
+        changed += 1;
+        if (canvas->valid && penger != NULL && SDL_HasIntersection(&cells[i].dst_rect, &penger->dst_rect)) {
+            regions[regions_count++] = cells[i].dst_rect;
+            continue;
+        }
+        redraw[redrawn] = cells[i];
+        clear[redrawn] = cells[i].dst_rect;
+        redrawn += 1;
+    }
+
+    if (changed > 0 || penger_moved) {
+        secc(SDL_SetRenderTarget(renderer, canvas->texture));
+        secc(SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR_R, BACKGROUND_COLOR_G, BACKGROUND_COLOR_B, 255));
+        if (!canvas->valid) {
+            secc(SDL_RenderClear(renderer));
+            if (penger != NULL) render_sprite(renderer, penger_texture, penger);
+        } else if (redrawn > 0) {
+            secc(SDL_RenderFillRects(renderer, clear, (int) redrawn));
+        }
+        render_digits(renderer, batch, glyphs, redraw, redrawn);
+        for (size_t i = 0; i < regions_count; ++i) {
+            canvas_repaint_rect(renderer, batch, glyphs, cells, count, penger_texture, penger, &regions[i]);
+        }
+        secc(SDL_SetRenderTarget(renderer, NULL));
+    }
+    if (penger != NULL) canvas->penger = *penger;
+    canvas->valid = 1;
+
+    return changed + (penger_moved ? 1 : 0);
+}
+
+// Everything outside of the cells and the penger is background, so only
+// those areas are copied from the canvas and the rest is a plain clear.
+void canvas_present(const Canvas *canvas, SDL_Renderer *renderer, const Sprite *penger)
+{
+    const SDL_Rect bounds = {0, 0, canvas->width, canvas->height};
+    SDL_Rect areas[2];
+    int areas_count = 0;
+    if (SDL_IntersectRect(&canvas->cells_bounds, &bounds, &areas[areas_count])) areas_count += 1;
+    if (penger != NULL && SDL_IntersectRect(&penger->dst_rect, &bounds, &areas[areas_count])) areas_count += 1;
+
+    secc(SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR_R, BACKGROUND_COLOR_G, BACKGROUND_COLOR_B, 255));
+    secc(SDL_RenderClear(renderer));
+    for (int i = 0; i < areas_count; ++i) {
+        secc(SDL_RenderCopy(renderer, canvas->texture, &areas[i], &areas[i]));
+    }
+}
+
+#ifdef PENGER
+Sprite penger_sprite_at(float time, int flipped, int window_width, int window_height)
+{
+    int sps  = PENGER_STEPS_PER_SECOND;
+    
+    int step = (int)(time*sps)%(60*sps); //step index [0,60*sps-1]
+
+    float progress  = step/(60.0*sps); // [0,1]
+    
+    int frame_index = step%2;
+
+    float penger_drawn_width = ((float)penger_width / 2) / PENGER_SCALE;
+
+    float penger_walk_width = window_width + penger_drawn_width;
+
+    const Sprite sprite = {
+        .src_rect = {
+            (int) (penger_width / 2) * frame_index,
+            0,
+            (int) penger_width / 2,
+            (int) penger_height
+        },
+        .dst_rect = {
+            floorf((float)penger_walk_width * progress - penger_drawn_width),
+            window_height - (penger_height / PENGER_SCALE),
+            (int) (penger_width / 2) / PENGER_SCALE,
+            (int) penger_height / PENGER_SCALE
+        },
+        .flipped = flipped,
+    };
+    return sprite;
+}
+
+void render_penger_at(SDL_Renderer *renderer, SDL_Texture *penger, float time, int flipped, int window_width, int window_height)
+{
+    const Sprite sprite = penger_sprite_at(time, flipped, window_width, window_height);
+    render_sprite(renderer, penger, &sprite);
+}
+#endif
+
+// SOFTWARE COMPOSITOR BEGIN //////////////////////////////
+// For hosts without a GPU. The digits are blended on the CPU straight from
+// the atlas pixels into a framebuffer and only the changed rectangles are
+// converted into the window surface and pushed to the screen.
+
+// x * y / 255 rounded to nearest, exact for x, y in [0, 255]
+static inline uint32_t mul255(uint32_t x, uint32_t y)
+{
+    const uint32_t t = x * y + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+// Blends a color modulated RGBA pixel over an opaque one, like SDL does
+// with SDL_BLENDMODE_BLEND and a texture color mod.
+uint32_t blend_pixel(uint32_t dst, uint32_t src, uint32_t mod)
+{
+    const uint32_t a = src >> 24;
+    uint32_t result = 0xFF000000;
+    for (int c = 0; c < 24; c += 8) {
+        const uint32_t s = mul255(mul255((src >> c) & 0xFF, (mod >> c) & 0xFF), a);
+        const uint32_t d = mul255((dst >> c) & 0xFF, 255 - a);
+        result |= (s + d) << c;
+    }
+    return result;
+}
+
+#ifdef SOWON_SSE2
+static inline __m128i mul255_epi16(__m128i x, __m128i y)
+{
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// Same as blend_pixel() for two pixels unpacked into 16 bit lanes
+static inline __m128i blend_epi16(__m128i dst, __m128i src, __m128i mod)
+{
+    const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+    const __m128i s = mul255_epi16(mul255_epi16(src, mod), a);
+    const __m128i d = mul255_epi16(dst, _mm_sub_epi16(_mm_set1_epi16(255), a));
+    return _mm_add_epi16(s, d);
+}
+#endif
+
+#ifdef SOWON_AVX2
+#ifdef _MSC_VER
+static int avx2_available(void)
+{
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return 0;
+    __cpuid(info, 1);
+    // OSXSAVE and AVX, then ask the OS whether it saves the YMM state
+    if (((info[2] >> 27) & 3) != 3) return 0;
+    if ((_xgetbv(0) & 6) != 6) return 0;
+    __cpuidex(info, 7, 0);
+    return (info[1] >> 5) & 1;
+}
+#else
+static int avx2_available(void)
+{
+    unsigned int a, b, c, d;
+    if (__get_cpuid_max(0, NULL) < 7) return 0;
+    __cpuid(1, a, b, c, d);
+    // OSXSAVE and AVX, then ask the OS whether it saves the YMM state
+    if (((c >> 27) & 3) != 3) return 0;
+    __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d) : "c" (0)); // xgetbv
+    if ((a & 6) != 6) return 0;
+    __cpuid_count(7, 0, a, b, c, d);
+    return (b >> 5) & 1;
+}
+#endif
+
+SOWON_AVX2_TARGET static inline __m256i mul255_epi16_avx2(__m256i x, __m256i y)
+{
+    const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, y), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+SOWON_AVX2_TARGET static inline __m256i blend_epi16_avx2(__m256i dst, __m256i src, __m256i mod)
+{
+    const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src, 0xFF), 0xFF);
+    const __m256i s = mul255_epi16_avx2(mul255_epi16_avx2(src, mod), a);
+    const __m256i d = mul255_epi16_avx2(dst, _mm256_sub_epi16(_mm256_set1_epi16(255), a));
+    return _mm256_add_epi16(s, d);
+}
+
+// Blends the pixels of the row 8 at a time, returns how many it did
+SOWON_AVX2_TARGET static int blend_row_avx2(uint32_t *dst, const uint32_t *src, int count, uint32_t mod)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mod16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int) (mod | 0xFF000000)), zero);
+    const __m256i opaque = _mm256_set1_epi32((int) 0xFF000000);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) &src[i]);
+        const __m256i d = _mm256_loadu_si256((const __m256i *) &dst[i]);
+        const __m256i lo = blend_epi16_avx2(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(s, zero), mod16);
+        const __m256i hi = blend_epi16_avx2(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(s, zero), mod16);
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_or_si256(_mm256_packus_epi16(lo, hi), opaque));
+    }
+    return i;
+}
+
+// -1 until the first blend_row() asks the CPU
+static int blend_avx2 = -1;
+#endif
+
+// Bit exact with blend_pixel() on every path
+void blend_row(uint32_t *dst, const uint32_t *src, int count, uint32_t mod)
+{
+    int i = 0;
+
+#ifdef SOWON_AVX2
+    if (blend_avx2 < 0) blend_avx2 = avx2_available();
+    if (blend_avx2) i = blend_row_avx2(dst, src, count, mod);
+#endif
+
+#ifdef SOWON_SSE2
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i mod16 = _mm_unpacklo_epi8(_mm_set1_epi32((int) (mod | 0xFF000000)), zero);
+        const __m128i opaque = _mm_set1_epi32((int) 0xFF000000);
+        for (; i + 4 <= count; i += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+            const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+            const __m128i lo = blend_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(s, zero), mod16);
+            const __m128i hi = blend_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(s, zero), mod16);
+            _mm_storeu_si128((__m128i *) &dst[i], _mm_or_si128(_mm_packus_epi16(lo, hi), opaque));
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        dst[i] = blend_pixel(dst[i], src[i], mod);
+    }
+}
+
+// Opaque ABGR8888 pixels, the same layout as digits_data
+typedef struct {
+    uint32_t *pixels;
+    int width;
+    int height;
+} Framebuffer;
+
+void framebuffer_resize(Framebuffer *fb, int width, int height)
+{
+    free(fb->pixels);
+    fb->pixels = malloc(sizeof(*fb->pixels) * width * height);
+    assert(fb->pixels != NULL);
+    fb->width = width;
+    fb->height = height;
+}
+
+void framebuffer_fill_rect(Framebuffer *fb, const SDL_Rect *rect, uint32_t color)
+{
+    // A row pointer, the stores could alias fb->width otherwise
+    for (int y = rect->y; y < rect->y + rect->h; ++y) {
+        uint32_t *row = &fb->pixels[y * fb->width + rect->x];
+        for (int x = 0; x < rect->w; ++x) row[x] = color;
+    }
+}
+
+// The part of the cell inside of clip. The cell size must match the atlas.
+void framebuffer_blend_cell(Framebuffer *fb, const Atlas *atlas, const Cell *cell, const SDL_Rect *clip, uint32_t mod)
+{
+    SDL_Rect area;
+    if (!SDL_IntersectRect(&cell->dst_rect, clip, &area)) return;
+
+    const int atlas_width = atlas->glyphs.char_width * DIGITS_COUNT;
+    const uint32_t *src = &atlas->pixels[
+        ((int) cell->wiggle_index * atlas->glyphs.char_height + area.y - cell->dst_rect.y) * atlas_width +
+        (int) cell->digit_index * atlas->glyphs.char_width + area.x - cell->dst_rect.x];
+    for (int y = 0; y < area.h; ++y) {
+        blend_row(&fb->pixels[(area.y + y) * fb->width + area.x], &src[y * atlas_width], area.w, mod);
+    }
+}
+
+// Nearest neighbour scaling, penger is tiny
+void framebuffer_blend_sprite(Framebuffer *fb, const uint32_t *pixels, size_t stride, const Sprite *sprite, const SDL_Rect *clip)
+{
+    SDL_Rect area;
+    if (!SDL_IntersectRect(&sprite->dst_rect, clip, &area)) return;
+
+    for (int y = area.y; y < area.y + area.h; ++y) {
+        const int sy = sprite->src_rect.y + (y - sprite->dst_rect.y) * sprite->src_rect.h / sprite->dst_rect.h;
+        for (int x = area.x; x < area.x + area.w; ++x) {
+            int dx = x - sprite->dst_rect.x;
+            if (sprite->flipped) dx = sprite->dst_rect.w - 1 - dx;
+            const int sx = sprite->src_rect.x + dx * sprite->src_rect.w / sprite->dst_rect.w;
+            uint32_t *dst = &fb->pixels[y * fb->width + x];
+            *dst = blend_pixel(*dst, pixels[sy * stride + sx], 0xFFFFFF);
+        }
+    }
+}
+
+#define SOFT_DIRTY_CAP (CELLS_CAP + 2)
+
+// The software counterpart of Canvas
+typedef struct {
+    Framebuffer fb;
+    int valid;
+    uint32_t color;
+    Cell cells[CELLS_CAP];
+    size_t cells_count;
+    Sprite penger;
+    SDL_Rect dirty[SOFT_DIRTY_CAP];
+    int dirty_count;
+} SoftCanvas;
+
+void soft_canvas_mark_dirty(SoftCanvas *canvas, const SDL_Rect *rect)
+{
+    const SDL_Rect bounds = {0, 0, canvas->fb.width, canvas->fb.height};
+    SDL_Rect area;
+    if (!SDL_IntersectRect(rect, &bounds, &area)) return;
+    assert(canvas->dirty_count < SOFT_DIRTY_CAP);
+    canvas->dirty[canvas->dirty_count++] = area;
+}
+
+// Recomposites the regions that changed since the previous frame. The
+// atlas must be resampled for the size of the cells. color is the color
+// mod of the digits (0xBBGGRR), penger may be NULL. Returns the amount of
+// dirty rectangles.
+int soft_canvas_update(SoftCanvas *canvas, const Atlas *atlas, const Cell *cells, size_t count, uint32_t color, const Sprite *penger)
+{
+    canvas->dirty_count = 0;
+
+    if (canvas->color != color) {
+        canvas->color = color;
+        canvas->valid = 0;
+    }
+    assert(count <= CELLS_CAP);
+    if (canvas->cells_count != count) canvas->valid = 0;
+    for (size_t i = 0; canvas->valid && i < count; ++i) {
+        if (!SDL_RectEquals(&canvas->cells[i].dst_rect, &cells[i].dst_rect)) {
+            canvas->valid = 0;
+        }
+    }
+
+    if (!canvas->valid) {
+        const SDL_Rect bounds = {0, 0, canvas->fb.width, canvas->fb.height};
+        soft_canvas_mark_dirty(canvas, &bounds);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            if (!cell_eq(&canvas->cells[i], &cells[i])) {
+                soft_canvas_mark_dirty(canvas, &cells[i].dst_rect);
+            }
+        }
+        if (penger != NULL && !sprite_eq(&canvas->penger, penger)) {
+            soft_canvas_mark_dirty(canvas, &canvas->penger.dst_rect);
+            soft_canvas_mark_dirty(canvas, &penger->dst_rect);
+        }
+    }
+    memcpy(canvas->cells, cells, sizeof(*cells) * count);
+    canvas->cells_count = count;
+    if (penger != NULL) canvas->penger = *penger;
+    canvas->valid = 1;
+
+    const int cells_fit_atlas =
+        cells[0].dst_rect.w == atlas->glyphs.char_width &&
+        cells[0].dst_rect.h == atlas->glyphs.char_height &&
+        atlas->pixels != NULL;
+
+    const uint32_t background = 0xFF000000
+        | (BACKGROUND_COLOR_B << 16)
+        | (BACKGROUND_COLOR_G << 8)
+        | BACKGROUND_COLOR_R;
+    for (int i = 0; i < canvas->dirty_count; ++i) {
+        const SDL_Rect *rect = &canvas->dirty[i];
+        framebuffer_fill_rect(&canvas->fb, rect, background);
+#ifdef PENGER
+        if (penger != NULL) {
+            framebuffer_blend_sprite(&canvas->fb, penger_data, penger_width, penger, rect);
+        }
+#endif
+        if (cells_fit_atlas) {
+            for (size_t j = 0; j < count; ++j) {
+                framebuffer_blend_cell(&canvas->fb, atlas, &cells[j], rect, color);
+            }
+        }
+    }
+
+    return canvas->dirty_count;
+}
+
+// ABGR8888 to ARGB8888, the window surface format of most hosts. Swaps
+// red and blue, SDL_ConvertPixels() takes over twice as long for it.
+void swap_red_blue_row(uint32_t *SOWON_RESTRICT dst, const uint32_t *SOWON_RESTRICT src, int count)
+{
+    int i = 0;
+
+#ifdef SOWON_SSE2
+    {
+        const __m128i green_alpha = _mm_set1_epi32((int) 0xFF00FF00);
+        const __m128i red_blue = _mm_set1_epi32(0x00FF00FF);
+        for (; i + 4 <= count; i += 4) {
+            const __m128i p = _mm_loadu_si128((const __m128i *) &src[i]);
+            const __m128i swapped = _mm_or_si128(_mm_slli_epi32(p, 16), _mm_srli_epi32(p, 16));
+            _mm_storeu_si128((__m128i *) &dst[i],
+                             _mm_or_si128(_mm_and_si128(p, green_alpha), _mm_and_si128(swapped, red_blue)));
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const uint32_t p = src[i];
+        dst[i] = (p & 0xFF00FF00) | ((p << 16 | p >> 16) & 0x00FF00FF);
+    }
+}
+
+// Converts the dirty rectangles into surface
+void soft_canvas_blit(const SoftCanvas *canvas, SDL_Surface *surface)
+{
+    const int swap_red_blue =
+        surface->format->format == SDL_PIXELFORMAT_ARGB8888 ||
+        surface->format->format == SDL_PIXELFORMAT_RGB888;
+    if (SDL_MUSTLOCK(surface)) secc(SDL_LockSurface(surface));
+    for (int i = 0; i < canvas->dirty_count; ++i) {
+        const SDL_Rect *rect = &canvas->dirty[i];
+        if (swap_red_blue) {
+            for (int y = rect->y; y < rect->y + rect->h; ++y) {
+                swap_red_blue_row(
+                    (uint32_t *) ((Uint8 *) surface->pixels + y * surface->pitch) + rect->x,
+                    &canvas->fb.pixels[y * canvas->fb.width + rect->x],
+                    rect->w);
+            }
+            continue;
+        }
+        secc(SDL_ConvertPixels(
+                 rect->w, rect->h,
+                 SDL_PIXELFORMAT_ABGR8888,
+                 &canvas->fb.pixels[rect->y * canvas->fb.width + rect->x],
+                 canvas->fb.width * (int) sizeof(*canvas->fb.pixels),
+                 surface->format->format,
+                 (Uint8 *) surface->pixels + rect->y * surface->pitch + rect->x * surface->format->BytesPerPixel,
+                 surface->pitch));
+    }
+    if (SDL_MUSTLOCK(surface)) SDL_UnlockSurface(surface);
+}
+
+// surface is the one SDL_GetWindowSurface() returned for window
+void soft_canvas_present(SoftCanvas *canvas, SDL_Window *window, SDL_Surface *surface)
+{
+    soft_canvas_blit(canvas, surface);
+    secc(SDL_UpdateWindowSurfaceRects(window, canvas->dirty, canvas->dirty_count));
+}
+// SOFTWARE COMPOSITOR END //////////////////////////////
+
+// The scale that fits chars_count glyphs into a w x h area
+float text_fit_scale(int w, int h, size_t chars_count)
+{
+    float text_aspect_ratio = (float) TEXT_WIDTH(chars_count) / (float) TEXT_HEIGHT;
+    float window_aspect_ratio = (float) w / (float) h;
+    if(text_aspect_ratio > window_aspect_ratio) {
+        return (float) w / (float) TEXT_WIDTH(chars_count);
+    } else {
+        return (float) h / (float) TEXT_HEIGHT;
+    }
+}
+
+void initial_pen(const SDL_Rect *area, int *pen_x, int *pen_y, float user_scale, float fit_scale, size_t chars_count)
+{
+    const int effective_digit_width = (int) floorf((float) CHAR_WIDTH * user_scale * fit_scale);
+    const int effective_digit_height = (int) floorf((float) CHAR_HEIGHT * user_scale * fit_scale);
+    *pen_x = area->x + area->w / 2 - effective_digit_width * (int) chars_count / 2;
+    *pen_y = area->y + area->h / 2 - effective_digit_height / 2;
+}
+
+// Up to here the reciprocals below are exact (checked for every value)
+#define CLOCK_RECIPROCAL_MAX (100 * 60 * 60 - 1)
+
+// Splits every seconds[i] into the glyph indices of HH:MM:SS, with as many
+// hour digits as needed but at least two, and stores their amount into
+// lengths[i]. Under 100 hours the divisions by constants are
+// multiplications by their reciprocals, in 32 bit lanes and without
+// branches, so that path can be vectorized. Longer durations only add the
+// loop over the extra hour digits.
+void clock_glyphs(const size_t *SOWON_RESTRICT seconds, size_t count,
+                  Uint8 (*SOWON_RESTRICT glyphs)[CHARS_CAP], size_t *SOWON_RESTRICT lengths)
+{
+    for (size_t i = 0; i < count; ++i) {
+        Uint8 *g = glyphs[i];
+        size_t n = 0;
+        uint32_t rest;
+        if (seconds[i] <= CLOCK_RECIPROCAL_MAX) {
+            const uint32_t t = (uint32_t) seconds[i];
+            const uint32_t hours = ((t >> 4) * 9321) >> 21;     // t / 3600
+            const uint32_t hours_tens = (hours * 103) >> 10;    // x / 10 for x < 100
+            rest = t - hours * 3600;
+            g[n++] = (Uint8) hours_tens;
+            g[n++] = (Uint8) (hours - hours_tens * 10);
+        } else {
+            size_t hours = seconds[i] / 3600;
+            rest = (uint32_t) (seconds[i] - hours * 3600);
+            Uint8 digits[CHARS_CAP];
+            size_t digits_count = 0;
+            for (; hours > 0; hours /= 10) digits[digits_count++] = (Uint8) (hours % 10);
+            while (digits_count > 0) g[n++] = digits[--digits_count];
+        }
+        const uint32_t minutes = (rest * 2185) >> 17;           // rest / 60
+        const uint32_t secs = rest - minutes * 60;
+        const uint32_t minutes_tens = (minutes * 103) >> 10;
+        const uint32_t secs_tens = (secs * 103) >> 10;
+        g[n++] = COLON_INDEX;
+        g[n++] = (Uint8) minutes_tens;
+        g[n++] = (Uint8) (minutes - minutes_tens * 10);
+        g[n++] = COLON_INDEX;
+        g[n++] = (Uint8) secs_tens;
+        g[n++] = (Uint8) (secs - secs_tens * 10);
+        lengths[i] = n;
+    }
+}
+
+// Lays out count glyphs from clock_glyphs() centered in the area. The
+// digits and the colons wiggle out of phase with their neighbours.
+void layout_cells(Cell *cells, const Uint8 *glyphs, size_t count, size_t wiggle_index,
+                  const SDL_Rect *area, float user_scale, float fit_scale)
+{
+    int pen_x, pen_y;
+    initial_pen(area, &pen_x, &pen_y, user_scale, fit_scale, count);
+    size_t digits = 0, colons = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t offset = glyphs[i] == COLON_INDEX ? colons++ : digits++;
+        cells[i] = make_cell_at(glyphs[i], (wiggle_index + offset) % WIGGLE_COUNT,
+                                &pen_x, &pen_y, user_scale, fit_scale);
+    }
+}
+
+typedef enum {
+    MODE_ASCENDING = 0,
+    MODE_COUNTDOWN,
+    MODE_CLOCK,
+} Mode;
+
+float parse_time(const char *time)
+{
+    float result = 0.0f;
+
+    while (*time) {
+        char *endptr = NULL;
+        float x = strtof(time, &endptr);
+
+        if (time == endptr) {
+            fprintf(stderr, "`%s` is not a number\n", time);
+            exit(1);
+        }
+
+        switch (*endptr) {
+        case '\0':
+        case 's': result += x;                 break;
+        case 'm': result += x * 60.0f;         break;
+        case 'h': result += x * 60.0f * 60.0f; break;
+        default:
+            fprintf(stderr, "`%c` is an unknown time unit\n", *endptr);
+            exit(1);
+        }
+
+        time = endptr;
+        if (*time) time += 1;
+    }
+
+    return result;
+}
+
+// FRAME PACING BEGIN //////////////////////////////
+// Frames are paced one of three ways, picked from the display refresh rate
+// and the target rate:
+// - vsync: the target is the refresh rate and the renderer waits for the
+//   vertical blank in SDL_RenderPresent(), so we never sleep ourselves
+// - hybrid (-H): SDL_Delay() until shortly before the deadline, then spin on
+//   the performance counter, for rates where the sleep granularity would
+//   judder. It burns a core for the spin, so it has to be asked for.
+// - timer: plain SDL_Delay(), when the frame rate is not the refresh rate,
+//   for long frames and for the CPU compositor
+typedef enum {
+    PACING_VSYNC = 0,
+    PACING_HYBRID,
+    PACING_TIMER,
+} Pacing;
+
+const char *pacing_name(Pacing pacing)
+{
+    switch (pacing) {
+    case PACING_VSYNC: return "vsync";
+    case PACING_HYBRID: return "hybrid";
+    case PACING_TIMER: return "timer";
+    }
+    return "unknown";
+}
+
+// Used when the display does not report its refresh rate
+#define DEFAULT_REFRESH_RATE 60
+// Frames at least this long (in ms) are paced with the timer alone
+#define PACING_TIMER_MIN_PERIOD 20
+// How early (in ms) the hybrid pacing wakes up to spin till the deadline
+#define PACING_SPIN_MARGIN 2
+
+int display_refresh_rate(SDL_Window *window)
+{
+    SDL_DisplayMode mode;
+    const int display = SDL_GetWindowDisplayIndex(window);
+    if (display < 0 || SDL_GetCurrentDisplayMode(display, &mode) < 0 || mode.refresh_rate <= 0) {
+        return DEFAULT_REFRESH_RATE;
+    }
+    return mode.refresh_rate;
+}
+
+typedef struct {
+    Pacing pacing;
+    Uint64 freq;
+    Uint64 period;          // target frame time in ticks
+    Uint64 deadline;        // when the current frame should end
+    int idle;               // the next frame follows an idle wait
+    float dt;
+    Uint64 last_time;
+
+    // Frame times of the frames that followed each other on the schedule,
+    // frames after an idle wait are not paced and are left out (Welford)
+    Uint64 paced_frames;
+    double mean;
+    double m2;
+} FpsDeltaTime;
+
+FpsDeltaTime make_fpsdeltatime(Pacing pacing, int target_fps)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 now = SDL_GetPerformanceCounter();
+    return (FpsDeltaTime){
+        .pacing = pacing,
+        .freq = freq,
+        .period = freq / (Uint64) target_fps,
+        .deadline = now,
+        .dt = 0.0f,
+        .last_time = now,
+    };
+}
+
+void frame_start(FpsDeltaTime *fpsdt)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 elapsed = now - fpsdt->last_time;
+    fpsdt->dt = ((float)elapsed)  / ((float)fpsdt->freq);
+    fpsdt->last_time = now;
+
+    // Stay on the schedule while the frames keep coming. The first frame
+    // after an idle wait is drawn right away and the schedule starts over
+    // from the wake up time, instead of sleeping a whole period first.
+    if (!fpsdt->idle && now < fpsdt->deadline + fpsdt->period) {
+        fpsdt->deadline += fpsdt->period;
+
+        const double ms = (double) elapsed * 1000.0 / (double) fpsdt->freq;
+        fpsdt->paced_frames += 1;
+        const double delta = ms - fpsdt->mean;
+        fpsdt->mean += delta / (double) fpsdt->paced_frames;
+        fpsdt->m2 += delta * (ms - fpsdt->mean);
+    } else {
+        fpsdt->deadline = now;
+    }
+    fpsdt->idle = 0;
+}
+
+// Sleeps till the deadline of the frame, idle_ms is how long the idle wait
+// after the frame is going to be. When that wait goes past the deadline the
+// next frame is an idle wakeup, so there is nothing to pace and the wait
+// sleeps instead. Returns 1 when it slept till the deadline.
+int frame_end(FpsDeltaTime *fpsdt, int idle_ms)
+{
+    if (fpsdt->pacing == PACING_VSYNC) return 0;
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= fpsdt->deadline) return 0;
+    if (idle_ms > 0 && (Uint64) idle_ms * fpsdt->freq / 1000 >= fpsdt->deadline - now) {
+        // An event may end the wait early, that frame starts a new schedule
+        fpsdt->idle = 1;
+        return 0;
+    }
+
+    Uint64 sleep_ms = (fpsdt->deadline - now) * 1000 / fpsdt->freq;
+    if (fpsdt->pacing == PACING_HYBRID) {
+        sleep_ms = sleep_ms > PACING_SPIN_MARGIN ? sleep_ms - PACING_SPIN_MARGIN : 0;
+    }
+    if (sleep_ms > 0) SDL_Delay((Uint32) sleep_ms);
+
+    if (fpsdt->pacing == PACING_HYBRID) {
+        while (SDL_GetPerformanceCounter() < fpsdt->deadline) {}
+    }
+    return 1;
+}
+
+void frame_report(const FpsDeltaTime *fpsdt, FILE *stream)
+{
+    const double variance = fpsdt->paced_frames > 1 ? fpsdt->m2 / (double) (fpsdt->paced_frames - 1) : 0.0;
+    fprintf(stream, "%s pacing, target %.3f ms: %llu paced frames, mean %.3f ms, variance %.4f ms^2, stddev %.3f ms\n",
+            pacing_name(fpsdt->pacing),
+            (double) fpsdt->period * 1000.0 / (double) fpsdt->freq,
+            (unsigned long long) fpsdt->paced_frames,
+            fpsdt->mean, variance, sqrt(variance));
+}
+// FRAME PACING END //////////////////////////////
+
+// PROFILER BEGIN //////////////////////////////
+// Per frame timings of the main loop phases. The last PROFILER_RING_CAP
+// frames are kept for the CSV dump, and every frame also goes into a log
+// linear histogram per phase (HdrHistogram style: 16 sub buckets per power
+// of two, so about 6% precision over 1us..64s) for the percentiles. Only
+// the main thread writes, so there are no locks.
+typedef enum {
+    PHASE_INPUT = 0,
+    PHASE_UPDATE,
+    PHASE_RENDER,
+    PHASE_PRESENT,
+    PHASE_FRAME,        // everything above together
+    PHASE_COUNT,
+} Phase;
+
+const char *phase_name(Phase phase)
+{
+    switch (phase) {
+    case PHASE_INPUT: return "input";
+    case PHASE_UPDATE: return "update";
+    case PHASE_RENDER: return "render";
+    case PHASE_PRESENT: return "present";
+    case PHASE_FRAME: return "frame";
+    case PHASE_COUNT: break;
+    }
+    return "unknown";
+}
+
+#define PROFILER_RING_CAP 4096
+#define HIST_SUB_BITS 4
+#define HIST_SUB_COUNT (1 << HIST_SUB_BITS)
+#define HIST_MAX_BITS 26
+#define HIST_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB_COUNT)
+// How often the overlay numbers get refreshed when nothing else changes
+#define PROFILER_OVERLAY_REFRESH 0.25f
+// Window title updates remembered for the per minute rate, more than the
+// title rate limit lets through in a minute
+#define PROFILER_TITLE_CAP 256
+
+typedef struct {
+    Uint64 start;                   // counter at the frame start
+    Uint32 us[PHASE_COUNT];
+} ProfilerFrame;
+
+typedef struct {
+    Uint32 counts[HIST_BUCKETS];
+    Uint64 total;
+    Uint32 max;
+} Histogram;
+
+typedef struct {
+    Uint64 freq;
+    Phase phase;
+    Uint64 phase_start;
+    ProfilerFrame current;
+    ProfilerFrame ring[PROFILER_RING_CAP];
+    Uint64 frames;                  // ever recorded, ring[frames % PROFILER_RING_CAP] is next
+    Histogram hist[PHASE_COUNT];
+    Uint64 title_updates[PROFILER_TITLE_CAP];   // counters of the latest ones
+    Uint64 title_updates_count;
+} Profiler;
+
+size_t hist_bucket(Uint32 us)
+{
+    if (us >= (1u << HIST_MAX_BITS)) us = (1u << HIST_MAX_BITS) - 1;
+    if (us < HIST_SUB_COUNT) return us;
+    int msb = HIST_SUB_BITS;
+    while (us >> (msb + 1)) msb += 1;
+    const int shift = msb - HIST_SUB_BITS;
+    return (size_t) (shift + 1) * HIST_SUB_COUNT + (us >> shift) - HIST_SUB_COUNT;
+}
+
+// The highest value that lands in the bucket
+Uint32 hist_bucket_value(size_t bucket)
+{
+    if (bucket < HIST_SUB_COUNT) return (Uint32) bucket;
+    const size_t shift = bucket / HIST_SUB_COUNT - 1;
+    const Uint32 sub = (Uint32) (bucket % HIST_SUB_COUNT) + HIST_SUB_COUNT;
+    return ((sub + 1) << shift) - 1;
+}
+
+void hist_record(Histogram *hist, Uint32 us)
+{
+    hist->counts[hist_bucket(us)] += 1;
+    hist->total += 1;
+    if (us > hist->max) hist->max = us;
+}
+
+// percentile in 0..100
+Uint32 hist_percentile(const Histogram *hist, Uint32 percentile)
+{
+    if (hist->total == 0) return 0;
+    const Uint64 rank = (hist->total * percentile + 99) / 100;
+    Uint64 seen = 0;
+    for (size_t i = 0; i < HIST_BUCKETS; ++i) {
+        seen += hist->counts[i];
+        if (seen >= rank && seen > 0) {
+            const Uint32 value = hist_bucket_value(i);
+            return value < hist->max ? value : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+void profiler_init(Profiler *profiler)
+{
+    memset(profiler, 0, sizeof(*profiler));
+    profiler->freq = SDL_GetPerformanceFrequency();
+}
+
+// Closes the current phase and starts the given one. A phase may be entered
+// several times per frame, the times add up.
+void profiler_begin(Profiler *profiler, Phase phase)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (phase == PHASE_INPUT) {
+        memset(&profiler->current, 0, sizeof(profiler->current));
+        profiler->current.start = now;
+    } else {
+        profiler->current.us[profiler->phase] += (Uint32) ((now - profiler->phase_start) * 1000000 / profiler->freq);
+    }
+    profiler->phase = phase;
+    profiler->phase_start = now;
+}
+
+void profiler_end_frame(Profiler *profiler)
+{
+    profiler_begin(profiler, PHASE_FRAME);
+    ProfilerFrame *frame = &profiler->current;
+    frame->us[PHASE_FRAME] = 0;
+    for (int i = 0; i < PHASE_FRAME; ++i) frame->us[PHASE_FRAME] += frame->us[i];
+    for (int i = 0; i < PHASE_COUNT; ++i) hist_record(&profiler->hist[i], frame->us[i]);
+    profiler->ring[profiler->frames % PROFILER_RING_CAP] = *frame;
+    profiler->frames += 1;
+}
+
+void profiler_count_title_update(Profiler *profiler, Uint64 now)
+{
+    profiler->title_updates[profiler->title_updates_count % PROFILER_TITLE_CAP] = now;
+    profiler->title_updates_count += 1;
+}
+
+// Window title updates within the last minute
+Uint32 profiler_title_updates_per_minute(const Profiler *profiler, Uint64 now)
+{
+    const Uint64 count = profiler->title_updates_count < PROFILER_TITLE_CAP
+        ? profiler->title_updates_count
+        : PROFILER_TITLE_CAP;
+    Uint32 result = 0;
+    for (Uint64 i = 0; i < count; ++i) {
+        if (now - profiler->title_updates[i] < 60 * profiler->freq) result += 1;
+    }
+    return result;
+}
+
+int profiler_dump_csv(const Profiler *profiler, const char *file_path)
+{
+    FILE *f = fopen(file_path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open `%s`: %s\n", file_path, strerror(errno));
+        return 0;
+    }
+
+    fprintf(f, "frame,time_ms");
+    for (int i = 0; i < PHASE_COUNT; ++i) fprintf(f, ",%s_us", phase_name(i));
+    fprintf(f, "\n");
+
+    const Uint64 first = profiler->frames > PROFILER_RING_CAP ? profiler->frames - PROFILER_RING_CAP : 0;
+    const Uint64 origin = profiler->ring[first % PROFILER_RING_CAP].start;
+    for (Uint64 n = first; n < profiler->frames; ++n) {
+        const ProfilerFrame *frame = &profiler->ring[n % PROFILER_RING_CAP];
+        fprintf(f, "%llu,%.3f", (unsigned long long) n,
+                (double) (frame->start - origin) * 1000.0 / (double) profiler->freq);
+        for (int i = 0; i < PHASE_COUNT; ++i) fprintf(f, ",%u", (unsigned) frame->us[i]);
+        fprintf(f, "\n");
+    }
+
+    fclose(f);
+    return 1;
+}
+
+#define OVERLAY_CHAR_WIDTH (CHAR_WIDTH / 10)
+#define OVERLAY_CHAR_HEIGHT (CHAR_HEIGHT / 10)
+// Per phase "p50:p95:p99:max", up to 8 digits per number, and the title
+// updates per minute
+#define OVERLAY_CELLS_CAP (PHASE_COUNT * 4 * 9 + 9)
+
+size_t overlay_number(Cell *cells, size_t count, Uint32 value, int *pen_x, int pen_y)
+{
+    char digits[16];
+    const int n = snprintf(digits, sizeof(digits), "%u", (unsigned) value);
+    for (int i = 0; i < n; ++i) {
+        cells[count].digit_index = (size_t) (digits[i] - '0');
+        cells[count].wiggle_index = 0;
+        cells[count].dst_rect = (SDL_Rect) {*pen_x, pen_y, OVERLAY_CHAR_WIDTH, OVERLAY_CHAR_HEIGHT};
+        *pen_x += OVERLAY_CHAR_WIDTH;
+        count += 1;
+    }
+    return count;
+}
+
+// Lays out one row per phase in the order of Phase with the p50, p95, p99
+// and max frame times in microseconds, separated by colons, and a last row
+// with the window title updates of the last minute
+size_t profiler_overlay_cells(const Profiler *profiler, Cell cells[OVERLAY_CELLS_CAP], Uint64 now)
+{
+    static const Uint32 percentiles[] = {50, 95, 99};
+    size_t count = 0;
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        const Histogram *hist = &profiler->hist[i];
+        int pen_x = OVERLAY_CHAR_WIDTH / 2;
+        const int pen_y = OVERLAY_CHAR_HEIGHT / 2 + i * OVERLAY_CHAR_HEIGHT;
+        for (size_t j = 0; j < sizeof(percentiles) / sizeof(percentiles[0]); ++j) {
+            count = overlay_number(cells, count, hist_percentile(hist, percentiles[j]), &pen_x, pen_y);
+            cells[count].digit_index = COLON_INDEX;
+            cells[count].wiggle_index = 0;
+            cells[count].dst_rect = (SDL_Rect) {pen_x, pen_y, OVERLAY_CHAR_WIDTH, OVERLAY_CHAR_HEIGHT};
+            pen_x += OVERLAY_CHAR_WIDTH;
+            count += 1;
+        }
+        count = overlay_number(cells, count, hist->max, &pen_x, pen_y);
+    }
+    int pen_x = OVERLAY_CHAR_WIDTH / 2;
+    const int pen_y = OVERLAY_CHAR_HEIGHT / 2 + PHASE_COUNT * OVERLAY_CHAR_HEIGHT;
+    count = overlay_number(cells, count, profiler_title_updates_per_minute(profiler, now), &pen_x, pen_y);
+    return count;
+}
+// PROFILER END //////////////////////////////
+
+// TIMER BEGIN //////////////////////////////
+// The displayed time is computed from performance counter timestamps
+// instead of integrating frame deltas into a float, so it does not drift
+// from the wall time no matter how long sowon runs.
+typedef struct {
+    Mode mode;
+    Uint64 freq;
+    Uint64 start;          // counter at the (re)start
+    Uint64 paused_total;   // ticks spent paused since the start
+    Uint64 paused_at;      // counter at the moment of pausing
+    int paused;
+    Uint64 duration;       // countdown length in ticks
+
+    // Clock mode: the second of the day and the counter at its start. Only
+    // re-synced with the wall clock when the counter says that second is over.
+    Uint64 clock_seconds;
+    Uint64 clock_since;
+} Timer;
+
+// Wall clock time as the second of the day plus nanoseconds into it
+void wall_clock_now(Uint64 *seconds, Uint64 *nsec)
+{
+    struct tm tm;
+    struct timespec ts;
+#ifdef _WIN32
+    // No clock_gettime() in the UCRT, but it has C11 timespec_get()
+    timespec_get(&ts, TIME_UTC);
+    localtime_s(&tm, &ts.tv_sec);
+#else
+    clock_gettime(CLOCK_REALTIME, &ts);
+    localtime_r(&ts.tv_sec, &tm);
+#endif
+    *nsec = (Uint64) ts.tv_nsec;
+    *seconds = tm.tm_sec
+             + tm.tm_min  * 60
+             + tm.tm_hour * 60 * 60;
+}
+
+// Resyncs the clock with the wall time. Going through localtime_r() every
+// second picks up timezone and DST changes without any extra checks.
+void timer_clock_sync(Timer *timer, Uint64 now)
+{
+    Uint64 seconds, nsec;
+    wall_clock_now(&seconds, &nsec);
+    timer->clock_seconds = seconds;
+    timer->clock_since = now - nsec * timer->freq / 1000000000;
+}
+
+void timer_restart(Timer *timer, Mode mode, float initial_time, int paused, Uint64 now)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    *timer = (Timer) {
+        .mode = mode,
+        .freq = freq,
+        .start = now,
+        .paused_at = now,
+        .paused = paused,
+        .duration = (Uint64) ((double) fmaxf(initial_time, 0.0f) * (double) freq + 0.5),
+        .clock_since = now,
+    };
+    if (mode == MODE_CLOCK) timer_clock_sync(timer, now);
+}
+
+void timer_toggle_pause(Timer *timer, Uint64 now)
+{
+    if (timer->paused) {
+        timer->paused_total += now - timer->paused_at;
+    } else {
+        timer->paused_at = now;
+    }
+    timer->paused = !timer->paused;
+}
+
+Uint64 timer_elapsed(const Timer *timer, Uint64 now)
+{
+    return (timer->paused ? timer->paused_at : now) - timer->start - timer->paused_total;
+}
+
+// Returns 1 when the countdown is over. A paused countdown is never over,
+// so `-p -e` waits for the first unpause.
+int timer_update(Timer *timer, Uint64 now)
+{
+    switch (timer->mode) {
+    case MODE_ASCENDING: break;
+    case MODE_COUNTDOWN: {
+        return !timer->paused && timer_elapsed(timer, now) >= timer->duration;
+    } break;
+    case MODE_CLOCK: {
+        if (timer->paused) break;
+        if (now - timer->clock_since >= timer->freq) timer_clock_sync(timer, now);
+    } break;
+    }
+    return 0;
+}
+
+// The displayed time in counter ticks
+Uint64 timer_displayed(const Timer *timer, Uint64 now)
+{
+    switch (timer->mode) {
+    case MODE_ASCENDING: {
+        return timer_elapsed(timer, now);
+    } break;
+    case MODE_COUNTDOWN: {
+        const Uint64 elapsed = timer_elapsed(timer, now);
+        return elapsed < timer->duration ? timer->duration - elapsed : 0;
+    } break;
+    case MODE_CLOCK: {
+        // subsecond resolution for penger, without ever reaching the next second
+        Uint64 subsecond = (timer->paused ? timer->paused_at : now) - timer->clock_since;
+        if (subsecond >= timer->freq) subsecond = timer->freq - 1;
+        return timer->clock_seconds * timer->freq + subsecond;
+    } break;
+    }
+    return 0;
+}
+
+// Ticks until `ticks`, moving up (or down if `descending`), crosses the next
+// multiple of period
+Uint64 until_next_tick(Uint64 ticks, Uint64 period, int descending)
+{
+    return descending ? ticks % period + 1 : period - ticks % period;
+}
+
+// How long the main loop may sleep before anything on the screen changes:
+// the next wiggle step, the next displayed second or the next penger step.
+int next_change_timeout(const Timer *timer, Uint64 now, float wiggle_cooldown)
+{
+    float timeout = wiggle_cooldown;
+
+    if (!timer->paused) {
+        const int descending = timer->mode == MODE_COUNTDOWN;
+        const Uint64 ticks = timer_displayed(timer, now);
+        if (!descending || ticks > 0) {
+            Uint64 until = until_next_tick(ticks, timer->freq, descending);
+#ifdef PENGER
+            const Uint64 penger_until = until_next_tick(ticks, timer->freq / PENGER_STEPS_PER_SECOND, descending);
+            if (penger_until < until) until = penger_until;
+#endif
+            timeout = fminf(timeout, (float) until / (float) timer->freq);
+        }
+    }
+
+    // +1 ms so we wake up right after the change instead of right before it
+    return (int) ceilf(fmaxf(timeout, 0.0f) * 1000.0f) + 1;
+}
+
+// Whole seconds to display
+size_t timer_seconds(const Timer *timer, Uint64 now)
+{
+    return (size_t) (timer_displayed(timer, now) / timer->freq);
+}
+
+// Penger only cares about the time within a minute, which keeps the float
+// precise however long the timer runs
+float timer_penger_time(const Timer *timer, Uint64 now)
+{
+    return (float) (timer_displayed(timer, now) % (60 * timer->freq)) / (float) timer->freq;
+}
+// TIMER END //////////////////////////////
+
+void update_wiggle(size_t *wiggle_index, float *wiggle_cooldown, float dt)
+{
+    *wiggle_cooldown -= dt;
+    if (*wiggle_cooldown <= 0.0f) {
+        *wiggle_index += 1;
+        *wiggle_cooldown = WIGGLE_DURATION;
+    }
+}
+
+typedef enum {
+    OUTPUT_RGBA = 0,
+    OUTPUT_Y4M,
+    OUTPUT_SHM,
+} OutputFormat;
+
+// A timer from the command line: `clock`, `ascending` or a countdown
+// duration, optionally followed by its grid slot as `@col,row`
+typedef struct {
+    Mode mode;
+    float initial_time;
+    int col, row;       // -1 when not given
+} TimerSpec;
+
+typedef struct {
+    TimerSpec timers[TIMERS_CAP];
+    size_t timers_count;
+    // Grid size when any timer has a position, 0 lays the timers out automatically
+    int grid_cols, grid_rows;
+    int paused;
+    int exit_after_countdown;
+    int software;
+    int verbose;
+    int no_title;
+    // Spin the last milliseconds before each frame, see Pacing
+    int hybrid_pacing;
+    // Timer server socket, see server.h
+    const char *server_path;
+    int no_render;
+    // CSV dump of the profiler at exit
+    const char *profile_path;
+    // Target frame rate, 0 picks the display refresh rate
+    int fps;
+
+    // Headless mode when output_path is not NULL
+    const char *output_path;
+    OutputFormat output_format;
+    int output_width;
+    int output_height;
+} Config;
+
+const char *flag_value(int argc, char **argv, int *i)
+{
+    if (*i + 1 >= argc) {
+        fprintf(stderr, "`%s` expects a value\n", argv[*i]);
+        exit(1);
+    }
+    *i += 1;
+    return argv[*i];
+}
+
+TimerSpec parse_timer_spec(const char *arg)
+{
+    TimerSpec spec = {.col = -1, .row = -1};
+
+    char what[64];
+    const char *at = strchr(arg, '@');
+    const size_t len = at ? (size_t) (at - arg) : strlen(arg);
+    if (len == 0 || len >= sizeof(what)) {
+        fprintf(stderr, "`%s` is not a valid timer\n", arg);
+        exit(1);
+    }
+    memcpy(what, arg, len);
+    what[len] = '\0';
+
+    if (strcmp(what, "clock") == 0) {
+        spec.mode = MODE_CLOCK;
+    } else if (strcmp(what, "ascending") == 0) {
+        spec.mode = MODE_ASCENDING;
+    } else {
+        spec.mode = MODE_COUNTDOWN;
+        spec.initial_time = parse_time(what);
+    }
+
+    if (at != NULL) {
+        char rest;
+        if (sscanf(at + 1, "%d,%d%c", &spec.col, &spec.row, &rest) != 2 ||
+            spec.col < 0 || spec.row < 0 || spec.col >= TIMERS_CAP || spec.row >= TIMERS_CAP) {
+            fprintf(stderr, "`%s` is not a valid position, expected @col,row\n", at);
+            exit(1);
+        }
+    }
+
+    return spec;
+}
+
+// Timers without a position take the free slots in reading order
+void place_timers(Config *config)
+{
+    int positioned = 0;
+    for (size_t i = 0; i < config->timers_count; ++i) {
+        const TimerSpec *spec = &config->timers[i];
+        if (spec->col < 0) continue;
+        positioned = 1;
+        if (spec->col + 1 > config->grid_cols) config->grid_cols = spec->col + 1;
+        if (spec->row + 1 > config->grid_rows) config->grid_rows = spec->row + 1;
+        for (size_t j = 0; j < i; ++j) {
+            if (config->timers[j].col == spec->col && config->timers[j].row == spec->row) {
+                fprintf(stderr, "Two timers at %d,%d\n", spec->col, spec->row);
+                exit(1);
+            }
+        }
+    }
+    if (!positioned) return;
+
+    int slot = 0;
+    for (size_t i = 0; i < config->timers_count; ++i) {
+        TimerSpec *spec = &config->timers[i];
+        if (spec->col >= 0) continue;
+        for (;; ++slot) {
+            const int col = slot % config->grid_cols, row = slot / config->grid_cols;
+            int taken = 0;
+            for (size_t j = 0; j < config->timers_count && !taken; ++j) {
+                taken = config->timers[j].col == col && config->timers[j].row == row;
+            }
+            if (!taken) {
+                spec->col = col;
+                spec->row = row;
+                if (row + 1 > config->grid_rows) config->grid_rows = row + 1;
+                break;
+            }
+        }
+    }
+}
+
+Config parse_config(int argc, char **argv)
 {
-    if (code < 0) {
-        fprintf(stderr, "SDL pooped itself: %s\n", SDL_GetError());
-        abort();
+    Config config = {
+        .output_format = OUTPUT_RGBA,
+        .output_width = TEXT_WIDTH(CHARS_MIN),
+        .output_height = TEXT_HEIGHT*2,
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-p") == 0) {
+            config.paused = 1;
+        } else if (strcmp(argv[i], "-e") == 0) {
+            config.exit_after_countdown = 1;
+        } else if (strcmp(argv[i], "-c") == 0) {
+            config.software = 1;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            config.verbose = 1;
+        } else if (strcmp(argv[i], "-T") == 0) {
+            config.no_title = 1;
+        } else if (strcmp(argv[i], "-H") == 0) {
+            config.hybrid_pacing = 1;
+        } else if (strcmp(argv[i], "-S") == 0) {
+            config.server_path = flag_value(argc, argv, &i);
+        } else if (strcmp(argv[i], "-n") == 0) {
+            config.no_render = 1;
+        } else if (strcmp(argv[i], "-P") == 0) {
+            config.profile_path = flag_value(argc, argv, &i);
+        } else if (strcmp(argv[i], "-o") == 0) {
+            config.output_path = flag_value(argc, argv, &i);
+        } else if (strcmp(argv[i], "-f") == 0) {
+            const char *format = flag_value(argc, argv, &i);
+            if (strcmp(format, "rgba") == 0) {
+                config.output_format = OUTPUT_RGBA;
+            } else if (strcmp(format, "y4m") == 0) {
+                config.output_format = OUTPUT_Y4M;
+            } else if (strcmp(format, "shm") == 0) {
+                config.output_format = OUTPUT_SHM;
+            } else {
+                fprintf(stderr, "`%s` is an unknown output format\n", format);
+                exit(1);
+            }
+        } else if (strcmp(argv[i], "-s") == 0) {
+            const char *size = flag_value(argc, argv, &i);
+            if (sscanf(size, "%dx%d", &config.output_width, &config.output_height) != 2 ||
+                config.output_width <= 0 || config.output_height <= 0) {
+                fprintf(stderr, "`%s` is not a valid size, expected WIDTHxHEIGHT\n", size);
+                exit(1);
+            }
+        } else if (strcmp(argv[i], "-r") == 0) {
+            const char *fps = flag_value(argc, argv, &i);
+            config.fps = atoi(fps);
+            if (config.fps <= 0) {
+                fprintf(stderr, "`%s` is not a valid frame rate\n", fps);
+                exit(1);
+            }
+        } else {
+            if (config.timers_count >= TIMERS_CAP) {
+                fprintf(stderr, "Too many timers, at most %d are supported\n", TIMERS_CAP);
+                exit(1);
+            }
+            config.timers[config.timers_count++] = parse_timer_spec(argv[i]);
+        }
     }
+
+    if (config.timers_count == 0) {
+        config.timers[config.timers_count++] = (TimerSpec) {.mode = MODE_ASCENDING, .col = -1, .row = -1};
+    }
+    place_timers(&config);
+
+    if (config.no_render && config.server_path == NULL) {
+        fprintf(stderr, "-n only makes sense for the timer server (-S)\n");
+        exit(1);
+    }
+
+    if (config.output_path != NULL && config.fps == 0) {
+        config.fps = HEADLESS_FPS;
+    }
+
+    if (config.output_format == OUTPUT_Y4M &&
+        (config.output_width % 2 != 0 || config.output_height % 2 != 0)) {
+        fprintf(stderr, "y4m output needs an even width and height\n");
+        exit(1);
+    }
+
+    return config;
 }
 
-void *secp(void *ptr)
+// TIMERS BEGIN //////////////////////////////
+// All the timers from the command line, driven by one loop. They share the
+// pause state, the wiggle and the glyphs, so every extra timer only costs
+// a quad per glyph.
+typedef struct {
+    Timer items[TIMERS_CAP];
+    size_t count;
+} Timers;
+
+void timers_restart(Timers *timers, const Config *config, Uint64 now)
 {
-    if (ptr == NULL) {
-        fprintf(stderr, "SDL pooped itself: %s\n", SDL_GetError());
-        abort();
+    timers->count = config->timers_count;
+    for (size_t i = 0; i < timers->count; ++i) {
+        timer_restart(&timers->items[i], config->timers[i].mode, config->timers[i].initial_time, config->paused, now);
     }
-
-    return ptr;
 }
 
-SDL_Surface *load_png_file_as_surface(uint32_t *data, size_t width, size_t height)
+void timers_toggle_pause(Timers *timers, Uint64 now)
 {
-    SDL_Surface* image_surface =
-        secp(SDL_CreateRGBSurfaceFrom(
-                 data,
-                 (int) width,
-                 (int) height,
-                 32,
-                 (int) width * 4,
-                 0x000000FF,
-                 0x0000FF00,
-                 0x00FF0000,
-                 0xFF000000));
-    return image_surface;
+    for (size_t i = 0; i < timers->count; ++i) {
+        timer_toggle_pause(&timers->items[i], now);
+    }
 }
 
-SDL_Texture *load_digits_png_file_as_texture(SDL_Renderer *renderer)
+// Returns 1 when there are countdowns and all of them are over
+int timers_update(Timers *timers, Uint64 now)
 {
-    SDL_Surface *image_surface = load_png_file_as_surface(digits_data, digits_width, digits_height);
-    return secp(SDL_CreateTextureFromSurface(renderer, image_surface));
+    size_t countdowns = 0, over = 0;
+    for (size_t i = 0; i < timers->count; ++i) {
+        over += timer_update(&timers->items[i], now);
+        countdowns += timers->items[i].mode == MODE_COUNTDOWN;
+    }
+    return countdowns > 0 && over == countdowns;
 }
 
-#ifdef PENGER
-SDL_Texture *load_penger_png_file_as_texture(SDL_Renderer *renderer)
+int timers_next_change_timeout(const Timers *timers, Uint64 now, float wiggle_cooldown)
 {
-    SDL_Surface *image_surface = load_png_file_as_surface(penger_data, penger_width, penger_height);
-    return secp(SDL_CreateTextureFromSurface(renderer, image_surface));
+    int timeout = next_change_timeout(&timers->items[0], now, wiggle_cooldown);
+    for (size_t i = 1; i < timers->count; ++i) {
+        const int t = next_change_timeout(&timers->items[i], now, wiggle_cooldown);
+        if (t < timeout) timeout = t;
+    }
+    return timeout;
 }
+
+// Sleeps until an event arrives or timeout ms pass. Before 2.0.16
+// SDL_WaitEventTimeout() polls the queue with SDL_Delay(1) in between, so
+// on older SDL just sleep through the timeout and let the next INPUT stage
+// poll whatever arrived meanwhile. The timeout never exceeds a wiggle step.
+void wait_for_event(int timeout)
+{
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+    // NULL leaves the event in the queue for the INPUT stage
+    SDL_WaitEventTimeout(NULL, timeout);
+#else
+    if (timeout > 0) SDL_Delay((Uint32) timeout);
 #endif
+}
 
-void render_digit_at(SDL_Renderer *renderer, SDL_Texture *digits, size_t digit_index,
-                     size_t wiggle_index, int *pen_x, int *pen_y, float user_scale, float fit_scale)
+// Lays out the count timers from clock_glyphs(), centered in their slots
+// of a grid over the w x h area. The slots come from the command line,
+// without them (or with a NULL config) the grid gets the amount of columns
+// that shows the digits the biggest. Returns the amount of cells.
+size_t layout_timers(Cell cells[CELLS_CAP], Uint8 (*glyphs)[CHARS_CAP], const size_t *lengths, size_t count,
+                     const Config *config, size_t wiggle_index, int w, int h, float user_scale)
 {
-    const int effective_digit_width = (int) floorf((float) CHAR_WIDTH * user_scale * fit_scale);
-    const int effective_digit_height = (int) floorf((float) CHAR_HEIGHT * user_scale * fit_scale);
+    if (count == 0) {
+        // Callers size the glyphs after the first cell
+        cells[0] = (Cell) {0};
+        return 0;
+    }
 
-    const SDL_Rect src_rect = {
-        (int) (digit_index * SPRITE_CHAR_WIDTH),
-        (int) (wiggle_index * SPRITE_CHAR_HEIGHT),
-        SPRITE_CHAR_WIDTH,
-        SPRITE_CHAR_HEIGHT
-    };
-    const SDL_Rect dst_rect = {
-        *pen_x,
-        *pen_y,
-        effective_digit_width,
-        effective_digit_height
-    };
-    SDL_RenderCopy(renderer, digits, &src_rect, &dst_rect);
-    *pen_x += effective_digit_width;
+    // All the timers get the scale of the widest one, so the glyphs are
+    // the same size everywhere
+    size_t widest = CHARS_MIN;
+    for (size_t i = 0; i < count; ++i) {
+        if (lengths[i] > widest) widest = lengths[i];
+    }
+
+    const int positioned = config != NULL && config->grid_cols > 0;
+    int cols = positioned ? config->grid_cols : 0;
+    int rows = positioned ? config->grid_rows : 0;
+    if (!positioned) {
+        const int n = (int) count;
+        float best = -1.0f;
+        for (int c = 1; c <= n; ++c) {
+            const int r = (n + c - 1) / c;
+            const float scale = text_fit_scale(w / c, h / r, widest);
+            if (scale > best) {
+                best = scale;
+                cols = c;
+                rows = r;
+            }
+        }
+    }
+
+    const int slot_w = w / cols, slot_h = h / rows;
+    // Some room between the neighbouring timers
+    const int pad = count > 1 ? slot_w / 40 : 0;
+    const float fit_scale = text_fit_scale(slot_w - 2 * pad, slot_h, widest);
+    size_t cells_count = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const int col = positioned ? config->timers[i].col : (int) i % cols;
+        const int row = positioned ? config->timers[i].row : (int) i / cols;
+        const SDL_Rect area = {col * slot_w + pad, row * slot_h, slot_w - 2 * pad, slot_h};
+        layout_cells(&cells[cells_count], glyphs[i], lengths[i], wiggle_index, &area, user_scale, fit_scale);
+        cells_count += lengths[i];
+    }
+    return cells_count;
 }
 
-#ifdef PENGER
-void render_penger_at(SDL_Renderer *renderer, SDL_Texture *penger, float time, int flipped, SDL_Window *window)
+// The geometry of the cells only changes with the window size, the zoom
+// and the lengths of the clocks, so the cache keeps the last layout and
+// every other frame only fills in the glyphs and the wiggles. The owner
+// clears valid on resizes and zooms.
+typedef struct {
+    int valid;
+    size_t count;
+    size_t lengths[TIMERS_CAP];
+    Cell cells[CELLS_CAP];      // laid out with wiggle_index 0
+    size_t cells_count;
+} LayoutCache;
+
+// Like layout_timers() from the seconds of every timer. w, h and
+// user_scale are only looked at when the layout has to be redone.
+size_t layout_cached(LayoutCache *cache, Cell cells[CELLS_CAP], const size_t *seconds, size_t count,
+                     const Config *config, size_t wiggle_index, int w, int h, float user_scale)
 {
-    int window_width, window_height;
-    SDL_GetWindowSize(window, &window_width, &window_height);
+    Uint8 glyphs[TIMERS_CAP][CHARS_CAP];
+    size_t lengths[TIMERS_CAP];
+    clock_glyphs(seconds, count, glyphs, lengths);
+
+    if (!cache->valid || cache->count != count || memcmp(cache->lengths, lengths, sizeof(*lengths) * count) != 0) {
+        cache->cells_count = layout_timers(cache->cells, glyphs, lengths, count,
+                                           config, 0, w, h, user_scale);
+        cache->count = count;
+        memcpy(cache->lengths, lengths, sizeof(*lengths) * count);
+        cache->valid = 1;
+    }
 
-    int sps  = PENGER_STEPS_PER_SECOND;
-    
-    int step = (int)(time*sps)%(60*sps); //step index [0,60*sps-1]
+    if (cache->cells_count == 0) cells[0] = cache->cells[0];
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < lengths[i]; ++j, ++n) {
+            cells[n] = cache->cells[n];
+            cells[n].digit_index = glyphs[i][j];
+            cells[n].wiggle_index = (cache->cells[n].wiggle_index + wiggle_index) % WIGGLE_COUNT;
+        }
+    }
+    return n;
+}
 
-    float progress  = step/(60.0*sps); // [0,1]
-    
-    int frame_index = step%2;
+// What to display for the timers, either the local ones or the ones the
+// timer server was told to show. The title, the penger and the pause color
+// follow the lead timer: the first one that is still running, or the first
+// one when they all stopped.
+typedef struct {
+    size_t seconds[TIMERS_CAP];
+    size_t count;
+    size_t lead;
+    int paused;
+    float penger_time;          // seconds within the minute of the lead timer
+    int descending;
+} TimersShown;
+
+TimersShown timers_shown(const Timers *timers, TimerServer *server, Uint64 now)
+{
+    TimersShown result = {0};
+    if (server != NULL) {
+        ServerShown shown[SERVER_SHOW_CAP];
+        const size_t count = server_shown(server, shown);
+        result.count = count < TIMERS_CAP ? count : TIMERS_CAP;
+        for (size_t i = 0; i < result.count; ++i) result.seconds[i] = (size_t) shown[i].seconds;
+        for (size_t i = result.count; i-- > 0;) {
+            const int over = shown[i].kind == SERVER_COUNTDOWN && shown[i].nanoseconds == 0;
+            if (!over && !shown[i].paused) result.lead = i;
+        }
+        if (result.count > 0) {
+            const ServerShown *lead = &shown[result.lead];
+            result.paused = lead->paused;
+            result.penger_time = (float) (lead->nanoseconds % 60000000000ull) / 1e9f;
+            result.descending = lead->kind == SERVER_COUNTDOWN;
+        }
+        return result;
+    }
 
-    float penger_drawn_width = ((float)penger_width / 2) / PENGER_SCALE;
+    result.count = timers->count;
+    for (size_t i = result.count; i-- > 0;) {
+        const Timer *timer = &timers->items[i];
+        result.seconds[i] = timer_seconds(timer, now);
+        const int over = timer->mode == MODE_COUNTDOWN && timer_displayed(timer, now) == 0;
+        if (!over) result.lead = i;
+    }
+    const Timer *lead = &timers->items[result.lead];
+    result.paused = lead->paused;
+    result.penger_time = timer_penger_time(lead, now);
+    result.descending = lead->mode == MODE_COUNTDOWN;
+    return result;
+}
+// TIMERS END //////////////////////////////
 
-    float penger_walk_width = window_width + penger_drawn_width;
+// HEADLESS BEGIN //////////////////////////////
+// Renders with the software compositor without any window and streams the
+// frames at a fixed rate as raw RGBA or YUV4MPEG2 (4:2:0, full range),
+// ready for `ffmpeg -f rawvideo -pixel_format rgba ...` or `ffmpeg -i -`.
+// Or publishes them into a shared memory ring (see shm.h), where frames
+// that did not change are skipped.
 
-    const SDL_Rect src_rect = {
-        (int) (penger_width / 2) * frame_index,
-        0,
-        (int) penger_width / 2,
-        (int) penger_height
+typedef struct {
+    FILE *stream;
+    OutputFormat format;
+    int width, height;
+    // Y4M planes are kept between frames, only the dirty rectangles get
+    // converted again
+    Uint8 *y, *u, *v;
+    Uint8 *rgba;
+    ShmRing *ring;
+} Output;
+
+Output output_open(const Config *config)
+{
+    Output output = {
+        .format = config->output_format,
+        .width = config->output_width,
+        .height = config->output_height,
     };
 
-    SDL_Rect dst_rect = {
-        floorf((float)penger_walk_width * progress - penger_drawn_width),
-        window_height - (penger_height / PENGER_SCALE),
-        (int) (penger_width / 2) / PENGER_SCALE,
-        (int) penger_height / PENGER_SCALE
-    };
+    if (output.format == OUTPUT_SHM) {
+        output.ring = shm_ring_create(config->output_path, output.width, output.height);
+        if (output.ring == NULL) exit(1);
+        return output;
+    }
 
-    SDL_RenderCopyEx(renderer, penger, &src_rect, &dst_rect, 0, NULL, flipped);
-}
+    if (strcmp(config->output_path, "-") == 0) {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
 #endif
+        output.stream = stdout;
+    } else {
+        output.stream = fopen(config->output_path, "wb");
+        if (output.stream == NULL) {
+            fprintf(stderr, "Could not open `%s`: %s\n", config->output_path, strerror(errno));
+            exit(1);
+        }
+    }
+
+    const size_t area = (size_t) output.width * output.height;
+    if (output.format == OUTPUT_Y4M) {
+        output.y = malloc(area + area / 2);
+        assert(output.y != NULL);
+        output.u = output.y + area;
+        output.v = output.u + area / 4;
+        fprintf(output.stream, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+                output.width, output.height, config->fps);
+    } else if (SDL_BYTEORDER != SDL_LIL_ENDIAN) {
+        output.rgba = malloc(area * 4);
+        assert(output.rgba != NULL);
+    }
+
+    return output;
+}
+
+// JPEG (BT.601 full range) conversion of the dirty rectangle, widened to
+// the 2x2 chroma blocks
+void output_convert_yuv(Output *output, const Framebuffer *fb, const SDL_Rect *rect)
+{
+    const int x0 = rect->x & ~1;
+    const int y0 = rect->y & ~1;
+    const int x1 = rect->x + rect->w + ((rect->x + rect->w) & 1);
+    const int y1 = rect->y + rect->h + ((rect->y + rect->h) & 1);
+
+    for (int y = y0; y < y1; y += 2) {
+        for (int x = x0; x < x1; x += 2) {
+            int sum_r = 0, sum_g = 0, sum_b = 0;
+            for (int dy = 0; dy < 2; ++dy) {
+                for (int dx = 0; dx < 2; ++dx) {
+                    const uint32_t p = fb->pixels[(y + dy) * fb->width + x + dx];
+                    const int r = p & 0xFF, g = (p >> 8) & 0xFF, b = (p >> 16) & 0xFF;
+                    output->y[(y + dy) * output->width + x + dx] = (Uint8) ((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+                    sum_r += r;
+                    sum_g += g;
+                    sum_b += b;
+                }
+            }
+            const int chroma = (y / 2) * (output->width / 2) + x / 2;
+            const int u = (-11059 * sum_r - 21709 * sum_g + 32768 * sum_b + (128 << 18) + (1 << 17)) >> 18;
+            const int v = (32768 * sum_r - 27439 * sum_g - 5329 * sum_b + (128 << 18) + (1 << 17)) >> 18;
+            output->u[chroma] = (Uint8) (u > 255 ? 255 : u);
+            output->v[chroma] = (Uint8) (v > 255 ? 255 : v);
+        }
+    }
+}
 
-void initial_pen(SDL_Window *window, int *pen_x, int *pen_y, float user_scale, float *fit_scale)
+// Returns 0 when the consumer went away
+int output_write_frame(Output *output, const SoftCanvas *canvas)
 {
-    int w, h;
-    SDL_GetWindowSize(window, &w, &h);
+    const size_t area = (size_t) output->width * output->height;
 
-    float text_aspect_ratio = (float) TEXT_WIDTH / (float) TEXT_HEIGHT;
-    float window_aspect_ratio = (float) w / (float) h;
-    if(text_aspect_ratio > window_aspect_ratio) {
-        *fit_scale = (float) w / (float) TEXT_WIDTH;
+    if (output->format == OUTPUT_SHM) {
+        if (canvas->dirty_count > 0) {
+            shm_ring_publish(output->ring, canvas->fb.pixels);
+        }
+        return 1;
+    }
+
+    if (output->format == OUTPUT_Y4M) {
+        for (int i = 0; i < canvas->dirty_count; ++i) {
+            output_convert_yuv(output, &canvas->fb, &canvas->dirty[i]);
+        }
+        fputs("FRAME\n", output->stream);
+        if (fwrite(output->y, 1, area + area / 2, output->stream) != area + area / 2) return 0;
+    } else if (output->rgba != NULL) {
+        for (size_t i = 0; i < area; ++i) {
+            const uint32_t p = canvas->fb.pixels[i];
+            output->rgba[i*4 + 0] = p & 0xFF;
+            output->rgba[i*4 + 1] = (p >> 8) & 0xFF;
+            output->rgba[i*4 + 2] = (p >> 16) & 0xFF;
+            output->rgba[i*4 + 3] = (p >> 24) & 0xFF;
+        }
+        if (fwrite(output->rgba, 4, area, output->stream) != area) return 0;
     } else {
-        *fit_scale = (float) h / (float) TEXT_HEIGHT;
+        if (fwrite(canvas->fb.pixels, 4, area, output->stream) != area) return 0;
     }
 
-    const int effective_digit_width = (int) floorf((float) CHAR_WIDTH * user_scale * *fit_scale);
-    const int effective_digit_height = (int) floorf((float) CHAR_HEIGHT * user_scale * *fit_scale);
-    *pen_x = w / 2 - effective_digit_width * CHARS_COUNT / 2;
-    *pen_y = h / 2 - effective_digit_height / 2;
+    return fflush(output->stream) == 0;
 }
 
-typedef enum {
-    MODE_ASCENDING = 0,
-    MODE_COUNTDOWN,
-    MODE_CLOCK,
-} Mode;
-
-float parse_time(const char *time)
+int run_headless(const Config *config, TimerServer *server)
 {
-    float result = 0.0f;
+    // No SDL_INIT_VIDEO, so there is no need for a display at all
+    secc(SDL_Init(0));
 
-    while (*time) {
-        char *endptr = NULL;
-        float x = strtof(time, &endptr);
+    Output output = output_open(config);
+    SoftCanvas canvas = {0};
+    framebuffer_resize(&canvas.fb, output.width, output.height);
+    Atlas atlas = {0};
 
-        if (time == endptr) {
-            fprintf(stderr, "`%s` is not a number\n", time);
-            exit(1);
-        }
+    size_t wiggle_index = 0;
+    float wiggle_cooldown = WIGGLE_DURATION;
 
-        switch (*endptr) {
-        case '\0':
-        case 's': result += x;                 break;
-        case 'm': result += x * 60.0f;         break;
-        case 'h': result += x * 60.0f * 60.0f; break;
-        default:
-            fprintf(stderr, "`%c` is an unknown time unit\n", *endptr);
-            exit(1);
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 last = start;
+    Timers timers;
+    timers_restart(&timers, config, start);
+    // The frame size never changes
+    static LayoutCache layout;
+    for (Uint64 frame = 0; ; ++frame) {
+        const Uint64 now = SDL_GetPerformanceCounter();
+        const float dt = (float) (now - last) / (float) freq;
+        last = now;
+
+        update_wiggle(&wiggle_index, &wiggle_cooldown, dt);
+        if (timers_update(&timers, now) && config->exit_after_countdown && server == NULL) {
+            break;
+        }
+        if (server != NULL) server_tick(server);
+
+        const TimersShown shown = timers_shown(&timers, server, now);
+        Cell cells[CELLS_CAP];
+        const size_t cells_count = layout_cached(&layout, cells, shown.seconds, shown.count, server ? NULL : config,
+                                                 wiggle_index, output.width, output.height, 1.0f);
+        if (cells[0].dst_rect.w > 0 && cells[0].dst_rect.h > 0) {
+            atlas_resample(&atlas, cells[0].dst_rect.w, cells[0].dst_rect.h);
         }
 
-        time = endptr;
-        if (*time) time += 1;
+        const Sprite *penger_sprite = NULL;
+#ifdef PENGER
+        const Sprite sprite = penger_sprite_at(shown.penger_time, shown.descending, output.width, output.height);
+        penger_sprite = &sprite;
+#endif
+        const uint32_t color = shown.paused
+            ? (PAUSE_COLOR_B << 16) | (PAUSE_COLOR_G << 8) | PAUSE_COLOR_R
+            : (MAIN_COLOR_B << 16) | (MAIN_COLOR_G << 8) | MAIN_COLOR_R;
+        soft_canvas_update(&canvas, &atlas, cells, cells_count, color, penger_sprite);
+        if (!output_write_frame(&output, &canvas)) break;
+
+        // Schedule against the start so the stream keeps its rate on average
+        const Uint64 next = start + (frame + 1) * freq / (Uint64) config->fps;
+        const Uint64 after = SDL_GetPerformanceCounter();
+        const Uint32 sleep_ms = next > after ? (Uint32) ((next - after) * 1000 / freq) : 0;
+        if (server != NULL) {
+            // Serve the clients while waiting for the next frame
+            server_poll(server, (int) sleep_ms);
+        } else if (sleep_ms > 0) {
+            SDL_Delay(sleep_ms);
+        }
     }
 
-    return result;
+    if (output.ring != NULL) {
+        shm_ring_destroy(output.ring);
+    } else if (output.stream != stdout) {
+        fclose(output.stream);
+    }
+    SDL_Quit();
+    return 0;
 }
+// HEADLESS END //////////////////////////////
 
-typedef struct {
-    Uint32 frame_delay;
-    float dt;
-    Uint64 last_time;
-} FpsDeltaTime;
+// SERVER BEGIN //////////////////////////////
+// How often (in ms) the window checks the server socket while idle
+#define SERVER_POLL_INTERVAL 10
 
-FpsDeltaTime make_fpsdeltatime(const Uint32 fps_cap)
+// The timer server without any rendering. Sleeps in epoll until a client
+// sends something or the next countdown expires.
+static volatile sig_atomic_t server_quit = 0;
+
+void server_quit_handler(int signum)
 {
-    return (FpsDeltaTime){
-        .frame_delay=(1000 / fps_cap),
-        .dt=0.0f,
-        .last_time=SDL_GetPerformanceCounter(),
-    };
+    (void) signum;
+    server_quit = 1;
 }
 
-void frame_start(FpsDeltaTime *fpsdt)
+int run_server(TimerServer *server)
 {
-    const Uint64 now = SDL_GetPerformanceCounter();
-    const Uint64 elapsed = now - fpsdt->last_time;
-    fpsdt->dt = ((float)elapsed)  / ((float)SDL_GetPerformanceFrequency());
-    // printf("FPS: %f | dt %f\n", 1.0 / fpsdt->dt, fpsdt->dt);
-    fpsdt->last_time = now;
+    signal(SIGINT, server_quit_handler);
+    signal(SIGTERM, server_quit_handler);
+    while (!server_quit) {
+        server_poll(server, server_tick(server));
+    }
+    server_destroy(server);
+    return 0;
 }
+// SERVER END //////////////////////////////
+
+// TITLE BEGIN //////////////////////////////
+// The window title shows the lead timer. Setting it is a round trip to
+// the window manager, so it only happens when the displayed second
+// changes, and at most every TITLE_MIN_INTERVAL ms. A change held back by
+// the limit goes out with the first frame after it.
+#define TITLE_CAP 256
+#define TITLE_MIN_INTERVAL 250
 
-void frame_end(FpsDeltaTime *fpsdt)
+typedef struct {
+    int enabled;
+    int shown;                  // seconds is in the title
+    size_t seconds;
+    Uint64 last_update;
+    Uint64 min_interval;        // in counter ticks
+} Title;
+
+Title make_title(int enabled)
 {
-    const Uint64 now = SDL_GetPerformanceCounter();
-    const Uint64 elapsed = now - fpsdt->last_time;
-    const Uint32 cap_frame_end = (Uint32) ((((float)elapsed) * 1000.0f) / ((float)SDL_GetPerformanceFrequency()));
+    return (Title) {
+        .enabled = enabled,
+        .min_interval = SDL_GetPerformanceFrequency() * TITLE_MIN_INTERVAL / 1000,
+    };
+}
 
-    if (cap_frame_end < fpsdt->frame_delay) {
-        SDL_Delay((fpsdt->frame_delay - cap_frame_end) );
+// Returns 1 when the window manager got a new title
+int title_update(Title *title, SDL_Window *window, size_t seconds, Uint64 now, Profiler *profiler)
+{
+    if (!title->enabled) return 0;
+    if (title->shown && title->seconds == seconds) return 0;
+    if (title->shown && now - title->last_update < title->min_interval) return 0;
+
+    Uint8 glyphs[1][CHARS_CAP];
+    size_t length;
+    clock_glyphs(&seconds, 1, glyphs, &length);
+    char text[TITLE_CAP];
+    for (size_t i = 0; i < length; ++i) {
+        text[i] = glyphs[0][i] == COLON_INDEX ? ':' : (char) ('0' + glyphs[0][i]);
     }
+    memcpy(&text[length], " - sowon", sizeof(" - sowon"));
+    SDL_SetWindowTitle(window, text);
+
+    title->shown = 1;
+    title->seconds = seconds;
+    title->last_update = now;
+    profiler_count_title_update(profiler, now);
+    return 1;
 }
-
-#define TITLE_CAP 256
+// TITLE END //////////////////////////////
 
 int main(int argc, char **argv)
 {
-    Mode mode = MODE_ASCENDING;
-    float displayed_time = 0.0f;
-    int paused = 0;
-    int exit_after_countdown = 0;
+    const Config config = parse_config(argc, argv);
 
-    for (int i = 1; i < argc; ++i) {
-        if (strcmp(argv[i], "-p") == 0) {
-            paused = 1;
-        } else if (strcmp(argv[i], "-e") == 0) {
-            exit_after_countdown = 1;
-        } else if (strcmp(argv[i], "clock") == 0) {
-            mode = MODE_CLOCK;
-        } else {
-            mode = MODE_COUNTDOWN;
-            displayed_time = parse_time(argv[i]);
-        }
+    TimerServer *server = NULL;
+    if (config.server_path != NULL) {
+        server = server_create(config.server_path);
+        if (server == NULL) exit(1);
+        if (config.no_render) return run_server(server);
+    }
+
+    decode_embedded_images();
+    if (config.output_path != NULL) {
+        const int result = run_headless(&config, server);
+        server_destroy(server);
+        return result;
     }
 
     secc(SDL_Init(SDL_INIT_VIDEO));
 
+    // A text height of margin, like a single timer always had
+    const int rows = config.grid_rows > 0 ? config.grid_rows : (int) config.timers_count;
     SDL_Window *window =
         secp(SDL_CreateWindow(
                  "sowon",
                  0, 0,
-                 TEXT_WIDTH, TEXT_HEIGHT*2,
+                 TEXT_WIDTH(CHARS_MIN), TEXT_HEIGHT*(rows + 1),
                  SDL_WINDOW_RESIZABLE));
 
-    SDL_Renderer *renderer =
-        secp(SDL_CreateRenderer(
-                 window, -1,
-                 SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_ACCELERATED));
-
-    secc(SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear"));
-
-    SDL_Texture *digits = load_digits_png_file_as_texture(renderer);
+    // Vsync can only pace us at the refresh rate itself
+    const int refresh_rate = display_refresh_rate(window);
+    const int target_fps = config.fps > 0 ? config.fps : refresh_rate;
+
+    // Without a GPU SDL falls back to its generic software renderer. Our
+    // own compositor does less work there, so use it instead.
+    SDL_Renderer *renderer = NULL;
+    if (!config.software) {
+        renderer = SDL_CreateRenderer(
+                       window, -1,
+                       (target_fps == refresh_rate ? SDL_RENDERER_PRESENTVSYNC : 0) | SDL_RENDERER_ACCELERATED);
+        if (renderer == NULL) {
+            fprintf(stderr, "WARNING: could not create an accelerated renderer: %s\n", SDL_GetError());
+        } else {
+            SDL_RendererInfo info;
+            secc(SDL_GetRendererInfo(renderer, &info));
+            if (info.flags & SDL_RENDERER_SOFTWARE) {
+                SDL_DestroyRenderer(renderer);
+                renderer = NULL;
+            }
+        }
+    }
 
+    SDL_Texture *digits = NULL;
     #ifdef PENGER
-    SDL_Texture *penger = load_penger_png_file_as_texture(renderer);
+    SDL_Texture *penger = NULL;
     #endif
+    if (renderer != NULL) {
+        secc(SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear"));
 
-    secc(SDL_SetTextureColorMod(digits, MAIN_COLOR_R, MAIN_COLOR_G, MAIN_COLOR_B));
+        digits = load_digits_png_file_as_texture(renderer);
 
-    if (paused) {
-        secc(SDL_SetTextureColorMod(digits, PAUSE_COLOR_R, PAUSE_COLOR_G, PAUSE_COLOR_B));
-    } else {
-        secc(SDL_SetTextureColorMod(digits, MAIN_COLOR_R, MAIN_COLOR_G, MAIN_COLOR_B));
+        #ifdef PENGER
+        penger = load_penger_png_file_as_texture(renderer);
+        #endif
     }
 
     int quit = 0;
     size_t wiggle_index = 0;
     float wiggle_cooldown = WIGGLE_DURATION;
     float user_scale = 1.0f;
-    char prev_title[TITLE_CAP];
-    FpsDeltaTime fps_dt = make_fpsdeltatime(FPS);
+    // Kept up to date by the resize events, so the frames never ask
+    int window_width, window_height;
+    SDL_GetWindowSize(window, &window_width, &window_height);
+    static LayoutCache layout;
+    Title title = make_title(!config.no_title);
+    Pacing pacing = config.hybrid_pacing && 1000 / target_fps < PACING_TIMER_MIN_PERIOD ? PACING_HYBRID : PACING_TIMER;
+    if (renderer != NULL) {
+        SDL_RendererInfo info;
+        secc(SDL_GetRendererInfo(renderer, &info));
+        if (info.flags & SDL_RENDERER_PRESENTVSYNC) pacing = PACING_VSYNC;
+    } else {
+        pacing = PACING_TIMER;
+    }
+    FpsDeltaTime fps_dt = make_fpsdeltatime(pacing, target_fps);
+    if (config.verbose) {
+        fprintf(stderr, "%d Hz display, %d fps target, %s pacing\n", refresh_rate, target_fps, pacing_name(pacing));
+    }
+    Timers timers;
+    timers_restart(&timers, &config, fps_dt.last_time);
+
+    // Renderers without render targets fall back to redrawing everything every frame
+    const int use_canvas = renderer != NULL && SDL_RenderTargetSupported(renderer);
+    Canvas canvas = {0};
+    SoftCanvas soft_canvas = {0};
+    static GlyphBatch batch;
+
+    const Glyphs sheet = {digits, SPRITE_CHAR_WIDTH, SPRITE_CHAR_HEIGHT};
+    Atlas atlas = {0};
+    Atlas overlay_atlas = {0};
+    if (renderer != NULL) {
+        SDL_RendererInfo info;
+        secc(SDL_GetRendererInfo(renderer, &info));
+        atlas.max_texture_width = info.max_texture_width;
+        atlas.max_texture_height = info.max_texture_height;
+        overlay_atlas.max_texture_width = info.max_texture_width;
+        overlay_atlas.max_texture_height = info.max_texture_height;
+    }
+    int force_present = 1;
+    // The output size of the renderer, or the window surface for the CPU
+    // compositor. Only asked for again when the window changes.
+    int output_width = 0, output_height = 0;
+    SDL_Surface *surface = NULL;
+    int output_stale = 1;
+    static Profiler profiler;
+    profiler_init(&profiler);
+    int show_overlay = 0;
     while (!quit) {
         frame_start(&fps_dt);
+        profiler_begin(&profiler, PHASE_INPUT);
         // INPUT BEGIN //////////////////////////////
+        if (server != NULL) server_poll(server, 0);
         SDL_Event event = {0};
         while (SDL_PollEvent(&event)) {
             switch (event.type) {
@@ -302,47 +2440,55 @@ int main(int argc, char **argv)
                 quit = 1;
             } break;
 
+            case SDL_WINDOWEVENT: {
+                // The window contents may be gone, the canvas still has them
+                force_present = 1;
+                if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                    window_width = event.window.data1;
+                    window_height = event.window.data2;
+                    layout.valid = 0;
+                }
+                if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED ||
+                    event.window.event == SDL_WINDOWEVENT_EXPOSED) {
+                    output_stale = 1;
+                }
+            } break;
+
+            case SDL_RENDER_TARGETS_RESET: {
+                canvas.valid = 0;
+            } break;
+
             case SDL_KEYDOWN: {
                 switch (event.key.keysym.sym) {
                 case SDLK_SPACE: {
-                    paused = !paused;
-                    if (paused) {
-                        secc(SDL_SetTextureColorMod(digits, PAUSE_COLOR_R, PAUSE_COLOR_G, PAUSE_COLOR_B));
-                    } else {
-                        secc(SDL_SetTextureColorMod(digits, MAIN_COLOR_R, MAIN_COLOR_G, MAIN_COLOR_B));
-                    }
+                    timers_toggle_pause(&timers, fps_dt.last_time);
                 } break;
 
                 case SDLK_KP_PLUS:
                 case SDLK_EQUALS: {
                     user_scale += SCALE_FACTOR * user_scale;
+                    layout.valid = 0;
                 } break;
 
                 case SDLK_KP_MINUS:
                 case SDLK_MINUS: {
                     user_scale -= SCALE_FACTOR * user_scale;
+                    layout.valid = 0;
                 } break;
 
                 case SDLK_KP_0:
                 case SDLK_0: {
                     user_scale = 1.0f;
+                    layout.valid = 0;
                 } break;
 
                 case SDLK_F5: {
-                    displayed_time = 0.0f;
-                    paused = 0;
-                    for (int i = 1; i < argc; ++i) {
-                        if (strcmp(argv[i], "-p") == 0) {
-                            paused = 1;
-                        } else {
-                            displayed_time = parse_time(argv[i]);
-                        }
-                    }
-                    if (paused) {
-                        secc(SDL_SetTextureColorMod(digits, PAUSE_COLOR_R, PAUSE_COLOR_G, PAUSE_COLOR_B));
-                    } else {
-                        secc(SDL_SetTextureColorMod(digits, MAIN_COLOR_R, MAIN_COLOR_G, MAIN_COLOR_B));
-                    }
+                    timers_restart(&timers, &config, fps_dt.last_time);
+                } break;
+
+                case SDLK_F3: {
+                    show_overlay = !show_overlay;
+                    force_present = 1;
                 } break;
 
                 case SDLK_F11: {
@@ -353,6 +2499,7 @@ int main(int argc, char **argv)
                     } else {
                         secc(SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN_DESKTOP));
                     }
+                    layout.valid = 0;
                 } break;
                 }
             } break;
@@ -364,6 +2511,7 @@ int main(int argc, char **argv)
                     } else if (event.wheel.y < 0) {
                         user_scale -= SCALE_FACTOR * user_scale;
                     }
+                    layout.valid = 0;
                 }
             } break;
 
@@ -372,97 +2520,150 @@ int main(int argc, char **argv)
         }
         // INPUT END //////////////////////////////
 
+        // UPDATE BEGIN //////////////////////////////
+        profiler_begin(&profiler, PHASE_UPDATE);
+        update_wiggle(&wiggle_index, &wiggle_cooldown, fps_dt.dt);
+
+        if (timers_update(&timers, fps_dt.last_time) && config.exit_after_countdown && server == NULL) {
+            break;
+        }
+        if (server != NULL) server_tick(server);
+        // UPDATE END //////////////////////////////
+
+
         // RENDER BEGIN //////////////////////////////
-        SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR_R, BACKGROUND_COLOR_G, BACKGROUND_COLOR_B, 255);
-        SDL_RenderClear(renderer);
+        profiler_begin(&profiler, PHASE_RENDER);
         {
-            const size_t t = (size_t) floorf(fmaxf(displayed_time, 0.0f));
-            // PENGER BEGIN //////////////////////////////
+            const TimersShown shown = timers_shown(&timers, server, fps_dt.last_time);
+            const size_t t = shown.count > 0 ? shown.seconds[shown.lead] : 0;
+
+            // The overlay numbers change every frame, so redraw everything
+            Cell overlay[OVERLAY_CELLS_CAP];
+            size_t overlay_count = 0;
+            if (show_overlay) {
+                overlay_count = profiler_overlay_cells(&profiler, overlay, fps_dt.last_time);
+                force_present = 1;
+            }
 
-            #ifdef PENGER
-            render_penger_at(renderer, penger, displayed_time, mode==MODE_COUNTDOWN, window);
-            #endif
+            // DIGITS BEGIN //////////////////////////////
+            Cell cells[CELLS_CAP];
+            const size_t cells_count = layout_cached(&layout, cells, shown.seconds, shown.count, server ? NULL : &config,
+                                                     wiggle_index, window_width, window_height, user_scale);
 
-            // PENGER END //////////////////////////////
+            const Uint8 color_r = shown.paused ? PAUSE_COLOR_R : MAIN_COLOR_R;
+            const Uint8 color_g = shown.paused ? PAUSE_COLOR_G : MAIN_COLOR_G;
+            const Uint8 color_b = shown.paused ? PAUSE_COLOR_B : MAIN_COLOR_B;
 
-            // DIGITS BEGIN //////////////////////////////
-            int pen_x, pen_y;
-            float fit_scale = 1.0;
-            initial_pen(window, &pen_x, &pen_y, user_scale, &fit_scale);
-
-
-            // TODO: support amount of hours >99
-            const size_t hours = t / 60 / 60;
-            render_digit_at(renderer, digits, hours / 10,   wiggle_index      % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-            render_digit_at(renderer, digits, hours % 10,  (wiggle_index + 1) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-            render_digit_at(renderer, digits, COLON_INDEX,  wiggle_index      % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-
-            const size_t minutes = t / 60 % 60;
-            render_digit_at(renderer, digits, minutes / 10, (wiggle_index + 2) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-            render_digit_at(renderer, digits, minutes % 10, (wiggle_index + 3) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-            render_digit_at(renderer, digits, COLON_INDEX,  (wiggle_index + 1) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-
-            const size_t seconds = t % 60;
-            render_digit_at(renderer, digits, seconds / 10, (wiggle_index + 4) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-            render_digit_at(renderer, digits, seconds % 10, (wiggle_index + 5) % WIGGLE_COUNT, &pen_x, &pen_y, user_scale, fit_scale);
-
-            char title[TITLE_CAP];
-            snprintf(title, sizeof(title), "%02zu:%02zu:%02zu - sowon", hours, minutes, seconds);
-            if (strcmp(prev_title, title) != 0) {
-                SDL_SetWindowTitle(window, title);
+            if (output_stale) {
+                if (renderer == NULL) {
+                    surface = secp(SDL_GetWindowSurface(window));
+                } else {
+                    secc(SDL_GetRendererOutputSize(renderer, &output_width, &output_height));
+                }
+                output_stale = 0;
             }
-            memcpy(title, prev_title, TITLE_CAP);
-            // DIGITS END //////////////////////////////
-        }
-        SDL_RenderPresent(renderer);
-        // RENDER END //////////////////////////////
 
-        // UPDATE BEGIN //////////////////////////////
-        if (wiggle_cooldown <= 0.0f) {
-            wiggle_index++;
-            wiggle_cooldown = WIGGLE_DURATION;
-        }
-        wiggle_cooldown -= fps_dt.dt;
+            if (renderer == NULL) {
+                if (soft_canvas.fb.width != surface->w || soft_canvas.fb.height != surface->h) {
+                    framebuffer_resize(&soft_canvas.fb, surface->w, surface->h);
+                    soft_canvas.valid = 0;
+                }
+                if (force_present) {
+                    soft_canvas.valid = 0;
+                    force_present = 0;
+                }
+                if (cells[0].dst_rect.w > 0 && cells[0].dst_rect.h > 0) {
+                    atlas_resample(&atlas, cells[0].dst_rect.w, cells[0].dst_rect.h);
+                }
 
-        if (!paused) {
-            switch (mode) {
-            case MODE_ASCENDING: {
-                displayed_time += fps_dt.dt;
-            } break;
-            case MODE_COUNTDOWN: {
-                if (displayed_time > 1e-6) {
-                    displayed_time -= fps_dt.dt;
-                } else {
-                    displayed_time = 0.0f;
-                    if (exit_after_countdown) {
-                        SDL_Quit();
-                        return 0;
+                const Sprite *penger_sprite = NULL;
+#ifdef PENGER
+                const Sprite sprite = penger_sprite_at(shown.penger_time, shown.descending, surface->w, surface->h);
+                penger_sprite = &sprite;
+#endif
+                const uint32_t color = ((uint32_t) color_b << 16) | ((uint32_t) color_g << 8) | color_r;
+                if (soft_canvas_update(&soft_canvas, &atlas, cells, cells_count, color, penger_sprite) > 0) {
+                    if (overlay_count > 0) {
+                        atlas_resample(&overlay_atlas, OVERLAY_CHAR_WIDTH, OVERLAY_CHAR_HEIGHT);
+                        const SDL_Rect bounds = {0, 0, soft_canvas.fb.width, soft_canvas.fb.height};
+                        for (size_t i = 0; i < overlay_count; ++i) {
+                            framebuffer_blend_cell(&soft_canvas.fb, &overlay_atlas, &overlay[i], &bounds, color);
+                        }
                     }
+                    profiler_begin(&profiler, PHASE_PRESENT);
+                    soft_canvas_present(&soft_canvas, window, surface);
+                    profiler_begin(&profiler, PHASE_RENDER);
                 }
-            } break;
-            case MODE_CLOCK: {
-                float displayed_time_prev = displayed_time;
-                time_t t = time(NULL);
-                struct tm *tm = localtime(&t);
-                displayed_time = tm->tm_sec
-                               + tm->tm_min  * 60.0f
-                               + tm->tm_hour * 60.0f * 60.0f;
-                if(displayed_time <= displayed_time_prev){
-                    //same second, keep previous count and add subsecond resolution for penger
-                    if(floorf(displayed_time_prev) == floorf(displayed_time_prev+fps_dt.dt)){ //check for no newsecond shenaningans from dt
-                        displayed_time = displayed_time_prev + fps_dt.dt; 
-                    }else{
-                        displayed_time = displayed_time_prev;
+            } else if (use_canvas) {
+                secc(SDL_SetTextureColorMod(digits, color_r, color_g, color_b));
+                const Glyphs *glyphs = atlas_glyphs(&atlas, renderer, &sheet, cells[0].dst_rect.w, cells[0].dst_rect.h);
+                SDL_Texture *penger_texture = NULL;
+                const Sprite *penger_sprite = NULL;
+#ifdef PENGER
+                const Sprite sprite = penger_sprite_at(shown.penger_time, shown.descending, window_width, window_height);
+                penger_texture = penger;
+                penger_sprite = &sprite;
+#endif
+                const size_t redrawn = canvas_update(&canvas, renderer, output_width, output_height, &batch, glyphs,
+                                                     cells, cells_count, penger_texture, penger_sprite);
+                if (redrawn > 0 || force_present) {
+                    canvas_present(&canvas, renderer, penger_sprite);
+                    if (overlay_count > 0) {
+                        const Glyphs *overlay_glyphs = atlas_glyphs(&overlay_atlas, renderer, &sheet, OVERLAY_CHAR_WIDTH, OVERLAY_CHAR_HEIGHT);
+                        render_digits(renderer, &batch, overlay_glyphs, overlay, overlay_count);
                     }
+                    profiler_begin(&profiler, PHASE_PRESENT);
+                    SDL_RenderPresent(renderer);
+                    profiler_begin(&profiler, PHASE_RENDER);
+                    force_present = 0;
                 }
-            } break;
+            } else {
+                secc(SDL_SetTextureColorMod(digits, color_r, color_g, color_b));
+                const Glyphs *glyphs = atlas_glyphs(&atlas, renderer, &sheet, cells[0].dst_rect.w, cells[0].dst_rect.h);
+
+                SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR_R, BACKGROUND_COLOR_G, BACKGROUND_COLOR_B, 255);
+                SDL_RenderClear(renderer);
+
+                // PENGER BEGIN //////////////////////////////
+
+                #ifdef PENGER
+                render_penger_at(renderer, penger, shown.penger_time, shown.descending, window_width, window_height);
+                #endif
+
+                // PENGER END //////////////////////////////
+
+                render_digits(renderer, &batch, glyphs, cells, cells_count);
+                if (overlay_count > 0) {
+                    const Glyphs *overlay_glyphs = atlas_glyphs(&overlay_atlas, renderer, &sheet, OVERLAY_CHAR_WIDTH, OVERLAY_CHAR_HEIGHT);
+                    render_digits(renderer, &batch, overlay_glyphs, overlay, overlay_count);
+                }
+                profiler_begin(&profiler, PHASE_PRESENT);
+                SDL_RenderPresent(renderer);
+                profiler_begin(&profiler, PHASE_RENDER);
             }
-        }
-        // UPDATE END //////////////////////////////
 
-        frame_end(&fps_dt);
+            title_update(&title, window, t, fps_dt.last_time, &profiler);
+            // DIGITS END //////////////////////////////
+        }
+        // RENDER END //////////////////////////////
+        profiler_end_frame(&profiler);
+
+        // IDLE BEGIN //////////////////////////////
+        // Nothing changes on the screen until the deadline below, so sleep
+        // until then or until an event arrives.
+        int timeout = timers_next_change_timeout(&timers, SDL_GetPerformanceCounter(),
+                                                 show_overlay ? fminf(wiggle_cooldown, PROFILER_OVERLAY_REFRESH) : wiggle_cooldown);
+        // SDL can not wait on the server socket, so check it regularly
+        if (server != NULL && timeout > SERVER_POLL_INTERVAL) timeout = SERVER_POLL_INTERVAL;
+        // A wait shorter than the rest of the frame is over once it is paced
+        if (frame_end(&fps_dt, timeout)) timeout = 0;
+        wait_for_event(timeout);
+        // IDLE END //////////////////////////////
     }
 
+    if (config.verbose) frame_report(&fps_dt, stderr);
+    if (config.profile_path != NULL) profiler_dump_csv(&profiler, config.profile_path);
+    server_destroy(server);
     SDL_Quit();
 
     return 0;
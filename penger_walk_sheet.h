@@ -0,0 +1,73 @@
+#ifndef PNG_penger_H_
+#define PNG_penger_H_
+#define PNG_penger_EMBEDDED
+size_t penger_width = 512;
+size_t penger_height = 256;
+uint32_t *penger_data = NULL;
+size_t penger_png_size = 1993;
+unsigned char penger_png[] = {
+137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,2,0,0,0,1,0,8,3,0,0,0,242,78,62,
+85,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,9,80,76,84,69,0,0,0,255,255,255,0,0,0,115,
+198,131,113,0,0,0,3,116,82,78,83,0,255,255,68,80,214,33,0,0,7,69,73,68,65,84,120,156,237,147,57,178,
+5,55,12,3,237,251,95,218,193,115,162,169,98,105,33,184,232,171,145,142,68,0,84,207,63,255,32,132,16,66,8,33,
+132,16,66,8,33,132,16,66,8,33,132,16,66,8,137,245,239,71,213,121,170,244,236,30,158,45,254,209,179,123,120,182,
+248,71,207,238,225,217,226,31,61,187,135,103,139,127,244,236,30,158,45,254,209,179,123,120,182,248,71,207,238,225,217,226,
+31,253,217,61,124,139,89,69,103,223,255,138,158,219,3,0,140,122,110,15,0,48,234,185,61,0,192,168,231,246,0,0,
+163,158,219,3,0,140,122,110,15,0,48,234,185,61,0,192,168,103,246,224,45,112,253,2,62,58,237,115,237,30,0,96,
+20,0,36,223,239,38,0,72,190,223,77,0,144,124,191,155,0,32,249,126,55,1,64,242,253,110,2,128,228,251,221,244,
+12,0,234,192,215,20,55,164,218,199,53,123,0,128,81,0,32,154,167,200,86,33,0,16,205,83,100,171,16,0,136,230,
+41,178,85,8,0,68,243,20,217,42,4,0,162,121,138,108,21,2,0,209,60,69,182,10,61,3,128,250,225,191,115,85,
+243,178,244,220,143,0,0,163,0,64,60,87,53,47,75,0,32,158,171,154,151,37,0,16,207,85,205,203,18,0,136,231,
+170,230,101,9,0,196,115,85,243,178,4,0,226,185,170,121,89,122,22,128,91,230,70,41,234,71,248,206,87,207,117,235,
+185,194,134,0,224,146,185,81,2,128,75,230,70,9,0,46,153,27,37,0,184,100,110,148,0,224,146,185,81,2,128,75,
+230,70,9,0,46,157,175,82,86,206,118,251,0,128,159,0,224,210,249,42,1,192,165,243,85,2,128,75,231,171,4,0,
+151,206,87,9,0,46,157,175,18,0,92,58,95,37,0,88,60,247,149,106,126,181,118,115,254,153,125,0,192,79,0,176,
+120,238,250,194,134,0,96,241,220,245,133,13,1,192,226,185,235,11,27,2,128,197,115,215,23,54,4,0,139,231,174,47,
+108,8,0,22,207,93,95,216,16,0,108,158,191,182,240,71,187,125,188,247,219,237,3,0,0,0,0,0,0,0,0,96,
+243,252,181,133,63,2,0,0,0,0,0,0,0,0,120,13,128,172,32,222,5,71,43,59,87,155,125,0,192,79,0,144,
+228,83,94,216,16,0,36,249,148,23,54,4,0,73,62,229,133,13,1,64,146,79,121,97,67,0,144,228,83,94,216,16,
+0,36,249,148,23,54,4,0,65,115,103,82,251,158,42,58,79,219,125,0,192,79,0,16,52,183,93,97,67,0,16,52,
+183,93,97,67,0,16,52,183,93,97,67,0,16,52,183,93,97,67,0,16,52,183,93,97,67,0,16,52,183,93,97,67,
+0,224,188,127,90,168,11,8,170,28,215,237,3,0,180,57,174,219,7,0,104,115,92,183,15,0,208,230,184,110,31,0,
+160,205,113,221,62,0,64,155,227,186,125,0,128,54,199,117,251,0,0,109,142,235,246,161,6,160,42,135,215,55,10,0,
+239,28,111,158,112,163,235,10,27,190,0,224,188,127,77,97,195,23,0,156,247,175,41,108,248,2,128,243,254,53,133,13,
+95,0,112,222,191,166,176,225,11,0,206,251,215,20,54,124,1,192,121,255,154,194,134,239,115,0,68,23,223,157,91,13,
+64,212,220,182,251,0,128,88,223,246,251,0,128,88,223,246,251,0,128,88,223,246,251,0,128,88,223,246,251,0,128,88,
+223,246,251,0,128,88,223,246,251,0,128,88,223,246,251,136,54,216,93,192,95,3,192,242,105,179,15,0,200,245,109,183,
+15,0,200,245,109,183,15,0,200,245,109,183,15,0,200,245,109,183,15,0,200,245,109,183,15,0,200,245,109,183,15,0,
+200,245,109,183,15,181,129,85,112,85,170,28,167,185,179,253,202,247,1,0,99,238,108,191,242,125,0,192,152,59,219,175,
+124,31,0,48,230,206,246,43,223,7,0,140,185,179,253,202,247,1,0,99,238,108,191,242,125,0,192,152,59,219,175,124,
+31,0,48,230,206,246,43,223,199,169,209,110,240,110,15,254,85,212,30,202,31,120,181,192,233,61,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,248,211,0,168,10,180,89,192,255,202,222,67,155,254,0,240,19,0,108,
+158,7,0,0,0,0,0,0,0,0,72,242,141,22,0,108,158,7,0,0,0,128,151,1,80,249,118,89,68,246,30,218,
+244,7,128,49,79,212,121,235,126,121,127,0,24,243,68,157,183,238,151,247,7,128,49,79,212,121,235,126,121,127,0,24,
+243,68,157,183,238,151,247,7,128,49,79,212,121,235,126,121,127,0,24,243,68,157,183,238,151,247,7,128,49,79,212,121,
+235,126,121,255,213,0,81,129,203,23,176,153,67,189,135,242,254,0,176,151,3,0,0,0,0,0,0,0,0,0,0,114,
+253,163,5,0,139,231,0,0,0,0,224,101,0,162,252,171,23,81,181,135,242,254,0,48,230,80,157,219,245,5,0,0,
+0,0,0,0,0,0,200,22,0,140,57,84,231,118,125,1,0,0,0,0,0,30,4,32,107,190,202,63,250,71,80,207,
+149,25,3,192,222,185,40,127,185,170,139,103,205,87,249,3,64,113,142,106,127,0,40,206,81,237,15,0,197,57,170,253,
+1,160,56,71,181,63,0,20,231,168,246,7,128,226,28,209,254,179,28,0,80,156,35,218,31,0,156,231,162,115,68,251,
+3,128,243,92,116,142,104,127,0,112,158,139,206,17,237,15,0,206,115,209,57,162,253,1,192,121,46,58,71,180,63,0,
+56,207,69,231,136,246,127,22,128,46,197,87,243,68,229,232,178,135,52,117,43,14,0,201,234,86,28,0,146,213,173,56,
+0,36,171,91,113,0,72,86,183,226,0,144,172,110,197,1,32,89,221,138,3,64,178,178,139,127,253,172,185,209,32,204,
+114,204,114,169,115,88,185,84,62,211,0,0,0,0,0,0,0,0,240,253,110,221,83,231,176,114,169,124,166,1,0,0,
+0,0,0,0,0,224,251,221,186,167,206,97,229,82,249,76,3,0,192,35,0,100,21,95,125,232,221,57,187,247,189,243,
+172,30,170,62,179,125,171,122,47,7,152,5,82,249,156,206,217,189,239,157,103,245,80,245,153,237,91,213,123,57,192,44,
+144,202,231,116,206,238,125,239,60,171,135,170,207,108,223,170,222,203,1,102,129,84,62,167,115,118,239,123,231,89,61,84,
+125,102,251,86,245,94,14,48,11,164,242,57,157,179,123,223,59,207,234,161,234,51,219,183,170,247,114,128,89,32,149,207,
+233,156,221,251,222,121,86,15,85,159,217,190,85,189,151,3,204,2,169,124,78,231,236,222,247,206,179,122,168,250,204,246,
+173,234,189,28,96,22,72,229,115,58,103,247,190,119,158,213,67,213,103,182,111,85,111,121,241,211,197,156,22,83,45,194,
+187,216,239,61,213,94,162,242,30,15,218,45,182,58,255,180,144,123,1,78,127,43,135,106,47,81,121,143,7,237,22,91,
+157,127,90,200,189,0,167,191,149,67,181,151,168,188,199,131,118,139,173,206,63,45,228,94,128,211,223,202,161,218,75,84,
+222,227,65,187,197,86,231,159,22,114,47,192,233,111,229,80,237,37,42,239,241,160,221,98,171,243,79,11,185,23,224,244,
+183,114,168,246,18,149,247,120,208,110,177,213,249,167,133,220,11,112,250,91,57,84,123,137,202,123,60,104,183,216,234,252,
+211,66,238,5,56,253,173,28,170,189,68,229,149,13,82,61,128,149,199,154,47,91,128,200,223,155,227,116,14,0,52,241,
+7,0,145,0,0,0,0,0,0,0,96,247,222,169,47,0,136,252,1,64,36,0,0,0,0,200,4,192,10,144,85,252,
+52,87,180,111,149,255,233,59,148,25,71,63,68,246,3,84,251,159,190,67,153,113,244,67,100,63,64,181,255,233,59,148,
+25,71,63,68,246,3,84,251,159,190,67,153,113,244,67,100,63,64,181,255,233,59,148,25,71,63,68,246,3,84,251,159,
+190,67,153,113,244,67,100,63,64,181,255,233,59,148,25,71,63,68,246,3,84,251,159,190,131,58,71,249,226,209,79,101,
+239,0,0,61,4,0,143,11,0,30,23,0,60,46,0,120,92,0,240,184,0,224,113,121,223,225,63,79,87,79,65,105,
+108,81,104,0,0,0,14,101,88,73,102,77,77,0,42,0,0,0,8,0,0,0,0,0,0,0,210,83,147,0,0,0,
+0,73,69,78,68,174,66,96,130,
+};
+#endif // PNG_penger_H_
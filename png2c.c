@@ -1,7 +1,17 @@
+#define _POSIX_C_SOURCE 200809L
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "./stb_image.h"
@@ -15,12 +25,251 @@ const char *shift(int *argc, char ***argv)
     return result;
 }
 
+static const unsigned char png_signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+// Embeds the PNG file itself. The pixels get decoded at startup, which
+// keeps the generated header small and fast to compile.
+void emit_embedded_png(const char *filepath, const char *name)
+{
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open file `%s`\n", filepath);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < 0) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    unsigned char *bytes = malloc(size > 0 ? size : 1);
+    if (bytes == NULL) {
+        fprintf(stderr, "Could not allocate %ld bytes for file `%s`\n", size, filepath);
+        exit(1);
+    }
+    if (fread(bytes, 1, size, f) != (size_t) size) {
+        fprintf(stderr, "Could not read file `%s`\n", filepath);
+        exit(1);
+    }
+    fclose(f);
+
+    // sowon decodes the embedded images with STBI_ONLY_PNG
+    int x, y, n;
+    if (size < (long) sizeof(png_signature) || memcmp(bytes, png_signature, sizeof(png_signature)) != 0) {
+        fprintf(stderr, "File `%s` is not a PNG, -e only embeds PNGs\n", filepath);
+        exit(1);
+    }
+    if (!stbi_info_from_memory(bytes, (int) size, &x, &y, &n)) {
+        fprintf(stderr, "Could not load file `%s`\n", filepath);
+        exit(1);
+    }
+
+    printf("#ifndef PNG_%s_H_\n", name);
+    printf("#define PNG_%s_H_\n", name);
+    printf("#define PNG_%s_EMBEDDED\n", name);
+    printf("size_t %s_width = %d;\n", name, x);
+    printf("size_t %s_height = %d;\n", name, y);
+    printf("uint32_t *%s_data = NULL;\n", name);
+    printf("size_t %s_png_size = %ld;\n", name, size);
+    printf("unsigned char %s_png[] = {", name);
+    for (long i = 0; i < size; ++i) {
+        if (i % 32 == 0) printf("\n");
+        printf("%u,", bytes[i]);
+    }
+    printf("\n};\n");
+    printf("#endif // PNG_%s_H_\n", name);
+
+    free(bytes);
+}
+
+// Longest "0x%x, " of a uint32_t
+#define HEX_MAX_LEN 12
+// Pixels formatted per job, a job's buffer is HEX_MAX_LEN times that
+#define HEX_JOB_PIXELS (1024 * 1024)
+#define HEX_MAX_THREADS 64
+
+// Same output as printf("0x%x, ") for every pixel, without going through
+// stdio for every one of them. Returns the amount of bytes written.
+size_t format_hex(char *out, const uint32_t *pixels, size_t count)
+{
+    static const char nibbles[16] = "0123456789abcdef";
+    char *p = out;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t x = pixels[i];
+        int digits = 1;
+        while (digits < 8 && (x >> (digits * 4)) != 0) digits += 1;
+        *p++ = '0';
+        *p++ = 'x';
+        for (int d = digits - 1; d >= 0; --d) {
+            *p++ = nibbles[(x >> (d * 4)) & 0xF];
+        }
+        *p++ = ',';
+        *p++ = ' ';
+    }
+    return (size_t) (p - out);
+}
+
+typedef struct {
+    const uint32_t *pixels;
+    size_t count;
+    char *out;
+    size_t out_size;
+} HexJob;
+
+#ifdef _WIN32
+DWORD WINAPI hex_job_run(LPVOID arg)
+#else
+void *hex_job_run(void *arg)
+#endif
+{
+    HexJob *job = arg;
+    job->out_size = format_hex(job->out, job->pixels, job->count);
+    return 0;
+}
+
+int cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const long n = (long) info.dwNumberOfProcessors;
+#else
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (n < 1) return 1;
+    if (n > HEX_MAX_THREADS) return HEX_MAX_THREADS;
+    return (int) n;
+}
+
+// Formats the pixels in rounds of one HEX_JOB_PIXELS job per thread, then
+// writes the buffers out in order
+void emit_hex(FILE *stream, const uint32_t *pixels, size_t count)
+{
+    const int threads = cpu_count();
+    HexJob jobs[HEX_MAX_THREADS];
+    for (int t = 0; t < threads; ++t) {
+        jobs[t].out = malloc(HEX_JOB_PIXELS * HEX_MAX_LEN);
+        assert(jobs[t].out != NULL);
+    }
+
+    for (size_t start = 0; start < count; ) {
+        int used = 0;
+        for (; used < threads && start < count; ++used) {
+            jobs[used].pixels = &pixels[start];
+            jobs[used].count = count - start < HEX_JOB_PIXELS ? count - start : HEX_JOB_PIXELS;
+            start += jobs[used].count;
+        }
+
+        if (used == 1) {
+            hex_job_run(&jobs[0]);
+        } else {
+#ifdef _WIN32
+            HANDLE handles[HEX_MAX_THREADS];
+            for (int t = 0; t < used; ++t) {
+                handles[t] = CreateThread(NULL, 0, hex_job_run, &jobs[t], 0, NULL);
+                assert(handles[t] != NULL);
+            }
+            WaitForMultipleObjects(used, handles, TRUE, INFINITE);
+            for (int t = 0; t < used; ++t) CloseHandle(handles[t]);
+#else
+            pthread_t handles[HEX_MAX_THREADS];
+            for (int t = 0; t < used; ++t) {
+                if (pthread_create(&handles[t], NULL, hex_job_run, &jobs[t]) != 0) {
+                    hex_job_run(&jobs[t]);
+                    handles[t] = pthread_self();
+                }
+            }
+            for (int t = 0; t < used; ++t) {
+                if (!pthread_equal(handles[t], pthread_self())) pthread_join(handles[t], NULL);
+            }
+#endif
+        }
+
+        for (int t = 0; t < used; ++t) {
+            fwrite(jobs[t].out, 1, jobs[t].out_size, stream);
+        }
+    }
+
+    for (int t = 0; t < threads; ++t) free(jobs[t].out);
+}
+
+// The decoder hands out the rows one by one, so only a batch of them is
+// ever in memory, not the whole image
+typedef struct {
+    const char *name;
+    int width, height;
+    uint32_t *batch;
+    size_t batch_rows, batch_used;
+} PixelRows;
+
+int emit_row(void *user, int y, const unsigned char *row)
+{
+    (void) y;                   // the rows come in order
+    PixelRows *rows = user;
+    if (rows->batch == NULL) {
+        printf("#ifndef PNG_%s_H_\n", rows->name);
+        printf("#define PNG_%s_H_\n", rows->name);
+        printf("size_t %s_width = %d;\n", rows->name, rows->width);
+        printf("size_t %s_height = %d;\n", rows->name, rows->height);
+        printf("uint32_t %s_data[] = {", rows->name);
+        // a batch is a job for every thread, so they all stay busy
+        rows->batch_rows = (size_t) cpu_count() * HEX_JOB_PIXELS / rows->width;
+        if (rows->batch_rows == 0) rows->batch_rows = 1;
+        rows->batch = malloc(rows->batch_rows * rows->width * sizeof(uint32_t));
+        assert(rows->batch != NULL);
+    }
+    memcpy(&rows->batch[rows->batch_used * rows->width], row, rows->width * sizeof(uint32_t));
+    rows->batch_used += 1;
+    if (rows->batch_used == rows->batch_rows) {
+        emit_hex(stdout, rows->batch, rows->batch_used * rows->width);
+        rows->batch_used = 0;
+    }
+    return 1;
+}
+
+// Only PNGs can be streamed, the other formats stb_image reads get decoded
+// whole and then handed to emit_row() all the same
+int is_png(const char *filepath)
+{
+    unsigned char header[sizeof(png_signature)];
+    FILE *f = fopen(filepath, "rb");
+    if (f == NULL) return 0;
+    const int result = fread(header, 1, sizeof(header), f) == sizeof(header)
+        && memcmp(header, png_signature, sizeof(png_signature)) == 0;
+    fclose(f);
+    return result;
+}
+
+int load_rows(const char *filepath, PixelRows *rows)
+{
+    if (is_png(filepath)) {
+        return stbi_png_stream(filepath, &rows->width, &rows->height, NULL, 4, emit_row, rows);
+    }
+
+    unsigned char *pixels = stbi_load(filepath, &rows->width, &rows->height, NULL, 4);
+    if (pixels == NULL) return 0;
+    for (int y = 0; y < rows->height; ++y) {
+        emit_row(rows, y, &pixels[(size_t) y * rows->width * 4]);
+    }
+    stbi_image_free(pixels);
+    return 1;
+}
+
 int main(int argc, char *argv[])
 {
     shift(&argc, &argv);        // skip program name
 
+    int embed = 0;
+    if (argc > 0 && strcmp(argv[0], "-e") == 0) {
+        embed = 1;
+        shift(&argc, &argv);
+    }
+
     if (argc <= 1) {
-        fprintf(stderr, "Usage: png2c <filepath.png> <name>\n");
+        fprintf(stderr, "Usage: png2c [-e] <filepath> <name>\n");
+        fprintf(stderr, "    <filepath> is a PNG, or without -e any other image stb_image reads\n");
+        fprintf(stderr, "    -e    embed the PNG file instead of the decoded pixels\n");
         fprintf(stderr, "ERROR: expected file path and name\n");
         exit(1);
     }
@@ -28,24 +277,22 @@ int main(int argc, char *argv[])
     const char *filepath = shift(&argc, &argv);
     const char *name = shift(&argc, &argv);
 
-    int x, y, n;
-    uint32_t *data = (uint32_t *)stbi_load(filepath, &x, &y, &n, 4);
+    if (embed) {
+        emit_embedded_png(filepath, name);
+        return 0;
+    }
 
-    if (data == NULL) {
-        fprintf(stderr, "Could not load file `%s`\n", filepath);
+    PixelRows rows = {0};
+    rows.name = name;
+    if (!load_rows(filepath, &rows)) {
+        fprintf(stderr, "Could not load file `%s`: %s\n", filepath, stbi_failure_reason());
         exit(1);
     }
+    emit_hex(stdout, rows.batch, rows.batch_used * rows.width);
 
-    printf("#ifndef PNG_%s_H_\n", name);
-    printf("#define PNG_%s_H_\n", name);
-    printf("size_t %s_width = %d;\n", name, x);
-    printf("size_t %s_height = %d;\n", name, y);
-    printf("uint32_t %s_data[] = {", name);
-    for (size_t i = 0; i < (size_t)(x * y); ++i) {
-        printf("0x%x, ", data[i]);
-    }
     printf("};\n");
     printf("#endif // PNG_%s_H_\n", name);
+    free(rows.batch);
 
     return 0;
 }
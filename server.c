@@ -0,0 +1,836 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE // strtok_r(), struct sockaddr_un
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./server.h"
+
+#ifndef __linux__
+
+struct TimerServer { int unused; };
+
+TimerServer *server_create(const char *socket_path)
+{
+    (void) socket_path;
+    fprintf(stderr, "The timer server is only supported on Linux\n");
+    return NULL;
+}
+
+void server_poll(TimerServer *server, int timeout_ms)
+{
+    (void) server;
+    (void) timeout_ms;
+}
+
+int server_tick(TimerServer *server)
+{
+    (void) server;
+    return -1;
+}
+
+size_t server_shown(TimerServer *server, ServerShown shown[SERVER_SHOW_CAP])
+{
+    (void) server;
+    (void) shown;
+    return 0;
+}
+
+void server_destroy(TimerServer *server)
+{
+    (void) server;
+}
+
+#else
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "./wheel.h"
+
+#define NONE UINT32_MAX
+#define NEVER UINT64_MAX
+#define SERVER_EVENTS_CAP 256
+#define SERVER_BACKLOG 4096
+// Clients that do not read their replies get dropped past this much
+#define SERVER_OUT_CAP (64 * 1024)
+// Resolution of the expiries, the poll timeouts are in ms anyway
+#define SERVER_TICK_NS 1000000
+
+typedef enum {
+    STATE_RUNNING = 0,
+    STATE_PAUSED,
+    STATE_EXPIRED,
+} TimerState;
+
+// The timer table as a struct of arrays. deadline is origin + duration for
+// the running countdowns and NEVER for everything else. The running
+// countdowns are also scheduled on a timing wheel by their index, so the
+// tick only ever looks at the ones that are due.
+typedef struct {
+    size_t count;
+    size_t capacity;
+    uint32_t *id;
+    uint8_t *kind;
+    uint8_t *state;
+    uint64_t *origin;       // the start, moved forward by the time spent paused
+    uint64_t *paused_at;
+    uint64_t *duration;
+    uint64_t *deadline;
+    uint32_t *subs;         // first subscription to the expiry, or NONE
+    Wheel wheel;            // in SERVER_TICK_NS ticks
+
+    // id -> index + 1, open addressing with linear probing, 0 is empty
+    uint32_t *slots;
+    size_t slots_cap;
+
+    // The second of the day of the clocks as of the wall clock second
+    // clock_time, localtime_r() only runs when that changes
+    time_t clock_time;
+    uint64_t clock_seconds;
+} TimerTable;
+
+// Singly linked lists of subscriptions in a pool. A subscription of a
+// client that went away is recognized by its generation and freed lazily.
+typedef struct {
+    uint32_t *client;
+    uint32_t *generation;
+    uint32_t *next;
+    size_t count;
+    size_t capacity;
+    uint32_t free;
+} Subscriptions;
+
+typedef struct {
+    int fd;                 // -1 when the entry is free
+    uint32_t generation;
+    char in[SERVER_LINE_CAP];
+    size_t in_len;
+    char *out;              // replies the socket did not take yet
+    size_t out_len;
+    size_t out_cap;
+} Client;
+
+struct TimerServer {
+    char *socket_path;
+    int listener;
+    int epoll;
+    TimerTable table;
+    Subscriptions subs;
+    uint32_t any_subs;      // subscriptions to every timer
+    Client *clients;
+    size_t clients_count;
+    size_t clients_cap;
+    uint32_t shown[SERVER_SHOW_CAP];
+    size_t shown_count;
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+static void *grow(void *items, size_t item_size, size_t capacity)
+{
+    void *result = realloc(items, item_size * capacity);
+    assert(result != NULL);
+    return result;
+}
+
+// TIMER TABLE BEGIN //////////////////////////////
+
+static size_t id_hash(uint32_t id)
+{
+    return (size_t) ((id * 2654435761u) ^ (id >> 16));
+}
+
+static size_t table_slot(const TimerTable *table, uint32_t id)
+{
+    const size_t mask = table->slots_cap - 1;
+    size_t h = id_hash(id) & mask;
+    while (table->slots[h] != 0 && table->id[table->slots[h] - 1] != id) {
+        h = (h + 1) & mask;
+    }
+    return h;
+}
+
+static uint32_t table_find(const TimerTable *table, uint32_t id)
+{
+    if (table->slots_cap == 0) return NONE;
+    const uint32_t entry = table->slots[table_slot(table, id)];
+    return entry == 0 ? NONE : entry - 1;
+}
+
+static void table_rehash(TimerTable *table, size_t slots_cap)
+{
+    free(table->slots);
+    table->slots = calloc(slots_cap, sizeof(*table->slots));
+    assert(table->slots != NULL);
+    table->slots_cap = slots_cap;
+    for (size_t i = 0; i < table->count; ++i) {
+        table->slots[table_slot(table, table->id[i])] = (uint32_t) i + 1;
+    }
+}
+
+static uint32_t table_insert(TimerTable *table, uint32_t id)
+{
+    if (table->count == table->capacity) {
+        const size_t capacity = table->capacity == 0 ? 64 : table->capacity * 2;
+        table->id = grow(table->id, sizeof(*table->id), capacity);
+        table->kind = grow(table->kind, sizeof(*table->kind), capacity);
+        table->state = grow(table->state, sizeof(*table->state), capacity);
+        table->origin = grow(table->origin, sizeof(*table->origin), capacity);
+        table->paused_at = grow(table->paused_at, sizeof(*table->paused_at), capacity);
+        table->duration = grow(table->duration, sizeof(*table->duration), capacity);
+        table->deadline = grow(table->deadline, sizeof(*table->deadline), capacity);
+        table->subs = grow(table->subs, sizeof(*table->subs), capacity);
+        wheel_reserve(&table->wheel, capacity);
+        table->capacity = capacity;
+    }
+    // Keep the load factor under 1/2
+    if ((table->count + 1) * 2 > table->slots_cap) {
+        table_rehash(table, table->slots_cap == 0 ? 128 : table->slots_cap * 2);
+    }
+
+    const uint32_t index = (uint32_t) table->count++;
+    table->id[index] = id;
+    table->subs[index] = NONE;
+    table->slots[table_slot(table, id)] = index + 1;
+    return index;
+}
+
+// Moves the last timer into the hole, so the arrays stay dense
+static void table_remove(TimerTable *table, uint32_t index)
+{
+    // Backward shift deletion, no tombstones with linear probing
+    const size_t mask = table->slots_cap - 1;
+    size_t hole = table_slot(table, table->id[index]);
+    for (size_t j = (hole + 1) & mask; table->slots[j] != 0; j = (j + 1) & mask) {
+        const size_t home = id_hash(table->id[table->slots[j] - 1]) & mask;
+        const int stays = hole <= j ? (hole < home && home <= j) : (hole < home || home <= j);
+        if (!stays) {
+            table->slots[hole] = table->slots[j];
+            hole = j;
+        }
+    }
+    table->slots[hole] = 0;
+    wheel_cancel(&table->wheel, index);
+
+    const uint32_t last = (uint32_t) --table->count;
+    if (index != last) {
+        table->id[index] = table->id[last];
+        table->kind[index] = table->kind[last];
+        table->state[index] = table->state[last];
+        table->origin[index] = table->origin[last];
+        table->paused_at[index] = table->paused_at[last];
+        table->duration[index] = table->duration[last];
+        table->deadline[index] = table->deadline[last];
+        table->subs[index] = table->subs[last];
+        wheel_move(&table->wheel, last, index);
+        table->slots[table_slot(table, table->id[index])] = index + 1;
+    }
+}
+
+static void table_arm(TimerTable *table, uint32_t i)
+{
+    if (table->kind[i] == SERVER_COUNTDOWN && table->state[i] == STATE_RUNNING) {
+        table->deadline[i] = table->origin[i] + table->duration[i];
+        // Rounded up, so the wheel never hands out a countdown early
+        wheel_schedule(&table->wheel, i, (table->deadline[i] + SERVER_TICK_NS - 1) / SERVER_TICK_NS);
+    } else {
+        table->deadline[i] = NEVER;
+        wheel_cancel(&table->wheel, i);
+    }
+}
+
+// The wall clock time of day in nanoseconds
+static uint64_t clock_ns(TimerTable *table)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    if (ts.tv_sec != table->clock_time) {
+        struct tm tm;
+        localtime_r(&ts.tv_sec, &tm);
+        table->clock_time = ts.tv_sec;
+        table->clock_seconds = (uint64_t) (tm.tm_sec + tm.tm_min * 60 + tm.tm_hour * 60 * 60);
+    }
+    return table->clock_seconds * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+// The time the timer shows, in nanoseconds
+static uint64_t table_displayed(TimerTable *table, uint32_t i, uint64_t now)
+{
+    const uint64_t at = table->state[i] == STATE_PAUSED ? table->paused_at[i] : now;
+    const uint64_t elapsed = at - table->origin[i];
+    switch ((ServerTimerKind) table->kind[i]) {
+    case SERVER_ASCENDING: return elapsed;
+    case SERVER_COUNTDOWN: {
+        if (table->state[i] == STATE_EXPIRED || elapsed >= table->duration[i]) return 0;
+        return table->duration[i] - elapsed;
+    }
+    case SERVER_CLOCK: return clock_ns(table);
+    }
+    return 0;
+}
+
+// TIMER TABLE END //////////////////////////////
+
+// CLIENTS BEGIN //////////////////////////////
+
+static void client_close(TimerServer *server, uint32_t ci)
+{
+    Client *client = &server->clients[ci];
+    if (client->fd < 0) return;
+    epoll_ctl(server->epoll, EPOLL_CTL_DEL, client->fd, NULL);
+    close(client->fd);
+    client->fd = -1;
+    client->generation += 1;
+    free(client->out);
+    client->out = NULL;
+    client->out_len = client->out_cap = 0;
+}
+
+static void client_watch(TimerServer *server, uint32_t ci, int want_out)
+{
+    struct epoll_event event = {
+        .events = EPOLLIN | (want_out ? EPOLLOUT : 0),
+        .data.u32 = ci,
+    };
+    epoll_ctl(server->epoll, EPOLL_CTL_MOD, server->clients[ci].fd, &event);
+}
+
+// Sends what is pending, returns 0 when the client went away
+static int client_flush(TimerServer *server, uint32_t ci)
+{
+    Client *client = &server->clients[ci];
+    size_t sent = 0;
+    while (sent < client->out_len) {
+        const ssize_t n = send(client->fd, client->out + sent, client->out_len - sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            client_close(server, ci);
+            return 0;
+        }
+        sent += (size_t) n;
+    }
+    memmove(client->out, client->out + sent, client->out_len - sent);
+    const int was_pending = client->out_len > 0;
+    client->out_len -= sent;
+    if (was_pending && client->out_len == 0) client_watch(server, ci, 0);
+    return 1;
+}
+
+static void client_send(TimerServer *server, uint32_t ci, const char *data, size_t size)
+{
+    Client *client = &server->clients[ci];
+    if (client->fd < 0) return;
+
+    if (client->out_len + size > SERVER_OUT_CAP) {
+        client_close(server, ci);
+        return;
+    }
+    const int was_idle = client->out_len == 0;
+    if (client->out_len + size > client->out_cap) {
+        client->out_cap = client->out_cap == 0 ? SERVER_LINE_CAP : client->out_cap * 2;
+        while (client->out_cap < client->out_len + size) client->out_cap *= 2;
+        client->out = grow(client->out, 1, client->out_cap);
+    }
+    memcpy(client->out + client->out_len, data, size);
+    client->out_len += size;
+
+    if (was_idle && client_flush(server, ci) && client->out_len > 0) {
+        client_watch(server, ci, 1);
+    }
+}
+
+static void client_reply(TimerServer *server, uint32_t ci, const char *fmt, ...)
+{
+    char line[SERVER_LINE_CAP];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line) - 1, fmt, args);
+    va_end(args);
+    if (n < 0) return;
+    if ((size_t) n > sizeof(line) - 2) n = sizeof(line) - 2;
+    line[n++] = '\n';
+    client_send(server, ci, line, (size_t) n);
+}
+
+static void accept_clients(TimerServer *server)
+{
+    for (;;) {
+        const int fd = accept(server->listener, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                fprintf(stderr, "Could not accept a client: %s\n", strerror(errno));
+            }
+            return;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+        uint32_t ci = NONE;
+        for (size_t i = 0; i < server->clients_count; ++i) {
+            if (server->clients[i].fd < 0) {
+                ci = (uint32_t) i;
+                break;
+            }
+        }
+        if (ci == NONE) {
+            if (server->clients_count == server->clients_cap) {
+                server->clients_cap = server->clients_cap == 0 ? 64 : server->clients_cap * 2;
+                server->clients = grow(server->clients, sizeof(*server->clients), server->clients_cap);
+            }
+            ci = (uint32_t) server->clients_count++;
+            server->clients[ci].generation = 0;
+        }
+
+        Client *client = &server->clients[ci];
+        client->fd = fd;
+        client->in_len = 0;
+        client->out = NULL;
+        client->out_len = client->out_cap = 0;
+
+        struct epoll_event event = {.events = EPOLLIN, .data.u32 = ci};
+        if (epoll_ctl(server->epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            client->fd = -1;
+        }
+    }
+}
+
+// CLIENTS END //////////////////////////////
+
+// SUBSCRIPTIONS BEGIN //////////////////////////////
+
+static uint32_t subs_push(Subscriptions *subs, uint32_t head, uint32_t client, uint32_t generation)
+{
+    uint32_t s = subs->free;
+    if (s != NONE) {
+        subs->free = subs->next[s];
+    } else {
+        if (subs->count == subs->capacity) {
+            subs->capacity = subs->capacity == 0 ? 64 : subs->capacity * 2;
+            subs->client = grow(subs->client, sizeof(*subs->client), subs->capacity);
+            subs->generation = grow(subs->generation, sizeof(*subs->generation), subs->capacity);
+            subs->next = grow(subs->next, sizeof(*subs->next), subs->capacity);
+        }
+        s = (uint32_t) subs->count++;
+    }
+    subs->client[s] = client;
+    subs->generation[s] = generation;
+    subs->next[s] = head;
+    return s;
+}
+
+static void subs_free_list(Subscriptions *subs, uint32_t head)
+{
+    while (head != NONE) {
+        const uint32_t next = subs->next[head];
+        subs->next[head] = subs->free;
+        subs->free = head;
+        head = next;
+    }
+}
+
+// Sends the line to every live subscriber of the list and drops the ones
+// that went away. Returns the new head.
+static uint32_t subs_notify(TimerServer *server, uint32_t head, const char *line, size_t size)
+{
+    Subscriptions *subs = &server->subs;
+    uint32_t *link = &head;
+    while (*link != NONE) {
+        const uint32_t s = *link;
+        const Client *client = &server->clients[subs->client[s]];
+        if (client->fd < 0 || client->generation != subs->generation[s]) {
+            *link = subs->next[s];
+            subs->next[s] = subs->free;
+            subs->free = s;
+            continue;
+        }
+        client_send(server, subs->client[s], line, size);
+        link = &subs->next[s];
+    }
+    return head;
+}
+
+// SUBSCRIPTIONS END //////////////////////////////
+
+// COMMANDS BEGIN //////////////////////////////
+
+static const char *kind_name(ServerTimerKind kind)
+{
+    switch (kind) {
+    case SERVER_ASCENDING: return "ascending";
+    case SERVER_COUNTDOWN: return "countdown";
+    case SERVER_CLOCK: return "clock";
+    }
+    return "unknown";
+}
+
+static const char *state_name(TimerState state)
+{
+    switch (state) {
+    case STATE_RUNNING: return "running";
+    case STATE_PAUSED: return "paused";
+    case STATE_EXPIRED: return "expired";
+    }
+    return "unknown";
+}
+
+static int parse_id(const char *token, uint32_t *id)
+{
+    if (token == NULL || *token < '0' || *token > '9') return 0;
+    char *end = NULL;
+    errno = 0;
+    const unsigned long long x = strtoull(token, &end, 10);
+    if (errno != 0 || *end != '\0' || x > UINT32_MAX) return 0;
+    *id = (uint32_t) x;
+    return 1;
+}
+
+// Same format as the command line durations: 1h23m54s, 90, 1.5m
+static int parse_duration(const char *token, uint64_t *ns)
+{
+    double result = 0.0;
+    while (*token) {
+        char *end = NULL;
+        const double x = strtod(token, &end);
+        if (end == token || !(x >= 0.0)) return 0;
+        switch (*end) {
+        case '\0':
+        case 's': result += x;                 break;
+        case 'm': result += x * 60.0;          break;
+        case 'h': result += x * 60.0 * 60.0;   break;
+        default: return 0;
+        }
+        token = end;
+        if (*token) token += 1;
+    }
+    // strtod() also takes inf, nan and 1e30, none of which fit in the cast
+    const double x = result * 1e9 + 0.5;
+    if (!(x < (double) UINT64_MAX)) return 0;
+    *ns = (uint64_t) x;
+    return 1;
+}
+
+static void execute(TimerServer *server, uint32_t ci, char *line)
+{
+    TimerTable *table = &server->table;
+    const uint64_t now = now_ns();
+
+    char *save = NULL;
+    const char *command = strtok_r(line, " \t\r", &save);
+    if (command == NULL) return;
+    const char *arg = strtok_r(NULL, " \t\r", &save);
+
+    if (strcmp(command, "show") == 0) {
+        // A bad id leaves the timers shown before untouched
+        uint32_t shown[SERVER_SHOW_CAP];
+        size_t count = 0;
+        for (; arg != NULL; arg = strtok_r(NULL, " \t\r", &save)) {
+            if (count == SERVER_SHOW_CAP) {
+                client_reply(server, ci, "error at most %d timers can be shown", SERVER_SHOW_CAP);
+                return;
+            }
+            if (!parse_id(arg, &shown[count])) {
+                client_reply(server, ci, "error `%s` is not a timer id", arg);
+                return;
+            }
+            count += 1;
+        }
+        memcpy(server->shown, shown, sizeof(*shown) * count);
+        server->shown_count = count;
+        client_reply(server, ci, "ok");
+        return;
+    }
+
+    if (strcmp(command, "subscribe") == 0 && arg != NULL && strcmp(arg, "*") == 0) {
+        server->any_subs = subs_push(&server->subs, server->any_subs, ci, server->clients[ci].generation);
+        client_reply(server, ci, "ok");
+        return;
+    }
+
+    static const char *const id_commands[] = {"start", "pause", "reset", "stop", "query", "subscribe"};
+    size_t known = 0;
+    while (known < sizeof(id_commands) / sizeof(id_commands[0]) && strcmp(command, id_commands[known]) != 0) {
+        known += 1;
+    }
+    if (known == sizeof(id_commands) / sizeof(id_commands[0])) {
+        client_reply(server, ci, "error unknown command `%s`", command);
+        return;
+    }
+
+    uint32_t id;
+    if (!parse_id(arg, &id)) {
+        client_reply(server, ci, "error expected `%s <id>`", command);
+        return;
+    }
+    uint32_t i = table_find(table, id);
+
+    if (strcmp(command, "start") == 0) {
+        const char *what = strtok_r(NULL, " \t\r", &save);
+        ServerTimerKind kind = SERVER_COUNTDOWN;
+        uint64_t duration = 0;
+        if (what == NULL) {
+            client_reply(server, ci, "error expected `start <id> <duration>|ascending|clock`");
+            return;
+        } else if (strcmp(what, "ascending") == 0) {
+            kind = SERVER_ASCENDING;
+        } else if (strcmp(what, "clock") == 0) {
+            kind = SERVER_CLOCK;
+        } else if (!parse_duration(what, &duration)) {
+            client_reply(server, ci, "error `%s` is not a duration", what);
+            return;
+        }
+        if (i == NONE) i = table_insert(table, id);
+        table->kind[i] = (uint8_t) kind;
+        table->state[i] = STATE_RUNNING;
+        table->origin[i] = now;
+        table->paused_at[i] = now;
+        table->duration[i] = duration;
+        table_arm(table, i);
+        client_reply(server, ci, "ok");
+        return;
+    }
+
+    if (i == NONE) {
+        client_reply(server, ci, "error no timer %u", (unsigned) id);
+        return;
+    }
+
+    if (strcmp(command, "pause") == 0) {
+        if (table->state[i] == STATE_RUNNING) {
+            table->state[i] = STATE_PAUSED;
+            table->paused_at[i] = now;
+        } else if (table->state[i] == STATE_PAUSED) {
+            table->state[i] = STATE_RUNNING;
+            table->origin[i] += now - table->paused_at[i];
+        }
+        table_arm(table, i);
+        client_reply(server, ci, "ok %s", state_name(table->state[i]));
+    } else if (strcmp(command, "reset") == 0) {
+        if (table->state[i] == STATE_EXPIRED) table->state[i] = STATE_RUNNING;
+        table->origin[i] = now;
+        table->paused_at[i] = now;
+        table_arm(table, i);
+        client_reply(server, ci, "ok");
+    } else if (strcmp(command, "stop") == 0) {
+        subs_free_list(&server->subs, table->subs[i]);
+        table_remove(table, i);
+        client_reply(server, ci, "ok");
+    } else if (strcmp(command, "query") == 0) {
+        client_reply(server, ci, "timer %u %s %llu %s", (unsigned) id,
+                     kind_name(table->kind[i]),
+                     (unsigned long long) (table_displayed(table, i, now) / 1000000000),
+                     state_name(table->state[i]));
+    } else {
+        table->subs[i] = subs_push(&server->subs, table->subs[i], ci, server->clients[ci].generation);
+        client_reply(server, ci, "ok");
+    }
+}
+
+static void read_commands(TimerServer *server, uint32_t ci)
+{
+    for (;;) {
+        Client *client = &server->clients[ci];
+        const ssize_t n = read(client->fd, client->in + client->in_len, sizeof(client->in) - client->in_len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) client_close(server, ci);
+            return;
+        }
+        if (n == 0) {
+            client_close(server, ci);
+            return;
+        }
+        client->in_len += (size_t) n;
+
+        size_t start = 0;
+        for (size_t i = start; i < client->in_len; ++i) {
+            if (client->in[i] != '\n') continue;
+            client->in[i] = '\0';
+            execute(server, ci, client->in + start);
+            // Replies may have dropped the client
+            if (server->clients[ci].fd < 0) return;
+            start = i + 1;
+        }
+        client = &server->clients[ci];
+        if (start == 0 && client->in_len == sizeof(client->in)) {
+            client_reply(server, ci, "error the line is longer than %d bytes", SERVER_LINE_CAP - 1);
+            client->in_len = 0;
+        } else {
+            memmove(client->in, client->in + start, client->in_len - start);
+            client->in_len -= start;
+        }
+    }
+}
+
+// COMMANDS END //////////////////////////////
+
+TimerServer *server_create(const char *socket_path)
+{
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "The socket path `%s` is too long\n", socket_path);
+        return NULL;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    // Every client is a file descriptor
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        fprintf(stderr, "Could not create a socket: %s\n", strerror(errno));
+        return NULL;
+    }
+
+    // Only take over the path when nobody listens on it anymore
+    if (connect(listener, (struct sockaddr *) &addr, sizeof(addr)) == 0) {
+        fprintf(stderr, "Another server is already listening on `%s`\n", socket_path);
+        close(listener);
+        return NULL;
+    }
+    unlink(socket_path);
+
+    if (bind(listener, (struct sockaddr *) &addr, sizeof(addr)) < 0 ||
+        listen(listener, SERVER_BACKLOG) < 0) {
+        fprintf(stderr, "Could not listen on `%s`: %s\n", socket_path, strerror(errno));
+        close(listener);
+        return NULL;
+    }
+    fcntl(listener, F_SETFL, fcntl(listener, F_GETFL) | O_NONBLOCK);
+
+    const int epoll = epoll_create1(0);
+    struct epoll_event event = {.events = EPOLLIN, .data.u32 = NONE};
+    if (epoll < 0 || epoll_ctl(epoll, EPOLL_CTL_ADD, listener, &event) < 0) {
+        fprintf(stderr, "Could not set up epoll: %s\n", strerror(errno));
+        if (epoll >= 0) close(epoll);
+        close(listener);
+        unlink(socket_path);
+        return NULL;
+    }
+
+    TimerServer *server = calloc(1, sizeof(*server));
+    assert(server != NULL);
+    server->socket_path = malloc(strlen(socket_path) + 1);
+    assert(server->socket_path != NULL);
+    strcpy(server->socket_path, socket_path);
+    server->listener = listener;
+    server->epoll = epoll;
+    server->subs.free = NONE;
+    server->any_subs = NONE;
+    wheel_init(&server->table.wheel, now_ns() / SERVER_TICK_NS);
+    return server;
+}
+
+void server_poll(TimerServer *server, int timeout_ms)
+{
+    struct epoll_event events[SERVER_EVENTS_CAP];
+    int n;
+    do {
+        n = epoll_wait(server->epoll, events, SERVER_EVENTS_CAP, timeout_ms);
+        for (int i = 0; i < n; ++i) {
+            const uint32_t ci = events[i].data.u32;
+            if (ci == NONE) {
+                accept_clients(server);
+                continue;
+            }
+            if (server->clients[ci].fd < 0) continue;
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                client_close(server, ci);
+                continue;
+            }
+            if ((events[i].events & EPOLLOUT) && !client_flush(server, ci)) continue;
+            if (events[i].events & EPOLLIN) read_commands(server, ci);
+        }
+        timeout_ms = 0;
+    } while (n == SERVER_EVENTS_CAP);
+}
+
+int server_tick(TimerServer *server)
+{
+    TimerTable *table = &server->table;
+    const uint64_t now = now_ns();
+    wheel_advance(&table->wheel, now / SERVER_TICK_NS);
+    uint32_t i;
+    while ((i = wheel_pop(&table->wheel)) != WHEEL_NONE) {
+        assert(table->deadline[i] <= now);
+        table->state[i] = STATE_EXPIRED;
+        table->deadline[i] = NEVER;
+        char line[64];
+        const int size = snprintf(line, sizeof(line), "expired %u\n", (unsigned) table->id[i]);
+        table->subs[i] = subs_notify(server, table->subs[i], line, (size_t) size);
+        server->any_subs = subs_notify(server, server->any_subs, line, (size_t) size);
+    }
+
+    const uint64_t next = wheel_next(&table->wheel);
+    if (next == WHEEL_NEVER) return -1;
+    // Rounded up, waking up early would only mean another round
+    const uint64_t ms = (next * SERVER_TICK_NS - now + 999999) / 1000000;
+    return ms > 1000 * 60 ? 1000 * 60 : (int) ms;
+}
+
+size_t server_shown(TimerServer *server, ServerShown shown[SERVER_SHOW_CAP])
+{
+    TimerTable *table = &server->table;
+    const uint64_t now = now_ns();
+    size_t count = 0;
+    for (size_t j = 0; j < server->shown_count; ++j) {
+        const uint32_t i = table_find(table, server->shown[j]);
+        if (i == NONE) continue;
+        shown[count].nanoseconds = table_displayed(table, i, now);
+        shown[count].seconds = shown[count].nanoseconds / 1000000000;
+        shown[count].kind = (ServerTimerKind) table->kind[i];
+        shown[count].paused = table->state[i] == STATE_PAUSED;
+        count += 1;
+    }
+    return count;
+}
+
+void server_destroy(TimerServer *server)
+{
+    if (server == NULL) return;
+    for (size_t i = 0; i < server->clients_count; ++i) {
+        client_close(server, (uint32_t) i);
+    }
+    close(server->epoll);
+    close(server->listener);
+    unlink(server->socket_path);
+    free(server->socket_path);
+
+    TimerTable *table = &server->table;
+    free(table->id);
+    free(table->kind);
+    free(table->state);
+    free(table->origin);
+    free(table->paused_at);
+    free(table->duration);
+    free(table->deadline);
+    free(table->subs);
+    free(table->slots);
+    wheel_free(&table->wheel);
+    free(server->subs.client);
+    free(server->subs.generation);
+    free(server->subs.next);
+    free(server->clients);
+    free(server);
+}
+
+#endif // __linux__
@@ -0,0 +1,60 @@
+#ifndef SERVER_H_
+#define SERVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Timer server of `sowon -S <path>`: a table of timers keyed by a 32 bit
+// id, controlled over a Unix domain stream socket at <path> with one
+// command per line. Every command gets exactly one reply line, except
+// for the expiry notifications that subscribers receive at any time.
+//
+//   start <id> <duration>|ascending|clock  -> ok
+//       (re)creates the timer and starts it
+//   pause <id>                             -> ok paused|running|expired
+//       toggles the pause
+//   reset <id>                             -> ok
+//       back to the start, keeping the pause state
+//   stop <id>                              -> ok
+//       removes the timer
+//   query <id>                             -> timer <id> <kind> <seconds> running|paused|expired
+//   subscribe <id>|*                       -> ok
+//       the client gets `expired <id>` when the countdown <id> (or any) ends
+//   show [<id>...]                         -> ok
+//       the timers to render, at most SERVER_SHOW_CAP of them
+//
+// Errors are replied with `error <message>`. Only Linux is supported, the
+// server is built on epoll.
+
+#define SERVER_SHOW_CAP 16
+#define SERVER_LINE_CAP 256
+
+typedef enum {
+    SERVER_ASCENDING = 0,
+    SERVER_COUNTDOWN,
+    SERVER_CLOCK,
+} ServerTimerKind;
+
+typedef struct {
+    uint64_t seconds;
+    uint64_t nanoseconds;   // the same time, for the animations
+    ServerTimerKind kind;
+    int paused;
+} ServerShown;
+
+typedef struct TimerServer TimerServer;
+
+// Returns NULL and reports the error on stderr on failure
+TimerServer *server_create(const char *socket_path);
+// Accepts clients and executes their commands, waiting up to timeout_ms
+// (0 does not wait, -1 waits forever) for any of them
+void server_poll(TimerServer *server, int timeout_ms);
+// Expires the countdowns that are over and notifies their subscribers.
+// Returns the milliseconds until the next countdown expires, -1 if none
+// is running.
+int server_tick(TimerServer *server);
+// The timers selected with `show` that still exist, in their order
+size_t server_shown(TimerServer *server, ServerShown shown[SERVER_SHOW_CAP]);
+void server_destroy(TimerServer *server);
+
+#endif // SERVER_H_
@@ -0,0 +1,141 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE // syscall()
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./shm.h"
+
+#ifdef _WIN32
+
+struct ShmRing { int unused; };
+
+ShmRing *shm_ring_create(const char *name, int width, int height)
+{
+    (void) name;
+    (void) width;
+    (void) height;
+    fprintf(stderr, "Shared memory output is not supported on Windows\n");
+    return NULL;
+}
+
+void shm_ring_publish(ShmRing *ring, const uint32_t *pixels)
+{
+    (void) ring;
+    (void) pixels;
+}
+
+void shm_ring_destroy(ShmRing *ring)
+{
+    (void) ring;
+}
+
+#else
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+struct ShmRing {
+    char *name;
+    ShmHeader *header;
+    size_t size;
+};
+
+ShmRing *shm_ring_create(const char *name, int width, int height)
+{
+    const uint64_t frame_size = (uint64_t) width * height * 4;
+    // Keep the frames cache line aligned
+    const uint64_t frame_offset = (sizeof(ShmHeader) + 63) & ~(uint64_t) 63;
+    const size_t size = frame_offset + frame_size * SHM_RING_SLOTS;
+
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "Could not open shared memory `%s`: %s\n", name, strerror(errno));
+        return NULL;
+    }
+    if (ftruncate(fd, (off_t) size) < 0) {
+        fprintf(stderr, "Could not resize shared memory `%s`: %s\n", name, strerror(errno));
+        close(fd);
+        return NULL;
+    }
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        fprintf(stderr, "Could not map shared memory `%s`: %s\n", name, strerror(errno));
+        return NULL;
+    }
+
+    ShmRing *ring = malloc(sizeof(*ring));
+    if (ring == NULL) {
+        munmap(mem, size);
+        return NULL;
+    }
+    ring->name = malloc(strlen(name) + 1);
+    if (ring->name == NULL) {
+        munmap(mem, size);
+        free(ring);
+        return NULL;
+    }
+    strcpy(ring->name, name);
+    ring->header = mem;
+    ring->size = size;
+
+    // A reader may still be attached from a previous run, make it drop the
+    // mapping by invalidating the magic first
+    __atomic_store_n(&ring->header->magic, 0, __ATOMIC_RELEASE);
+    memset(ring->header->slot, 0, sizeof(ring->header->slot));
+    ring->header->version = SHM_RING_VERSION;
+    ring->header->width = (uint32_t) width;
+    ring->header->height = (uint32_t) height;
+    ring->header->slots = SHM_RING_SLOTS;
+    ring->header->frame_offset = frame_offset;
+    ring->header->frame_size = frame_size;
+    __atomic_store_n(&ring->header->seq, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->header->magic, SHM_RING_MAGIC, __ATOMIC_RELEASE);
+
+    return ring;
+}
+
+void shm_ring_publish(ShmRing *ring, const uint32_t *pixels)
+{
+    ShmHeader *header = ring->header;
+    const uint32_t seq = header->seq + 1;
+    ShmSlot *slot = &header->slot[seq % SHM_RING_SLOTS];
+    char *frame = (char *) header + header->frame_offset + (seq % SHM_RING_SLOTS) * header->frame_size;
+
+    // Mark the slot as being written, so readers that are still on it can tell
+    __atomic_store_n(&slot->seq, 0, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    memcpy(frame, pixels, header->frame_size);
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    slot->timestamp_ns = (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+    __atomic_store_n(&slot->seq, (uint64_t) seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&header->seq, seq, __ATOMIC_RELEASE);
+
+#ifdef __linux__
+    syscall(SYS_futex, &header->seq, FUTEX_WAKE, 0x7fffffff, NULL, NULL, 0);
+#endif
+}
+
+void shm_ring_destroy(ShmRing *ring)
+{
+    if (ring == NULL) return;
+    __atomic_store_n(&ring->header->magic, 0, __ATOMIC_RELEASE);
+    munmap(ring->header, ring->size);
+    shm_unlink(ring->name);
+    free(ring->name);
+    free(ring);
+}
+
+#endif // _WIN32
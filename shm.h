@@ -0,0 +1,44 @@
+#ifndef SHM_H_
+#define SHM_H_
+
+#include <stdint.h>
+
+// Layout of the shared memory frame ring published by `sowon -f shm`.
+//
+// The header is followed by SHM_RING_SLOTS frames of width*height native
+// uint32_t 0xAABBGGRR pixels (R, G, B, A bytes on little endian hosts). The writer fills the slot
+// (seq % SHM_RING_SLOTS) for the frame number seq, stamps it and only then
+// bumps the header seq. Frames that did not change are never republished.
+// A reader waits for seq to change (it is a futex word on Linux), reads
+// the newest slot in place, and checks that the slot seq is still the one
+// it started with. A different seq means the writer lapped the reader.
+
+#define SHM_RING_MAGIC 0x4e4f574fu // "OWON"
+#define SHM_RING_VERSION 1
+#define SHM_RING_SLOTS 3
+
+typedef struct {
+    uint64_t seq;
+    uint64_t timestamp_ns; // CLOCK_MONOTONIC when the frame was published
+} ShmSlot;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t slots;
+    uint32_t seq;          // latest published frame, 0 means none yet
+    uint64_t frame_offset; // from the start of the mapping to slot 0
+    uint64_t frame_size;
+    ShmSlot slot[SHM_RING_SLOTS];
+} ShmHeader;
+
+typedef struct ShmRing ShmRing;
+
+// Returns NULL and reports the error on stderr on failure
+ShmRing *shm_ring_create(const char *name, int width, int height);
+void shm_ring_publish(ShmRing *ring, const uint32_t *pixels);
+void shm_ring_destroy(ShmRing *ring);
+
+#endif // SHM_H_
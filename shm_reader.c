@@ -0,0 +1,127 @@
+// Attaches to the frame ring of `sowon -f shm -o <name>` and reports every
+// published frame together with its publish-to-read latency.
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE // syscall()
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "./shm.h"
+
+uint64_t now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+void wait_for_seq_change(ShmHeader *header, uint32_t seq)
+{
+#ifdef __linux__
+    const struct timespec timeout = {1, 0};
+    syscall(SYS_futex, &header->seq, FUTEX_WAIT, seq, &timeout, NULL, 0);
+#else
+    (void) header;
+    (void) seq;
+    const struct timespec delay = {0, 1000000};
+    nanosleep(&delay, NULL);
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: shm_reader <name> [frames]\n");
+        fprintf(stderr, "ERROR: expected the shared memory name\n");
+        exit(1);
+    }
+    const char *name = argv[1];
+    const long frames = argc > 2 ? atol(argv[2]) : -1;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        fprintf(stderr, "Could not open shared memory `%s`: %s\n", name, strerror(errno));
+        exit(1);
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(ShmHeader)) {
+        fprintf(stderr, "`%s` is not a sowon frame ring\n", name);
+        exit(1);
+    }
+    ShmHeader *header = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (header == MAP_FAILED) {
+        fprintf(stderr, "Could not map shared memory `%s`: %s\n", name, strerror(errno));
+        exit(1);
+    }
+    if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC ||
+        header->version != SHM_RING_VERSION ||
+        header->frame_offset + header->frame_size * header->slots > (uint64_t) st.st_size) {
+        fprintf(stderr, "`%s` is not a sowon frame ring\n", name);
+        exit(1);
+    }
+    printf("%s: %ux%u, %u slots\n", name, header->width, header->height, header->slots);
+
+    uint64_t latency_min = UINT64_MAX, latency_max = 0, latency_sum = 0;
+    long received = 0, torn = 0;
+    uint32_t last = __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+    while (frames < 0 || received < frames) {
+        const uint32_t seq = __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+        if (seq == last) {
+            if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC) {
+                fprintf(stderr, "The writer went away\n");
+                break;
+            }
+            wait_for_seq_change(header, last);
+            continue;
+        }
+        const uint64_t read_at = now_ns();
+
+        const ShmSlot *slot = &header->slot[seq % SHM_RING_SLOTS];
+        const uint64_t timestamp = slot->timestamp_ns;
+        const uint32_t *pixels = (const uint32_t *) ((const char *) header + header->frame_offset + (seq % SHM_RING_SLOTS) * header->frame_size);
+        // Touch the frame in place, a real compositor would upload it here
+        uint32_t checksum = 0;
+        for (uint64_t i = 0; i < header->frame_size / 4; ++i) {
+            checksum ^= pixels[i];
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq) {
+            torn += 1;
+            last = seq;
+            continue;
+        }
+
+        const uint64_t latency = read_at - timestamp;
+        if (latency < latency_min) latency_min = latency;
+        if (latency > latency_max) latency_max = latency;
+        latency_sum += latency;
+        received += 1;
+        printf("frame %u: latency %.3f ms, checksum %08x%s\n",
+               seq, (double) latency / 1e6, checksum,
+               seq - last > 1 ? " (skipped frames)" : "");
+        last = seq;
+    }
+
+    if (received > 0) {
+        printf("%ld frames, %ld torn, latency min %.3f ms, avg %.3f ms, max %.3f ms\n",
+               received, torn,
+               (double) latency_min / 1e6,
+               (double) latency_sum / (double) received / 1e6,
+               (double) latency_max / 1e6);
+    }
+
+    return 0;
+}
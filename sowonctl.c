@@ -0,0 +1,276 @@
+// Talks to the timer server of `sowon -S <path>` (see server.h). Either
+// sends one command and prints the replies, or load tests the server with
+// many subscribed clients and reports the expiry notification latency.
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE // struct sockaddr_un
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "./server.h"
+
+uint64_t now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+int connect_server(const char *path)
+{
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "The socket path `%s` is too long\n", path);
+        exit(1);
+    }
+    strcpy(addr.sun_path, path);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+        fprintf(stderr, "Could not connect to `%s`: %s\n", path, strerror(errno));
+        exit(1);
+    }
+    return fd;
+}
+
+void send_all(int fd, const char *data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            fprintf(stderr, "Could not send: %s\n", strerror(errno));
+            exit(1);
+        }
+        data += n;
+        size -= (size_t) n;
+    }
+}
+
+// Line reader over a blocking socket
+typedef struct {
+    int fd;
+    char buf[4096];
+    size_t len;
+    size_t start;
+} Lines;
+
+const char *next_line(Lines *lines)
+{
+    for (;;) {
+        char *nl = memchr(lines->buf + lines->start, '\n', lines->len - lines->start);
+        if (nl != NULL) {
+            *nl = '\0';
+            const char *line = lines->buf + lines->start;
+            lines->start = (size_t) (nl - lines->buf) + 1;
+            return line;
+        }
+        memmove(lines->buf, lines->buf + lines->start, lines->len - lines->start);
+        lines->len -= lines->start;
+        lines->start = 0;
+        if (lines->len == sizeof(lines->buf)) return NULL;
+        const ssize_t n = read(lines->fd, lines->buf + lines->len, sizeof(lines->buf) - lines->len);
+        if (n <= 0) return NULL;
+        lines->len += (size_t) n;
+    }
+}
+
+int run_command(const char *path, int argc, char **argv)
+{
+    char command[SERVER_LINE_CAP];
+    size_t len = 0;
+    for (int i = 0; i < argc; ++i) {
+        const int n = snprintf(command + len, sizeof(command) - len, "%s%s", i > 0 ? " " : "", argv[i]);
+        if (n < 0 || (size_t) n >= sizeof(command) - len - 1) {
+            fprintf(stderr, "The command is too long\n");
+            exit(1);
+        }
+        len += (size_t) n;
+    }
+    command[len++] = '\n';
+
+    Lines lines = {.fd = connect_server(path)};
+    send_all(lines.fd, command, len);
+
+    // A subscriber keeps getting the notifications after the reply
+    const int follow = strcmp(argv[0], "subscribe") == 0;
+    const char *line;
+    while ((line = next_line(&lines)) != NULL) {
+        printf("%s\n", line);
+        fflush(stdout);
+        if (!follow) break;
+    }
+    close(lines.fd);
+    return line != NULL && strncmp(line, "error", 5) == 0;
+}
+
+int compare_u64(const void *a, const void *b)
+{
+    const uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+typedef struct {
+    int fd;
+    char buf[256];
+    size_t len;
+} LoadClient;
+
+// Every client subscribes to one of the timers, then all the timers get
+// started at once and every client waits for its `expired`
+int run_load_test(const char *path, int clients_count, int timers_count, double seconds)
+{
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    LoadClient *clients = calloc((size_t) clients_count, sizeof(*clients));
+    uint64_t *latencies = malloc(sizeof(*latencies) * (size_t) clients_count);
+    uint64_t *deadlines = malloc(sizeof(*deadlines) * (size_t) timers_count);
+    assert(clients != NULL && latencies != NULL && deadlines != NULL);
+
+    // Only existing timers can be subscribed to, so create them first as
+    // ascending ones. Starting them again later keeps the subscribers.
+    Lines control = {.fd = connect_server(path)};
+    size_t batch_cap = (size_t) timers_count * 48, batch_len = 0;
+    char *batch = malloc(batch_cap);
+    assert(batch != NULL);
+    for (int t = 0; t < timers_count; ++t) {
+        batch_len += (size_t) snprintf(batch + batch_len, batch_cap - batch_len, "start %d ascending\n", t + 1);
+    }
+    send_all(control.fd, batch, batch_len);
+    for (int t = 0; t < timers_count; ++t) next_line(&control);
+
+    // Subscribe everybody
+    uint64_t begin = now_ns();
+    for (int c = 0; c < clients_count; ++c) {
+        clients[c].fd = connect_server(path);
+        char line[64];
+        const int n = snprintf(line, sizeof(line), "subscribe %d\n", c % timers_count + 1);
+        send_all(clients[c].fd, line, (size_t) n);
+    }
+    for (int c = 0; c < clients_count; ++c) {
+        Lines lines = {.fd = clients[c].fd};
+        const char *reply = next_line(&lines);
+        if (reply == NULL || strcmp(reply, "ok") != 0) {
+            fprintf(stderr, "Client %d could not subscribe: %s\n", c, reply ? reply : "connection closed");
+            exit(1);
+        }
+        fcntl(clients[c].fd, F_SETFL, fcntl(clients[c].fd, F_GETFL) | O_NONBLOCK);
+    }
+    printf("%d clients connected and subscribed in %.1f ms\n", clients_count, (double) (now_ns() - begin) / 1e6);
+
+    // Start every timer, pipelined over one connection. Spread the
+    // expiries over 100 ms so they do not all land in the same tick.
+    batch_len = 0;
+    for (int t = 0; t < timers_count; ++t) {
+        const double duration = seconds + (double) (t % 100) / 1000.0;
+        batch_len += (size_t) snprintf(batch + batch_len, batch_cap - batch_len, "start %d %.3f\n", t + 1, duration);
+    }
+    begin = now_ns();
+    for (int t = 0; t < timers_count; ++t) {
+        deadlines[t] = begin + (uint64_t) ((seconds + (double) (t % 100) / 1000.0) * 1e9);
+    }
+    send_all(control.fd, batch, batch_len);
+    for (int t = 0; t < timers_count; ++t) {
+        const char *reply = next_line(&control);
+        if (reply == NULL || strcmp(reply, "ok") != 0) {
+            fprintf(stderr, "Could not start timer %d: %s\n", t + 1, reply ? reply : "connection closed");
+            exit(1);
+        }
+    }
+    const uint64_t started = now_ns();
+    printf("%d timers started in %.1f ms (%.0f commands/s)\n", timers_count,
+           (double) (started - begin) / 1e6, timers_count / ((double) (started - begin) / 1e9));
+
+    const int epoll = epoll_create1(0);
+    assert(epoll >= 0);
+    for (int c = 0; c < clients_count; ++c) {
+        struct epoll_event event = {.events = EPOLLIN, .data.u32 = (uint32_t) c};
+        epoll_ctl(epoll, EPOLL_CTL_ADD, clients[c].fd, &event);
+    }
+
+    int received = 0;
+    const uint64_t give_up = started + (uint64_t) ((seconds + 5.0) * 1e9);
+    while (received < clients_count && now_ns() < give_up) {
+        struct epoll_event events[256];
+        const int n = epoll_wait(epoll, events, 256, 100);
+        const uint64_t now = now_ns();
+        for (int i = 0; i < n; ++i) {
+            LoadClient *client = &clients[events[i].data.u32];
+            const ssize_t size = read(client->fd, client->buf + client->len, sizeof(client->buf) - client->len - 1);
+            if (size <= 0) continue;
+            client->len += (size_t) size;
+            client->buf[client->len] = '\0';
+            char *nl;
+            while ((nl = strchr(client->buf, '\n')) != NULL) {
+                *nl = '\0';
+                unsigned id;
+                if (sscanf(client->buf, "expired %u", &id) == 1 && id >= 1 && (int) id <= timers_count) {
+                    latencies[received++] = now > deadlines[id - 1] ? now - deadlines[id - 1] : 0;
+                }
+                const size_t rest = client->len - (size_t) (nl + 1 - client->buf);
+                memmove(client->buf, nl + 1, rest + 1);
+                client->len = rest;
+            }
+        }
+    }
+
+    printf("%d of %d expiry notifications received\n", received, clients_count);
+    if (received > 0) {
+        qsort(latencies, (size_t) received, sizeof(*latencies), compare_u64);
+        printf("latency after the deadline: p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+               (double) latencies[received / 2] / 1e6,
+               (double) latencies[(size_t) received * 99 / 100] / 1e6,
+               (double) latencies[received - 1] / 1e6);
+    }
+
+    for (int t = 0; t < timers_count; ++t) {
+        const int n = snprintf(batch, batch_cap, "stop %d\n", t + 1);
+        send_all(control.fd, batch, (size_t) n);
+        next_line(&control);
+    }
+    for (int c = 0; c < clients_count; ++c) close(clients[c].fd);
+    close(control.fd);
+    close(epoll);
+    free(batch);
+    free(deadlines);
+    free(latencies);
+    free(clients);
+    return received == clients_count ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: sowonctl <socket> <command> [args...]\n");
+        fprintf(stderr, "       sowonctl <socket> -l <clients> <timers> [seconds]\n");
+        fprintf(stderr, "    -l    load test: <clients> connections subscribe to <timers> countdowns\n");
+        fprintf(stderr, "          of [seconds] (default 1) and wait for their expiry\n");
+        fprintf(stderr, "ERROR: expected the socket path and a command\n");
+        exit(1);
+    }
+    const char *path = argv[1];
+
+    if (strcmp(argv[2], "-l") == 0) {
+        if (argc < 5 || atoi(argv[3]) <= 0 || atoi(argv[4]) <= 0) {
+            fprintf(stderr, "ERROR: expected the amount of clients and timers\n");
+            exit(1);
+        }
+        const double seconds = argc > 5 ? atof(argv[5]) : 1.0;
+        return run_load_test(path, atoi(argv[3]), atoi(argv[4]), seconds);
+    }
+
+    return run_command(path, argc - 2, argv + 2);
+}
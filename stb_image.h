@@ -37,7 +37,7 @@
 
       - decode from memory or through FILE (define STBI_NO_STDIO to remove code)
       - decode from arbitrary I/O callbacks
-      - SIMD acceleration on x86/x64 (SSE2) and ARM (NEON)
+      - SIMD acceleration on x86/x64 (SSE2, AVX2) and ARM (NEON)
 
    Full documentation under "DOCUMENTATION" below.
 
@@ -216,9 +216,9 @@ RECENT REVISION HISTORY:
 //
 // SIMD support
 //
-// The JPEG decoder will try to automatically use SIMD kernels on x86 when
-// supported by the compiler. For ARM Neon support, you must explicitly
-// request it.
+// The JPEG decoder and the PNG unfiltering of 8-bit RGB and RGBA images will
+// try to automatically use SIMD kernels on x86 when supported by the
+// compiler. For ARM Neon support, you must explicitly request it.
 //
 // (The old do-it-yourself SIMD API is no longer supported in the current
 // code.)
@@ -229,6 +229,11 @@ RECENT REVISION HISTORY:
 // (at least this is true for iOS and Android). Therefore, the NEON support is
 // toggled by a build flag: define STBI_NEON to get NEON loops.
 //
+// The JPEG IDCT, 2x2 chroma upsampling and YCbCr->RGBA conversion also have
+// AVX2 versions that are used instead of the SSE2 ones on CPUs (and OSes)
+// that support it. They don't need any extra compiler flags; define
+// STBI_NO_AVX2 to leave them out.
+//
 // If for some reason you do not want to use any of SIMD code, or if
 // you have issues compiling it, you can disable it entirely by
 // defining STBI_NO_SIMD.
@@ -318,6 +323,14 @@ RECENT REVISION HISTORY:
 //   - If you use STBI_NO_PNG (or _ONLY_ without PNG), and you still
 //     want the zlib decoder to be available, #define STBI_SUPPORT_ZLIB
 //
+//   - #define STBI_PNG_THREADS to inflate PNG files on several threads
+//     (pthreads, or Win32 threads on Windows). This only helps files
+//     whose zlib stream was written with full flushes: the pieces between
+//     them are decoded in parallel, and the rows get unfiltered as the
+//     pieces come in. Other files decode on the calling thread as usual.
+//     stbi_set_png_threads() picks the number of threads, by default one
+//     per CPU.
+//
 
 
 #ifndef STBI_NO_STDIO
@@ -456,6 +469,27 @@ STBIDEF int      stbi_is_16_bit          (char const *filename);
 STBIDEF int      stbi_is_16_bit_from_file(FILE *f);
 #endif
 
+#ifndef STBI_NO_PNG
+// streaming PNG interface: instead of returning the whole image, hands it
+// out one row at a time, so the decoder only ever holds a few rows and the
+// zlib window. rows have 8 bits per channel and desired_channels channels
+// (or *channels_in_file if that is 0). *x, *y and *channels_in_file are set
+// before the first row comes out. y is the index of the row in the image,
+// the rows come in file order, so bottom up when flipping. returning 0
+// from the callback stops the decode. interlaced images can't be unfiltered
+// row by row, those are decoded whole and then handed out.
+// returns 1 on success, 0 on failure (see stbi_failure_reason)
+typedef int stbi_png_row_callback(void *user, int y, const stbi_uc *row);
+
+STBIDEF int      stbi_png_stream_from_memory   (stbi_uc           const *buffer, int len   , int *x, int *y, int *channels_in_file, int desired_channels, stbi_png_row_callback *row, void *row_user);
+STBIDEF int      stbi_png_stream_from_callbacks(stbi_io_callbacks const *clbk  , void *user, int *x, int *y, int *channels_in_file, int desired_channels, stbi_png_row_callback *row, void *row_user);
+
+#ifndef STBI_NO_STDIO
+STBIDEF int      stbi_png_stream          (char const *filename, int *x, int *y, int *channels_in_file, int desired_channels, stbi_png_row_callback *row, void *row_user);
+STBIDEF int      stbi_png_stream_from_file(FILE *f,              int *x, int *y, int *channels_in_file, int desired_channels, stbi_png_row_callback *row, void *row_user);
+#endif
+#endif
+
 
 
 // for image formats that explicitly notate that they have premultiplied alpha,
@@ -470,6 +504,11 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+#ifdef STBI_PNG_THREADS
+// number of threads to decode a PNG on, 0 for one per CPU
+STBIDEF void stbi_set_png_threads(int thread_count);
+#endif
+
 // as above, but only applies to images loaded on the thread that calls the function
 // this function is only available if your compiler supports thread-local variables;
 // calling it will fail to link if your compiler doesn't
@@ -554,6 +593,18 @@ STBIDEF int   stbi_zlib_decode_noheader_buffer(char *obuffer, int olen, const ch
 #define STBI_ASSERT(x) assert(x)
 #endif
 
+#if defined(STBI_PNG_THREADS) && !defined(STBI_NO_PNG)
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 #ifdef __cplusplus
 #define STBI_EXTERN extern "C"
 #else
@@ -588,12 +639,14 @@ typedef unsigned short stbi__uint16;
 typedef   signed short stbi__int16;
 typedef unsigned int   stbi__uint32;
 typedef   signed int   stbi__int32;
+typedef unsigned __int64 stbi__uint64;
 #else
 #include <stdint.h>
 typedef uint16_t stbi__uint16;
 typedef int16_t  stbi__int16;
 typedef uint32_t stbi__uint32;
 typedef int32_t  stbi__int32;
+typedef uint64_t stbi__uint64;
 #endif
 
 // should produce compiler error if size is wrong
@@ -695,7 +748,7 @@ static int stbi__cpuid3(void)
 
 #define STBI_SIMD_ALIGN(type, name) __declspec(align(16)) type name
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if !(defined(STBI_NO_JPEG) && defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    int info3 = stbi__cpuid3();
@@ -706,7 +759,7 @@ static int stbi__sse2_available(void)
 #else // assume GCC-style if not VC++
 #define STBI_SIMD_ALIGN(type, name) type name __attribute__((aligned(16)))
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if !(defined(STBI_NO_JPEG) && defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    // If we're even attempting to compile this on GCC/Clang, that means
@@ -719,6 +772,58 @@ static int stbi__sse2_available(void)
 #endif
 #endif
 
+// AVX2 JPEG kernels. Unlike SSE2 these can't be assumed from the build
+// flags, so they are compiled for AVX2 one function at a time and only
+// selected after a run-time check of both the CPU and the OS.
+#if defined(STBI_SSE2) && !defined(STBI_NO_JPEG) && !defined(STBI_NO_AVX2)
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define STBI_AVX2
+#define STBI__AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && _MSC_VER >= 1700
+#define STBI_AVX2
+#define STBI__AVX2_TARGET
+#endif
+#endif
+
+#ifdef STBI_AVX2
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+static int stbi__avx2_available(void)
+{
+   int info[4];
+   unsigned int xcr0;
+   __cpuid(info,0);
+   if (info[0] < 7) return 0;
+   __cpuid(info,1);
+   // OSXSAVE and AVX, then ask the OS whether it saves the YMM state
+   if (((info[2] >> 27) & 3) != 3) return 0;
+#ifdef __clang__
+   __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (xcr0) : "c" (0) : "edx"); // xgetbv
+#else
+   xcr0 = (unsigned int) _xgetbv(0);
+#endif
+   if ((xcr0 & 6) != 6) return 0;
+   __cpuidex(info,7,0);
+   return (info[1] >> 5) & 1;
+}
+#else
+#include <cpuid.h>
+static int stbi__avx2_available(void)
+{
+   unsigned int a, b, c, d;
+   if (__get_cpuid_max(0, NULL) < 7) return 0;
+   __cpuid(1, a, b, c, d);
+   // OSXSAVE and AVX, then ask the OS whether it saves the YMM state
+   if (((c >> 27) & 3) != 3) return 0;
+   __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d) : "c" (0)); // xgetbv
+   if ((a & 6) != 6) return 0;
+   __cpuid_count(7, 0, a, b, c, d);
+   return (b >> 5) & 1;
+}
+#endif
+#endif
+
 // ARM NEON
 #if defined(STBI_NO_SIMD) && defined(STBI_NEON)
 #undef STBI_NEON
@@ -845,6 +950,7 @@ static int      stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp);
 static int      stbi__png_test(stbi__context *s);
 static void    *stbi__png_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri);
 static int      stbi__png_info(stbi__context *s, int *x, int *y, int *comp);
+static int      stbi__png_stream_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *user);
 static int      stbi__png_is16(stbi__context *s);
 #endif
 
@@ -1342,6 +1448,41 @@ STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk, void *u
    return stbi__load_and_postprocess_8bit(&s,x,y,comp,req_comp);
 }
 
+#ifndef STBI_NO_PNG
+STBIDEF int stbi_png_stream_from_memory(stbi_uc const *buffer, int len, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *row_user)
+{
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__png_stream_main(&s,x,y,comp,req_comp,row,row_user);
+}
+
+STBIDEF int stbi_png_stream_from_callbacks(stbi_io_callbacks const *clbk, void *user, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *row_user)
+{
+   stbi__context s;
+   stbi__start_callbacks(&s, (stbi_io_callbacks *) clbk, user);
+   return stbi__png_stream_main(&s,x,y,comp,req_comp,row,row_user);
+}
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_png_stream(char const *filename, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *row_user)
+{
+   FILE *f = stbi__fopen(filename, "rb");
+   int result;
+   if (!f) return stbi__err("can't fopen", "Unable to open file");
+   result = stbi_png_stream_from_file(f,x,y,comp,req_comp,row,row_user);
+   fclose(f);
+   return result;
+}
+
+STBIDEF int stbi_png_stream_from_file(FILE *f, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *row_user)
+{
+   stbi__context s;
+   stbi__start_file(&s,f);
+   return stbi__png_stream_main(&s,x,y,comp,req_comp,row,row_user);
+}
+#endif
+#endif
+
 #ifndef STBI_NO_GIF
 STBIDEF stbi_uc *stbi_load_gif_from_memory(stbi_uc const *buffer, int len, int **delays, int *x, int *y, int *z, int *comp, int req_comp)
 {
@@ -1651,9 +1792,35 @@ static stbi_uc stbi__compute_y(int r, int g, int b)
 #if defined(STBI_NO_PNG) && defined(STBI_NO_BMP) && defined(STBI_NO_PSD) && defined(STBI_NO_TGA) && defined(STBI_NO_GIF) && defined(STBI_NO_PIC) && defined(STBI_NO_PNM)
 // nothing
 #else
+// converts one row of x pixels from img_n to req_comp components
+static void stbi__convert_format_row(const unsigned char *src, unsigned char *dest, int img_n, int req_comp, unsigned int x)
+{
+   int i;
+   #define STBI__COMBO(a,b)  ((a)*8+(b))
+   #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
+   // convert source image with img_n components to one with req_comp components;
+   // avoid switch per pixel, so use switch per scanline and massive macros
+   switch (STBI__COMBO(img_n, req_comp)) {
+      STBI__CASE(1,2) { dest[0]=src[0]; dest[1]=255;                                     } break;
+      STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
+      STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=255;                     } break;
+      STBI__CASE(2,1) { dest[0]=src[0];                                                  } break;
+      STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
+      STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=src[1];                  } break;
+      STBI__CASE(3,4) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];dest[3]=255;        } break;
+      STBI__CASE(3,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(3,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]); dest[1] = 255;    } break;
+      STBI__CASE(4,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(4,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]); dest[1] = src[3]; } break;
+      STBI__CASE(4,3) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];                    } break;
+      default: STBI_ASSERT(0);
+   }
+   #undef STBI__CASE
+}
+
 static unsigned char *stbi__convert_format(unsigned char *data, int img_n, int req_comp, unsigned int x, unsigned int y)
 {
-   int i,j;
+   int j;
    unsigned char *good;
 
    if (req_comp == img_n) return data;
@@ -1665,31 +1832,8 @@ static unsigned char *stbi__convert_format(unsigned char *data, int img_n, int r
       return stbi__errpuc("outofmem", "Out of memory");
    }
 
-   for (j=0; j < (int) y; ++j) {
-      unsigned char *src  = data + j * x * img_n   ;
-      unsigned char *dest = good + j * x * req_comp;
-
-      #define STBI__COMBO(a,b)  ((a)*8+(b))
-      #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
-      // convert source image with img_n components to one with req_comp components;
-      // avoid switch per pixel, so use switch per scanline and massive macros
-      switch (STBI__COMBO(img_n, req_comp)) {
-         STBI__CASE(1,2) { dest[0]=src[0]; dest[1]=255;                                     } break;
-         STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
-         STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=255;                     } break;
-         STBI__CASE(2,1) { dest[0]=src[0];                                                  } break;
-         STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                  } break;
-         STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=src[1];                  } break;
-         STBI__CASE(3,4) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];dest[3]=255;        } break;
-         STBI__CASE(3,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(3,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]); dest[1] = 255;    } break;
-         STBI__CASE(4,1) { dest[0]=stbi__compute_y(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(4,2) { dest[0]=stbi__compute_y(src[0],src[1],src[2]); dest[1] = src[3]; } break;
-         STBI__CASE(4,3) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];                    } break;
-         default: STBI_ASSERT(0);
-      }
-      #undef STBI__CASE
-   }
+   for (j=0; j < (int) y; ++j)
+      stbi__convert_format_row(data + j * x * img_n, good + j * x * req_comp, img_n, req_comp, x);
 
    STBI_FREE(data);
    return good;
@@ -1708,9 +1852,34 @@ static stbi__uint16 stbi__compute_y_16(int r, int g, int b)
 #if defined(STBI_NO_PNG) && defined(STBI_NO_PSD)
 // nothing
 #else
+static void stbi__convert_format16_row(const stbi__uint16 *src, stbi__uint16 *dest, int img_n, int req_comp, unsigned int x)
+{
+   int i;
+   #define STBI__COMBO(a,b)  ((a)*8+(b))
+   #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
+   // convert source image with img_n components to one with req_comp components;
+   // avoid switch per pixel, so use switch per scanline and massive macros
+   switch (STBI__COMBO(img_n, req_comp)) {
+      STBI__CASE(1,2) { dest[0]=src[0]; dest[1]=0xffff;                                     } break;
+      STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                     } break;
+      STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=0xffff;                     } break;
+      STBI__CASE(2,1) { dest[0]=src[0];                                                     } break;
+      STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                     } break;
+      STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=src[1];                     } break;
+      STBI__CASE(3,4) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];dest[3]=0xffff;        } break;
+      STBI__CASE(3,1) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(3,2) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]); dest[1] = 0xffff; } break;
+      STBI__CASE(4,1) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]);                   } break;
+      STBI__CASE(4,2) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]); dest[1] = src[3]; } break;
+      STBI__CASE(4,3) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];                       } break;
+      default: STBI_ASSERT(0);
+   }
+   #undef STBI__CASE
+}
+
 static stbi__uint16 *stbi__convert_format16(stbi__uint16 *data, int img_n, int req_comp, unsigned int x, unsigned int y)
 {
-   int i,j;
+   int j;
    stbi__uint16 *good;
 
    if (req_comp == img_n) return data;
@@ -1722,31 +1891,8 @@ static stbi__uint16 *stbi__convert_format16(stbi__uint16 *data, int img_n, int r
       return (stbi__uint16 *) stbi__errpuc("outofmem", "Out of memory");
    }
 
-   for (j=0; j < (int) y; ++j) {
-      stbi__uint16 *src  = data + j * x * img_n   ;
-      stbi__uint16 *dest = good + j * x * req_comp;
-
-      #define STBI__COMBO(a,b)  ((a)*8+(b))
-      #define STBI__CASE(a,b)   case STBI__COMBO(a,b): for(i=x-1; i >= 0; --i, src += a, dest += b)
-      // convert source image with img_n components to one with req_comp components;
-      // avoid switch per pixel, so use switch per scanline and massive macros
-      switch (STBI__COMBO(img_n, req_comp)) {
-         STBI__CASE(1,2) { dest[0]=src[0]; dest[1]=0xffff;                                     } break;
-         STBI__CASE(1,3) { dest[0]=dest[1]=dest[2]=src[0];                                     } break;
-         STBI__CASE(1,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=0xffff;                     } break;
-         STBI__CASE(2,1) { dest[0]=src[0];                                                     } break;
-         STBI__CASE(2,3) { dest[0]=dest[1]=dest[2]=src[0];                                     } break;
-         STBI__CASE(2,4) { dest[0]=dest[1]=dest[2]=src[0]; dest[3]=src[1];                     } break;
-         STBI__CASE(3,4) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];dest[3]=0xffff;        } break;
-         STBI__CASE(3,1) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(3,2) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]); dest[1] = 0xffff; } break;
-         STBI__CASE(4,1) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]);                   } break;
-         STBI__CASE(4,2) { dest[0]=stbi__compute_y_16(src[0],src[1],src[2]); dest[1] = src[3]; } break;
-         STBI__CASE(4,3) { dest[0]=src[0];dest[1]=src[1];dest[2]=src[2];                       } break;
-         default: STBI_ASSERT(0);
-      }
-      #undef STBI__CASE
-   }
+   for (j=0; j < (int) y; ++j)
+      stbi__convert_format16_row(data + j * x * img_n, good + j * x * req_comp, img_n, req_comp, x);
 
    STBI_FREE(data);
    return good;
@@ -1826,7 +1972,7 @@ static stbi_uc *stbi__hdr_to_ldr(float   *data, int x, int y, int comp)
 //      - quality integer IDCT derived from IJG's 'slow'
 //    performance
 //      - fast huffman; reasonable integer IDCT
-//      - some SIMD kernels for common paths on targets with SSE2/NEON
+//      - some SIMD kernels for common paths on targets with SSE2/AVX2/NEON
 //      - uses a lot of intermediate memory, could cache poorly
 
 #ifndef STBI_NO_JPEG
@@ -2589,6 +2735,155 @@ static void stbi__idct_simd(stbi_uc *out, int out_stride, short data[64])
 
 #endif // STBI_SSE2
 
+#ifdef STBI_AVX2
+// avx2 integer IDCT. Same arithmetic as the SSE2 version, but every 1D pass
+// works on all 8 columns (or rows) at once: the rotations are folded so that
+// each even/odd output is two madds of coefficient pairs, which keeps the
+// shuffles down to the loads and one transpose. The only difference is that
+// the pair sums the SSE2 code forms in 16 bits (row0+row4, row1+row7, ...)
+// can't wrap here, which valid data never triggers.
+static STBI__AVX2_TARGET void stbi__idct_avx2(stbi_uc *out, int out_stride, short data[64])
+{
+   __m256i ea, eb, oa, ob;
+   __m256i o0, o1, o2, o3, o4, o5, o6, o7;
+
+   // dot product constant: even elems=x, odd elems=y
+   #define dct_const(x,y)  _mm256_setr_epi16((short) (x),(short) (y),(short) (x),(short) (y),(short) (x),(short) (y),(short) (x),(short) (y), \
+                                             (short) (x),(short) (y),(short) (x),(short) (y),(short) (x),(short) (y),(short) (x),(short) (y))
+
+   // two 128-bit loads into the low and high lane
+   #define dct_load2(lo,hi) \
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (lo))), _mm_loadu_si128((const __m128i *) (hi)), 1)
+
+   // out = a.b + c.d, each a dot product of 16-bit pairs
+   #define dct_dot2(out, a,b, c,d) \
+      __m256i out = _mm256_add_epi32(_mm256_madd_epi16((a), (b)), _mm256_madd_epi16((c), (d)))
+
+   // input pairs (0,2) (4,6) (1,3) (5,7) in ea/eb/oa/ob, results o0..o7
+   #define dct_pass(bias,shift) \
+      { \
+         /* even part */ \
+         dct_dot2(x0, ea, e0_a, eb, e0_b); \
+         dct_dot2(x1, ea, e1_a, eb, e1_b); \
+         dct_dot2(x2, ea, e2_a, eb, e2_b); \
+         dct_dot2(x3, ea, e3_a, eb, e3_b); \
+         /* odd part */ \
+         dct_dot2(x4, oa, o4_a, ob, o4_b); \
+         dct_dot2(x5, oa, o5_a, ob, o5_b); \
+         dct_dot2(x6, oa, o6_a, ob, o6_b); \
+         dct_dot2(x7, oa, o7_a, ob, o7_b); \
+         __m256i x0b = _mm256_add_epi32(x0, bias); \
+         __m256i x1b = _mm256_add_epi32(x1, bias); \
+         __m256i x2b = _mm256_add_epi32(x2, bias); \
+         __m256i x3b = _mm256_add_epi32(x3, bias); \
+         o0 = _mm256_srai_epi32(_mm256_add_epi32(x0b, x7), shift); \
+         o7 = _mm256_srai_epi32(_mm256_sub_epi32(x0b, x7), shift); \
+         o1 = _mm256_srai_epi32(_mm256_add_epi32(x1b, x6), shift); \
+         o6 = _mm256_srai_epi32(_mm256_sub_epi32(x1b, x6), shift); \
+         o2 = _mm256_srai_epi32(_mm256_add_epi32(x2b, x5), shift); \
+         o5 = _mm256_srai_epi32(_mm256_sub_epi32(x2b, x5), shift); \
+         o3 = _mm256_srai_epi32(_mm256_add_epi32(x3b, x4), shift); \
+         o4 = _mm256_srai_epi32(_mm256_sub_epi32(x3b, x4), shift); \
+      }
+
+   // the SSE2 rotations: t2e/t3e from (2,6), y0o/y2o from (7,3),
+   // y1o/y3o from (5,1) and y4o/y5o from (1+7,3+5)
+   int r0_0x = stbi__f2f(0.5411961f), r0_0y = stbi__f2f(0.5411961f) + stbi__f2f(-1.847759065f);
+   int r0_1x = stbi__f2f(0.5411961f) + stbi__f2f( 0.765366865f), r0_1y = stbi__f2f(0.5411961f);
+   int r1_0x = stbi__f2f(1.175875602f) + stbi__f2f(-0.899976223f), r1_0y = stbi__f2f(1.175875602f);
+   int r1_1x = stbi__f2f(1.175875602f), r1_1y = stbi__f2f(1.175875602f) + stbi__f2f(-2.562915447f);
+   int r2_0x = stbi__f2f(-1.961570560f) + stbi__f2f( 0.298631336f), r2_0y = stbi__f2f(-1.961570560f);
+   int r2_1x = stbi__f2f(-1.961570560f), r2_1y = stbi__f2f(-1.961570560f) + stbi__f2f( 3.072711026f);
+   int r3_0x = stbi__f2f(-0.390180644f) + stbi__f2f( 2.053119869f), r3_0y = stbi__f2f(-0.390180644f);
+   int r3_1x = stbi__f2f(-0.390180644f), r3_1y = stbi__f2f(-0.390180644f) + stbi__f2f( 1.501321110f);
+
+   // x0 = t0e+t3e, x1 = t1e+t2e, x2 = t1e-t2e, x3 = t0e-t3e
+   __m256i e0_a = dct_const(4096,  r0_1x), e0_b = dct_const( 4096,  r0_1y);
+   __m256i e1_a = dct_const(4096,  r0_0x), e1_b = dct_const(-4096,  r0_0y);
+   __m256i e2_a = dct_const(4096, -r0_0x), e2_b = dct_const(-4096, -r0_0y);
+   __m256i e3_a = dct_const(4096, -r0_1x), e3_b = dct_const( 4096, -r0_1y);
+   // x4 = y0o+y4o, x5 = y1o+y5o, x6 = y2o+y5o, x7 = y3o+y4o
+   __m256i o4_a = dct_const(r1_0x,         r2_0y + r1_0y), o4_b = dct_const(r1_0y,         r2_0x + r1_0x);
+   __m256i o5_a = dct_const(r3_0y + r1_1x, r1_1y),         o5_b = dct_const(r3_0x + r1_1y, r1_1x);
+   __m256i o6_a = dct_const(r1_1x,         r2_1y + r1_1y), o6_b = dct_const(r1_1y,         r2_1x + r1_1x);
+   __m256i o7_a = dct_const(r3_1y + r1_0x, r1_0y),         o7_b = dct_const(r3_1x + r1_0y, r1_0x);
+
+   // rounding biases in column/row passes, see stbi__idct_block for explanation.
+   __m256i bias_0 = _mm256_set1_epi32(512);
+   __m256i bias_1 = _mm256_set1_epi32(65536 + (128<<17));
+
+   // load: columns 0-3 in the low lane, 4-7 in the high lane. row 7 can't
+   // be read 4 past its start, so rows 5 and 7 use the high halves instead.
+   ea = _mm256_unpacklo_epi16(dct_load2(data + 0*8, data + 0*8+4), dct_load2(data + 2*8, data + 2*8+4));
+   eb = _mm256_unpacklo_epi16(dct_load2(data + 4*8, data + 4*8+4), dct_load2(data + 6*8, data + 6*8+4));
+   oa = _mm256_unpacklo_epi16(dct_load2(data + 1*8, data + 1*8+4), dct_load2(data + 3*8, data + 3*8+4));
+   ob = _mm256_unpackhi_epi16(dct_load2(data + 5*8-4, data + 5*8), dct_load2(data + 7*8-4, data + 7*8));
+
+   // column pass
+   dct_pass(bias_0, 10);
+
+   {
+      // pack rows to 16 bits and pair up columns (0,2) (1,3) per row
+      __m256i pair = _mm256_setr_epi8(0,1,4,5,2,3,6,7, 8,9,12,13,10,11,14,15, 0,1,4,5,2,3,6,7, 8,9,12,13,10,11,14,15);
+      __m256i k01 = _mm256_shuffle_epi8(_mm256_packs_epi32(o0, o1), pair);
+      __m256i k23 = _mm256_shuffle_epi8(_mm256_packs_epi32(o2, o3), pair);
+      __m256i k45 = _mm256_shuffle_epi8(_mm256_packs_epi32(o4, o5), pair);
+      __m256i k67 = _mm256_shuffle_epi8(_mm256_packs_epi32(o6, o7), pair);
+
+      // transpose the pairs; afterwards the low lane holds rows 0,2,4,6
+      // and the high lane rows 1,3,5,7
+      __m256i l0 = _mm256_unpacklo_epi32(k01, k23);
+      __m256i l1 = _mm256_unpackhi_epi32(k01, k23);
+      __m256i l2 = _mm256_unpacklo_epi32(k45, k67);
+      __m256i l3 = _mm256_unpackhi_epi32(k45, k67);
+      __m256i z0 = _mm256_unpacklo_epi64(l0, l2);
+      __m256i z1 = _mm256_unpackhi_epi64(l0, l2);
+      __m256i z2 = _mm256_unpacklo_epi64(l1, l3);
+      __m256i z3 = _mm256_unpackhi_epi64(l1, l3);
+      ea = _mm256_permute2x128_si256(z0, z2, 0x20);
+      eb = _mm256_permute2x128_si256(z0, z2, 0x31);
+      oa = _mm256_permute2x128_si256(z1, z3, 0x20);
+      ob = _mm256_permute2x128_si256(z1, z3, 0x31);
+   }
+
+   // row pass
+   dct_pass(bias_1, 17);
+
+   {
+      // pack to bytes: q0..q3 and q4..q7, 4 rows of each per lane
+      __m256i b0 = _mm256_packus_epi16(_mm256_packs_epi32(o0, o1), _mm256_packs_epi32(o2, o3));
+      __m256i b1 = _mm256_packus_epi16(_mm256_packs_epi32(o4, o5), _mm256_packs_epi32(o6, o7));
+
+      // 4x4 byte transpose in each lane, then join the two halves of each row
+      __m256i t = _mm256_setr_epi8(0,4,8,12, 1,5,9,13, 2,6,10,14, 3,7,11,15, 0,4,8,12, 1,5,9,13, 2,6,10,14, 3,7,11,15);
+      __m256i c0 = _mm256_shuffle_epi8(b0, t);
+      __m256i c1 = _mm256_shuffle_epi8(b1, t);
+      __m256i r0 = _mm256_unpacklo_epi32(c0, c1); // rows 0 2 | 1 3
+      __m256i r1 = _mm256_unpackhi_epi32(c0, c1); // rows 4 6 | 5 7
+      __m128i r02 = _mm256_castsi256_si128(r0);
+      __m128i r13 = _mm256_extracti128_si256(r0, 1);
+      __m128i r46 = _mm256_castsi256_si128(r1);
+      __m128i r57 = _mm256_extracti128_si256(r1, 1);
+
+      // store
+      _mm_storel_epi64((__m128i *) out, r02); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, r13); out += out_stride;
+      _mm_storeh_pi((__m64 *) out, _mm_castsi128_ps(r02)); out += out_stride;
+      _mm_storeh_pi((__m64 *) out, _mm_castsi128_ps(r13)); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, r46); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, r57); out += out_stride;
+      _mm_storeh_pi((__m64 *) out, _mm_castsi128_ps(r46)); out += out_stride;
+      _mm_storeh_pi((__m64 *) out, _mm_castsi128_ps(r57));
+   }
+
+#undef dct_const
+#undef dct_load2
+#undef dct_dot2
+#undef dct_pass
+}
+
+#endif // STBI_AVX2
+
 #ifdef STBI_NEON
 
 // NEON integer IDCT. should produce bit-identical
@@ -3499,6 +3794,75 @@ static stbi_uc *stbi__resample_row_hv_2_simd(stbi_uc *out, stbi_uc *in_near, stb
 }
 #endif
 
+#ifdef STBI_AVX2
+// same filter as stbi__resample_row_hv_2_simd, 16 pixels at a time
+static STBI__AVX2_TARGET stbi_uc *stbi__resample_row_hv_2_avx2(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
+{
+   int i=0,t0,t1;
+
+   if (w == 1) {
+      out[0] = out[1] = stbi__div4(3*in_near[0] + in_far[0] + 2);
+      return out;
+   }
+
+   t1 = 3*in_near[0] + in_far[0];
+   for (; i < ((w-1) & ~15); i += 16) {
+      // vertical pass: 3*x + y = 4*x + (y - x)
+      __m256i farw  = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_far + i)));
+      __m256i nearw = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_near + i)));
+      __m256i diff  = _mm256_sub_epi16(farw, nearw);
+      __m256i nears = _mm256_slli_epi16(nearw, 2);
+      __m256i curr  = _mm256_add_epi16(nears, diff); // current row
+
+      // "prev" and "next" are the current row shifted by one pixel, which
+      // crosses lanes: build the neighbouring lane (with t1 or the first
+      // pixel of the next block at the far end) and byte-align against it.
+      __m128i prvw = _mm_slli_si128(_mm_cvtsi32_si128(t1), 14);
+      __m128i nxtw = _mm_cvtsi32_si128(3*in_near[i+16] + in_far[i+16]);
+      __m256i prvl = _mm256_inserti128_si256(_mm256_castsi128_si256(prvw), _mm256_castsi256_si128(curr), 1);
+      __m256i nxtl = _mm256_permute2x128_si256(curr, _mm256_castsi128_si256(nxtw), 0x21);
+      __m256i prev = _mm256_alignr_epi8(curr, prvl, 14);
+      __m256i next = _mm256_alignr_epi8(nxtl, curr, 2);
+
+      // horizontal filter, polyphase as in the SSE2 version
+      __m256i bias = _mm256_set1_epi16(8);
+      __m256i curs = _mm256_slli_epi16(curr, 2);
+      __m256i prvd = _mm256_sub_epi16(prev, curr);
+      __m256i nxtd = _mm256_sub_epi16(next, curr);
+      __m256i curb = _mm256_add_epi16(curs, bias);
+      __m256i even = _mm256_add_epi16(prvd, curb);
+      __m256i odd  = _mm256_add_epi16(nxtd, curb);
+
+      // interleave even and odd pixels, then undo scaling. the in-lane
+      // unpacks and pack leave the 32 output bytes in order.
+      __m256i int0 = _mm256_unpacklo_epi16(even, odd);
+      __m256i int1 = _mm256_unpackhi_epi16(even, odd);
+      __m256i de0  = _mm256_srli_epi16(int0, 4);
+      __m256i de1  = _mm256_srli_epi16(int1, 4);
+      _mm256_storeu_si256((__m256i *) (out + i*2), _mm256_packus_epi16(de0, de1));
+
+      // "previous" value for next iter
+      t1 = 3*in_near[i+15] + in_far[i+15];
+   }
+
+   t0 = t1;
+   t1 = 3*in_near[i] + in_far[i];
+   out[i*2] = stbi__div16(3*t1 + t0 + 8);
+
+   for (++i; i < w; ++i) {
+      t0 = t1;
+      t1 = 3*in_near[i]+in_far[i];
+      out[i*2-1] = stbi__div16(3*t0 + t1 + 8);
+      out[i*2  ] = stbi__div16(3*t1 + t0 + 8);
+   }
+   out[w*2-1] = stbi__div4(t1+2);
+
+   STBI_NOTUSED(hs);
+
+   return out;
+}
+#endif
+
 static stbi_uc *stbi__resample_row_generic(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
 {
    // resample with nearest-neighbor
@@ -3673,6 +4037,73 @@ static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc cons
 }
 #endif
 
+#ifdef STBI_AVX2
+// the SSE2 converter 16 pixels at a time; it still does the tail and step != 4
+static STBI__AVX2_TARGET void stbi__YCbCr_to_RGB_avx2(stbi_uc *out, stbi_uc const *y, stbi_uc const *pcb, stbi_uc const *pcr, int count, int step)
+{
+   int i = 0;
+
+   if (step == 4) {
+      __m256i signflip  = _mm256_set1_epi8(-0x80);
+      __m256i cr_const0 = _mm256_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+      __m256i cr_const1 = _mm256_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+      __m256i cb_const0 = _mm256_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+      __m256i cb_const1 = _mm256_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+      __m256i y_bias = _mm256_set1_epi8((char) (unsigned char) 128);
+      __m256i xw = _mm256_set1_epi16(255); // alpha channel
+
+      for (; i+15 < count; i += 16) {
+         // load, and spread the bytes so that the in-lane unpacks below
+         // see pixels 0-7 in the low lane and 8-15 in the high lane
+         __m256i y_bytes  = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (y+i))), 0x50);
+         __m256i cr_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pcr+i))), 0x50);
+         __m256i cb_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pcb+i))), 0x50);
+         __m256i cr_biased = _mm256_xor_si256(cr_bytes, signflip); // -128
+         __m256i cb_biased = _mm256_xor_si256(cb_bytes, signflip); // -128
+
+         // unpack to short (and left-shift cr, cb by 8)
+         __m256i yw  = _mm256_unpacklo_epi8(y_bias, y_bytes);
+         __m256i crw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cr_biased);
+         __m256i cbw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cb_biased);
+
+         // color transform
+         __m256i yws = _mm256_srli_epi16(yw, 4);
+         __m256i cr0 = _mm256_mulhi_epi16(cr_const0, crw);
+         __m256i cb0 = _mm256_mulhi_epi16(cb_const0, cbw);
+         __m256i cb1 = _mm256_mulhi_epi16(cbw, cb_const1);
+         __m256i cr1 = _mm256_mulhi_epi16(crw, cr_const1);
+         __m256i rws = _mm256_add_epi16(cr0, yws);
+         __m256i gwt = _mm256_add_epi16(cb0, yws);
+         __m256i bws = _mm256_add_epi16(yws, cb1);
+         __m256i gws = _mm256_add_epi16(gwt, cr1);
+
+         // descale
+         __m256i rw = _mm256_srai_epi16(rws, 4);
+         __m256i bw = _mm256_srai_epi16(bws, 4);
+         __m256i gw = _mm256_srai_epi16(gws, 4);
+
+         // back to byte, set up for transpose
+         __m256i brb = _mm256_packus_epi16(rw, bw);
+         __m256i gxb = _mm256_packus_epi16(gw, xw);
+
+         // transpose to interleave channels; each lane ends up with 4+4
+         // pixels, so put the halves back in order on the way out
+         __m256i t0 = _mm256_unpacklo_epi8(brb, gxb);
+         __m256i t1 = _mm256_unpackhi_epi8(brb, gxb);
+         __m256i o0 = _mm256_unpacklo_epi16(t0, t1);
+         __m256i o1 = _mm256_unpackhi_epi16(t0, t1);
+
+         // store
+         _mm256_storeu_si256((__m256i *) (out + 0), _mm256_permute2x128_si256(o0, o1, 0x20));
+         _mm256_storeu_si256((__m256i *) (out + 32), _mm256_permute2x128_si256(o0, o1, 0x31));
+         out += 64;
+      }
+   }
+
+   stbi__YCbCr_to_RGB_simd(out, y+i, pcb+i, pcr+i, count-i, step);
+}
+#endif
+
 // set up the kernels
 static void stbi__setup_jpeg(stbi__jpeg *j)
 {
@@ -3688,6 +4119,14 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
    }
 #endif
 
+#ifdef STBI_AVX2
+   if (stbi__avx2_available()) {
+      j->idct_block_kernel = stbi__idct_avx2;
+      j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_avx2;
+      j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_avx2;
+   }
+#endif
+
 #ifdef STBI_NEON
    j->idct_block_kernel = stbi__idct_simd;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
@@ -3930,6 +4369,10 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 //      - all output is written to a single output buffer (can malloc/realloc)
 //    performance
 //      - fast huffman
+//      - 64-bit bit buffer, refilled a word at a time
+//      - literal/length table resolving a whole length or two literals
+//        per lookup
+//      - matches copied 8 bytes at a time
 
 #ifndef STBI_NO_ZLIB
 
@@ -3937,6 +4380,12 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 #define STBI__ZFAST_BITS  9 // accelerate all cases in default tables
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
 
+// wider tables of the block decoder, see stbi__zbuild_fast()
+#define STBI__ZLIT_BITS   11
+#define STBI__ZLIT_MASK   ((1 << STBI__ZLIT_BITS) - 1)
+#define STBI__ZDIST_BITS  10
+#define STBI__ZDIST_MASK  ((1 << STBI__ZDIST_BITS) - 1)
+
 // zlib-style huffman encoding
 // (jpegs packs from left, zlib from right, so can't share code)
 typedef struct
@@ -4017,42 +4466,90 @@ static int stbi__zbuild_huffman(stbi__zhuffman *z, const stbi_uc *sizelist, int
 //    because PNG allows splitting the zlib stream arbitrarily,
 //    and it's annoying structurally to have PNG call ZLIB call PNG,
 //    we require PNG read all the IDATs and combine them into a single
-//    memory buffer
+//    memory buffer. the streaming PNG loader gets around that with the
+//    read and flush callbacks below instead.
+
+// the largest distance a match can reach back
+#define STBI__ZWINDOW 32768
 
 typedef struct
 {
    stbi_uc *zbuffer, *zbuffer_end;
    int num_bits;
-   stbi__uint32 code_buffer;
+   stbi__uint64 code_buffer;
 
    char *zout;
    char *zout_start;
    char *zout_end;
    int   z_expandable;
+   int   zout_cap; // how far an expandable buffer may grow, 0 for no limit
+
+   // streaming: with read set, the input is refilled into zin through it
+   // whenever it runs low; with flush set, the output buffer is a window
+   // that gets handed to flush whenever it fills up, keeping the last
+   // STBI__ZWINDOW bytes for the matches to come
+   int (*read)(void *user, stbi_uc *data, int size);
+   int (*flush)(void *user, stbi_uc *data, int size);
+   void *stream_user;
+   stbi_uc *zin;
+   int zin_size;
+   int zin_overrun; // zero bytes made up past the end of the input
+   char *zout_flushed;
 
    stbi__zhuffman z_length, z_distance;
+   stbi__uint32 lit_fast[1 << STBI__ZLIT_BITS];
+   stbi__uint32 dist_fast[1 << STBI__ZDIST_BITS];
 } stbi__zbuf;
 
+// moves the unread input to the front of zin and reads more behind it
+static void stbi__zrefill(stbi__zbuf *z)
+{
+   int left = (int) (z->zbuffer_end - z->zbuffer);
+   memmove(z->zin, z->zbuffer, left);
+   z->zbuffer = z->zin;
+   z->zbuffer_end = z->zin + left + z->read(z->stream_user, z->zin + left, z->zin_size - left);
+}
+
 stbi_inline static stbi_uc stbi__zget8(stbi__zbuf *z)
 {
-   if (z->zbuffer >= z->zbuffer_end) return 0;
+   if (z->zbuffer >= z->zbuffer_end) {
+      if (z->read) stbi__zrefill(z);
+      if (z->zbuffer >= z->zbuffer_end) { ++z->zin_overrun; return 0; }
+   }
    return *z->zbuffer++;
 }
 
+// tops the bit buffer up to at least 56 bits; past the end of the input
+// it fills with zeros
 static void stbi__fill_bits(stbi__zbuf *z)
 {
-   do {
-      STBI_ASSERT(z->code_buffer < (1U << z->num_bits));
-      z->code_buffer |= (unsigned int) stbi__zget8(z) << z->num_bits;
-      z->num_bits += 8;
-   } while (z->num_bits <= 24);
+   STBI_ASSERT(z->num_bits >= 64 || z->code_buffer < ((stbi__uint64) 1 << z->num_bits));
+   if (z->zbuffer_end - z->zbuffer < 8 && z->read) stbi__zrefill(z);
+   if (z->zbuffer_end - z->zbuffer >= 8) {
+      // take as many whole bytes of the next 8 as fit
+      stbi_uc *p = z->zbuffer;
+      int n = (63 - z->num_bits) >> 3;
+      stbi__uint64 word = (stbi__uint64) p[0]       | (stbi__uint64) p[1] <<  8 |
+                          (stbi__uint64) p[2] << 16 | (stbi__uint64) p[3] << 24 |
+                          (stbi__uint64) p[4] << 32 | (stbi__uint64) p[5] << 40 |
+                          (stbi__uint64) p[6] << 48 | (stbi__uint64) p[7] << 56;
+      word &= ((stbi__uint64) 1 << (n * 8)) - 1;
+      z->code_buffer |= word << z->num_bits;
+      z->num_bits += n * 8;
+      z->zbuffer += n;
+   } else {
+      while (z->num_bits <= 56) {
+         z->code_buffer |= (stbi__uint64) stbi__zget8(z) << z->num_bits;
+         z->num_bits += 8;
+      }
+   }
 }
 
 stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
 {
    unsigned int k;
    if (z->num_bits < n) stbi__fill_bits(z);
-   k = z->code_buffer & ((1 << n) - 1);
+   k = (unsigned int) (z->code_buffer & ((1 << n) - 1));
    z->code_buffer >>= n;
    z->num_bits -= n;
    return k;
@@ -4063,7 +4560,7 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    int b,s,k;
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse((int) (a->code_buffer & 0xffff), 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -4080,7 +4577,7 @@ stbi_inline static int stbi__zhuffman_decode(stbi__zbuf *a, stbi__zhuffman *z)
 {
    int b,s;
    if (a->num_bits < 16) stbi__fill_bits(a);
-   b = z->fast[a->code_buffer & STBI__ZFAST_MASK];
+   b = z->fast[(int) (a->code_buffer & STBI__ZFAST_MASK)];
    if (b) {
       s = b >> 9;
       a->code_buffer >>= s;
@@ -4095,11 +4592,27 @@ static int stbi__zexpand(stbi__zbuf *z, char *zout, int n)  // need to make room
    char *q;
    int cur, limit, old_limit;
    z->zout = zout;
+   if (z->flush) {
+      // hand out the new output, then slide the window down
+      int keep = (int) (zout - z->zout_start);
+      // the made up zeros may decode to output forever, stop at the first bit of them
+      if (z->zin_overrun*8 > z->num_bits) return stbi__err("outofdata","Corrupt PNG");
+      if (!z->flush(z->stream_user, (stbi_uc *) z->zout_flushed, (int) (zout - z->zout_flushed))) return 0;
+      if (keep > STBI__ZWINDOW) keep = STBI__ZWINDOW;
+      memmove(z->zout_start, zout - keep, keep);
+      z->zout = z->zout_flushed = z->zout_start + keep;
+      if (z->zout_end - z->zout < n) return stbi__err("output buffer limit","Corrupt PNG");
+      return 1;
+   }
    if (!z->z_expandable) return stbi__err("output buffer limit","Corrupt PNG");
    cur   = (int) (z->zout     - z->zout_start);
    limit = old_limit = (int) (z->zout_end - z->zout_start);
    while (cur + n > limit)
       limit *= 2;
+   if (z->zout_cap && limit > z->zout_cap) {
+      if (cur + n > z->zout_cap) return stbi__err("output buffer limit","Corrupt PNG");
+      limit = z->zout_cap;
+   }
    q = (char *) STBI_REALLOC_SIZED(z->zout_start, old_limit, limit);
    STBI_NOTUSED(old_limit);
    if (q == NULL) return stbi__err("outofmem", "Out of memory");
@@ -4123,21 +4636,173 @@ static const int stbi__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129
 static const int stbi__zdist_extra[32] =
 { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
 
+// Entries of lit_fast and dist_fast, indexed by the next STBI__ZLIT_BITS or
+// STBI__ZDIST_BITS bits of the stream. 0 means the code is longer than the
+// table (or an invalid symbol) and goes the slow way.
+//   bits 0-3  bits taken by the code(s)
+//   bits 4-5  lit_fast: STBI__ZLIT, STBI__ZLEN or STBI__ZEND
+//   bit  6    lit_fast: two literals
+//   bits 8-15 literal / extra bits of the length or distance
+//   bits 16-  second literal / length or distance base
+#define STBI__ZLIT   0x10
+#define STBI__ZLEN   0x20
+#define STBI__ZEND   0x30
+#define STBI__ZKIND  0x30
+#define STBI__ZPAIR  0x40
+
+static stbi__uint32 stbi__zfast_entry(int symbol, int is_dist)
+{
+   if (is_dist) {
+      if (symbol >= 30) return 0;
+      return (stbi__uint32) stbi__zdist_extra[symbol] << 8 | (stbi__uint32) stbi__zdist_base[symbol] << 16;
+   }
+   if (symbol < 256) return STBI__ZLIT | (stbi__uint32) symbol << 8;
+   if (symbol == 256) return STBI__ZEND;
+   if (symbol >= 286) return 0;
+   symbol -= 257;
+   return STBI__ZLEN | (stbi__uint32) stbi__zlength_extra[symbol] << 8 | (stbi__uint32) stbi__zlength_base[symbol] << 16;
+}
+
+// Same canonical codes as stbi__zbuild_huffman(), which has already
+// checked the sizes, but every entry says what to do with the symbol. For
+// the literal/length alphabet a literal whose code leaves room for the
+// code of another literal gets both.
+static void stbi__zbuild_fast(stbi__uint32 *fast, int bits, const stbi_uc *sizelist, int num, int is_dist)
+{
+   int i, j, code, next_code[16], sizes[17];
+   memset(sizes, 0, sizeof(sizes));
+   memset(fast, 0, sizeof(*fast) << bits);
+   for (i=0; i < num; ++i)
+      ++sizes[sizelist[i]];
+   sizes[0] = 0;
+   code = 0;
+   for (i=1; i < 16; ++i) {
+      next_code[i] = code;
+      code = (code + sizes[i]) << 1;
+   }
+   for (i=0; i < num; ++i) {
+      int s = sizelist[i];
+      if (s) {
+         if (s <= bits) {
+            stbi__uint32 entry = stbi__zfast_entry(i, is_dist);
+            if (entry) entry |= (stbi__uint32) s;
+            for (j = stbi__bit_reverse(next_code[s],s); j < (1 << bits); j += (1 << s))
+               fast[j] = entry;
+         }
+         ++next_code[s];
+      }
+   }
+   if (is_dist) return;
+
+   // downwards, so fast[j >> s] is still a single symbol
+   for (j=(1 << bits)-1; j > 0; --j) {
+      stbi__uint32 first = fast[j], second;
+      int s = first & 15;
+      if ((first & STBI__ZKIND) != STBI__ZLIT) continue;
+      second = fast[j >> s];
+      if ((second & STBI__ZKIND) == STBI__ZLIT && s + (int) (second & 15) <= bits)
+         fast[j] = STBI__ZLIT | STBI__ZPAIR | (first & 0xff00) | (second & 0xff00) << 8 | (stbi__uint32) (s + (int) (second & 15));
+   }
+}
+
+static int stbi__zbuild_tables(stbi__zbuf *a, const stbi_uc *lengths, int hlit, const stbi_uc *distances, int hdist)
+{
+   if (!stbi__zbuild_huffman(&a->z_length, lengths, hlit)) return 0;
+   if (!stbi__zbuild_huffman(&a->z_distance, distances, hdist)) return 0;
+   stbi__zbuild_fast(a->lit_fast, STBI__ZLIT_BITS, lengths, hlit, 0);
+   stbi__zbuild_fast(a->dist_fast, STBI__ZDIST_BITS, distances, hdist, 1);
+   return 1;
+}
+
+// Copies a match of len bytes from dist bytes back, 8 or 16 bytes at a
+// time. It may write up to STBI__ZCOPY_SLACK-1 bytes past the end of the
+// match.
+#define STBI__ZCOPY_SLACK 16
+static char *stbi__zcopy_match(char *zout, int dist, int len)
+{
+   char *end = zout + len;
+   const char *p = zout - dist;
+   if (dist == 1) { // run of one byte; common in images.
+      memset(zout, *p, len);
+      return end;
+   }
+   if (dist >= 16) {
+      do {
+         memcpy(zout, p, 16);
+         zout += 16;
+         p += 16;
+      } while (zout < end);
+      return end;
+   }
+   if (dist < 8) {
+      // the match repeats every dist bytes, so also every multiple of it:
+      // go byte by byte until a multiple of at least 8 is behind
+      int period = dist * ((8 + dist - 1) / dist);
+      int head = period - dist;
+      while (head-- > 0 && zout < end)
+         *zout++ = *p++;
+      p = zout - period;
+   }
+   while (zout < end) {
+      memcpy(zout, p, 8);
+      zout += 8;
+      p += 8;
+   }
+   return end;
+}
+
 static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
-      if (z < 256) {
-         if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
-         if (zout >= a->zout_end) {
-            if (!stbi__zexpand(a, zout, 1)) return 0;
-            zout = a->zout;
+      stbi__uint32 e;
+      int len,dist;
+      // the longest length and distance with their extra bits are 48 bits
+      if (a->num_bits < 48) stbi__fill_bits(a);
+      e = a->lit_fast[(int) (a->code_buffer & STBI__ZLIT_MASK)];
+      if ((e & STBI__ZKIND) == STBI__ZLIT) {
+         a->code_buffer >>= e & 15;
+         a->num_bits -= e & 15;
+         if (a->zout_end - zout < 2) {
+            int n = (e & STBI__ZPAIR) ? 2 : 1;
+            if (a->zout_end - zout < n) {
+               if (!stbi__zexpand(a, zout, n)) return 0;
+               zout = a->zout;
+            }
+            if (a->zout_end - zout < 2) { // exactly one byte left for one literal
+               *zout++ = (char) (e >> 8);
+               continue;
+            }
+         }
+         zout[0] = (char) (e >> 8);
+         zout[1] = (char) (e >> 16);
+         zout += (e & STBI__ZPAIR) ? 2 : 1;
+         continue;
+      }
+
+      if (e) {
+         if ((e & STBI__ZKIND) == STBI__ZEND) {
+            a->code_buffer >>= e & 15;
+            a->num_bits -= e & 15;
+            a->zout = zout;
+            return 1;
          }
-         *zout++ = (char) z;
+         a->code_buffer >>= e & 15;
+         a->num_bits -= e & 15;
+         len = (int) (e >> 16) + (int) (a->code_buffer & ((1 << ((e >> 8) & 15)) - 1));
+         a->code_buffer >>= (e >> 8) & 15;
+         a->num_bits -= (e >> 8) & 15;
       } else {
-         stbi_uc *p;
-         int len,dist;
+         int z = stbi__zhuffman_decode(a, &a->z_length);
+         if (z < 0 || z >= 286) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
+         if (z < 256) {
+            if (zout >= a->zout_end) {
+               if (!stbi__zexpand(a, zout, 1)) return 0;
+               zout = a->zout;
+            }
+            *zout++ = (char) z;
+            continue;
+         }
          if (z == 256) {
             a->zout = zout;
             return 1;
@@ -4145,22 +4810,32 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
          z -= 257;
          len = stbi__zlength_base[z];
          if (stbi__zlength_extra[z]) len += stbi__zreceive(a, stbi__zlength_extra[z]);
-         z = stbi__zhuffman_decode(a, &a->z_distance);
-         if (z < 0) return stbi__err("bad huffman code","Corrupt PNG");
+      }
+
+      e = a->dist_fast[(int) (a->code_buffer & STBI__ZDIST_MASK)];
+      if (e) {
+         a->code_buffer >>= e & 15;
+         a->num_bits -= e & 15;
+         dist = (int) (e >> 16) + (int) (a->code_buffer & ((1 << ((e >> 8) & 15)) - 1));
+         a->code_buffer >>= (e >> 8) & 15;
+         a->num_bits -= (e >> 8) & 15;
+      } else {
+         int z = stbi__zhuffman_decode(a, &a->z_distance);
+         if (z < 0 || z >= 30) return stbi__err("bad huffman code","Corrupt PNG");
          dist = stbi__zdist_base[z];
          if (stbi__zdist_extra[z]) dist += stbi__zreceive(a, stbi__zdist_extra[z]);
-         if (zout - a->zout_start < dist) return stbi__err("bad dist","Corrupt PNG");
-         if (zout + len > a->zout_end) {
-            if (!stbi__zexpand(a, zout, len)) return 0;
-            zout = a->zout;
-         }
-         p = (stbi_uc *) (zout - dist);
-         if (dist == 1) { // run of one byte; common in images.
-            stbi_uc v = *p;
-            if (len) { do *zout++ = v; while (--len); }
-         } else {
-            if (len) { do *zout++ = *p++; while (--len); }
-         }
+      }
+
+      if (zout - a->zout_start < dist) return stbi__err("bad dist","Corrupt PNG");
+      if (zout + len > a->zout_end) {
+         if (!stbi__zexpand(a, zout, len)) return 0;
+         zout = a->zout;
+      }
+      if (a->zout_end - zout >= len + STBI__ZCOPY_SLACK) {
+         zout = stbi__zcopy_match(zout, dist, len);
+      } else { // too close to the end of the buffer to write past the match
+         stbi_uc *p = (stbi_uc *) (zout - dist);
+         do *zout++ = *p++; while (--len);
       }
    }
 }
@@ -4209,37 +4884,58 @@ static int stbi__compute_huffman_codes(stbi__zbuf *a)
       }
    }
    if (n != ntot) return stbi__err("bad codelengths","Corrupt PNG");
-   if (!stbi__zbuild_huffman(&a->z_length, lencodes, hlit)) return 0;
-   if (!stbi__zbuild_huffman(&a->z_distance, lencodes+hlit, hdist)) return 0;
-   return 1;
+   return stbi__zbuild_tables(a, lencodes, hlit, lencodes+hlit, hdist);
 }
 
 static int stbi__parse_uncompressed_block(stbi__zbuf *a)
 {
    stbi_uc header[4];
-   int len,nlen,k;
+   int len,nlen,k,buffered;
    if (a->num_bits & 7)
       stbi__zreceive(a, a->num_bits & 7); // discard
    // drain the bit-packed data into header
    k = 0;
-   while (a->num_bits > 0) {
+   while (a->num_bits > 0 && k < 4) {
       header[k++] = (stbi_uc) (a->code_buffer & 255); // suppress MSVC run-time check
       a->code_buffer >>= 8;
       a->num_bits -= 8;
    }
-   STBI_ASSERT(a->num_bits == 0);
    // now fill header the normal way
    while (k < 4)
       header[k++] = stbi__zget8(a);
    len  = header[1] * 256 + header[0];
    nlen = header[3] * 256 + header[2];
    if (nlen != (len ^ 0xffff)) return stbi__err("zlib corrupt","Corrupt PNG");
-   if (a->zbuffer + len > a->zbuffer_end) return stbi__err("read past buffer","Corrupt PNG");
-   if (a->zout + len > a->zout_end)
-      if (!stbi__zexpand(a, a->zout, len)) return 0;
-   memcpy(a->zout, a->zbuffer, len);
-   a->zbuffer += len;
-   a->zout += len;
+   buffered = a->num_bits / 8;
+   if (!a->read && len > buffered && a->zbuffer_end - a->zbuffer < len - buffered) return stbi__err("read past buffer","Corrupt PNG");
+   while (len > 0) {
+      // a window takes the block in pieces it has room for
+      int n = (a->flush && len > STBI__ZWINDOW) ? STBI__ZWINDOW : len;
+      if (a->zout + n > a->zout_end)
+         if (!stbi__zexpand(a, a->zout, n)) return 0;
+      len -= n;
+      // the bit buffer holds the first bytes, the rest of the block after
+      // them stays there for the next block
+      while (a->num_bits > 0 && n > 0) {
+         *a->zout++ = (char) (a->code_buffer & 255);
+         a->code_buffer >>= 8;
+         a->num_bits -= 8;
+         --n;
+      }
+      while (n > 0) {
+         int avail = (int) (a->zbuffer_end - a->zbuffer);
+         if (avail == 0 && a->read) {
+            stbi__zrefill(a);
+            avail = (int) (a->zbuffer_end - a->zbuffer);
+         }
+         if (avail == 0) return stbi__err("read past buffer","Corrupt PNG");
+         if (avail > n) avail = n;
+         memcpy(a->zout, a->zbuffer, avail);
+         a->zbuffer += avail;
+         a->zout += avail;
+         n -= avail;
+      }
+   }
    return 1;
 }
 
@@ -4302,8 +4998,7 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
       } else {
          if (type == 1) {
             // use fixed code lengths
-            if (!stbi__zbuild_huffman(&a->z_length  , stbi__zdefault_length  , 288)) return 0;
-            if (!stbi__zbuild_huffman(&a->z_distance, stbi__zdefault_distance,  32)) return 0;
+            if (!stbi__zbuild_tables(a, stbi__zdefault_length, 288, stbi__zdefault_distance, 32)) return 0;
          } else {
             if (!stbi__compute_huffman_codes(a)) return 0;
          }
@@ -4313,12 +5008,56 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
    return 1;
 }
 
+#if defined(STBI_PNG_THREADS) && !defined(STBI_NO_PNG)
+// decodes a piece of a zlib stream that starts where the previous piece
+// ended on a block boundary. unless it's the last one, the piece has to
+// end with a stored block right at end, which is what a full flush writes;
+// back references to before the start of a piece fail the "bad dist"
+// check, so a piece that decodes is independent of the ones before it
+static int stbi__parse_zlib_piece(stbi__zbuf *a, int parse_header, stbi_uc *end, int last)
+{
+   stbi_uc *start = a->zbuffer;
+   int final, type;
+   if (parse_header)
+      if (!stbi__parse_zlib_header(a)) return 0;
+   a->num_bits = 0;
+   a->code_buffer = 0;
+   do {
+      ptrdiff_t used;
+      final = stbi__zreceive(a,1);
+      type = stbi__zreceive(a,2);
+      if (type == 0) {
+         if (!stbi__parse_uncompressed_block(a)) return 0;
+      } else if (type == 3) {
+         return 0;
+      } else {
+         if (type == 1) {
+            if (!stbi__zbuild_tables(a, stbi__zdefault_length, 288, stbi__zdefault_distance, 32)) return 0;
+         } else {
+            if (!stbi__compute_huffman_codes(a)) return 0;
+         }
+         if (!stbi__parse_huffman_block(a)) return 0;
+      }
+      if (last) continue;
+      // bits taken out of the input so far
+      used = (a->zbuffer - start) * 8 - a->num_bits;
+      if (used >= (end - start) * 8)
+         return !final && type == 0 && used == (end - start) * 8;
+   } while (!final);
+   return last;
+}
+#endif
+
 static int stbi__do_zlib(stbi__zbuf *a, char *obuf, int olen, int exp, int parse_header)
 {
    a->zout_start = obuf;
    a->zout       = obuf;
    a->zout_end   = obuf + olen;
    a->z_expandable = exp;
+   a->zout_cap = 0;
+   a->zin_overrun = 0;
+   a->read = NULL;
+   a->flush = NULL;
 
    return stbi__parse_zlib(a, parse_header);
 }
@@ -4433,11 +5172,23 @@ static int stbi__check_png_header(stbi__context *s)
    return 1;
 }
 
+// where the streaming interface sends its rows
 typedef struct
 {
-   stbi__context *s;
+   stbi_png_row_callback *row;
+   void *user;
+   int *x, *y, *comp;
+   int req_comp;
+   stbi_uc *pixels; // a row converted to req_comp
+   stbi__uint32 next; // rows handed out so far
+} stbi__png_rows;
+
+typedef struct
+{
+   stbi__context *s;
    stbi_uc *idata, *expanded, *out;
    int depth;
+   stbi__png_rows *rows; // set when streaming
 } stbi__png;
 
 
@@ -4472,218 +5223,501 @@ static int stbi__paeth(int a, int b, int c)
    return c;
 }
 
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+// SIMD unfiltering of 8-bit RGB and RGBA rows. The filters that depend on
+// the pixel to the left go one pixel per step, all channels at once in the
+// low lanes, instead of one byte per step. 'up' has no such dependency and
+// runs 16 bytes at a time when the pixels keep their size.
+//
+// cur, prior and raw point past the first pixel of the row, which the
+// scalar code has already done. img_n is 3 or 4, out_n is img_n or img_n+1
+// (then the added alpha is 255). Pixels are moved as 4 bytes, except the
+// last one of the row, which would reach past the end of raw or cur.
+// Returns 0 for the filters left to the scalar code.
+
+#ifdef STBI_SSE2
+static __m128i stbi__png_load_px(const stbi_uc *p, int n)
+{
+   int v = 0;
+   if (n == 4) memcpy(&v, p, 4);
+   else        memcpy(&v, p, 3);
+   return _mm_cvtsi32_si128(v);
+}
+
+static void stbi__png_store_px(stbi_uc *p, __m128i px, int n)
+{
+   int v = _mm_cvtsi128_si32(px);
+   if (n == 4) memcpy(p, &v, 4);
+   else        memcpy(p, &v, 3);
+}
+
+// same choice as stbi__paeth() in every lane, ties go to a, then b
+static __m128i stbi__paeth_simd(__m128i a, __m128i b, __m128i c)
+{
+   __m128i zero = _mm_setzero_si128();
+   __m128i a16 = _mm_unpacklo_epi8(a, zero);
+   __m128i b16 = _mm_unpacklo_epi8(b, zero);
+   __m128i c16 = _mm_unpacklo_epi8(c, zero);
+   __m128i pa = _mm_sub_epi16(b16, c16); // p-a
+   __m128i pb = _mm_sub_epi16(a16, c16); // p-b
+   __m128i pc = _mm_add_epi16(pa, pb);   // p-c
+   __m128i not_a, pick_c, bc;
+   pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+   pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+   pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+   not_a  = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+   pick_c = _mm_cmpgt_epi16(pb, pc);
+   bc = _mm_or_si128(_mm_and_si128(pick_c, c16), _mm_andnot_si128(pick_c, b16));
+   return _mm_packus_epi16(_mm_or_si128(_mm_and_si128(not_a, bc), _mm_andnot_si128(not_a, a16)), zero);
+}
+
+static int stbi__png_unfilter_simd(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int img_n, int out_n, stbi__uint32 count)
+{
+   __m128i alpha = img_n != out_n ? _mm_slli_epi32(_mm_cvtsi32_si128(255), 24) : _mm_setzero_si128();
+   __m128i a, b, c, x;
+   stbi__uint32 i;
+   if (count == 0) return 1;
+
+   switch (filter) {
+      case STBI__F_up:
+         if (img_n == out_n) {
+            stbi__uint32 k, nk = count * img_n;
+            for (k=0; k+16 <= nk; k += 16) {
+               x = _mm_loadu_si128((const __m128i *) (raw + k));
+               b = _mm_loadu_si128((const __m128i *) (prior + k));
+               _mm_storeu_si128((__m128i *) (cur + k), _mm_add_epi8(x, b));
+            }
+            for (; k < nk; ++k)
+               cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+            return 1;
+         }
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            stbi__png_store_px(cur, _mm_or_si128(_mm_add_epi8(x, b), alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_sub:
+      case STBI__F_paeth_first: // paeth(a,0,0) is a
+         a = stbi__png_load_px(cur - out_n, out_n);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            a = _mm_add_epi8(x, a);
+            stbi__png_store_px(cur, _mm_or_si128(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_avg:
+         a = stbi__png_load_px(cur - out_n, out_n);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            // _mm_avg_epu8 rounds up, the filter rounds down
+            c = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+            a = _mm_add_epi8(x, c);
+            stbi__png_store_px(cur, _mm_or_si128(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_paeth:
+         a = stbi__png_load_px(cur - out_n, out_n);
+         c = stbi__png_load_px(prior - out_n, 4);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            a = _mm_add_epi8(x, stbi__paeth_simd(a, b, c));
+            c = b;
+            stbi__png_store_px(cur, _mm_or_si128(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+   }
+   return 0;
+}
+#endif // STBI_SSE2
+
+#ifdef STBI_NEON
+static uint8x8_t stbi__png_load_px(const stbi_uc *p, int n)
+{
+   stbi__uint32 v = 0;
+   if (n == 4) memcpy(&v, p, 4);
+   else        memcpy(&v, p, 3);
+   return vreinterpret_u8_u32(vdup_n_u32(v));
+}
+
+static void stbi__png_store_px(stbi_uc *p, uint8x8_t px, int n)
+{
+   stbi__uint32 v = vget_lane_u32(vreinterpret_u32_u8(px), 0);
+   if (n == 4) memcpy(p, &v, 4);
+   else        memcpy(p, &v, 3);
+}
+
+// same choice as stbi__paeth() in every lane, ties go to a, then b
+static uint8x8_t stbi__paeth_simd(uint8x8_t a, uint8x8_t b, uint8x8_t c)
+{
+   uint16x8_t pa = vabdl_u8(b, c);                                // |p-a|
+   uint16x8_t pb = vabdl_u8(a, c);                                // |p-b|
+   uint16x8_t pc = vabdq_u16(vaddl_u8(a, b), vshll_n_u8(c, 1));   // |p-c|
+   uint8x8_t not_a  = vmovn_u16(vorrq_u16(vcgtq_u16(pa, pb), vcgtq_u16(pa, pc)));
+   uint8x8_t pick_c = vmovn_u16(vcgtq_u16(pb, pc));
+   return vbsl_u8(not_a, vbsl_u8(pick_c, c, b), a);
+}
+
+static int stbi__png_unfilter_simd(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int img_n, int out_n, stbi__uint32 count)
+{
+   uint8x8_t alpha = vreinterpret_u8_u32(vdup_n_u32(img_n != out_n ? 0xff000000u : 0));
+   uint8x8_t a, b, c, x;
+   stbi__uint32 i;
+   if (count == 0) return 1;
+
+   switch (filter) {
+      case STBI__F_up:
+         if (img_n == out_n) {
+            stbi__uint32 k, nk = count * img_n;
+            for (k=0; k+16 <= nk; k += 16)
+               vst1q_u8(cur + k, vaddq_u8(vld1q_u8(raw + k), vld1q_u8(prior + k)));
+            for (; k < nk; ++k)
+               cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+            return 1;
+         }
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            stbi__png_store_px(cur, vorr_u8(vadd_u8(x, b), alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_sub:
+      case STBI__F_paeth_first: // paeth(a,0,0) is a
+         a = stbi__png_load_px(cur - out_n, out_n);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            a = vadd_u8(x, a);
+            stbi__png_store_px(cur, vorr_u8(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_avg:
+         a = stbi__png_load_px(cur - out_n, out_n);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            a = vadd_u8(x, vhadd_u8(a, b));
+            stbi__png_store_px(cur, vorr_u8(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+
+      case STBI__F_paeth:
+         a = stbi__png_load_px(cur - out_n, out_n);
+         c = stbi__png_load_px(prior - out_n, 4);
+         for (i=0; i < count; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            int last = i+1 == count;
+            x = stbi__png_load_px(raw, last ? img_n : 4);
+            b = stbi__png_load_px(prior, 4);
+            a = vadd_u8(x, stbi__paeth_simd(a, b, c));
+            c = b;
+            stbi__png_store_px(cur, vorr_u8(a, alpha), last ? out_n : 4);
+         }
+         return 1;
+   }
+   return 0;
+}
+#endif // STBI_NEON
+#endif // STBI_SSE2 || STBI_NEON
+
 static const stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
-// create the png data from post-deflated data
-static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 raw_len, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
+// unfilters one row of x pixels into cur; raw is the row's filter type
+// byte followed by its filtered bytes, prior the unfiltered row above or
+// NULL for the first one. below 8 bits, the packed bytes end up in the
+// rightmost bytes of the row for stbi__png_expand_row
+static int stbi__png_unfilter_row(stbi_uc *cur, stbi_uc *prior, const stbi_uc *raw, int img_n, int out_n, stbi__uint32 x, int depth, int simd)
 {
    int bytes = (depth == 16? 2 : 1);
-   stbi__context *s = a->s;
-   stbi__uint32 i,j,stride = x*out_n*bytes;
-   stbi__uint32 img_len, img_width_bytes;
+   stbi_uc *row = cur;
+   stbi__uint32 i;
    int k;
-   int img_n = s->img_n; // copy it into a local for later
 
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
    int width = x;
+   int filter = *raw++;
 
-   STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
-   a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
-   if (!a->out) return stbi__err("outofmem", "Out of memory");
-
-   if (!stbi__mad3sizes_valid(img_n, x, depth, 7)) return stbi__err("too large", "Corrupt PNG");
-   img_width_bytes = (((img_n * x * depth) + 7) >> 3);
-   img_len = (img_width_bytes + 1) * y;
-
-   // we used to check for exact match between raw_len and img_len on non-interlaced PNGs,
-   // but issue #276 reported a PNG in the wild that had extra data at the end (all zeros),
-   // so just check for raw_len < img_len always.
-   if (raw_len < img_len) return stbi__err("not enough pixels","Corrupt PNG");
+   if (filter > 4)
+      return stbi__err("invalid filter","Corrupt PNG");
 
-   for (j=0; j < y; ++j) {
-      stbi_uc *cur = a->out + stride*j;
-      stbi_uc *prior;
-      int filter = *raw++;
+   if (depth < 8) {
+      stbi__uint32 img_width_bytes = (((img_n * x * depth) + 7) >> 3);
+      STBI_ASSERT(img_width_bytes <= x);
+      cur += x*out_n - img_width_bytes; // store output to the rightmost img_len bytes, so we can decode in place
+      if (prior) prior += x*out_n - img_width_bytes;
+      filter_bytes = 1;
+      width = img_width_bytes;
+   }
+
+   // if first row, use special filter that doesn't sample previous row
+   if (prior == NULL) {
+      filter = first_row_filter[filter];
+      prior = cur; // never read by the first row filters
+   }
+
+   // handle first byte explicitly
+   for (k=0; k < filter_bytes; ++k) {
+      switch (filter) {
+         case STBI__F_none       : cur[k] = raw[k]; break;
+         case STBI__F_sub        : cur[k] = raw[k]; break;
+         case STBI__F_up         : cur[k] = STBI__BYTECAST(raw[k] + prior[k]); break;
+         case STBI__F_avg        : cur[k] = STBI__BYTECAST(raw[k] + (prior[k]>>1)); break;
+         case STBI__F_paeth      : cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(0,prior[k],0)); break;
+         case STBI__F_avg_first  : cur[k] = raw[k]; break;
+         case STBI__F_paeth_first: cur[k] = raw[k]; break;
+      }
+   }
 
-      if (filter > 4)
-         return stbi__err("invalid filter","Corrupt PNG");
+   if (depth == 8) {
+      if (img_n != out_n)
+         cur[img_n] = 255; // first pixel
+      raw += img_n;
+      cur += out_n;
+      prior += out_n;
+   } else if (depth == 16) {
+      if (img_n != out_n) {
+         cur[filter_bytes]   = 255; // first pixel top byte
+         cur[filter_bytes+1] = 255; // first pixel bottom byte
+      }
+      raw += filter_bytes;
+      cur += output_bytes;
+      prior += output_bytes;
+   } else {
+      raw += 1;
+      cur += 1;
+      prior += 1;
+   }
 
-      if (depth < 8) {
-         STBI_ASSERT(img_width_bytes <= x);
-         cur += x*out_n - img_width_bytes; // store output to the rightmost img_len bytes, so we can decode in place
-         filter_bytes = 1;
-         width = img_width_bytes;
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+   if (simd && stbi__png_unfilter_simd(filter, cur, prior, raw, img_n, out_n, x-1)) {
+      // done
+   } else
+#else
+   STBI_NOTUSED(simd);
+#endif
+   // this is a little gross, so that we don't switch per-pixel or per-component
+   if (depth < 8 || img_n == out_n) {
+      int nk = (width - 1)*filter_bytes;
+      #define STBI__CASE(f) \
+          case f:     \
+             for (k=0; k < nk; ++k)
+      switch (filter) {
+         // "none" filter turns into a memcpy here; make that explicit.
+         case STBI__F_none:         memcpy(cur, raw, nk); break;
+         STBI__CASE(STBI__F_sub)          { cur[k] = STBI__BYTECAST(raw[k] + cur[k-filter_bytes]); } break;
+         STBI__CASE(STBI__F_up)           { cur[k] = STBI__BYTECAST(raw[k] + prior[k]); } break;
+         STBI__CASE(STBI__F_avg)          { cur[k] = STBI__BYTECAST(raw[k] + ((prior[k] + cur[k-filter_bytes])>>1)); } break;
+         STBI__CASE(STBI__F_paeth)        { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k-filter_bytes],prior[k],prior[k-filter_bytes])); } break;
+         STBI__CASE(STBI__F_avg_first)    { cur[k] = STBI__BYTECAST(raw[k] + (cur[k-filter_bytes] >> 1)); } break;
+         STBI__CASE(STBI__F_paeth_first)  { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k-filter_bytes],0,0)); } break;
       }
-      prior = cur - stride; // bugfix: need to compute this after 'cur +=' computation above
-
-      // if first row, use special filter that doesn't sample previous row
-      if (j == 0) filter = first_row_filter[filter];
-
-      // handle first byte explicitly
-      for (k=0; k < filter_bytes; ++k) {
-         switch (filter) {
-            case STBI__F_none       : cur[k] = raw[k]; break;
-            case STBI__F_sub        : cur[k] = raw[k]; break;
-            case STBI__F_up         : cur[k] = STBI__BYTECAST(raw[k] + prior[k]); break;
-            case STBI__F_avg        : cur[k] = STBI__BYTECAST(raw[k] + (prior[k]>>1)); break;
-            case STBI__F_paeth      : cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(0,prior[k],0)); break;
-            case STBI__F_avg_first  : cur[k] = raw[k]; break;
-            case STBI__F_paeth_first: cur[k] = raw[k]; break;
-         }
+      #undef STBI__CASE
+   } else {
+      STBI_ASSERT(img_n+1 == out_n);
+      #define STBI__CASE(f) \
+          case f:     \
+             for (i=x-1; i >= 1; --i, cur[filter_bytes]=255,raw+=filter_bytes,cur+=output_bytes,prior+=output_bytes) \
+                for (k=0; k < filter_bytes; ++k)
+      switch (filter) {
+         STBI__CASE(STBI__F_none)         { cur[k] = raw[k]; } break;
+         STBI__CASE(STBI__F_sub)          { cur[k] = STBI__BYTECAST(raw[k] + cur[k- output_bytes]); } break;
+         STBI__CASE(STBI__F_up)           { cur[k] = STBI__BYTECAST(raw[k] + prior[k]); } break;
+         STBI__CASE(STBI__F_avg)          { cur[k] = STBI__BYTECAST(raw[k] + ((prior[k] + cur[k- output_bytes])>>1)); } break;
+         STBI__CASE(STBI__F_paeth)        { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k- output_bytes],prior[k],prior[k- output_bytes])); } break;
+         STBI__CASE(STBI__F_avg_first)    { cur[k] = STBI__BYTECAST(raw[k] + (cur[k- output_bytes] >> 1)); } break;
+         STBI__CASE(STBI__F_paeth_first)  { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k- output_bytes],0,0)); } break;
       }
+      #undef STBI__CASE
 
-      if (depth == 8) {
-         if (img_n != out_n)
-            cur[img_n] = 255; // first pixel
-         raw += img_n;
-         cur += out_n;
-         prior += out_n;
-      } else if (depth == 16) {
-         if (img_n != out_n) {
-            cur[filter_bytes]   = 255; // first pixel top byte
-            cur[filter_bytes+1] = 255; // first pixel bottom byte
+      // the loop above sets the high byte of the pixels' alpha, but for
+      // 16 bit png files we also need the low byte set. we'll do that here.
+      if (depth == 16) {
+         cur = row; // start at the beginning of the row again
+         for (i=0; i < x; ++i,cur+=output_bytes) {
+            cur[filter_bytes+1] = 255;
          }
-         raw += filter_bytes;
-         cur += output_bytes;
-         prior += output_bytes;
-      } else {
-         raw += 1;
-         cur += 1;
-         prior += 1;
       }
+   }
+   return 1;
+}
 
-      // this is a little gross, so that we don't switch per-pixel or per-component
-      if (depth < 8 || img_n == out_n) {
-         int nk = (width - 1)*filter_bytes;
-         #define STBI__CASE(f) \
-             case f:     \
-                for (k=0; k < nk; ++k)
-         switch (filter) {
-            // "none" filter turns into a memcpy here; make that explicit.
-            case STBI__F_none:         memcpy(cur, raw, nk); break;
-            STBI__CASE(STBI__F_sub)          { cur[k] = STBI__BYTECAST(raw[k] + cur[k-filter_bytes]); } break;
-            STBI__CASE(STBI__F_up)           { cur[k] = STBI__BYTECAST(raw[k] + prior[k]); } break;
-            STBI__CASE(STBI__F_avg)          { cur[k] = STBI__BYTECAST(raw[k] + ((prior[k] + cur[k-filter_bytes])>>1)); } break;
-            STBI__CASE(STBI__F_paeth)        { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k-filter_bytes],prior[k],prior[k-filter_bytes])); } break;
-            STBI__CASE(STBI__F_avg_first)    { cur[k] = STBI__BYTECAST(raw[k] + (cur[k-filter_bytes] >> 1)); } break;
-            STBI__CASE(STBI__F_paeth_first)  { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k-filter_bytes],0,0)); } break;
+// unpacks the 1/2/4-bit samples that stbi__png_unfilter_row left in the
+// rightmost bytes of cur to a byte each
+static void stbi__png_expand_row(stbi_uc *cur, stbi__uint32 x, int img_n, int out_n, int depth, int color)
+{
+   stbi_uc *row = cur;
+   stbi__uint32 img_width_bytes = (((img_n * x * depth) + 7) >> 3);
+   stbi_uc *in  = cur + x*out_n - img_width_bytes;
+   int k;
+   // unpack 1/2/4-bit into a 8-bit buffer. allows us to keep the common 8-bit path optimal at minimal cost for 1/2/4-bit
+   // png guarante byte alignment, if width is not multiple of 8/4/2 we'll decode dummy trailing data that will be skipped in the later loop
+   stbi_uc scale = (color == 0) ? stbi__depth_scale_table[depth] : 1; // scale grayscale values to 0..255 range
+
+   // note that the final byte might overshoot and write more data than desired.
+   // we can allocate enough data that this never writes out of memory, but it
+   // could also overwrite the next scanline. can it overwrite non-empty data
+   // on the next scanline? yes, consider 1-pixel-wide scanlines with 1-bit-per-pixel.
+   // so we need to explicitly clamp the final ones
+
+   if (depth == 4) {
+      for (k=x*img_n; k >= 2; k-=2, ++in) {
+         *cur++ = scale * ((*in >> 4)       );
+         *cur++ = scale * ((*in     ) & 0x0f);
+      }
+      if (k > 0) *cur++ = scale * ((*in >> 4)       );
+   } else if (depth == 2) {
+      for (k=x*img_n; k >= 4; k-=4, ++in) {
+         *cur++ = scale * ((*in >> 6)       );
+         *cur++ = scale * ((*in >> 4) & 0x03);
+         *cur++ = scale * ((*in >> 2) & 0x03);
+         *cur++ = scale * ((*in     ) & 0x03);
+      }
+      if (k > 0) *cur++ = scale * ((*in >> 6)       );
+      if (k > 1) *cur++ = scale * ((*in >> 4) & 0x03);
+      if (k > 2) *cur++ = scale * ((*in >> 2) & 0x03);
+   } else if (depth == 1) {
+      for (k=x*img_n; k >= 8; k-=8, ++in) {
+         *cur++ = scale * ((*in >> 7)       );
+         *cur++ = scale * ((*in >> 6) & 0x01);
+         *cur++ = scale * ((*in >> 5) & 0x01);
+         *cur++ = scale * ((*in >> 4) & 0x01);
+         *cur++ = scale * ((*in >> 3) & 0x01);
+         *cur++ = scale * ((*in >> 2) & 0x01);
+         *cur++ = scale * ((*in >> 1) & 0x01);
+         *cur++ = scale * ((*in     ) & 0x01);
+      }
+      if (k > 0) *cur++ = scale * ((*in >> 7)       );
+      if (k > 1) *cur++ = scale * ((*in >> 6) & 0x01);
+      if (k > 2) *cur++ = scale * ((*in >> 5) & 0x01);
+      if (k > 3) *cur++ = scale * ((*in >> 4) & 0x01);
+      if (k > 4) *cur++ = scale * ((*in >> 3) & 0x01);
+      if (k > 5) *cur++ = scale * ((*in >> 2) & 0x01);
+      if (k > 6) *cur++ = scale * ((*in >> 1) & 0x01);
+   }
+   if (img_n != out_n) {
+      int q;
+      // insert alpha = 255
+      cur = row;
+      if (img_n == 1) {
+         for (q=x-1; q >= 0; --q) {
+            cur[q*2+1] = 255;
+            cur[q*2+0] = cur[q];
          }
-         #undef STBI__CASE
-         raw += nk;
       } else {
-         STBI_ASSERT(img_n+1 == out_n);
-         #define STBI__CASE(f) \
-             case f:     \
-                for (i=x-1; i >= 1; --i, cur[filter_bytes]=255,raw+=filter_bytes,cur+=output_bytes,prior+=output_bytes) \
-                   for (k=0; k < filter_bytes; ++k)
-         switch (filter) {
-            STBI__CASE(STBI__F_none)         { cur[k] = raw[k]; } break;
-            STBI__CASE(STBI__F_sub)          { cur[k] = STBI__BYTECAST(raw[k] + cur[k- output_bytes]); } break;
-            STBI__CASE(STBI__F_up)           { cur[k] = STBI__BYTECAST(raw[k] + prior[k]); } break;
-            STBI__CASE(STBI__F_avg)          { cur[k] = STBI__BYTECAST(raw[k] + ((prior[k] + cur[k- output_bytes])>>1)); } break;
-            STBI__CASE(STBI__F_paeth)        { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k- output_bytes],prior[k],prior[k- output_bytes])); } break;
-            STBI__CASE(STBI__F_avg_first)    { cur[k] = STBI__BYTECAST(raw[k] + (cur[k- output_bytes] >> 1)); } break;
-            STBI__CASE(STBI__F_paeth_first)  { cur[k] = STBI__BYTECAST(raw[k] + stbi__paeth(cur[k- output_bytes],0,0)); } break;
-         }
-         #undef STBI__CASE
-
-         // the loop above sets the high byte of the pixels' alpha, but for
-         // 16 bit png files we also need the low byte set. we'll do that here.
-         if (depth == 16) {
-            cur = a->out + stride*j; // start at the beginning of the row again
-            for (i=0; i < x; ++i,cur+=output_bytes) {
-               cur[filter_bytes+1] = 255;
-            }
+         STBI_ASSERT(img_n == 3);
+         for (q=x-1; q >= 0; --q) {
+            cur[q*4+3] = 255;
+            cur[q*4+2] = cur[q*3+2];
+            cur[q*4+1] = cur[q*3+1];
+            cur[q*4+0] = cur[q*3+0];
          }
       }
    }
+}
+
+// force 16-bit samples from big-endian to platform-native. this is a
+// separate pass since the unfiltering of the next row relies on the data
+// being untouched
+static void stbi__png_swap16(stbi_uc *cur, stbi__uint32 count)
+{
+   stbi__uint16 *cur16 = (stbi__uint16*)cur;
+   stbi__uint32 i;
+
+   for(i=0; i < count; ++i,cur16++,cur+=2) {
+      *cur16 = (cur[0] << 8) | cur[1];
+   }
+}
+
+static int stbi__png_simd_available(int img_n, int depth)
+{
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+   int simd = depth == 8 && (img_n == 3 || img_n == 4);
+#ifdef STBI_SSE2
+   simd = simd && stbi__sse2_available();
+#endif
+   return simd;
+#else
+   STBI_NOTUSED(img_n);
+   STBI_NOTUSED(depth);
+   return 0;
+#endif
+}
+
+// allocates the output of stbi__create_png_image_raw
+static int stbi__png_image_begin(stbi__png *a, int out_n, stbi__uint32 x, stbi__uint32 y, int depth)
+{
+   int bytes = (depth == 16? 2 : 1);
+   STBI_ASSERT(out_n == a->s->img_n || out_n == a->s->img_n+1);
+   a->out = (stbi_uc *) stbi__malloc_mad3(x, y, out_n*bytes, 0); // extra bytes to write off the end into
+   if (!a->out) return stbi__err("outofmem", "Out of memory");
+
+   if (!stbi__mad3sizes_valid(a->s->img_n, x, depth, 7)) return stbi__err("too large", "Corrupt PNG");
+   return 1;
+}
+
+// unfilters the rows j0 to j1 of a->out, raw starts with row j0
+static int stbi__png_image_rows(stbi__png *a, stbi_uc *raw, int out_n, stbi__uint32 x, stbi__uint32 j0, stbi__uint32 j1, int depth)
+{
+   int bytes = (depth == 16? 2 : 1);
+   stbi__uint32 j,stride = x*out_n*bytes;
+   int img_n = a->s->img_n; // copy it into a local for later
+   stbi__uint32 img_width_bytes = (((img_n * x * depth) + 7) >> 3);
+   int simd = stbi__png_simd_available(img_n, depth);
+
+   for (j=j0; j < j1; ++j) {
+      stbi_uc *cur = a->out + stride*j;
+      if (!stbi__png_unfilter_row(cur, j ? cur - stride : NULL, raw, img_n, out_n, x, depth, simd)) return 0;
+      raw += img_width_bytes + 1;
+   }
+   return 1;
+}
+
+// takes the unfiltered rows of a->out to one byte or native uint16 per channel
+static void stbi__png_image_end(stbi__png *a, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
+{
+   int bytes = (depth == 16? 2 : 1);
+   stbi__uint32 j,stride = x*out_n*bytes;
+   int img_n = a->s->img_n;
 
    // we make a separate pass to expand bits to pixels; for performance,
    // this could run two scanlines behind the above code, so it won't
    // intefere with filtering but will still be in the cache.
    if (depth < 8) {
-      for (j=0; j < y; ++j) {
-         stbi_uc *cur = a->out + stride*j;
-         stbi_uc *in  = a->out + stride*j + x*out_n - img_width_bytes;
-         // unpack 1/2/4-bit into a 8-bit buffer. allows us to keep the common 8-bit path optimal at minimal cost for 1/2/4-bit
-         // png guarante byte alignment, if width is not multiple of 8/4/2 we'll decode dummy trailing data that will be skipped in the later loop
-         stbi_uc scale = (color == 0) ? stbi__depth_scale_table[depth] : 1; // scale grayscale values to 0..255 range
-
-         // note that the final byte might overshoot and write more data than desired.
-         // we can allocate enough data that this never writes out of memory, but it
-         // could also overwrite the next scanline. can it overwrite non-empty data
-         // on the next scanline? yes, consider 1-pixel-wide scanlines with 1-bit-per-pixel.
-         // so we need to explicitly clamp the final ones
-
-         if (depth == 4) {
-            for (k=x*img_n; k >= 2; k-=2, ++in) {
-               *cur++ = scale * ((*in >> 4)       );
-               *cur++ = scale * ((*in     ) & 0x0f);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 4)       );
-         } else if (depth == 2) {
-            for (k=x*img_n; k >= 4; k-=4, ++in) {
-               *cur++ = scale * ((*in >> 6)       );
-               *cur++ = scale * ((*in >> 4) & 0x03);
-               *cur++ = scale * ((*in >> 2) & 0x03);
-               *cur++ = scale * ((*in     ) & 0x03);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 6)       );
-            if (k > 1) *cur++ = scale * ((*in >> 4) & 0x03);
-            if (k > 2) *cur++ = scale * ((*in >> 2) & 0x03);
-         } else if (depth == 1) {
-            for (k=x*img_n; k >= 8; k-=8, ++in) {
-               *cur++ = scale * ((*in >> 7)       );
-               *cur++ = scale * ((*in >> 6) & 0x01);
-               *cur++ = scale * ((*in >> 5) & 0x01);
-               *cur++ = scale * ((*in >> 4) & 0x01);
-               *cur++ = scale * ((*in >> 3) & 0x01);
-               *cur++ = scale * ((*in >> 2) & 0x01);
-               *cur++ = scale * ((*in >> 1) & 0x01);
-               *cur++ = scale * ((*in     ) & 0x01);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 7)       );
-            if (k > 1) *cur++ = scale * ((*in >> 6) & 0x01);
-            if (k > 2) *cur++ = scale * ((*in >> 5) & 0x01);
-            if (k > 3) *cur++ = scale * ((*in >> 4) & 0x01);
-            if (k > 4) *cur++ = scale * ((*in >> 3) & 0x01);
-            if (k > 5) *cur++ = scale * ((*in >> 2) & 0x01);
-            if (k > 6) *cur++ = scale * ((*in >> 1) & 0x01);
-         }
-         if (img_n != out_n) {
-            int q;
-            // insert alpha = 255
-            cur = a->out + stride*j;
-            if (img_n == 1) {
-               for (q=x-1; q >= 0; --q) {
-                  cur[q*2+1] = 255;
-                  cur[q*2+0] = cur[q];
-               }
-            } else {
-               STBI_ASSERT(img_n == 3);
-               for (q=x-1; q >= 0; --q) {
-                  cur[q*4+3] = 255;
-                  cur[q*4+2] = cur[q*3+2];
-                  cur[q*4+1] = cur[q*3+1];
-                  cur[q*4+0] = cur[q*3+0];
-               }
-            }
-         }
-      }
+      for (j=0; j < y; ++j)
+         stbi__png_expand_row(a->out + stride*j, x, img_n, out_n, depth, color);
    } else if (depth == 16) {
-      // force the image data from big-endian to platform-native.
-      // this is done in a separate pass due to the decoding relying
-      // on the data being untouched, but could probably be done
-      // per-line during decode if care is taken.
-      stbi_uc *cur = a->out;
-      stbi__uint16 *cur16 = (stbi__uint16*)cur;
-
-      for(i=0; i < x*y*out_n; ++i,cur16++,cur+=2) {
-         *cur16 = (cur[0] << 8) | cur[1];
-      }
+      stbi__png_swap16(a->out, x*y*out_n);
    }
+}
+
+// create the png data from post-deflated data
+static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 raw_len, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
+{
+   stbi__uint32 img_len;
+
+   if (!stbi__png_image_begin(a, out_n, x, y, depth)) return 0;
+   img_len = ((((a->s->img_n * x * depth) + 7) >> 3) + 1) * y;
+
+   // we used to check for exact match between raw_len and img_len on non-interlaced PNGs,
+   // but issue #276 reported a PNG in the wild that had extra data at the end (all zeros),
+   // so just check for raw_len < img_len always.
+   if (raw_len < img_len) return stbi__err("not enough pixels","Corrupt PNG");
 
+   if (!stbi__png_image_rows(a, raw, out_n, x, 0, y, depth)) return 0;
+   stbi__png_image_end(a, out_n, x, y, depth, color);
    return 1;
 }
 
@@ -4731,11 +5765,386 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
    return 1;
 }
 
-static int stbi__compute_transparency(stbi__png *z, stbi_uc tc[3], int out_n)
+// state of a non-interlaced image unfiltered straight out of the zlib
+// window, so the inflated data never has to be held all at once
+typedef struct
 {
-   stbi__context *s = z->s;
-   stbi__uint32 i, pixel_count = s->img_x * s->img_y;
-   stbi_uc *p = z->out;
+   stbi__png *a;
+   int out_n, simd;
+   stbi__uint32 row_bytes, stride;
+   stbi__uint32 rows_done, have;
+   stbi_uc *row;  // a row that got cut across two flushes
+   int finished;  // every row is out, the rest of the stream isn't needed
+} stbi__png_window;
+
+// zlib flush callback, unfilters the rows of the data into a->out
+static int stbi__png_window_flush(void *user, stbi_uc *data, int size)
+{
+   stbi__png_window *w = (stbi__png_window *) user;
+   stbi__png *a = w->a;
+   while (size > 0 && w->rows_done < a->s->img_y) {
+      stbi_uc *raw, *cur;
+      if (w->have == 0 && (stbi__uint32) size >= w->row_bytes) {
+         // the whole row is in the window, unfilter it from there
+         raw = data;
+         data += w->row_bytes;
+         size -= w->row_bytes;
+      } else {
+         stbi__uint32 n = w->row_bytes - w->have;
+         if (n > (stbi__uint32) size) n = size;
+         memcpy(w->row + w->have, data, n);
+         w->have += n;
+         data += n;
+         size -= n;
+         if (w->have < w->row_bytes) break;
+         raw = w->row;
+         w->have = 0;
+      }
+      cur = a->out + w->stride*w->rows_done;
+      if (!stbi__png_unfilter_row(cur, w->rows_done ? cur - w->stride : NULL, raw, a->s->img_n, w->out_n, a->s->img_x, a->depth, w->simd)) return 0;
+      ++w->rows_done;
+   }
+   if (w->rows_done == a->s->img_y) {
+      // stops the inflate, trailing data is ignored like on the streaming path
+      w->finished = 1;
+      return 0;
+   }
+   return 1;
+}
+
+// inflates the IDAT data of a non-interlaced image through a window and
+// unfilters the rows into a->out as they come out of it
+static int stbi__png_inflate_rows(stbi__png *a, stbi__uint32 len, int out_n, int color, int parse_header)
+{
+   stbi__context *s = a->s;
+   stbi__png_window w;
+   stbi__zbuf z;
+   stbi_uc *mem;
+   int bytes = (a->depth == 16 ? 2 : 1);
+   int ok;
+
+   if (!stbi__png_image_begin(a, out_n, s->img_x, s->img_y, a->depth)) return 0;
+   memset(&w, 0, sizeof(w));
+   w.a = a;
+   w.out_n = out_n;
+   w.simd = stbi__png_simd_available(s->img_n, a->depth);
+   w.row_bytes = ((s->img_n * s->img_x * a->depth + 7) >> 3) + 1;
+   w.stride = s->img_x * out_n * bytes;
+
+   // the row, then room for the window and a stored piece
+   mem = (stbi_uc *) stbi__malloc(w.row_bytes + 2*STBI__ZWINDOW);
+   if (mem == NULL) return stbi__err("outofmem", "Out of memory");
+   w.row = mem;
+   z.zbuffer = a->idata;
+   z.zbuffer_end = a->idata + len;
+   z.zout_start = z.zout = z.zout_flushed = (char *) (mem + w.row_bytes);
+   z.zout_end = z.zout_start + 2*STBI__ZWINDOW;
+   z.z_expandable = 0;
+   z.zout_cap = 0;
+   z.zin_overrun = 0;
+   z.read = NULL;
+   z.flush = stbi__png_window_flush;
+   z.stream_user = &w;
+
+   ok = stbi__parse_zlib(&z, parse_header);
+   if (ok && z.zin_overrun*8 > z.num_bits) ok = stbi__err("outofdata","Corrupt PNG");
+   if (ok) ok = stbi__png_window_flush(&w, (stbi_uc *) z.zout_flushed, (int) (z.zout - z.zout_flushed));
+   if (w.finished) ok = 1;
+   else if (ok) ok = stbi__err("not enough pixels","Corrupt PNG");
+   STBI_FREE(mem);
+   if (ok) stbi__png_image_end(a, out_n, s->img_x, s->img_y, a->depth, color);
+   return ok;
+}
+
+#ifdef STBI_PNG_THREADS
+// a zlib stream written with full flushes is cut at them into pieces that
+// inflate on their own, one per thread at a time
+
+#define STBI__PNG_MAX_THREADS 64
+// the least compressed bytes in a piece, smaller ones aren't worth a handoff
+#define STBI__PNG_MIN_PIECE   (64*1024)
+
+static int stbi__png_threads = 0;
+
+STBIDEF void stbi_set_png_threads(int thread_count)
+{
+   stbi__png_threads = thread_count;
+}
+
+typedef struct
+{
+   stbi_uc *start, *end;
+   char *out;
+   int out_len;
+   int state; // 0 while inflating, 1 done, -1 failed
+} stbi__png_piece;
+
+typedef struct
+{
+   stbi__png_piece *pieces;
+   int count, next;
+   stbi_uc *data_end;
+   int parse_header;
+   int cap;
+   double ratio; // inflated bytes per compressed byte, for the first guess of a piece's size
+#ifdef _WIN32
+   CRITICAL_SECTION lock;
+   CONDITION_VARIABLE done;
+#else
+   pthread_mutex_t lock;
+   pthread_cond_t done;
+#endif
+} stbi__png_pieces;
+
+#ifdef _WIN32
+#define stbi__png_pieces_lock(q)      EnterCriticalSection(&(q)->lock)
+#define stbi__png_pieces_unlock(q)    LeaveCriticalSection(&(q)->lock)
+#define stbi__png_pieces_wait(q)      SleepConditionVariableCS(&(q)->done, &(q)->lock, INFINITE)
+#define stbi__png_pieces_signal(q)    WakeAllConditionVariable(&(q)->done)
+#else
+#define stbi__png_pieces_lock(q)      pthread_mutex_lock(&(q)->lock)
+#define stbi__png_pieces_unlock(q)    pthread_mutex_unlock(&(q)->lock)
+#define stbi__png_pieces_wait(q)      pthread_cond_wait(&(q)->done, &(q)->lock)
+#define stbi__png_pieces_signal(q)    pthread_cond_broadcast(&(q)->done)
+#endif
+
+static int stbi__png_thread_count(void)
+{
+   int n = stbi__png_threads;
+   if (n <= 0) {
+#ifdef _WIN32
+      SYSTEM_INFO info;
+      GetSystemInfo(&info);
+      n = (int) info.dwNumberOfProcessors;
+#else
+      n = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+   }
+   if (n < 1) n = 1;
+   if (n > STBI__PNG_MAX_THREADS) n = STBI__PNG_MAX_THREADS;
+   return n;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI stbi__png_piece_worker(LPVOID arg)
+#else
+static void *stbi__png_piece_worker(void *arg)
+#endif
+{
+   stbi__png_pieces *q = (stbi__png_pieces *) arg;
+   stbi__zbuf a;
+   for (;;) {
+      stbi__png_piece *p;
+      char *buf;
+      int k, size, ok = 0;
+      stbi__png_pieces_lock(q);
+      k = q->next++;
+      stbi__png_pieces_unlock(q);
+      if (k >= q->count) break;
+      p = &q->pieces[k];
+
+      // a piece usually inflates like the whole stream does
+      size = (int) ((double) (p->end - p->start) * q->ratio * 1.25);
+      if (size > q->cap || size < 0) size = q->cap;
+      if (size < 1024) size = 1024;
+      buf = (char *) stbi__malloc(size);
+      if (buf) {
+         a.zbuffer = p->start;
+         a.zbuffer_end = q->data_end; // a piece that doesn't end at p->end must not run out early
+         a.zout_start = a.zout = buf;
+         a.zout_end = buf + size;
+         a.z_expandable = 1;
+         a.zout_cap = q->cap;
+         a.zin_overrun = 0;
+         a.read = NULL;
+         a.flush = NULL;
+         ok = stbi__parse_zlib_piece(&a, q->parse_header && k == 0, p->end, k == q->count-1);
+      }
+
+      stbi__png_pieces_lock(q);
+      if (ok) {
+         p->out = a.zout_start;
+         p->out_len = (int) (a.zout - a.zout_start);
+         p->state = 1;
+      } else {
+         if (buf) STBI_FREE(a.zout_start);
+         p->state = -1;
+      }
+      stbi__png_pieces_signal(q);
+      stbi__png_pieces_unlock(q);
+   }
+   return 0;
+}
+
+// inflates the IDAT data on several threads, and unfilters the rows of a
+// non-interlaced image straight out of the pieces as they come in. returns
+// 1 with the image in a->out, or the inflated data in a->expanded when
+// interlaced; 0 on error; -1 if the stream has no full flushes or a piece
+// didn't inflate on its own, to try the usual way instead
+static int stbi__png_inflate_parallel(stbi__png *a, stbi__uint32 len, stbi__uint32 raw_len, int out_n, int color, int interlace, int parse_header, stbi__uint32 *expanded_len)
+{
+   stbi__context *s = a->s;
+   stbi_uc *data = a->idata;
+   stbi__png_pieces q;
+   stbi_uc *expanded; // all of the inflated data if interlaced, else the row across two pieces
+#ifdef _WIN32
+   HANDLE workers[STBI__PNG_MAX_THREADS];
+#else
+   pthread_t workers[STBI__PNG_MAX_THREADS];
+#endif
+   stbi__uint32 i, last, min_piece, have = 0, rows = 0;
+   stbi__uint32 row_bytes = ((s->img_n * s->img_x * a->depth + 7) >> 3) + 1;
+   int threads = stbi__png_thread_count();
+   int k, started = 0, result = 1;
+
+   if (threads < 2 || len < 2*STBI__PNG_MIN_PIECE) return -1;
+   min_piece = len / (threads * 4); // a few pieces per thread even out their sizes
+   if (min_piece < STBI__PNG_MIN_PIECE) min_piece = STBI__PNG_MIN_PIECE;
+
+   // a full flush ends in an empty stored block, LEN 0 and NLEN 0xffff.
+   // the same bytes can show up anywhere, so these are only candidates,
+   // the pieces check that they really end there
+   q.count = 1;
+   for (i = last = 2; i + 4 < len; ++i)
+      if (data[i] == 0 && data[i+1] == 0 && data[i+2] == 0xff && data[i+3] == 0xff && i+4 - last >= min_piece && len - (i+4) >= min_piece / 2) {
+         ++q.count;
+         last = i + 4;
+      }
+   if (q.count < 2) return -1;
+
+   q.pieces = (stbi__png_piece *) stbi__malloc_mad2(q.count, sizeof(stbi__png_piece), 0);
+   expanded = (stbi_uc *) stbi__malloc(interlace ? raw_len : row_bytes);
+   if (!q.pieces || !expanded) {
+      STBI_FREE(q.pieces);
+      STBI_FREE(expanded);
+      return stbi__err("outofmem", "Out of memory");
+   }
+   memset(q.pieces, 0, q.count * sizeof(stbi__png_piece));
+   q.pieces[0].start = data;
+   for (i = last = 2, k = 0; i + 4 < len; ++i)
+      if (data[i] == 0 && data[i+1] == 0 && data[i+2] == 0xff && data[i+3] == 0xff && i+4 - last >= min_piece && len - (i+4) >= min_piece / 2) {
+         last = i + 4;
+         q.pieces[k].end = q.pieces[k+1].start = data + last;
+         ++k;
+      }
+   q.pieces[k].end = data + len;
+   q.next = 0;
+   q.data_end = data + len;
+   q.parse_header = parse_header;
+   q.cap = (int) raw_len; // no piece holds more than the whole image
+   q.ratio = (double) raw_len / len;
+#ifdef _WIN32
+   InitializeCriticalSection(&q.lock);
+   InitializeConditionVariable(&q.done);
+#else
+   pthread_mutex_init(&q.lock, NULL);
+   pthread_cond_init(&q.done, NULL);
+#endif
+
+   if (threads > q.count) threads = q.count;
+   for (k = 0; k < threads; ++k) {
+#ifdef _WIN32
+      workers[started] = CreateThread(NULL, 0, stbi__png_piece_worker, &q, 0, NULL);
+      if (workers[started] != NULL) ++started;
+#else
+      if (pthread_create(&workers[started], NULL, stbi__png_piece_worker, &q) == 0) ++started;
+#endif
+   }
+
+   if (started == 0) {
+      result = -1;
+   } else if (!interlace) {
+      if (!stbi__png_image_begin(a, out_n, s->img_x, s->img_y, a->depth)) result = 0;
+   }
+
+   // take the pieces in order, and unfilter the rows behind them
+   for (k = 0; k < q.count && result == 1; ++k) {
+      stbi__png_piece *p = &q.pieces[k];
+      stbi__uint32 n;
+      int state;
+      stbi__png_pieces_lock(&q);
+      while (p->state == 0)
+         stbi__png_pieces_wait(&q);
+      state = p->state;
+      stbi__png_pieces_unlock(&q);
+      if (state < 0) {
+         result = -1;
+         break;
+      }
+      if (interlace) {
+         n = (stbi__uint32) p->out_len < raw_len - have ? (stbi__uint32) p->out_len : raw_len - have;
+         memcpy(expanded + have, p->out, n);
+         have += n;
+      } else {
+         stbi_uc *in = (stbi_uc *) p->out;
+         stbi__uint32 left = p->out_len, j1;
+         if (have && rows < s->img_y) {
+            // finish the row the previous piece started
+            n = row_bytes - have < left ? row_bytes - have : left;
+            memcpy(expanded + have, in, n);
+            have += n;
+            in += n;
+            left -= n;
+            if (have == row_bytes) {
+               if (!stbi__png_image_rows(a, expanded, out_n, s->img_x, rows, rows+1, a->depth)) result = 0;
+               ++rows;
+               have = 0;
+            }
+         }
+         j1 = rows + left / row_bytes;
+         if (j1 > s->img_y) j1 = s->img_y;
+         if (result == 1 && !stbi__png_image_rows(a, in, out_n, s->img_x, rows, j1, a->depth)) result = 0;
+         in += (j1 - rows) * row_bytes;
+         left -= (j1 - rows) * row_bytes;
+         rows = j1;
+         if (rows < s->img_y && left) {
+            memcpy(expanded, in, left);
+            have = left;
+         }
+      }
+      STBI_FREE(p->out);
+      p->out = NULL;
+   }
+
+   // let the workers run out of pieces
+   stbi__png_pieces_lock(&q);
+   q.next = q.count;
+   stbi__png_pieces_unlock(&q);
+#ifdef _WIN32
+   if (started) WaitForMultipleObjects(started, workers, TRUE, INFINITE);
+   for (k = 0; k < started; ++k) CloseHandle(workers[k]);
+   DeleteCriticalSection(&q.lock);
+#else
+   for (k = 0; k < started; ++k) pthread_join(workers[k], NULL);
+   pthread_cond_destroy(&q.done);
+   pthread_mutex_destroy(&q.lock);
+#endif
+   for (k = 0; k < q.count; ++k) STBI_FREE(q.pieces[k].out);
+   STBI_FREE(q.pieces);
+
+   if (result == 1 && !interlace) {
+      if (rows < s->img_y)
+         result = stbi__err("not enough pixels","Corrupt PNG");
+      else
+         stbi__png_image_end(a, out_n, s->img_x, s->img_y, a->depth, color);
+      STBI_FREE(expanded);
+   } else if (result == 1) {
+      a->expanded = expanded;
+      *expanded_len = have;
+   } else {
+      STBI_FREE(expanded);
+   }
+   if (result != 1) {
+      STBI_FREE(a->out);
+      a->out = NULL;
+   }
+   return result;
+}
+#endif // STBI_PNG_THREADS
+
+static int stbi__compute_transparency(stbi_uc *p, stbi__uint32 pixel_count, stbi_uc tc[3], int out_n)
+{
+   stbi__uint32 i;
 
    // compute color-based transparency, assuming we've
    // already got 255 as the alpha value in the output
@@ -4756,11 +6165,9 @@ static int stbi__compute_transparency(stbi__png *z, stbi_uc tc[3], int out_n)
    return 1;
 }
 
-static int stbi__compute_transparency16(stbi__png *z, stbi__uint16 tc[3], int out_n)
+static int stbi__compute_transparency16(stbi__uint16 *p, stbi__uint32 pixel_count, stbi__uint16 tc[3], int out_n)
 {
-   stbi__context *s = z->s;
-   stbi__uint32 i, pixel_count = s->img_x * s->img_y;
-   stbi__uint16 *p = (stbi__uint16*) z->out;
+   stbi__uint32 i;
 
    // compute color-based transparency, assuming we've
    // already got 65535 as the alpha value in the output
@@ -4781,17 +6188,9 @@ static int stbi__compute_transparency16(stbi__png *z, stbi__uint16 tc[3], int ou
    return 1;
 }
 
-static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int pal_img_n)
+static void stbi__png_palette_row(stbi_uc *p, const stbi_uc *orig, stbi__uint32 pixel_count, const stbi_uc *palette, int pal_img_n)
 {
-   stbi__uint32 i, pixel_count = a->s->img_x * a->s->img_y;
-   stbi_uc *p, *temp_out, *orig = a->out;
-
-   p = (stbi_uc *) stbi__malloc_mad2(pixel_count, pal_img_n, 0);
-   if (p == NULL) return stbi__err("outofmem", "Out of memory");
-
-   // between here and free(out) below, exitting would leak
-   temp_out = p;
-
+   stbi__uint32 i;
    if (pal_img_n == 3) {
       for (i=0; i < pixel_count; ++i) {
          int n = orig[i]*4;
@@ -4810,6 +6209,20 @@ static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int
          p += 4;
       }
    }
+}
+
+static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int pal_img_n)
+{
+   stbi__uint32 pixel_count = a->s->img_x * a->s->img_y;
+   stbi_uc *p, *temp_out;
+
+   p = (stbi_uc *) stbi__malloc_mad2(pixel_count, pal_img_n, 0);
+   if (p == NULL) return stbi__err("outofmem", "Out of memory");
+
+   // between here and free(out) below, exitting would leak
+   temp_out = p;
+
+   stbi__png_palette_row(p, a->out, pixel_count, palette, pal_img_n);
    STBI_FREE(a->out);
    a->out = temp_out;
 
@@ -4831,13 +6244,11 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert)
    stbi__de_iphone_flag = flag_true_if_should_convert;
 }
 
-static void stbi__de_iphone(stbi__png *z)
+static void stbi__de_iphone(stbi_uc *p, stbi__uint32 pixel_count, int out_n)
 {
-   stbi__context *s = z->s;
-   stbi__uint32 i, pixel_count = s->img_x * s->img_y;
-   stbi_uc *p = z->out;
+   stbi__uint32 i;
 
-   if (s->img_out_n == 3) {  // convert bgr to rgb
+   if (out_n == 3) {  // convert bgr to rgb
       for (i=0; i < pixel_count; ++i) {
          stbi_uc t = p[0];
          p[0] = p[2];
@@ -4845,7 +6256,7 @@ static void stbi__de_iphone(stbi__png *z)
          p += 3;
       }
    } else {
-      STBI_ASSERT(s->img_out_n == 4);
+      STBI_ASSERT(out_n == 4);
       if (stbi__unpremultiply_on_load) {
          // convert bgr to rgb and unpremultiply
          for (i=0; i < pixel_count; ++i) {
@@ -4876,6 +6287,231 @@ static void stbi__de_iphone(stbi__png *z)
 
 #define STBI__PNG_TYPE(a,b,c,d)  (((unsigned) (a) << 24) + ((unsigned) (b) << 16) + ((unsigned) (c) << 8) + (unsigned) (d))
 
+// sets the outputs and gets the row buffer ready; comp is the number of
+// channels the rows come in before going to req_comp
+static int stbi__png_rows_begin(stbi__png_rows *r, stbi__uint32 x, stbi__uint32 y, int comp)
+{
+   *r->x = x;
+   *r->y = y;
+   if (r->comp) *r->comp = comp;
+   r->pixels = (stbi_uc *) stbi__malloc_mad2(x, 8, 0); // up to 4 channels of 16 bits
+   if (r->pixels == NULL) return stbi__err("outofmem", "Out of memory");
+   r->next = 0;
+   return 1;
+}
+
+// takes a row of x pixels with n channels, 16 bits per channel if is16,
+// to 8-bit req_comp and hands it out. the row may be overwritten
+static int stbi__png_rows_emit(stbi__png_rows *r, stbi_uc *pix, stbi__uint32 x, int n, int is16)
+{
+   int y = r->next++;
+   if (r->next > (stbi__uint32) *r->y) return 1; // more data than rows, ignore like the whole image path
+   if (r->req_comp && r->req_comp != n) {
+      if (is16)
+         stbi__convert_format16_row((stbi__uint16 *) pix, (stbi__uint16 *) r->pixels, n, r->req_comp, x);
+      else
+         stbi__convert_format_row(pix, r->pixels, n, r->req_comp, x);
+      pix = r->pixels;
+      n = r->req_comp;
+   }
+   if (is16) {
+      stbi__uint16 *p16 = (stbi__uint16 *) pix;
+      stbi__uint32 i;
+      for (i=0; i < x*n; ++i)
+         pix[i] = (stbi_uc) ((p16[i] >> 8) & 0xFF); // top half of each byte is sufficient approx of 16->8 bit scaling
+   }
+   if (stbi__vertically_flip_on_load) y = *r->y - 1 - y;
+   if (!r->row(r->user, y, pix)) return stbi__err("stopped", "Row callback stopped the decode");
+   return 1;
+}
+
+// state of a non-interlaced image being inflated and unfiltered from the
+// IDAT chunks as they are read
+typedef struct
+{
+   stbi__png *z;
+   stbi__uint32 chunk_left; // bytes of the current IDAT not read yet
+   int idat_done;           // got to a chunk that isn't IDAT
+   int img_n, out_n, depth, color, simd, is_iphone;
+   stbi_uc *palette, pal_img_n;
+   int has_trans;
+   stbi_uc *tc;
+   stbi__uint16 *tc16;
+   stbi_uc *raw;            // filter type byte and the filtered row
+   stbi__uint32 raw_len, raw_have;
+   stbi_uc *cur, *prior;    // unfiltered rows, left as is for the next row
+   stbi_uc *tmp, *pal_out;  // a row on its way out
+   stbi__uint32 stride, rows_done;
+   int finished;            // every row is out, the rest of the stream isn't needed
+} stbi__png_stream;
+
+// zlib read callback, hands out the data of the IDAT chunks in a row
+static int stbi__png_stream_read(void *user, stbi_uc *data, int size)
+{
+   stbi__png_stream *st = (stbi__png_stream *) user;
+   stbi__context *s = st->z->s;
+   int total = 0;
+   while (size > 0 && !st->idat_done) {
+      int n;
+      if (st->chunk_left == 0) {
+         stbi__pngchunk c;
+         stbi__get32be(s); // CRC of the previous chunk
+         c = stbi__get_chunk_header(s);
+         if (c.type != STBI__PNG_TYPE('I','D','A','T')) {
+            // the image data is over, nothing after it matters to us
+            st->idat_done = 1;
+            break;
+         }
+         st->chunk_left = c.length;
+         continue;
+      }
+      n = st->chunk_left < (stbi__uint32) size ? (int) st->chunk_left : size;
+      if (!stbi__getn(s, data, n)) {
+         st->idat_done = 1;
+         break;
+      }
+      st->chunk_left -= n;
+      data += n;
+      size -= n;
+      total += n;
+   }
+   return total;
+}
+
+static int stbi__png_stream_row(stbi__png_stream *st)
+{
+   stbi__png *z = st->z;
+   stbi__uint32 x = z->s->img_x;
+   stbi_uc *t;
+   int n = st->out_n;
+   if (!stbi__png_unfilter_row(st->cur, st->rows_done ? st->prior : NULL, st->raw, st->img_n, st->out_n, x, st->depth, st->simd)) return 0;
+   ++st->rows_done;
+
+   // the rest works on a copy, cur has to stay as is to be the next prior
+   memcpy(st->tmp, st->cur, st->stride);
+   if (st->depth < 8)
+      stbi__png_expand_row(st->tmp, x, st->img_n, st->out_n, st->depth, st->color);
+   else if (st->depth == 16)
+      stbi__png_swap16(st->tmp, x*st->out_n);
+   if (st->has_trans) {
+      if (st->depth == 16)
+         stbi__compute_transparency16((stbi__uint16 *) st->tmp, x, st->tc16, st->out_n);
+      else
+         stbi__compute_transparency(st->tmp, x, st->tc, st->out_n);
+   }
+   if (st->is_iphone && stbi__de_iphone_flag && st->out_n > 2)
+      stbi__de_iphone(st->tmp, x, st->out_n);
+   t = st->tmp;
+   if (st->pal_img_n) {
+      // like the whole image path, expand straight to 4 channels if asked for
+      n = z->rows->req_comp >= 3 ? z->rows->req_comp : st->pal_img_n;
+      stbi__png_palette_row(st->pal_out, st->tmp, x, st->palette, n);
+      t = st->pal_out;
+   }
+   return stbi__png_rows_emit(z->rows, t, x, n, st->depth == 16);
+}
+
+// zlib flush callback, cuts the inflated data into rows
+static int stbi__png_stream_flush(void *user, stbi_uc *data, int size)
+{
+   stbi__png_stream *st = (stbi__png_stream *) user;
+   while (size > 0) {
+      stbi__uint32 n = st->raw_len - st->raw_have;
+      if (n > (stbi__uint32) size) n = size;
+      memcpy(st->raw + st->raw_have, data, n);
+      st->raw_have += n;
+      data += n;
+      size -= n;
+      if (st->raw_have == st->raw_len) {
+         stbi_uc *t;
+         if (!stbi__png_stream_row(st)) return 0;
+         st->raw_have = 0;
+         t = st->cur; st->cur = st->prior; st->prior = t;
+         if (st->rows_done == st->z->s->img_y) {
+            // stops the inflate, trailing data is ignored like on the whole image path
+            st->finished = 1;
+            return 0;
+         }
+      }
+   }
+   return 1;
+}
+
+// decodes a non-interlaced image starting at the first IDAT chunk, whose
+// header has just been read, and hands it out through z->rows
+static int stbi__png_stream_idat(stbi__png *z, stbi__uint32 first_len, int req_comp, int color, int is_iphone,
+                                 stbi_uc *palette, int pal_img_n, int has_trans, stbi_uc *tc, stbi__uint16 *tc16)
+{
+   stbi__context *s = z->s;
+   stbi__png_stream st;
+   stbi__zbuf *a;
+   stbi_uc *mem;
+   int bytes = (z->depth == 16 ? 2 : 1);
+   int ok;
+
+   memset(&st, 0, sizeof(st));
+   st.z = z;
+   st.chunk_left = first_len;
+   st.img_n = s->img_n;
+   st.depth = z->depth;
+   st.color = color;
+   st.is_iphone = is_iphone;
+   st.palette = palette;
+   st.pal_img_n = (stbi_uc) pal_img_n;
+   st.has_trans = has_trans;
+   st.tc = tc;
+   st.tc16 = tc16;
+   if ((req_comp == s->img_n+1 && req_comp != 3 && !pal_img_n) || has_trans)
+      st.out_n = s->img_n+1;
+   else
+      st.out_n = s->img_n;
+   st.simd = stbi__png_simd_available(st.img_n, st.depth);
+
+   if (!stbi__mad3sizes_valid(st.img_n, s->img_x, z->depth, 7)) return stbi__err("too large", "Corrupt PNG");
+   st.raw_len = ((st.img_n * s->img_x * z->depth + 7) >> 3) + 1;
+   st.stride = s->img_x * st.out_n * bytes;
+
+   if (!stbi__png_rows_begin(z->rows, s->img_x, s->img_y, pal_img_n ? pal_img_n : (has_trans ? s->img_n+1 : s->img_n)))
+      return 0;
+
+   // one block for the rows, the zlib state, its input and its window
+   mem = (stbi_uc *) stbi__malloc(st.raw_len + st.stride*3 + s->img_x*4 + sizeof(stbi__zbuf) + 4096 + 2*STBI__ZWINDOW);
+   if (mem == NULL) {
+      STBI_FREE(z->rows->pixels); z->rows->pixels = NULL;
+      return stbi__err("outofmem", "Out of memory");
+   }
+   a = (stbi__zbuf *) mem; // first, so it is aligned
+   st.cur     = mem + sizeof(stbi__zbuf);
+   st.prior   = st.cur   + st.stride;
+   st.tmp     = st.prior + st.stride;
+   st.pal_out = st.tmp   + st.stride;
+   st.raw     = st.pal_out + s->img_x*4;
+   a->zin     = st.raw + st.raw_len;
+   a->zin_size = 4096;
+   a->zbuffer = a->zbuffer_end = a->zin;
+   a->zout_start = a->zout = a->zout_flushed = (char *) (a->zin + a->zin_size);
+   a->zout_end = a->zout_start + 2*STBI__ZWINDOW; // room for the window and a stored piece
+   a->z_expandable = 0;
+   a->zout_cap = 0;
+   a->zin_overrun = 0;
+   a->read = stbi__png_stream_read;
+   a->flush = stbi__png_stream_flush;
+   a->stream_user = &st;
+
+   ok = stbi__parse_zlib(a, !is_iphone);
+   if (ok && a->zin_overrun*8 > a->num_bits) ok = stbi__err("outofdata","Corrupt PNG");
+   if (ok) ok = stbi__png_stream_flush(&st, (stbi_uc *) a->zout_flushed, (int) (a->zout - a->zout_flushed));
+   if (st.finished) ok = 1;
+   else if (ok && st.rows_done < s->img_y) ok = stbi__err("not enough pixels","Corrupt PNG");
+   if (ok) {
+      if (pal_img_n) s->img_n = pal_img_n;
+      else if (has_trans) ++s->img_n;
+   }
+   STBI_FREE(mem);
+   STBI_FREE(z->rows->pixels); z->rows->pixels = NULL;
+   return ok;
+}
+
 static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
 {
    stbi_uc palette[1024], pal_img_n=0;
@@ -4970,6 +6606,8 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (pal_img_n && !pal_len) return stbi__err("no PLTE","Corrupt PNG");
             if (scan == STBI__SCAN_header) { s->img_n = pal_img_n; return 1; }
+            if (z->rows && !interlace && !z->idata)
+               return stbi__png_stream_idat(z, c.length, req_comp, color, is_iphone, palette, pal_img_n, has_trans, tc, tc16);
             if ((int)(ioff + c.length) < (int)ioff) return 0;
             if (ioff + c.length > idata_limit) {
                stbi__uint32 idata_limit_old = idata_limit;
@@ -4991,26 +6629,52 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (scan != STBI__SCAN_load) return 1;
             if (z->idata == NULL) return stbi__err("no IDAT","Corrupt PNG");
-            // initial guess for decoded data size to avoid unnecessary reallocs
-            bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
-            raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
-            z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
-            if (z->expanded == NULL) return 0; // zlib should set error
-            STBI_FREE(z->idata); z->idata = NULL;
+            // the exact decoded data size, so the output never needs a realloc
+            if (!interlace) {
+               bpl = (s->img_x * s->img_n * z->depth + 7) / 8; // bytes per line
+               raw_len = (bpl + 1 /* filter mode per row */) * s->img_y;
+            } else {
+               int p;
+               raw_len = 0;
+               for (p=0; p < 7; ++p) {
+                  static const int xorig[] = { 0,4,0,2,0,1,0 };
+                  static const int yorig[] = { 0,0,4,0,2,0,1 };
+                  static const int xspc[]  = { 8,8,4,4,2,2,1 };
+                  static const int yspc[]  = { 8,8,8,4,4,2,2 };
+                  stbi__uint32 x = (s->img_x - xorig[p] + xspc[p]-1) / xspc[p];
+                  stbi__uint32 y = (s->img_y - yorig[p] + yspc[p]-1) / yspc[p];
+                  if (x && y) raw_len += ((x * s->img_n * z->depth + 7) / 8 + 1) * y;
+               }
+            }
             if ((req_comp == s->img_n+1 && req_comp != 3 && !pal_img_n) || has_trans)
                s->img_out_n = s->img_n+1;
             else
                s->img_out_n = s->img_n;
-            if (!stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace)) return 0;
+            #ifdef STBI_PNG_THREADS
+            k = stbi__png_inflate_parallel(z, ioff, raw_len, s->img_out_n, color, interlace, !is_iphone, &raw_len);
+            if (k == 0) return 0;
+            if (k < 0)
+            #endif
+            {
+               if (!interlace) {
+                  if (!stbi__png_inflate_rows(z, ioff, s->img_out_n, color, !is_iphone)) return 0;
+               } else {
+                  z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
+                  if (z->expanded == NULL) return 0; // zlib should set error
+               }
+            }
+            STBI_FREE(z->idata); z->idata = NULL;
+            // a non-interlaced image is already unfiltered
+            if (!z->out && !stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace)) return 0;
             if (has_trans) {
                if (z->depth == 16) {
-                  if (!stbi__compute_transparency16(z, tc16, s->img_out_n)) return 0;
+                  if (!stbi__compute_transparency16((stbi__uint16 *) z->out, s->img_x * s->img_y, tc16, s->img_out_n)) return 0;
                } else {
-                  if (!stbi__compute_transparency(z, tc, s->img_out_n)) return 0;
+                  if (!stbi__compute_transparency(z->out, s->img_x * s->img_y, tc, s->img_out_n)) return 0;
                }
             }
             if (is_iphone && stbi__de_iphone_flag && s->img_out_n > 2)
-               stbi__de_iphone(z);
+               stbi__de_iphone(z->out, s->img_x * s->img_y, s->img_out_n);
             if (pal_img_n) {
                // pal_img_n == 3 or 4
                s->img_n = pal_img_n; // record the actual colors we had
@@ -5084,6 +6748,7 @@ static void *stbi__png_load(stbi__context *s, int *x, int *y, int *comp, int req
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    return stbi__do_png(&p, x,y,comp,req_comp, ri);
 }
 
@@ -5111,13 +6776,46 @@ static int stbi__png_info(stbi__context *s, int *x, int *y, int *comp)
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    return stbi__png_info_raw(&p, x, y, comp);
 }
 
+static int stbi__png_stream_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi_png_row_callback *row, void *user)
+{
+   stbi__png p;
+   stbi__png_rows r;
+   int ok;
+   if (req_comp < 0 || req_comp > 4) return stbi__err("bad req_comp", "Internal error");
+   r.row = row;
+   r.user = user;
+   r.x = x;
+   r.y = y;
+   r.comp = comp;
+   r.req_comp = req_comp;
+   r.pixels = NULL;
+   p.s = s;
+   p.rows = &r;
+   ok = stbi__parse_png_file(&p, STBI__SCAN_load, req_comp);
+   if (ok && p.out) {
+      // interlaced, so the whole image got decoded the usual way
+      int n = s->img_out_n;
+      stbi__uint32 j, stride = s->img_x * n * (p.depth == 16 ? 2 : 1);
+      ok = stbi__png_rows_begin(&r, s->img_x, s->img_y, s->img_n);
+      for (j=0; ok && j < s->img_y; ++j)
+         ok = stbi__png_rows_emit(&r, p.out + stride*j, s->img_x, n, p.depth == 16);
+      STBI_FREE(r.pixels);
+   }
+   STBI_FREE(p.out);      p.out      = NULL;
+   STBI_FREE(p.expanded); p.expanded = NULL;
+   STBI_FREE(p.idata);    p.idata    = NULL;
+   return ok;
+}
+
 static int stbi__png_is16(stbi__context *s)
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    if (!stbi__png_info_raw(&p, NULL, NULL, NULL))
 	   return 0;
    if (p.depth != 16) {
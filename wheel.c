@@ -0,0 +1,226 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "./wheel.h"
+
+// The occupancy masks are one uint64_t per level, so WHEEL_SLOTS is at most 64
+#define WHEEL_MASK ((uint64_t) WHEEL_SLOTS - 1)
+#define WHEEL_DUE (WHEEL_LEVELS * WHEEL_SLOTS)
+// Ticks covered by the whole wheel
+#define WHEEL_SPAN ((uint64_t) 1 << (WHEEL_SLOT_BITS * WHEEL_LEVELS))
+
+// How far from `from` the next set bit of mask is, going around. The mask
+// must not be empty.
+static int first_set_from(uint64_t mask, int from)
+{
+    const uint64_t rotated = from == 0 ? mask : (mask >> from) | (mask << (WHEEL_SLOTS - from));
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(rotated);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, rotated);
+    return (int) index;
+#else
+    int index = 0;
+    while (!((rotated >> index) & 1)) index += 1;
+    return index;
+#endif
+}
+
+static void list_push(Wheel *wheel, uint16_t list, uint32_t handle)
+{
+    const uint32_t head = wheel->heads[list];
+    wheel->next[handle] = head;
+    wheel->prev[handle] = WHEEL_NONE;
+    if (head != WHEEL_NONE) wheel->prev[head] = handle;
+    wheel->heads[list] = handle;
+    wheel->list[handle] = list;
+    if (list < WHEEL_DUE) {
+        wheel->occupied[list / WHEEL_SLOTS] |= (uint64_t) 1 << (list % WHEEL_SLOTS);
+    }
+}
+
+static void list_unlink(Wheel *wheel, uint32_t handle)
+{
+    const uint16_t list = wheel->list[handle];
+    const uint32_t next = wheel->next[handle];
+    const uint32_t prev = wheel->prev[handle];
+    if (prev != WHEEL_NONE) {
+        wheel->next[prev] = next;
+    } else {
+        wheel->heads[list] = next;
+    }
+    if (next != WHEEL_NONE) wheel->prev[next] = prev;
+    if (list < WHEEL_DUE && wheel->heads[list] == WHEEL_NONE) {
+        wheel->occupied[list / WHEEL_SLOTS] &= ~((uint64_t) 1 << (list % WHEEL_SLOTS));
+    }
+    wheel->list[handle] = WHEEL_IDLE;
+}
+
+void wheel_init(Wheel *wheel, uint64_t now)
+{
+    *wheel = (Wheel) {.now = now};
+    for (size_t i = 0; i < sizeof(wheel->heads) / sizeof(wheel->heads[0]); ++i) {
+        wheel->heads[i] = WHEEL_NONE;
+    }
+}
+
+static void *grow(void *items, size_t item_size, size_t capacity)
+{
+    void *result = realloc(items, item_size * capacity);
+    assert(result != NULL);
+    return result;
+}
+
+void wheel_reserve(Wheel *wheel, size_t capacity)
+{
+    if (capacity <= wheel->capacity) return;
+    wheel->tick = grow(wheel->tick, sizeof(*wheel->tick), capacity);
+    wheel->next = grow(wheel->next, sizeof(*wheel->next), capacity);
+    wheel->prev = grow(wheel->prev, sizeof(*wheel->prev), capacity);
+    wheel->list = grow(wheel->list, sizeof(*wheel->list), capacity);
+    for (size_t i = wheel->capacity; i < capacity; ++i) {
+        wheel->list[i] = WHEEL_IDLE;
+    }
+    wheel->capacity = capacity;
+}
+
+// Files the timer relative to wheel->now, into the lowest level whose
+// range still reaches its tick
+static void wheel_place(Wheel *wheel, uint32_t handle)
+{
+    const uint64_t tick = wheel->tick[handle];
+    if (tick <= wheel->now) {
+        list_push(wheel, WHEEL_DUE, handle);
+        return;
+    }
+
+    const uint64_t delta = tick - wheel->now;
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+        if (delta < (uint64_t) 1 << (WHEEL_SLOT_BITS * (level + 1))) {
+            const uint64_t slot = (tick >> (WHEEL_SLOT_BITS * level)) & WHEEL_MASK;
+            list_push(wheel, (uint16_t) (level * WHEEL_SLOTS + slot), handle);
+            return;
+        }
+    }
+
+    // Beyond the span: park it in the farthest top level slot, the cascade
+    // of that slot places it again
+    const uint64_t parked = wheel->now + WHEEL_SPAN - 1;
+    const uint64_t slot = (parked >> (WHEEL_SLOT_BITS * (WHEEL_LEVELS - 1))) & WHEEL_MASK;
+    list_push(wheel, (uint16_t) ((WHEEL_LEVELS - 1) * WHEEL_SLOTS + slot), handle);
+}
+
+void wheel_schedule(Wheel *wheel, uint32_t handle, uint64_t tick)
+{
+    assert(handle < wheel->capacity);
+    if (wheel->list[handle] != WHEEL_IDLE) list_unlink(wheel, handle);
+    wheel->tick[handle] = tick;
+    wheel_place(wheel, handle);
+}
+
+void wheel_cancel(Wheel *wheel, uint32_t handle)
+{
+    assert(handle < wheel->capacity);
+    if (wheel->list[handle] != WHEEL_IDLE) list_unlink(wheel, handle);
+}
+
+void wheel_move(Wheel *wheel, uint32_t from, uint32_t to)
+{
+    assert(from < wheel->capacity && to < wheel->capacity);
+    assert(wheel->list[to] == WHEEL_IDLE);
+    const uint16_t list = wheel->list[from];
+    if (list == WHEEL_IDLE) return;
+
+    const uint32_t next = wheel->next[from];
+    const uint32_t prev = wheel->prev[from];
+    wheel->tick[to] = wheel->tick[from];
+    wheel->next[to] = next;
+    wheel->prev[to] = prev;
+    wheel->list[to] = list;
+    if (prev != WHEEL_NONE) {
+        wheel->next[prev] = to;
+    } else {
+        wheel->heads[list] = to;
+    }
+    if (next != WHEEL_NONE) wheel->prev[next] = to;
+    wheel->list[from] = WHEEL_IDLE;
+}
+
+// The next tick after wheel->now at which a non-empty slot comes up
+static uint64_t wheel_next_event(const Wheel *wheel)
+{
+    uint64_t result = WHEEL_NEVER;
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+        const uint64_t mask = wheel->occupied[level];
+        if (mask == 0) continue;
+        // Level n comes up at every multiple of its slot width, the slot
+        // being the bits of that multiple at level n
+        const int shift = WHEEL_SLOT_BITS * level;
+        const uint64_t base = (wheel->now >> shift) + 1;
+        const int distance = first_set_from(mask, (int) (base & WHEEL_MASK));
+        const uint64_t tick = (base + (uint64_t) distance) << shift;
+        if (tick < result) result = tick;
+    }
+    return result;
+}
+
+static void wheel_cascade(Wheel *wheel, int level, uint64_t slot)
+{
+    const uint16_t list = (uint16_t) (level * WHEEL_SLOTS + slot);
+    uint32_t handle = wheel->heads[list];
+    wheel->heads[list] = WHEEL_NONE;
+    wheel->occupied[level] &= ~((uint64_t) 1 << slot);
+    while (handle != WHEEL_NONE) {
+        const uint32_t next = wheel->next[handle];
+        wheel_place(wheel, handle);
+        handle = next;
+    }
+}
+
+void wheel_advance(Wheel *wheel, uint64_t now)
+{
+    while (wheel->now < now) {
+        const uint64_t tick = wheel_next_event(wheel);
+        if (tick > now) {
+            wheel->now = now;
+            break;
+        }
+        wheel->now = tick;
+
+        // Upper levels come down first, their timers may be due right now
+        for (int level = WHEEL_LEVELS - 1; level > 0; --level) {
+            const int shift = WHEEL_SLOT_BITS * level;
+            if ((tick & (((uint64_t) 1 << shift) - 1)) == 0) {
+                wheel_cascade(wheel, level, (tick >> shift) & WHEEL_MASK);
+            }
+        }
+        wheel_cascade(wheel, 0, tick & WHEEL_MASK);
+    }
+}
+
+uint32_t wheel_pop(Wheel *wheel)
+{
+    const uint32_t handle = wheel->heads[WHEEL_DUE];
+    if (handle != WHEEL_NONE) list_unlink(wheel, handle);
+    return handle;
+}
+
+uint64_t wheel_next(const Wheel *wheel)
+{
+    if (wheel->heads[WHEEL_DUE] != WHEEL_NONE) return wheel->now;
+    return wheel_next_event(wheel);
+}
+
+void wheel_free(Wheel *wheel)
+{
+    free(wheel->tick);
+    free(wheel->next);
+    free(wheel->prev);
+    free(wheel->list);
+    wheel_init(wheel, wheel->now);
+}
@@ -0,0 +1,63 @@
+#ifndef WHEEL_H_
+#define WHEEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Hierarchical timing wheel (Varghese & Lauck). Schedules expiries of
+// timers known by a dense uint32_t handle in O(1) and hands them out once
+// the wheel is advanced past their tick, without looking at the timers
+// that are not due.
+//
+// WHEEL_LEVELS wheels of WHEEL_SLOTS slots each: level n holds the timers
+// due within WHEEL_SLOTS^(n+1) ticks, in the slot picked by the bits of
+// their tick at that level. Crossing a slot boundary of level n moves its
+// timers down to the levels below (a cascade), so every timer is touched
+// at most WHEEL_LEVELS times. Timers further away than the whole wheel
+// spans wait in the top level and get rescheduled when they come around.
+//
+// Advancing skips straight to the next non-empty slot with the per-level
+// occupancy masks, so idle stretches cost nothing.
+
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_SLOT_BITS)
+#define WHEEL_LEVELS 6
+#define WHEEL_NONE UINT32_MAX
+#define WHEEL_NEVER UINT64_MAX
+#define WHEEL_IDLE UINT16_MAX
+
+typedef struct {
+    uint64_t now;               // the last tick the wheel was advanced to
+    uint64_t occupied[WHEEL_LEVELS];
+
+    // One list per slot plus the list of the due timers, each a doubly
+    // linked list through the per-handle arrays
+    uint32_t heads[WHEEL_LEVELS * WHEEL_SLOTS + 1];
+
+    size_t capacity;
+    uint64_t *tick;
+    uint32_t *next;
+    uint32_t *prev;
+    uint16_t *list;             // WHEEL_IDLE when not scheduled
+} Wheel;
+
+void wheel_init(Wheel *wheel, uint64_t now);
+// Makes room for the handles below capacity, new ones are not scheduled
+void wheel_reserve(Wheel *wheel, size_t capacity);
+// (Re)schedules handle to expire at tick, in the past means right away
+void wheel_schedule(Wheel *wheel, uint32_t handle, uint64_t tick);
+void wheel_cancel(Wheel *wheel, uint32_t handle);
+// The timer of handle `from` now goes by `to`, which must not be scheduled
+void wheel_move(Wheel *wheel, uint32_t from, uint32_t to);
+// Moves the wheel forward to now, the timers due by then get handed out
+// by wheel_pop()
+void wheel_advance(Wheel *wheel, uint64_t now);
+// Returns WHEEL_NONE when there is no due timer left
+uint32_t wheel_pop(Wheel *wheel);
+// The earliest tick something can be due at, WHEEL_NEVER when nothing is
+// scheduled. Timers several levels up make it earlier than their expiry,
+// but waking up for it only costs a cascade.
+uint64_t wheel_next(const Wheel *wheel);
+void wheel_free(Wheel *wheel);
+
+#endif // WHEEL_H_